@@ -0,0 +1,346 @@
+#ifndef ALLOCATION_TRACKING_H
+#define ALLOCATION_TRACKING_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace custom {
+	/**
+	 * The containers whose allocations are tracked, each of which is reported on separately. Queue and PriorityQueue
+	 * share their node storage and are reported together as Queue.
+	 */
+	enum class ContainerType {
+		Vector,
+		LinkedList,
+		DoublyLinkedList,
+		Stack,
+		Queue,
+		Map,
+		BinarySearchTree,
+		BinaryTree,
+		Tree,
+		Graph
+	};
+
+	/**
+	 * A snapshot of the allocation counters of a container type, summed over every object of that type.
+	 */
+	struct AllocationStats {
+		size_t allocations = 0;  /**< The number of blocks of memory allocated. */
+		size_t deallocations = 0;  /**< The number of blocks of memory freed. */
+		size_t bytes_allocated = 0;  /**< The total size of the blocks allocated. */
+		size_t bytes_freed = 0;  /**< The total size of the blocks freed. */
+		size_t peak_bytes = 0;  /**< The largest number of bytes allocated and not yet freed at any one time. */
+		size_t reallocations = 0;  /**< The number of times an array was moved into a larger or smaller block. */
+
+		/**
+		 * Returns the number of bytes which are allocated and not yet freed.
+		 * @return - an unsigned integer representing the number of live bytes.
+		 */
+		[[nodiscard]] size_t live_bytes() const noexcept {
+			return bytes_allocated - bytes_freed;
+		}
+	};
+
+	/**
+	 * Opt-in instrumentation of the memory allocated by the containers of the library, enabled by defining
+	 * `CUSTOM_TRACK_ALLOCATIONS` on the command line of every translation unit of the program, e.g.
+	 * `-DCUSTOM_TRACK_ALLOCATIONS`. The containers report every block they allocate or free: the arrays of Vector,
+	 * the nodes of the lists, stacks, queues, trees and graphs, and the buckets and bucket nodes of Map.
+	 *
+	 * When the macro is not defined, the hooks are empty inline functions, nodes have no allocation functions of their
+	 * own and Map uses `std::allocator`, so the containers compile to exactly the same code as without the hooks.
+	 * \note
+	 * The macro must be defined consistently across the program, as the layout of the containers' allocation paths
+	 * depends on it.
+	 */
+	namespace allocation_tracking {
+#ifdef CUSTOM_TRACK_ALLOCATIONS
+		inline constexpr bool enabled = true;  /**< Whether allocations are being tracked. */
+#else
+		inline constexpr bool enabled = false;  /**< Whether allocations are being tracked. */
+#endif
+
+		inline constexpr size_t container_types = static_cast<size_t>(ContainerType::Graph) + 1;  /**< The number of container types tracked. */
+
+		/**
+		 * Returns the name of a container type, as shown in the report.
+		 * @param type - the container type.
+		 * @return - a string literal with the name of the container type.
+		 */
+		constexpr const char* name(ContainerType type) noexcept {
+			constexpr const char* names[container_types] = {"Vector", "LinkedList", "DoublyLinkedList", "Stack",
+			                                                "Queue", "Map", "BinarySearchTree", "BinaryTree", "Tree",
+			                                                "Graph"};
+			return names[static_cast<size_t>(type)];
+		}
+
+		namespace detail {
+			// The counters of one container type, updated from any thread
+			struct Counters {
+				std::atomic<size_t> allocations{0};
+				std::atomic<size_t> deallocations{0};
+				std::atomic<size_t> bytes_allocated{0};
+				std::atomic<size_t> bytes_freed{0};
+				std::atomic<size_t> live_bytes{0};
+				std::atomic<size_t> peak_bytes{0};
+				std::atomic<size_t> reallocations{0};
+			};
+
+			inline std::array<Counters, container_types>& counters() noexcept {
+				static std::array<Counters, container_types> counters;
+				return counters;
+			}
+
+			inline Counters& counters(ContainerType type) noexcept {
+				return counters()[static_cast<size_t>(type)];
+			}
+		}
+
+		/**
+		 * Records a block of memory allocated by a container.
+		 * **Time Complexity** = *O(1)*.
+		 * @param type - the type of the container allocating the memory.
+		 * @param bytes - the size of the block in bytes.
+		 */
+		inline void record_allocation([[maybe_unused]] ContainerType type, [[maybe_unused]] size_t bytes) noexcept {
+#ifdef CUSTOM_TRACK_ALLOCATIONS
+			detail::Counters& counters = detail::counters(type);
+			counters.allocations.fetch_add(1, std::memory_order_relaxed);
+			counters.bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+			size_t live = counters.live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+			size_t peak = counters.peak_bytes.load(std::memory_order_relaxed);
+			while (peak < live && !counters.peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed));
+#endif
+		}
+
+		/**
+		 * Records a block of memory freed by a container.
+		 * **Time Complexity** = *O(1)*.
+		 * @param type - the type of the container freeing the memory.
+		 * @param bytes - the size of the block in bytes.
+		 */
+		inline void record_deallocation([[maybe_unused]] ContainerType type, [[maybe_unused]] size_t bytes) noexcept {
+#ifdef CUSTOM_TRACK_ALLOCATIONS
+			detail::Counters& counters = detail::counters(type);
+			counters.deallocations.fetch_add(1, std::memory_order_relaxed);
+			counters.bytes_freed.fetch_add(bytes, std::memory_order_relaxed);
+			counters.live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+#endif
+		}
+
+		/**
+		 * Records an array of a container moved into a block of a different size. The allocation of the new block and
+		 * the deallocation of the old one are recorded separately.
+		 * **Time Complexity** = *O(1)*.
+		 * @param type - the type of the container.
+		 */
+		inline void record_reallocation([[maybe_unused]] ContainerType type) noexcept {
+#ifdef CUSTOM_TRACK_ALLOCATIONS
+			detail::counters(type).reallocations.fetch_add(1, std::memory_order_relaxed);
+#endif
+		}
+
+		/**
+		 * Provides the counters of a container type. The counters are read one at a time, so they may be slightly
+		 * inconsistent with each other while other threads allocate. Without `CUSTOM_TRACK_ALLOCATIONS` every counter
+		 * is 0.
+		 * **Time Complexity** = *O(1)*.
+		 * @param type - the container type.
+		 * @return - the counters of the container type.
+		 */
+		inline AllocationStats stats(ContainerType type) noexcept {
+			AllocationStats result;
+			if constexpr (enabled) {
+				const detail::Counters& counters = detail::counters(type);
+				result.allocations = counters.allocations.load(std::memory_order_relaxed);
+				result.deallocations = counters.deallocations.load(std::memory_order_relaxed);
+				result.bytes_allocated = counters.bytes_allocated.load(std::memory_order_relaxed);
+				result.bytes_freed = counters.bytes_freed.load(std::memory_order_relaxed);
+				result.peak_bytes = counters.peak_bytes.load(std::memory_order_relaxed);
+				result.reallocations = counters.reallocations.load(std::memory_order_relaxed);
+			}
+			return result;
+		}
+
+		/**
+		 * Resets the counters of every container type to 0, e.g. between the phases of a program. Memory which is
+		 * still allocated is counted again as live bytes, so the peak restarts from the memory currently in use.
+		 * **Time Complexity** = *O(1)*.
+		 */
+		inline void reset() noexcept {
+			if constexpr (enabled) {
+				for (detail::Counters& counters: detail::counters()) {
+					size_t live = counters.live_bytes.load(std::memory_order_relaxed);
+					counters.allocations.store(0, std::memory_order_relaxed);
+					counters.deallocations.store(0, std::memory_order_relaxed);
+					counters.bytes_allocated.store(live, std::memory_order_relaxed);
+					counters.bytes_freed.store(0, std::memory_order_relaxed);
+					counters.peak_bytes.store(live, std::memory_order_relaxed);
+					counters.reallocations.store(0, std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/**
+		 * Writes a table of the counters of every container type which has allocated memory, one row per type.
+		 * **Time Complexity** = *O(1)*.
+		 * @param out - the stream to write the table to, `std::cout` by default.
+		 */
+		inline void report(std::ostream& out = std::cout) {
+			if constexpr (!enabled) {
+				out << "Allocation tracking is disabled, define CUSTOM_TRACK_ALLOCATIONS to enable it\n";
+			} else {
+				out << std::left << std::setw(18) << "Container" << std::right << std::setw(14) << "Allocations"
+				    << std::setw(14) << "Frees" << std::setw(18) << "Bytes allocated" << std::setw(16) << "Bytes freed"
+				    << std::setw(14) << "Live bytes" << std::setw(14) << "Peak bytes" << std::setw(10) << "Reallocs"
+				    << '\n';
+				for (size_t i = 0; i < container_types; ++i) {
+					auto type = static_cast<ContainerType>(i);
+					AllocationStats row = stats(type);
+					if (row.allocations == 0 && row.live_bytes() == 0)
+						continue;
+					out << std::left << std::setw(18) << name(type) << std::right << std::setw(14) << row.allocations
+					    << std::setw(14) << row.deallocations << std::setw(18) << row.bytes_allocated << std::setw(16)
+					    << row.bytes_freed << std::setw(14) << row.live_bytes() << std::setw(14) << row.peak_bytes
+					    << std::setw(10) << row.reallocations << '\n';
+				}
+			}
+		}
+
+		/**
+		 * An empty base class of the nodes of a container. With `CUSTOM_TRACK_ALLOCATIONS` defined it gives the nodes
+		 * allocation functions which record every node created with `new` and destroyed with `delete`, otherwise it
+		 * adds nothing to the nodes.
+		 * @tparam Type - the type of the container the nodes belong to.
+		 */
+		template<ContainerType Type>
+		struct TrackedNode {
+#ifdef CUSTOM_TRACK_ALLOCATIONS
+			static void* operator new(size_t bytes) {
+				void* node = ::operator new(bytes);
+				record_allocation(Type, bytes);
+				return node;
+			}
+
+			// Declared so nodes can still be constructed in storage allocated by the container
+			static void* operator new(size_t, void* place) noexcept {
+				return place;
+			}
+
+			static void operator delete(void* node, size_t bytes) noexcept {
+				record_deallocation(Type, bytes);
+				::operator delete(node, bytes);
+			}
+#endif
+		};
+
+		/**
+		 * An allocator for the standard containers used inside a container, which records every block it allocates
+		 * and frees.
+		 * @tparam T - the type of the elements allocated.
+		 * @tparam Type - the type of the container the memory is allocated for.
+		 */
+		template<typename T, ContainerType Type>
+		class TrackingAllocator {
+		public:
+			using value_type = T;  /**< The type of the elements allocated. */
+
+			template<typename U>
+			struct rebind {
+				using other = TrackingAllocator<U, Type>;  /**< The allocator of another element type. */
+			};
+
+			TrackingAllocator() noexcept = default;
+
+			template<typename U>
+			TrackingAllocator(const TrackingAllocator<U, Type>&) noexcept {}
+
+			T* allocate(size_t count) {
+				T* memory = std::allocator<T>().allocate(count);
+				record_allocation(Type, count * sizeof(T));
+				return memory;
+			}
+
+			void deallocate(T* memory, size_t count) noexcept {
+				record_deallocation(Type, count * sizeof(T));
+				std::allocator<T>().deallocate(memory, count);
+			}
+
+			template<typename U>
+			bool operator==(const TrackingAllocator<U, Type>&) const noexcept {
+				return true;
+			}
+		};
+
+		/**
+		 * The allocator for the standard containers used inside a container: a TrackingAllocator with
+		 * `CUSTOM_TRACK_ALLOCATIONS` defined and `std::allocator` otherwise.
+		 * @tparam T - the type of the elements allocated.
+		 * @tparam Type - the type of the container the memory is allocated for.
+		 */
+		template<typename T, ContainerType Type>
+		using Allocator = std::conditional_t<enabled, TrackingAllocator<T, Type>, std::allocator<T>>;
+
+		/**
+		 * Whether an allocator is `std::allocator`, in which case a container allocates with `new` and `delete` as if
+		 * it had no allocator, so its code is the same as before allocators were supported.
+		 * @tparam Alloc - the allocator of the container.
+		 */
+		template<typename Alloc>
+		inline constexpr bool default_allocator = std::is_same_v<Alloc, std::allocator<typename Alloc::value_type>>;
+
+		/**
+		 * Allocates and constructs a node of a container with the allocator of the container, recording the
+		 * allocation. With `std::allocator` the node is created with `new`, which records it through TrackedNode.
+		 * @tparam Type - the type of the container the node belongs to.
+		 * @tparam Node - the type of the node.
+		 * @tparam Alloc - the allocator of the container.
+		 * @tparam Args - the types of the arguments of the constructor of the node.
+		 * @param allocator - the allocator of the container, rebound to `Node` unless it is `std::allocator`.
+		 * @param args - the arguments of the constructor of the node.
+		 * @return - a pointer to the new node.
+		 */
+		template<ContainerType Type, typename Node, typename Alloc, typename... Args>
+		Node* create_node(Alloc& allocator, Args&& ... args) {
+			if constexpr (default_allocator<Alloc>)
+				return new Node(std::forward<Args>(args)...);
+			else {
+				typename std::allocator_traits<Alloc>::template rebind_alloc<Node> node_allocator(allocator);
+				Node* node = node_allocator.allocate(1);
+				record_allocation(Type, sizeof(Node));
+				::new(static_cast<void*>(node)) Node(std::forward<Args>(args)...);
+				return node;
+			}
+		}
+
+		/**
+		 * Destroys and deallocates a node created by create_node(), recording the deallocation.
+		 * @tparam Type - the type of the container the node belongs to.
+		 * @tparam Node - the type of the node.
+		 * @tparam Alloc - the allocator of the container.
+		 * @param allocator - the allocator of the container the node was created with.
+		 * @param node - a pointer to the node, which may be `nullptr`.
+		 */
+		template<ContainerType Type, typename Node, typename Alloc>
+		void destroy_node(Alloc& allocator, Node* node) noexcept {
+			if constexpr (default_allocator<Alloc>)
+				delete node;
+			else if (node) {
+				typename std::allocator_traits<Alloc>::template rebind_alloc<Node> node_allocator(allocator);
+				node->~Node();
+				node_allocator.deallocate(node, 1);
+				record_deallocation(Type, sizeof(Node));
+			}
+		}
+	}
+}// namespace custom
+
+#endif// ALLOCATION_TRACKING_H
@@ -4,8 +4,13 @@
 #include <cassert>
 #include <cstddef>
 #include <initializer_list>
+#include <stdexcept>
+#include <string>
 #include <utility>
 
+#include "Checking.h"
+#include "MemoryUsage.h"
+#include "Serialization.h"
 #include "Vector.h"
 
 namespace custom {
@@ -13,6 +18,8 @@ namespace custom {
 	 * A templated array class which provides an alternative to using C-style arrays by making
 	 * it easier and simpler to work with arrays through the use of member variables and functions.
 	 * The array is a static data structure meaning its size cannot be changed once initialized.
+	 * The elements are stored in the array object itself, so an array can be built, read and written in constant
+	 * expressions, and a `constexpr` array is placed in the read-only data of the program.
 	 * @tparam T - the type of the object to be stored in the array.
 	 * @tparam alloc_size - an unsigned integer representing the total capacity of the array.
 	 */
@@ -26,10 +33,10 @@ namespace custom {
 
 	public:
 		/**
-		 * Default array constructor which allocates memory for the specified number of elements
+		 * Default array constructor which value-initialises the specified number of elements
 		 * of type T. Sets the member mSize to the capacity specified.
 		 */
-		constexpr Array() noexcept : data(new T[alloc_size]), mSize{alloc_size} {}
+		constexpr Array() noexcept : data{}, mSize{alloc_size} {}
 
 		/**
 		 * Overloaded initializer list constructor which sets the elements of the array using an
@@ -38,7 +45,7 @@ namespace custom {
 		 * @param init - the initialiser list whose contents will be added to the array.
 		 * @see <a href="https://en.cppreference.com/w/cpp/utility/initializer_list">std::initializer_list</a>
 		 */
-		constexpr Array(std::initializer_list<T> init) noexcept : data(new T[alloc_size]), mSize{alloc_size} {
+		constexpr Array(std::initializer_list<T> init) noexcept : data{}, mSize{alloc_size} {
 			assert(mSize >= init.size());
 			for (size_t i = 0; i < init.size(); ++i)
 				data[i] = std::move(*(init.begin()+i));
@@ -48,7 +55,7 @@ namespace custom {
 		 * Array copy constructor, which copies the elements of another array of type T into this array.
 		 * @param other - an array object with data of the same type, `T`.
 		 */
-		constexpr Array(const Array& other) noexcept : data(new T[other.mSize]), mSize{other.mSize} {
+		constexpr Array(const Array& other) noexcept : data{}, mSize{other.mSize} {
 			for (size_t i = 0; i < mSize; ++i)
 				data[i] = other.data[i];
 		}
@@ -62,10 +69,7 @@ namespace custom {
 		 */
 		constexpr Array& operator=(const Array& other) noexcept {
 			if (this != &other) {
-				if (mSize)
-					delete[] data;
 				mSize = other.mSize;
-				data = new T[mSize];
 				for (size_t i = 0; i < mSize; ++i)
 					data[i] = other.data[i];
 			}
@@ -74,29 +78,28 @@ namespace custom {
 
 		/**
 		 * Array move constructor, which moves the elements of another array of type T into this array and
-		 * sets the other array to its default state.
+		 * sets the size of the other array to 0.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the other array.
 		 * @param other - an `r-value reference` to the array to be moved.
 		 */
-		constexpr Array(Array&& other) noexcept : data(other.data), mSize{other.mSize} {
-			other.data = nullptr;
+		constexpr Array(Array&& other) noexcept : data{}, mSize{other.mSize} {
+			for (size_t i = 0; i < mSize; ++i)
+				data[i] = std::move(other.data[i]);
 			other.mSize = 0;
 		}
 
 		/**
 		 * Move assignment operator which moves another array object's contents into the current array and
-		 * sets the other array to its default state.
-		 * \note
-		 * If the current object, that is being moved into, is not empty, **it will be cleared**.
+		 * sets the size of the other array to 0.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the other array.
 		 * @param other - an `r-value reference` to the array object to be moved.
 		 * @return - a reference to the current array object.
 		 */
 		constexpr Array& operator=(Array&& other) noexcept {
 			if (this != &other) {
-				if (mSize)
-					delete[] data;
-				data = other.data;
 				mSize = other.mSize;
-				other.data = nullptr;
+				for (size_t i = 0; i < mSize; ++i)
+					data[i] = std::move(other.data[i]);
 				other.mSize = 0;
 			}
 			return *this;
@@ -104,23 +107,25 @@ namespace custom {
 
 		/**
 		 * Square bracket operator which allows for access to the data of an element at the
-		 * specified index in the array. If the index is out of bounds, the program is terminated.
+		 * specified index in the array. If the index is out of bounds, an `out_of_range` exception is thrown, or the
+		 * program is terminated if the library is built with the assert-only checking policy.
 		 * @param index - an unsigned integer representing the index of the element to access.
 		 * @return - a reference to the data at the specified index.
 		 */
-		constexpr T& operator[](const size_t& index) noexcept {
-			assert(index < mSize);
+		constexpr T& operator[](const size_t& index) noexcept(!checks_throw) {
+			check<std::out_of_range>(index < mSize, "Invalid index, out of range");
 			return data[index];
 		}
 
 		/**
 		 * Square bracket operator which allows for access to the data of an element at the
-		 * specified index in the array. If the index is out of bounds, the program is terminated.
+		 * specified index in the array. If the index is out of bounds, an `out_of_range` exception is thrown, or the
+		 * program is terminated if the library is built with the assert-only checking policy.
 		 * @param index - an unsigned integer representing the index of the element to access.
 		 * @return - a const reference to the data at the specified index.
 		 */
-		constexpr const T& operator[](const size_t& index) const noexcept {
-			assert(index < mSize);
+		constexpr const T& operator[](const size_t& index) const noexcept(!checks_throw) {
+			check<std::out_of_range>(index < mSize, "Invalid index, out of range");
 			return data[index];
 		}
 
@@ -143,33 +148,100 @@ namespace custom {
 			return mSize;
 		}
 
+		/**
+		 * Returns a breakdown of the memory held by the array: the elements are the payload, while the rest of the
+		 * object is structural overhead. The array never allocates.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - a MemoryUsage object with the bytes of payload and structure.
+		 */
+		[[nodiscard]] constexpr MemoryUsage memory_usage() const noexcept {
+			MemoryUsage usage;
+			usage.payload = mSize * sizeof(T);
+			usage.structure = sizeof(*this) - usage.payload;
+			return usage;
+		}
+
+		/**
+		 * Serializes the array in the binary format of Serialization.h, copying it in one block if its elements are
+		 * trivially copyable.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the array.
+		 * @param out - the serialization::Writer to append the array to.
+		 */
+		void serialize(serialization::Writer& out) const {
+			out.header<T>(serialization::Kind::Array, mSize);
+			out.values(data, mSize);
+		}
+
+		/**
+		 * Deserializes an array written by serialize(). If the data does not hold a serialized array of `alloc_size`
+		 * elements of type `T`, a `runtime_error` exception is thrown.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the array.
+		 * @param in - the serialization::Reader to read the array from.
+		 * @return - the array.
+		 */
+		static Array deserialize(serialization::Reader& in) {
+			check_size(in.header<T>(serialization::Kind::Array).count);
+			Array result;
+			if constexpr (serialization::Codec<T>::raw)
+				in.values(result.data, alloc_size);
+			else {
+				for (size_t i = 0; i < alloc_size; ++i)
+					result.data[i] = in.value<T>();
+			}
+			return result;
+		}
+
+		/**
+		 * Returns a read-only view of the elements of an array written by serialize(), in place in the data. Only
+		 * available for trivially copyable elements.
+		 * **Time Complexity** = *O(1)*.
+		 * @param in - the serialization::Reader to read the array from.
+		 * @return - a span of the `alloc_size` elements, valid as long as the data.
+		 */
+		static std::span<const T, alloc_size> view(serialization::Reader& in) requires serialization::Codec<T>::raw {
+			check_size(in.header<T>(serialization::Kind::Array).count);
+			return std::span<const T, alloc_size>(in.view<T>(alloc_size));
+		}
+
 		/**
 		 * Creates and returns an iterator with the position of the beginning of the array.
 		 * @return - a VectorIterator object with the position of the beginning element of the array.
 		 */
-		Iterator begin() const noexcept {
-			return Iterator(data, data, &data[mSize]);
+		constexpr Iterator begin() const noexcept {
+			return Iterator(elements(), elements(), elements() + mSize);
 		}
 
 		/**
 		 * Creates and returns an iterator with the position past the end of the array.
 		 * @return - a VectorIterator object with the position past the ending element of the array.
 		 */
-		Iterator end() const noexcept {
-			return Iterator((&data[mSize]), data, (&data[mSize]));
+		constexpr Iterator end() const noexcept {
+			return Iterator(elements() + mSize, elements(), elements() + mSize);
 		}
 
+	private:
+		T data[alloc_size];  /**< The elements of the array. */
+		size_t mSize;  /**< An unsigned integer representing the number of elements in the array. */
+
 		/**
-		 * Array destructor which calls calls the destructor of each element in the array
-		 * and frees its allocated memory.
+		 * Checks the number of elements of a serialized array, throwing a `runtime_error` exception if it is not
+		 * `alloc_size`.
+		 * @param count - the number of elements in the header of the serialized array.
 		 */
-		constexpr virtual ~Array() {
-			delete[] data;
+		static void check_size(std::uint64_t count) {
+			if (count != alloc_size)
+				throw std::runtime_error("Error: the serialized Array has " + std::to_string(count) +
+				                         " elements, not " + std::to_string(alloc_size));
 		}
 
-	private:
-		T* data;  /**< A pointer of type `T` which points to the beginning of the array. */
-		size_t mSize;  /**< An unsigned integer representing the number of elements in the array. */
+		/**
+		 * Returns a pointer to the first element for the iterators, which, as for the Vector, can modify the elements
+		 * of a const array.
+		 * @return - a pointer to the beginning of the array.
+		 */
+		constexpr T* elements() const noexcept {
+			return const_cast<T*>(data);
+		}
 	};
 }
 
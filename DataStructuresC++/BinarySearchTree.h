@@ -3,10 +3,17 @@
 
 #include <initializer_list>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <type_traits>
 #include <vector>
 
+#include "AllocationTracking.h"
+#include "MemoryUsage.h"
+#include "Serialization.h"
+#include "Tracing.h"
+
 namespace custom {
 	/**
 	 * A template implementation of a specialised tree data structure where each node can have at most two children
@@ -18,24 +25,37 @@ namespace custom {
 	 * In order for the nodes to be ordered based on data values, the data type `T` must be arithmetic.
 	 *
 	 * @tparam T - the type of the data of each node in the tree.
+	 * @tparam Allocator - the allocator the nodes are allocated with, `std::allocator` by default, see
+	 * pmr::BinarySearchTree.
 	 * @see <a href="https://en.wikipedia.org/wiki/Binary_search_tree">Binary search tree</a>
 	 */
-	template<typename T, typename = typename std::enable_if_t<std::is_arithmetic<T>::value>>
+	template<typename T, typename = typename std::enable_if_t<std::is_arithmetic<T>::value>,
+	         typename Allocator = std::allocator<T>>
 	class BinarySearchTree {
 	public:
+		using allocator_type = Allocator;  /**< An alias for the allocator the nodes are allocated with. */
+
 		/**
 		 * Default BinarySearchTree constructor which sets the root and current head node pointers to `nullptr` and
 		 * initialises the private helper variable `left` to false.
 		 */
 		BinarySearchTree() noexcept: root(nullptr), current_head(nullptr), left(false) {}
 
+		/**
+		 * Overloaded BinarySearchTree constructor which initialises an empty tree whose nodes will be allocated with
+		 * the allocator provided.
+		 * @param allocator - the allocator to allocate the nodes with.
+		 */
+		explicit BinarySearchTree(const Allocator& allocator) noexcept: root(nullptr), current_head(nullptr),
+		                                                                left(false), mAllocator(allocator) {}
+
 		/**
 		 * Overloaded BinarySearchTree constructor which takes a value of type `T` and constructs a new node with
 		 * the data provided. The root and current head nodes are set to this new node.
 		 * @param data - data of type `T` to be copied into the root node.
 		 */
 		explicit BinarySearchTree(const T& data) noexcept: left(false) {
-			root = new Node(data);
+			root = create_node(data);
 			current_head = root;
 		}
 
@@ -45,7 +65,7 @@ namespace custom {
 		 * @param data -  - a *r-value reference* to data of type `T` to be moved into the root node.
 		 */
 		explicit BinarySearchTree(T&& data) noexcept: left(false) {
-			root = new Node(std::move(data));
+			root = create_node(std::move(data));
 			current_head = root;
 		}
 
@@ -57,9 +77,11 @@ namespace custom {
 		 * in the tree.
 		 *
 		 * @param init - an initialiser list of type `T` whose contents will be added to the tree.
+		 * @param allocator - the allocator to allocate the nodes with.
 		 * @see <a href="https://en.cppreference.com/w/cpp/utility/initializer_list">std::initializer_list</a>
 		 */
-		BinarySearchTree(std::initializer_list<T> init) noexcept: left(false) {
+		BinarySearchTree(std::initializer_list<T> init, const Allocator& allocator = Allocator()) noexcept:
+				root(nullptr), current_head(nullptr), left(false), mAllocator(allocator) {
 			for (auto it = init.begin(); it != init.end(); ++it)
 				add(std::move(*it));
 		}
@@ -73,10 +95,15 @@ namespace custom {
 		 *
 		 * @param data - data of type `T` to be copied into the new node.
 		 */
-		void add(const T& data) noexcept {
+		void add(const T& data) {
+			tracing::Scope scope(tracing::Operation::Insert);
+			if (root == nullptr) {
+				root = create_node(data);
+				return;
+			}
 			Node* change = find_node(data, root);
-			if (change == nullptr && current_head != nullptr) {
-				change = new Node(data);
+			if (change == nullptr) {
+				change = create_node(data);
 				if (left)
 					current_head->left = change;
 				else
@@ -96,9 +123,14 @@ namespace custom {
 		 * @param data - a *r-value reference* of the data of type `T` to be moved into the new node.
 		 */
 		void add(T&& data) {
+			tracing::Scope scope(tracing::Operation::Insert);
+			if (root == nullptr) {
+				root = create_node(std::move(data));
+				return;
+			}
 			Node* change = find_node(data, root);
-			if (change == nullptr && current_head != nullptr) {
-				change = new Node(std::move(data));
+			if (change == nullptr) {
+				change = create_node(std::move(data));
 				if (left)
 					current_head->left = change;
 				else
@@ -133,6 +165,54 @@ namespace custom {
 			return root == nullptr;
 		}
 
+		/**
+		 * Returns a breakdown of the memory held by the tree: the data of the nodes is the payload, while the pointers
+		 * to the children, the padding of each node and the tree object itself are structural overhead.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the tree.
+		 *
+		 * @return - a MemoryUsage object with the bytes of payload, structure and estimated allocator overhead.
+		 */
+		[[nodiscard]] MemoryUsage memory_usage() const noexcept {
+			MemoryUsage usage;
+			usage.structure = sizeof(*this);
+			memory_detail::add_blocks(usage, count_nodes(root), sizeof(Node), sizeof(T));
+			return usage;
+		}
+
+		/**
+		 * Serializes the tree in the binary format of Serialization.h, as the data of its nodes in pre-order, which is
+		 * the order they are added back in to rebuild the same tree.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the tree.
+		 *
+		 * @param out - the serialization::Writer to append the tree to.
+		 */
+		void serialize(serialization::Writer& out) const {
+			std::vector<T> data;
+			PreOrder(root, data);
+			out.header<T>(serialization::Kind::BinarySearchTree, data.size());
+			out.values(data.data(), data.size());
+		}
+
+		/**
+		 * Deserializes a tree written by serialize(), with the same shape. If the data does not hold a serialized
+		 * BinarySearchTree of `T`, or holds a value more than once, an exception is thrown.
+		 *
+		 * **Time Complexity** = *O(n * log(n))* where n is the number of nodes in the tree.
+		 *
+		 * @param in - the serialization::Reader to read the tree from.
+		 * @return - the tree.
+		 */
+		static BinarySearchTree deserialize(serialization::Reader& in) {
+			std::vector<T> data(in.header<T>(serialization::Kind::BinarySearchTree).count);
+			in.values(data.data(), data.size());
+			BinarySearchTree result;
+			for (const T& value: data)
+				result.add(value);
+			return result;
+		}
+
 		/**
 		 * Conversion operator for boolean type. Evaluates to true if the root node of the tree is **not**
 		 * `nullptr`.
@@ -154,6 +234,7 @@ namespace custom {
 		 * @return - a `std::vector` of type `T` containing the value of each node in the tree after pre-order traversal.
 		 */
 		[[nodiscard]] std::vector<T> contents_PreOrder() const noexcept {
+			tracing::Scope scope(tracing::Operation::Traversal);
 			std::vector<T> temp = {};
 			return PreOrder(root, temp);
 		}
@@ -167,6 +248,7 @@ namespace custom {
 		 * @return - a `std::vector` of type `T` containing the value of each node in the tree after in-order traversal.
 		 */
 		[[nodiscard]] std::vector<T> contents_InOrder() const noexcept {
+			tracing::Scope scope(tracing::Operation::Traversal);
 			std::vector<T> temp = {};
 			return InOrder(root, temp);
 		}
@@ -180,6 +262,7 @@ namespace custom {
 		 * @return - a `std::vector` of type `T` containing the value of each node in the tree after post-order traversal.
 		 */
 		[[nodiscard]] std::vector<T> contents_PostOrder() const noexcept {
+			tracing::Scope scope(tracing::Operation::Traversal);
 			std::vector<T> temp = {};
 			return PostOrder(root, temp);
 		}
@@ -195,43 +278,29 @@ namespace custom {
 		 * @param val - the value of the node to be removed.
 		 */
 		void remove(const T& val) {
+			tracing::Scope scope(tracing::Operation::Erase);
 			Node* node = find_node(val, root);
-			if (node == nullptr) {
+			if (node == nullptr)
 				throw std::runtime_error("Error: value not found, so cannot be deleted");
-			} else if (node->left == nullptr && node->right == nullptr) {
-				delete node;
-				if (left)
-					current_head->left = nullptr;
-				else
-					current_head->right = nullptr;
-				return;
-			} else if (node->left == nullptr) {
-				Node* node_cpy = node;
-				node = node->right;
-				delete node_cpy;
-				if (left)
-					current_head->left = node;
-				else
-					current_head->right = node;
-				return;
-			} else if (node->right == nullptr) {
-				Node* node_cpy = node;
-				node = node->left;
-				delete node_cpy;
-				if (left)
-					current_head->left = node;
-				else
-					current_head->right = node;
-				return;
-			} else {
+			if (node->left && node->right) {  // Replaced by the lowest value of its right sub-tree, which is unlinked
+				current_head = node;
 				Node* replace = min_value(node->right);
-				node->data = replace->data;
-				delete replace;
-				if (left)
-					current_head->left = nullptr;
+				if (current_head == node)
+					node->right = replace->right;
 				else
-					current_head->right = nullptr;
+					current_head->left = replace->right;
+				node->data = std::move(replace->data);
+				destroy_node(replace);
+				return;
 			}
+			Node* child = node->left ? node->left : node->right;
+			if (node == root)
+				root = child;
+			else if (left)
+				current_head->left = child;
+			else
+				current_head->right = child;
+			destroy_node(node);
 		}
 
 		/**
@@ -245,6 +314,17 @@ namespace custom {
 			root = nullptr;
 		}
 
+		/**
+		 * Returns a copy of the allocator the nodes are allocated with.
+		 *
+		 * **Time Complexity** = *O(1)*.
+		 *
+		 * @return - the allocator of the tree.
+		 */
+		[[nodiscard]] Allocator get_allocator() const noexcept {
+			return mAllocator;
+		}
+
 		/**
 		 * BinarySearchTree destructor which calls clear() to clear all the node elements in the tree if the tree is
 		 * initialized.
@@ -261,7 +341,7 @@ namespace custom {
 		 * A node structure to contain the data, of type `T` for each node in the tree and Node pointers for the
 		 * left and right children nodes.
 		 */
-		struct Node {
+		struct Node : allocation_tracking::TrackedNode<ContainerType::BinarySearchTree> {
 			T data;  /**< The data of type `T` of each node. */
 			Node* left = nullptr;  /**< Pointer to the left child node of this node, which will have a lesser value. */
 			Node* right = nullptr;  /**< Pointer to the right child node of this node, which will have a greater value. */
@@ -284,6 +364,40 @@ namespace custom {
 		Node* root;  /**< Pointer to the root node of the tree. */
 		Node* current_head;  /**< A pointer to a node in the tree currently in context, which in this class is mainly used to utility use. */
 		bool left;  /**< A private helper member which is used by tree-altering functions. */
+		[[no_unique_address]] Allocator mAllocator;  /**< The allocator the nodes are allocated with. */
+
+		/**
+		 * Private helper function which allocates and constructs a node with the allocator of the tree.
+		 *
+		 * @param data - the data of the node, copied or moved into it.
+		 * @return - a pointer to the new node.
+		 */
+		template<typename Data>
+		Node* create_node(Data&& data) noexcept {
+			return allocation_tracking::create_node<ContainerType::BinarySearchTree, Node>(mAllocator,
+			                                                                             std::forward<Data>(data));
+		}
+
+		/**
+		 * Private helper function which destroys and deallocates a node from create_node().
+		 *
+		 * @param node - a pointer to the node.
+		 */
+		void destroy_node(Node* node) noexcept {
+			allocation_tracking::destroy_node<ContainerType::BinarySearchTree>(mAllocator, node);
+		}
+
+		/**
+		 * Private helper function which counts the nodes of the sub-tree with the root node provided.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the sub-tree.
+		 *
+		 * @param node - a pointer to the root node of the sub-tree.
+		 * @return - an unsigned integer representing the number of nodes in the sub-tree.
+		 */
+		size_t count_nodes(const Node* node) const noexcept {
+			return node ? 1 + count_nodes(node->left) + count_nodes(node->right) : 0;
+		}
 
 		/**
 		 * Private helper function which find a node with the data specified, starting from the root node provided.
@@ -416,9 +530,19 @@ namespace custom {
 				delete_tree(node->left);
 			if (node->right)
 				delete_tree(node->right);
-			delete node;
+			destroy_node(node);
 		}
 	};
+
+	namespace pmr {
+		/**
+		 * A BinarySearchTree whose nodes are allocated from a `std::pmr::memory_resource`.
+		 * @tparam T - the type of the data of each node in the tree.
+		 */
+		template<typename T>
+		using BinarySearchTree = custom::BinarySearchTree<T, std::enable_if_t<std::is_arithmetic_v<T>>,
+		                                                  std::pmr::polymorphic_allocator<T>>;
+	}// namespace pmr
 }// namespace custom
 
 #endif//BINARY_SEARCH_TREE_H
\ No newline at end of file
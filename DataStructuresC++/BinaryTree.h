@@ -1,33 +1,54 @@
 #ifndef BINARY_TREE_H
 #define BINARY_TREE_H
 
+#include <cstdint>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <vector>
 
+#include "AllocationTracking.h"
+#include "Checking.h"
+#include "MemoryUsage.h"
+#include "Serialization.h"
+#include "Tracing.h"
+
 namespace custom {
-	template<typename T>
+	template<typename T, typename Allocator = std::allocator<T>>
 	/**
 	 * A template implementation of a specialised tree data structure where each node can have at most two children
 	 * nodes. Each node has a member data of type `T` and pointers to the left and right children nodes.
 	 *
 	 * @tparam T - the type of the data of each node in the tree.
+	 * @tparam Allocator - the allocator the nodes are allocated with, `std::allocator` by default, see pmr::BinaryTree.
 	 * @see <a href="https://en.wikipedia.org/wiki/Binary_tree">Binary tree</a>
 	 */
 	class BinaryTree {
 	public:
+		using allocator_type = Allocator;  /**< An alias for the allocator the nodes are allocated with. */
+
 		/**
 		 * Default BinaryTree constructor which sets the root and current head members to `nullptr`.
 		 */
 		BinaryTree() noexcept: root(nullptr), current_head(nullptr) {}
 
+		/**
+		 * Overloaded BinaryTree constructor which initialises an empty tree whose nodes will be allocated with the
+		 * allocator provided.
+		 * @param allocator - the allocator to allocate the nodes with.
+		 */
+		explicit BinaryTree(const Allocator& allocator) noexcept: root(nullptr), current_head(nullptr),
+		                                                          mAllocator(allocator) {}
+
 		/**
 		 * Overloaded BinaryTree constructor which takes a value of type `T` and constructs a new node with the data
 		 * provided, setting it to the root and current head of the tree.
 		 * @param data - data of type `T` to be copied into the root node.
+		 * @param allocator - the allocator to allocate the nodes with.
 		 */
-		explicit BinaryTree(const T& data) noexcept {
-			root = new Node(data);
+		explicit BinaryTree(const T& data, const Allocator& allocator = Allocator()) noexcept: mAllocator(allocator) {
+			root = create_node(data);
 			current_head = root;
 		}
 
@@ -35,9 +56,10 @@ namespace custom {
 		 * Overloaded BinaryTree constructor which takes a value of type `T` and constructs a new node with the data
 		 * provided, setting it to the root and current head of the tree.
 		 * @param data -  - a *r-value reference* to data of type `T` to be moved into the root node.
+		 * @param allocator - the allocator to allocate the nodes with.
 		 */
-		explicit BinaryTree(T&& data) noexcept {
-			root = new Node(std::move(data));
+		explicit BinaryTree(T&& data, const Allocator& allocator = Allocator()) noexcept: mAllocator(allocator) {
+			root = create_node(std::move(data));
 			current_head = root;
 		}
 
@@ -51,14 +73,12 @@ namespace custom {
 		 * @param data - data of type `T` to be copied into the new node.
 		 */
 		void new_left(const T& data) {
-			if (current_head && current_head->left == nullptr) {
-				Node* new_node = new Node(data);
-				current_head->left = new_node;
-			} else if (!current_head) {
-				throw std::runtime_error("Current head node is not initialized, cannot add left node.");
-			} else
-				throw std::runtime_error(
-						"Left node is already initialised, use change_left function to change left node.");
+			tracing::Scope scope(tracing::Operation::Insert);
+			check<std::runtime_error>(current_head != nullptr,
+			                          "Current head node is not initialized, cannot add left node.");
+			check<std::runtime_error>(current_head->left == nullptr,
+			                          "Left node is already initialised, use change_left function to change left node.");
+			current_head->left = create_node(data);
 		}
 
 		/**
@@ -71,14 +91,12 @@ namespace custom {
 		 * @param data - a *r-value reference* to data of type `T` to be moved into the new node.
 		 */
 		void new_left(T&& data) {
-			if (current_head && current_head->left == nullptr) {
-				Node* new_node = new Node(std::move(data));
-				current_head->left = new_node;
-			} else if (!current_head) {
-				throw std::runtime_error("Current head node is not initialized, cannot add left node.");
-			} else
-				throw std::runtime_error(
-						"Left node is already initialised, use change_left function to change left node.");
+			tracing::Scope scope(tracing::Operation::Insert);
+			check<std::runtime_error>(current_head != nullptr,
+			                          "Current head node is not initialized, cannot add left node.");
+			check<std::runtime_error>(current_head->left == nullptr,
+			                          "Left node is already initialised, use change_left function to change left node.");
+			current_head->left = create_node(std::move(data));
 		}
 
 		/**
@@ -91,14 +109,12 @@ namespace custom {
 		 * @param data - data of type `T` to be copied into the new node.
 		 */
 		void new_right(const T& data) {
-			if (current_head && current_head->right == nullptr) {
-				Node* new_node = new Node(data);
-				current_head->right = new_node;
-			} else if (!current_head) {
-				throw std::runtime_error("Current head node is not initialized, cannot add right node.");
-			} else
-				throw std::runtime_error(
-						"Right node is already initialised, use change_right function to change right node.");
+			tracing::Scope scope(tracing::Operation::Insert);
+			check<std::runtime_error>(current_head != nullptr,
+			                          "Current head node is not initialized, cannot add right node.");
+			check<std::runtime_error>(current_head->right == nullptr,
+			                          "Right node is already initialised, use change_right function to change right node.");
+			current_head->right = create_node(data);
 		}
 
 		/**
@@ -111,14 +127,12 @@ namespace custom {
 		 * @param data - a *r-value reference* to data of type `T` to be moved into the new node.
 		 */
 		void new_right(T&& data) {
-			if (current_head && current_head->right == nullptr) {
-				Node* new_node = new Node(std::move(data));
-				current_head->right = new_node;
-			} else if (!current_head) {
-				throw std::runtime_error("Current head node is not initialized, cannot add right node.");
-			} else
-				throw std::runtime_error(
-						"Right node is already initialised, use change_right function to change right node.");
+			tracing::Scope scope(tracing::Operation::Insert);
+			check<std::runtime_error>(current_head != nullptr,
+			                          "Current head node is not initialized, cannot add right node.");
+			check<std::runtime_error>(current_head->right == nullptr,
+			                          "Right node is already initialised, use change_right function to change right node.");
+			current_head->right = create_node(std::move(data));
 		}
 
 		/**
@@ -133,11 +147,10 @@ namespace custom {
 		void change_data(const T& data) {
 			if (current_head)
 				current_head->data = data;
-			else if (current_head == root && root == nullptr) {
-				Node* new_node = new Node(data);
-				root = new_node;
-			} else
-				throw std::runtime_error("Current node is uninitialised, there is no value to change.");
+			else {
+				check<std::runtime_error>(root == nullptr, "Current node is uninitialised, there is no value to change.");
+				root = create_node(data);
+			}
 		}
 
 		/**
@@ -152,11 +165,10 @@ namespace custom {
 		void change_data(T&& data) {
 			if (current_head)
 				current_head->data = std::move(data);
-			else if (current_head == root && root == nullptr) {
-				Node* new_node = new Node(std::move(data));
-				root = new_node;
-			} else
-				throw std::runtime_error("Current node is uninitialised, there is no value to change.");
+			else {
+				check<std::runtime_error>(root == nullptr, "Current node is uninitialised, there is no value to change.");
+				root = create_node(std::move(data));
+			}
 		}
 
 		/**
@@ -169,10 +181,9 @@ namespace custom {
 		 * @param data - data of type `T` to be copied into the current head node's left child node.
 		 */
 		void change_left(const T& data) {
-			if (current_head && current_head->left)
-				current_head->left->data = data;
-			else
-				throw std::runtime_error("Left node is uninitialised, use new_left function to add a left node.");
+			check<std::runtime_error>(current_head && current_head->left,
+			                          "Left node is uninitialised, use new_left function to add a left node.");
+			current_head->left->data = data;
 		}
 
 		/**
@@ -185,10 +196,9 @@ namespace custom {
 		 * @param data - a *r-value reference* to data of type `T` to be moved into the current head node's left child node.
 		 */
 		void change_left(T&& data) {
-			if (current_head && current_head->left)
-				current_head->left->data = std::move(data);
-			else
-				throw std::runtime_error("Left node is uninitialised, use new_left function to add a left node.");
+			check<std::runtime_error>(current_head && current_head->left,
+			                          "Left node is uninitialised, use new_left function to add a left node.");
+			current_head->left->data = std::move(data);
 		}
 
 		/**
@@ -201,10 +211,9 @@ namespace custom {
 		 * @param data - data of type `T` to be copied into the current head node's right child node.
 		 */
 		void change_right(const T& data) {
-			if (current_head && current_head->right)
-				current_head->right->data = data;
-			else
-				throw std::runtime_error("Right node is uninitialised, use new_right function to add a right node.");
+			check<std::runtime_error>(current_head && current_head->right,
+			                          "Right node is uninitialised, use new_right function to add a right node.");
+			current_head->right->data = data;
 		}
 
 		/**
@@ -217,10 +226,9 @@ namespace custom {
 		 * @param data - a *r-value reference* to data of type `T` to be moved into the current head node's right child node.
 		 */
 		void change_right(T&& data) {
-			if (current_head && current_head->right)
-				current_head->right->data = std::move(data);
-			else
-				throw std::runtime_error("Right node is uninitialised, use new_right function to add a right node.");
+			check<std::runtime_error>(current_head && current_head->right,
+			                          "Right node is uninitialised, use new_right function to add a right node.");
+			current_head->right->data = std::move(data);
 		}
 
 		/**
@@ -230,11 +238,9 @@ namespace custom {
 		 *
 		 * If the current head node or its left child node is uninitialized, a `runtime_error` exception is thrown.
 		 */
-		void advance_left() {
-			if (current_head && current_head->left)
-				current_head = current_head->left;
-			else
-				throw std::runtime_error("Left node is uninitialised.");
+		void advance_left() noexcept(!checks_throw) {
+			check<std::runtime_error>(current_head && current_head->left, "Left node is uninitialised.");
+			current_head = current_head->left;
 		}
 
 		/**
@@ -244,11 +250,9 @@ namespace custom {
 		 *
 		 * If the current head node or its right child node is uninitialized, a `runtime_error` exception is thrown.
 		 */
-		void advance_right() {
-			if (current_head && current_head->right)
-				current_head = current_head->right;
-			else
-				throw std::runtime_error("Right node is uninitialised.");
+		void advance_right() noexcept(!checks_throw) {
+			check<std::runtime_error>(current_head && current_head->right, "Right node is uninitialised.");
+			current_head = current_head->right;
 		}
 
 		/**
@@ -269,10 +273,9 @@ namespace custom {
 		 *
 		 * @return - a const reference to the value of the data member of the current head node.
 		 */
-		const T& get_data() const {
-			if (current_head)
-				return current_head->data;
-			throw std::runtime_error("Current head node is uninitialised, no data to return.");
+		const T& get_data() const noexcept(!checks_throw) {
+			check<std::runtime_error>(current_head != nullptr, "Current head node is uninitialised, no data to return.");
+			return current_head->data;
 		}
 
 		/**
@@ -311,6 +314,55 @@ namespace custom {
 			return root == nullptr;
 		}
 
+		/**
+		 * Returns a breakdown of the memory held by the tree: the data of the nodes is the payload, while the pointers
+		 * to the children, the padding of each node and the tree object itself are structural overhead.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the tree.
+		 *
+		 * @return - a MemoryUsage object with the bytes of payload, structure and estimated allocator overhead.
+		 */
+		[[nodiscard]] MemoryUsage memory_usage() const noexcept {
+			MemoryUsage usage;
+			usage.structure = sizeof(*this);
+			memory_detail::add_blocks(usage, count_nodes(root), sizeof(Node), sizeof(T));
+			return usage;
+		}
+
+		/**
+		 * Serializes the tree in the binary format of Serialization.h, as the data of its nodes in pre-order, each
+		 * followed by a byte whose lowest two bits tell whether the node has a left and a right child.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the tree.
+		 *
+		 * @param out - the serialization::Writer to append the tree to.
+		 */
+		void serialize(serialization::Writer& out) const {
+			out.header<T>(serialization::Kind::BinaryTree, count_nodes(root));
+			if (root)
+				write_subtree(out, root);
+		}
+
+		/**
+		 * Deserializes a tree written by serialize(), with the same shape and the root as the current head. If the
+		 * data does not hold a serialized BinaryTree of `T`, a `runtime_error` exception is thrown.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the tree.
+		 *
+		 * @param in - the serialization::Reader to read the tree from.
+		 * @return - the tree.
+		 */
+		static BinaryTree deserialize(serialization::Reader& in) {
+			size_t count = in.header<T>(serialization::Kind::BinaryTree).count;
+			BinaryTree result;
+			if (count)
+				result.read_subtree(in, result.root, count);
+			if (count)
+				throw std::runtime_error("Error: the serialized BinaryTree has fewer nodes than its header");
+			result.current_head = result.root;
+			return result;
+		}
+
 		/**
 		 * Conversion operator for boolean type. Evaluates to true if the current head node of the tree is **not**
 		 * `nullptr`.
@@ -332,10 +384,9 @@ namespace custom {
 		 *
 		 * @return - a const reference to the data member of the left child node of the current head node.
 		 */
-		const T& show_left() const {
-			if (current_head && current_head->left)
-				return current_head->left->data;
-			throw std::runtime_error("Error: left node is empty");
+		const T& show_left() const noexcept(!checks_throw) {
+			check<std::runtime_error>(current_head && current_head->left, "Error: left node is empty");
+			return current_head->left->data;
 		}
 
 		/**
@@ -347,10 +398,9 @@ namespace custom {
 		 *
 		 * @return - a const reference to the data member of the right child node of the current head node.
 		 */
-		const T& show_right() const {
-			if (current_head && current_head->right)
-				return current_head->right->data;
-			throw std::runtime_error("Error: right node is empty");
+		const T& show_right() const noexcept(!checks_throw) {
+			check<std::runtime_error>(current_head && current_head->right, "Error: right node is empty");
+			return current_head->right->data;
 		}
 
 		/**
@@ -362,6 +412,7 @@ namespace custom {
 		 * @return - a `std::vector` of type `T` containing the value of each node in the tree after pre-order traversal.
 		 */
 		[[nodiscard]] std::vector<T> contents_PreOrder() const noexcept {
+			tracing::Scope scope(tracing::Operation::Traversal);
 			std::vector<T> temp = {};
 			return PreOrder(root, temp);
 		}
@@ -375,6 +426,7 @@ namespace custom {
 		 * @return - a `std::vector` of type `T` containing the value of each node in the tree after in-order traversal.
 		 */
 		[[nodiscard]] std::vector<T> contents_InOrder() const noexcept {
+			tracing::Scope scope(tracing::Operation::Traversal);
 			std::vector<T> temp = {};
 			return InOrder(root, temp);
 		}
@@ -388,6 +440,7 @@ namespace custom {
 		 * @return - a `std::vector` of type `T` containing the value of each node in the tree after post-order traversal.
 		 */
 		[[nodiscard]] std::vector<T> contents_PostOrder() const noexcept {
+			tracing::Scope scope(tracing::Operation::Traversal);
 			std::vector<T> temp = {};
 			return PostOrder(root, temp);
 		}
@@ -400,12 +453,12 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 */
 		void remove_left() {
-			if (current_head && current_head->left)
-				delete_tree(current_head->left);
-			else if (!current_head) {
-				throw std::runtime_error("Current head node is not initialized, cannot remove left node.");
-			} else
-				throw std::runtime_error("Error: Left node is uninitialised, there is nothing to remove");
+			tracing::Scope scope(tracing::Operation::Erase);
+			check<std::runtime_error>(current_head != nullptr,
+			                          "Current head node is not initialized, cannot remove left node.");
+			check<std::runtime_error>(current_head->left != nullptr,
+			                          "Error: Left node is uninitialised, there is nothing to remove");
+			delete_tree(current_head->left);
 		}
 
 		/**
@@ -416,12 +469,12 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 */
 		void remove_right() {
-			if (current_head && current_head->right)
-				delete_tree(current_head->right);
-			else if (!current_head) {
-				throw std::runtime_error("Current head node is not initialized, cannot remove right node.");
-			} else
-				throw std::runtime_error("Error: Right node is uninitialised, there is nothing to remove");
+			tracing::Scope scope(tracing::Operation::Erase);
+			check<std::runtime_error>(current_head != nullptr,
+			                          "Current head node is not initialized, cannot remove right node.");
+			check<std::runtime_error>(current_head->right != nullptr,
+			                          "Error: Right node is uninitialised, there is nothing to remove");
+			delete_tree(current_head->right);
 		}
 
 		/**
@@ -436,6 +489,17 @@ namespace custom {
 			current_head = root;
 		}
 
+		/**
+		 * Returns a copy of the allocator the nodes are allocated with.
+		 *
+		 * **Time Complexity** = *O(1)*.
+		 *
+		 * @return - the allocator of the tree.
+		 */
+		[[nodiscard]] Allocator get_allocator() const noexcept {
+			return mAllocator;
+		}
+
 		/**
 		 * BinaryTree destructor which will call clear() to clear the tree from the root if it is initialized.
 		 *
@@ -451,7 +515,7 @@ namespace custom {
 		 * A node structure to contain the data, of type `T` for each node in the tree and Node pointers for the
 		 * left and right children nodes.
 		 */
-		struct Node {
+		struct Node : allocation_tracking::TrackedNode<ContainerType::BinaryTree> {
 			T data;  /**< The data of type `T` of each node. */
 			Node* left = nullptr;  /**< Pointer to the left child node of this node. */
 			Node* right = nullptr;  /**< Pointer to the right child node of this node. */
@@ -473,6 +537,78 @@ namespace custom {
 
 		Node* root;  /**< Pointer to the root node of the tree. */
 		Node* current_head;  /**< A pointer to a node in the tree currently in context. */
+		[[no_unique_address]] Allocator mAllocator;  /**< The allocator the nodes are allocated with. */
+
+		/**
+		 * Private helper function which allocates and constructs a node with the allocator of the tree.
+		 *
+		 * @param data - the data of the node, copied or moved into it.
+		 * @return - a pointer to the new node.
+		 */
+		template<typename Data>
+		Node* create_node(Data&& data) noexcept {
+			return allocation_tracking::create_node<ContainerType::BinaryTree, Node>(mAllocator, std::forward<Data>(data));
+		}
+
+		/**
+		 * Private helper function which destroys and deallocates a node from create_node().
+		 *
+		 * @param node - a pointer to the node.
+		 */
+		void destroy_node(Node* node) noexcept {
+			allocation_tracking::destroy_node<ContainerType::BinaryTree>(mAllocator, node);
+		}
+
+		/**
+		 * Private helper function which counts the nodes of the sub-tree with the root node provided.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the sub-tree.
+		 *
+		 * @param node - a pointer to the root node of the sub-tree.
+		 * @return - an unsigned integer representing the number of nodes in the sub-tree.
+		 */
+		size_t count_nodes(const Node* node) const noexcept {
+			return node ? 1 + count_nodes(node->left) + count_nodes(node->right) : 0;
+		}
+
+		/**
+		 * Private helper function which serializes the sub-tree with the root node provided in pre-order.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the sub-tree.
+		 *
+		 * @param out - the serialization::Writer to append the sub-tree to.
+		 * @param node - a pointer to the root node of the sub-tree, which must not be `nullptr`.
+		 */
+		static void write_subtree(serialization::Writer& out, const Node* node) {
+			out.value(node->data);
+			out.value(static_cast<std::uint8_t>((node->left ? 1 : 0) | (node->right ? 2 : 0)));
+			if (node->left)
+				write_subtree(out, node->left);
+			if (node->right)
+				write_subtree(out, node->right);
+		}
+
+		/**
+		 * Private helper function which deserializes a sub-tree written by write_subtree(), linking each node as soon as
+		 * it is created so the tree owns it if an exception is thrown.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the sub-tree.
+		 *
+		 * @param in - the serialization::Reader to read the sub-tree from.
+		 * @param node - a reference to the pointer to set to the root node of the sub-tree.
+		 * @param count - the number of nodes left to read, which is decremented for each node read.
+		 */
+		void read_subtree(serialization::Reader& in, Node*& node, size_t& count) {
+			if (count == 0)
+				throw std::runtime_error("Error: the serialized BinaryTree has more nodes than its header");
+			--count;
+			node = create_node(in.value<T>());
+			auto children = in.value<std::uint8_t>();
+			if (children & 1)
+				read_subtree(in, node->left, count);
+			if (children & 2)
+				read_subtree(in, node->right, count);
+		}
 
 		/**
 		 * Private helper function to help recursively traverse the tree pre-order and add each node's data to
@@ -563,10 +699,18 @@ namespace custom {
 				delete_tree(node->left);
 			if (node->right != nullptr)
 				delete_tree(node->right);
-			delete node;
+			destroy_node(node);
 		}
 	};
 
+	namespace pmr {
+		/**
+		 * A BinaryTree whose nodes are allocated from a `std::pmr::memory_resource`.
+		 * @tparam T - the type of the data of each node in the tree.
+		 */
+		template<typename T>
+		using BinaryTree = custom::BinaryTree<T, std::pmr::polymorphic_allocator<T>>;
+	}// namespace pmr
 }// namespace custom
 
 #endif// BINARY_TREE_H
\ No newline at end of file
@@ -0,0 +1,64 @@
+#ifndef CHECKING_H
+#define CHECKING_H
+
+#include <cassert>
+
+/**
+ * The checking policy of the library, chosen for the whole program by defining `CUSTOM_CHECKING` on the command line
+ * of every translation unit, e.g. `-DCUSTOM_CHECKING=CUSTOM_UNCHECKED`:
+ *  - `CUSTOM_CHECKED`, the default, checks every index, iterator position and non-empty precondition of the
+ *    containers and their iterators and throws the documented exception when one is broken,
+ *  - `CUSTOM_ASSERT_ONLY` checks the same preconditions with `assert`, so they abort debug builds and cost nothing once
+ *    `NDEBUG` is defined,
+ *  - `CUSTOM_UNCHECKED` performs no checks; breaking a precondition is undefined behaviour, as it is for the standard
+ *    containers.
+ * Without checks the element access and iterator functions are `noexcept`, so release builds need neither the
+ * branches nor the unwinding paths.
+ */
+#define CUSTOM_UNCHECKED 0
+#define CUSTOM_ASSERT_ONLY 1
+#define CUSTOM_CHECKED 2
+
+#ifndef CUSTOM_CHECKING
+#define CUSTOM_CHECKING CUSTOM_CHECKED
+#endif
+
+namespace custom {
+	/**
+	 * The checking policies the library can be built with.
+	 */
+	enum class CheckingPolicy {
+		Unchecked = CUSTOM_UNCHECKED,  /**< No precondition is checked. */
+		AssertOnly = CUSTOM_ASSERT_ONLY,  /**< Preconditions are checked with `assert`. */
+		Checked = CUSTOM_CHECKED  /**< Preconditions are checked and broken ones throw an exception. */
+	};
+
+	inline constexpr CheckingPolicy checking = static_cast<CheckingPolicy>(CUSTOM_CHECKING);  /**< The checking policy of the program. */
+
+	static_assert(checking == CheckingPolicy::Unchecked || checking == CheckingPolicy::AssertOnly ||
+	              checking == CheckingPolicy::Checked, "CUSTOM_CHECKING must be CUSTOM_UNCHECKED, CUSTOM_ASSERT_ONLY "
+	                                                   "or CUSTOM_CHECKED");
+
+	inline constexpr bool checks_throw = checking == CheckingPolicy::Checked;  /**< Whether broken preconditions throw, used in the `noexcept` specifications of the checked functions. */
+
+	/**
+	 * Checks a precondition of a container or iterator according to the checking policy: throws an exception of type
+	 * `Exception` with the message provided if it is broken and the policy is checked, asserts it if the policy is
+	 * assert-only and does nothing if it is unchecked.
+	 * **Time Complexity** = *O(1)*.
+	 * @tparam Exception - the type of exception thrown, constructible from a string.
+	 * @param condition - the precondition, which must be `true`.
+	 * @param message - the message of the exception or assertion.
+	 */
+	template<typename Exception>
+	constexpr void check([[maybe_unused]] bool condition, [[maybe_unused]] const char* message) {
+		if constexpr (checking == CheckingPolicy::Checked) {
+			if (!condition) [[unlikely]]
+				throw Exception(message);
+		} else if constexpr (checking == CheckingPolicy::AssertOnly) {
+			assert(condition && message);
+		}
+	}
+}// namespace custom
+
+#endif// CHECKING_H
@@ -3,10 +3,17 @@
 
 #include <initializer_list>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <vector>
 
+#include "AllocationTracking.h"
+#include "Checking.h"
 #include "LinkedList.h"
+#include "MemoryUsage.h"
+#include "Serialization.h"
+#include "Tracing.h"
 
 namespace custom {
 	/**
@@ -78,16 +85,10 @@ namespace custom {
 		 * `out_of_range` exception if an invalid iterator, one whose member pointer is nullptr, is incremented.
 		 * @return - a reference to the current object after incrementing.
 		 */
-		DoublyListIterator& operator++() {
-#ifdef DEBUG
-			if (mPtr) {
-#endif
-				mPtr = mPtr->next;
-				return *this;
-#ifdef DEBUG
-			}
-			throw std::out_of_range("Cannot increment list iterator past end of list");
-#endif
+		DoublyListIterator& operator++() noexcept(!checks_throw) {
+			check<std::out_of_range>(mPtr != nullptr, "Cannot increment list iterator past end of list");
+			mPtr = mPtr->next;
+			return *this;
 		}
 
 		/**
@@ -96,17 +97,10 @@ namespace custom {
 		 * whose member pointer is nullptr, is incremented.
 		 * @return - a copy DoublyListIterator object at the position before incrementing.
 		 */
-		const DoublyListIterator operator++(int) {
-#ifdef DEBUG
-			if (mPtr) {
-#endif
-				const DoublyListIterator temp(*this);
-				++*this;
-				return temp;
-#ifdef DEBUG
-			}
-			throw std::out_of_range("Cannot increment list iterator past end of list");
-#endif
+		const DoublyListIterator operator++(int) noexcept(!checks_throw) {
+			const DoublyListIterator temp(*this);
+			++*this;
+			return temp;
 		}
 
 		/**
@@ -114,16 +108,10 @@ namespace custom {
 		 * `out_of_range` exception if an invalid iterator, one whose member pointer is nullptr, is decremented into.
 		 * @return - a reference to the current object after decrementing.
 		 */
-		DoublyListIterator& operator--() {
-#ifdef DEBUG
-			if (mPtr) {
-#endif
-				mPtr = mPtr->last;
-				return *this;
-#ifdef DEBUG
-			}
-			throw std::out_of_range("Cannot decrement list iterator to before beginning of list");
-#endif
+		DoublyListIterator& operator--() noexcept(!checks_throw) {
+			check<std::out_of_range>(mPtr != nullptr, "Cannot decrement list iterator to before beginning of list");
+			mPtr = mPtr->last;
+			return *this;
 		}
 
 		/**
@@ -132,17 +120,10 @@ namespace custom {
 		 * whose member pointer is nullptr, is decremented.
 		 * @return - a copy DoublyListIterator object at the position before decrementing.
 		 */
-		const DoublyListIterator operator--(int) {
-#ifdef DEBUG
-			if (mPtr) {
-#endif
-				const DoublyListIterator temp(*this);
-				--*this;
-				return temp;
-#ifdef DEBUG
-			}
-			throw std::out_of_range("Cannot decrement list iterator to before beginning of list");
-#endif
+		const DoublyListIterator operator--(int) noexcept(!checks_throw) {
+			const DoublyListIterator temp(*this);
+			--*this;
+			return temp;
 		}
 
 		/**
@@ -152,31 +133,22 @@ namespace custom {
 		 * @param distance - an unsigned integer to represent the number of positions to advance.
 		 * @return - a reference to the current object.
 		 */
-		DoublyListIterator& advance(const int& distance) {
-#ifdef DEBUG
-			if (mPtr) {
-#endif
-				int moved = 0;
-				if (distance > 0) {
-					while (mPtr && moved < distance) {
-						++*this;
-						++moved;
-					}
-				} else {
-					while (mPtr && moved > distance) {
-						--*this;
-						--moved;
-					}
+		DoublyListIterator& advance(const int& distance) noexcept(!checks_throw) {
+			check<std::runtime_error>(mPtr != nullptr, "Iterator is at an invalid position, cannot advance");
+			int moved = 0;
+			if (distance > 0) {
+				while (mPtr && moved < distance) {
+					mPtr = mPtr->next;
+					++moved;
+				}
+			} else {
+				while (mPtr && moved > distance) {
+					mPtr = mPtr->last;
+					--moved;
 				}
-#ifdef DEBUG
-				if (moved != distance)
-					throw std::invalid_argument("Distance out of range of iterator");
-#endif
-				return *this;
 			}
-#ifdef DEBUG
-			throw std::runtime_error("Iterator is at an invalid position, cannot advance");
-#endif
+			check<std::invalid_argument>(moved == distance, "Distance out of range of iterator");
+			return *this;
 		}
 
 		/**
@@ -184,14 +156,8 @@ namespace custom {
 		 * to nullptr, an `out_of_range` exception is thrown.
 		 * @return - a copy of the incremented object.
 		 */
-		DoublyListIterator next() const {
-#ifdef DEBUG
-			if (mPtr)
-#endif
-				return ++DoublyListIterator(*this);
-#ifdef DEBUG
-			throw std::out_of_range("Cannot increment list iterator past end of list");
-#endif
+		DoublyListIterator next() const noexcept(!checks_throw) {
+			return ++DoublyListIterator(*this);
 		}
 
 		/**
@@ -199,14 +165,8 @@ namespace custom {
 		 * to nullptr, an `out_of_range` exception is thrown.
 		 * @return - a copy of the decremented object.
 		 */
-		DoublyListIterator prev() const {
-#ifdef DEBUG
-			if (mPtr)
-#endif
-				return --DoublyListIterator(*this);
-#ifdef DEBUG
-			throw std::out_of_range("Cannot increment list iterator past end of list");
-#endif
+		DoublyListIterator prev() const noexcept(!checks_throw) {
+			return --DoublyListIterator(*this);
 		}
 
 		/**
@@ -215,23 +175,10 @@ namespace custom {
 		 * @param amount - an unsigned integer to represent the distance to advance the iterator by.
 		 * @return - a copy of the advanced object.
 		 */
-		DoublyListIterator operator+(const size_t& amount) {
+		DoublyListIterator operator+(const size_t& amount) noexcept(!checks_throw) {
 			DoublyListIterator result(*this);
-#ifdef DEBUG
-			size_t moved = 0;
-			while (result.mPtr && moved < amount) {
-				result.mPtr = result.mPtr->next;
-				++moved;
-			}
-			if (moved == amount)
-				return result;
-			throw std::out_of_range("Cannot increment list iterator past end of list");
-#endif
-#ifdef RELEASE
-			for (size_t i = 0; i < amount; ++i)
-				result.mPtr = result.mPtr->next;
+			result += amount;
 			return result;
-#endif
 		}
 
 		/**
@@ -240,22 +187,12 @@ namespace custom {
 		 * @param amount - an unsigned integer to represent the distance to advance the iterator by.
 		 * @return - a reference to the advanced object.
 		 */
-		DoublyListIterator& operator+=(const size_t& amount) {
-#ifdef DEBUG
-			size_t moved = 0;
-			while (mPtr && moved < amount) {
+		DoublyListIterator& operator+=(const size_t& amount) noexcept(!checks_throw) {
+			for (size_t i = 0; i < amount; ++i) {
+				check<std::out_of_range>(mPtr != nullptr, "Cannot increment list iterator past end of list");
 				mPtr = mPtr->next;
-				++moved;
 			}
-			if (moved == amount)
-				return *this;
-			throw std::out_of_range("Cannot increment list iterator past end of list");
-#endif
-#ifdef RELEASE
-			for (size_t i = 0; i < amount; ++i)
-				mPtr = mPtr->next;
 			return *this;
-#endif
 		}
 
 		/**
@@ -264,23 +201,10 @@ namespace custom {
 		 * @param amount - an unsigned integer to represent the distance to advance the iterator by.
 		 * @return - a copy of the advanced object.
 		 */
-		DoublyListIterator operator-(const size_t& amount) {
+		DoublyListIterator operator-(const size_t& amount) noexcept(!checks_throw) {
 			DoublyListIterator result(*this);
-#ifdef DEBUG
-			size_t moved = 0;
-			while (mPtr && moved < amount) {
-				result.mPtr = result.mPtr->last;
-				++moved;
-			}
-			if (moved == amount)
-				return result;
-			throw std::out_of_range("Cannot increment list iterator before beginning of list");
-#endif
-#ifdef RELEASE
-			for (size_t i = 0; i < amount; ++i)
-				result.mPtr = result.mPtr->last;
+			result -= amount;
 			return result;
-#endif
 		}
 
 		/**
@@ -289,22 +213,12 @@ namespace custom {
 		 * @param amount - an unsigned integer to represent the distance to advance the iterator by.
 		 * @return - a reference to the advanced object.
 		 */
-		DoublyListIterator& operator-=(const size_t& amount) {
-#ifdef DEBUG
-			size_t moved = 0;
-			while (mPtr && moved < amount) {
+		DoublyListIterator& operator-=(const size_t& amount) noexcept(!checks_throw) {
+			for (size_t i = 0; i < amount; ++i) {
+				check<std::out_of_range>(mPtr != nullptr, "Cannot increment list iterator before beginning of list");
 				mPtr = mPtr->last;
-				++moved;
 			}
-			if (moved == amount)
-				return *this;
-			throw std::out_of_range("Cannot increment list iterator past end of list");
-#endif
-#ifdef RELEASE
-			for (size_t i = 0; i < amount; ++i)
-				mPtr = mPtr->last;
 			return *this;
-#endif
 		}
 
 		/**
@@ -330,14 +244,9 @@ namespace custom {
 		 * to an invalid position, a `runtime_error` exception is thrown.
 		 * @return - A reference to the data at the current iterator position.
 		 */
-		ValueType& operator*() const {
-#ifdef DEBUG
-			if (mPtr)
-#endif
-				return mPtr->data;
-#ifdef DEBUG
-			throw std::runtime_error("Iterator does not point to a valid position, cannot dereference");
-#endif
+		ValueType& operator*() const noexcept(!checks_throw) {
+			check<std::runtime_error>(mPtr != nullptr, "Iterator does not point to a valid position, cannot dereference");
+			return mPtr->data;
 		}
 
 		/**
@@ -377,12 +286,15 @@ namespace custom {
 	 * to continue running.
 	 *
 	 * @tparam T - the type of the data to be stored in each node.
+	 * @tparam Allocator - the allocator the nodes are allocated with, `std::allocator` by default, see
+	 * pmr::DoublyLinkedList.
 	 * @see <a href="https://en.wikipedia.org/wiki/Linked_list#Doubly_linked_list">Doubly linked list</a>
 	 */
-	template<typename T>
+	template<typename T, typename Allocator = std::allocator<T>>
 	class DoublyLinkedList {
 	public:
 		using ValueType = T;  /**< An alias for the type of data `T` to be used by external utility classes. */
+		using allocator_type = Allocator;  /**< An alias for the allocator the nodes are allocated with. */
 		using Iterator = DoublyListIterator<DoublyLinkedList>;  /**< An alias for the DoublyLinkedList iterator class. */
 
 		friend class DoublyListIterator<DoublyLinkedList>;  /**< Friend DoublyLinkedList iterator class, allowing it to access private members. */
@@ -395,13 +307,21 @@ namespace custom {
 		 */
 		DoublyLinkedList() noexcept: head(nullptr), tail(nullptr), mLength(0) {}
 
+		/**
+		 * Overloaded DoublyLinkedList constructor which initialises an empty list whose nodes will be allocated with
+		 * the allocator provided.
+		 * @param allocator - the allocator to allocate the nodes with.
+		 */
+		explicit DoublyLinkedList(const Allocator& allocator) noexcept: head(nullptr), tail(nullptr), mLength(0),
+		                                                                mAllocator(allocator) {}
+
 		/**
 		 * Overloaded DoublyLinkedList constructor which allocates memory for one element node and copies the data provided.
 		 * This constructor is explicit, meaning implicit conversion is not supported.
 		 * @param data - data of type `T` to be copied into the head node of the DoublyLinkedList.
 		 */
 		explicit DoublyLinkedList(const T& data) noexcept: mLength(1) {
-			head = new Node(data);
+			head = create_node(data);
 			tail = head;
 		}
 
@@ -411,7 +331,7 @@ namespace custom {
 		 * @param data - an *r-value reference* to data of type `T`, to be moved into the head node of the DoublyLinkedList.
 		 */
 		explicit DoublyLinkedList(T&& data) noexcept: mLength(1) {
-			head = new Node(std::move(data));
+			head = create_node(std::move(data));
 			tail = head;
 		}
 
@@ -420,26 +340,30 @@ namespace custom {
 		 * its arguments to the list.
 		 * **Time Complexity** = *O(n)* where n is the number elements in the initialiser list.
 		 * @param init - an initialiser list of type `T` whose contents will be added to the list.
+		 * @param allocator - the allocator to allocate the nodes with.
 		 * @see <a href="https://en.cppreference.com/w/cpp/utility/initializer_list">std::initializer_list</a>
 		 */
-		DoublyLinkedList(std::initializer_list<T> init) noexcept: mLength(0) {
+		DoublyLinkedList(std::initializer_list<T> init, const Allocator& allocator = Allocator()) noexcept:
+				head(nullptr), tail(nullptr), mLength(0), mAllocator(allocator) {
 			for (auto it = init.begin(); it != init.end(); ++it)
 				append(std::move(*it));
 		}
 
 		/**
 		 * Copy constructor for a DoublyLinkedList which will perform a deep copy, element-wise, of another DoublyLinkedList
-		 * object of the same type `T`.
+		 * object of the same type `T`, with the allocator the allocator of the other list selects for a copy.
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the other list.
 		 * @param other - another DoublyLinkedList object of the same type `T` to be copied.
 		 */
-		DoublyLinkedList(const DoublyLinkedList<T>& other) noexcept: mLength(other.mLength) {
+		DoublyLinkedList(const DoublyLinkedList& other) noexcept:
+				mLength(other.mLength),
+				mAllocator(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.mAllocator)) {
 			if (other.mLength) {
-				head = new Node(other.head->data);
+				head = create_node(other.head->data);
 				tail = head;
 				Node* other_node = other.head->next;
 				while (other_node) {
-					Node* new_node = new Node(other_node->data);
+					Node* new_node = create_node(other_node->data);
 					tail->next = new_node;
 					new_node->last = tail;
 					tail = tail->next;
@@ -454,7 +378,7 @@ namespace custom {
 
 		/**
 		 * Copy assignment operator for the DoublyLinkedList which will copy another DoublyLinkedList object of the same type
-		 * `T` into the current object.
+		 * `T` into the current object, which keeps its allocator.
 		 * \note
 		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the other list + the number of elements
@@ -462,17 +386,17 @@ namespace custom {
 		 * @param other - another DoublyLinkedList object of the same type `T` to be copied.
 		 * @return - a reference to the current object.
 		 */
-		DoublyLinkedList<T>& operator=(const DoublyLinkedList<T>& other) noexcept {
+		DoublyLinkedList& operator=(const DoublyLinkedList& other) noexcept {
 			if (this != &other) {
 				if (mLength)
 					clear();
 				if (other.mLength) {
-					head = new Node(other.head->data);
+					head = create_node(other.head->data);
 					mLength = other.mLength;
 					tail = head;
 					Node* other_node = other.head->next;
 					while (other_node) {
-						Node* new_node = new Node(other_node->data);
+						Node* new_node = create_node(other_node->data);
 						tail->next = new_node;
 						new_node->last = tail;
 						tail = tail->next;
@@ -489,12 +413,12 @@ namespace custom {
 
 		/**
 		 * Move constructor for a DoublyLinkedList which will take the data from another DoublyLinkedList object of the same type
-		 * `T` and set the other object to its default state of not have any data.
+		 * `T`, along with its allocator, and set the other object to its default state of not have any data.
 		 * **Time Complexity** = *O(1)*.
 		 * @param other - an *r-value reference* to a DoublyLinkedList object of type `T` to be moved.
 		 */
-		DoublyLinkedList(DoublyLinkedList<T>&& other) noexcept: head(other.head), tail(other.tail),
-		                                                        mLength(other.mLength) {
+		DoublyLinkedList(DoublyLinkedList&& other) noexcept: head(other.head), tail(other.tail),
+		                                                     mLength(other.mLength), mAllocator(other.mAllocator) {
 			other.head = nullptr;
 			other.tail = nullptr;
 			other.mLength = 0;
@@ -502,17 +426,25 @@ namespace custom {
 
 		/**
 		 * Move assignment operator for the DoublyLinkedList which will move another DoublyLinkedList object of type `T` into
-		 * the current object.
+		 * the current object, which keeps its allocator. If the allocators do not compare equal, e.g.
+		 * `std::pmr::polymorphic_allocator` objects of different memory resources, the elements are moved one by one.
 		 * \note
 		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
-		 * **Time Complexity** = *O(n)* where n is the number of elements in the current list object.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the current list object, + the number of
+		 * elements in the other list if the allocators differ.
 		 * @param other - an *r-value reference* to a DoublyLinkedList object of type `T` to be moved.
 		 * @return - a reference to the current object.
 		 */
-		DoublyLinkedList<T>& operator=(DoublyLinkedList<T>&& other) noexcept {
+		DoublyLinkedList& operator=(DoublyLinkedList&& other) noexcept {
 			if (this != &other) {
 				if (mLength)
 					clear();
+				if (!std::allocator_traits<Allocator>::is_always_equal::value && mAllocator != other.mAllocator) {
+					for (Node* node = other.head; node; node = node->next)
+						append(std::move(node->data));
+					other.clear();
+					return *this;
+				}
 				head = other.head;
 				tail = other.tail;
 				mLength = other.mLength;
@@ -530,7 +462,8 @@ namespace custom {
 		 * @param data - the data to be copied into the end of the list.
 		 */
 		void append(const T& data) noexcept {
-			Node* new_node = new Node(data);
+			tracing::Scope scope(tracing::Operation::Insert);
+			Node* new_node = create_node(data);
 			if (mLength) {
 				++mLength;
 				tail->next = new_node;
@@ -550,7 +483,8 @@ namespace custom {
 		 * @param data - an *r-value reference* to the data to be moved into the end of the list.
 		 */
 		void append(T&& data) noexcept {
-			Node* new_node = new Node(std::move(data));
+			tracing::Scope scope(tracing::Operation::Insert);
+			Node* new_node = create_node(std::move(data));
 			if (mLength) {
 				++mLength;
 				tail->next = new_node;
@@ -603,64 +537,58 @@ namespace custom {
 		 * @param index - an unsigned integer to represent the index of the list to insert into.
 		 */
 		void insert(const T& data, const size_t& index) {
-#ifdef DEBUG
-			if (mLength && index <= mLength) {
-#endif
-				Node* new_node = new Node(data);
-				++mLength;
-				if (index != 0 && index < mLength) {
-					if (index < mLength / 2) {  // Index is closer to the head of the list
-						size_t _index = 1;
-						Node* cur_node = head;
-						Node* last_node;
-						while (true) {
-							last_node = cur_node;
-							cur_node = cur_node->next;
-							if (_index == index) {
-								last_node->next = new_node;
-								new_node->last = last_node;
-								new_node->next = cur_node;
-								cur_node->last = new_node;
-								return;
-							}
-							++_index;
+			tracing::Scope scope(tracing::Operation::Insert);
+			check<std::runtime_error>(mLength != 0, "Linked list is empty and uninitialised, use append instead");
+			check<std::invalid_argument>(index <= mLength, "Invalid index, out of range");
+			Node* new_node = create_node(data);
+			++mLength;
+			if (index != 0 && index + 1 < mLength) {
+				if (index < mLength / 2) {  // Index is closer to the head of the list
+					size_t _index = 1;
+					Node* cur_node = head;
+					Node* last_node;
+					while (true) {
+						last_node = cur_node;
+						cur_node = cur_node->next;
+						if (_index == index) {
+							last_node->next = new_node;
+							new_node->last = last_node;
+							new_node->next = cur_node;
+							cur_node->last = new_node;
+							return;
 						}
-					} else { // Index is closer to the tail of the list
-						size_t _index = mLength - 1;
-						Node* cur_node = tail;
-						Node* next_node;
-						while (true) {
-							next_node = cur_node;
-							cur_node = cur_node->last;
-							if (_index == index) {
-								next_node->last = new_node;
-								new_node->next = next_node;
-								new_node->last = cur_node;
-								cur_node->next = new_node;
-								return;
-							}
-							--_index;
+						++_index;
+					}
+				} else { // Index is closer to the tail of the list
+					size_t _index = mLength - 2;
+					Node* cur_node = tail;
+					Node* next_node;
+					while (true) {
+						next_node = cur_node;
+						cur_node = cur_node->last;
+						if (_index == index) {
+							next_node->last = new_node;
+							new_node->next = next_node;
+							new_node->last = cur_node;
+							cur_node->next = new_node;
+							return;
 						}
+						--_index;
 					}
 				}
-				if (index == 0) {  // Insertion at the beginning
-					new_node->next = head;
-					head->last = new_node;
-					head = new_node;
-					return;
-				}
-				if (index == mLength) {  // Insertion at the end
-					tail->next = new_node;
-					new_node->last = tail;
-					tail = new_node;
-					return;
-				}
-#ifdef DEBUG
 			}
-			if (mLength && index > mLength)
-				throw std::invalid_argument("Invalid index, out of range");
-			throw std::runtime_error("Linked list is empty and uninitialised, use append instead");
-#endif
+			if (index == 0) {  // Insertion at the beginning
+				new_node->next = head;
+				head->last = new_node;
+				head = new_node;
+				return;
+			}
+			if (index + 1 == mLength) {  // Insertion at the end
+				tail->next = new_node;
+				new_node->last = tail;
+				tail = new_node;
+				return;
+			}
 		}
 
 		/**
@@ -674,84 +602,86 @@ namespace custom {
 		 * @param index - an unsigned integer to represent the index of the list to insert into.
 		 */
 		void insert(T&& data, const size_t& index) {
-#ifdef DEBUG
-			if (mLength && index <= mLength) {
-#endif
-				Node* new_node = new Node(std::move(data));
-				++mLength;
-				if (index != 0 && index < mLength) {
-					if (index < mLength / 2) {
-						size_t _index = 1;
-						Node* cur_node = head;
-						Node* last_node;
-						while (true) {
-							last_node = cur_node;
-							cur_node = cur_node->next;
-							if (_index == index) {
-								last_node->next = new_node;
-								new_node->last = last_node;
-								new_node->next = cur_node;
-								cur_node->last = new_node;
-								return;
-							}
-							++_index;
+			tracing::Scope scope(tracing::Operation::Insert);
+			check<std::runtime_error>(mLength != 0, "Linked list is empty and uninitialised, use append instead");
+			check<std::invalid_argument>(index <= mLength, "Invalid index, out of range");
+			Node* new_node = create_node(std::move(data));
+			++mLength;
+			if (index != 0 && index + 1 < mLength) {
+				if (index < mLength / 2) {
+					size_t _index = 1;
+					Node* cur_node = head;
+					Node* last_node;
+					while (true) {
+						last_node = cur_node;
+						cur_node = cur_node->next;
+						if (_index == index) {
+							last_node->next = new_node;
+							new_node->last = last_node;
+							new_node->next = cur_node;
+							cur_node->last = new_node;
+							return;
 						}
-					} else {
-						size_t _index = mLength - 1;
-						Node* cur_node = tail;
-						Node* next_node;
-						while (true) {
-							next_node = cur_node;
-							cur_node = cur_node->last;
-							if (_index == index) {
-								next_node->last = new_node;
-								new_node->next = next_node;
-								new_node->last = cur_node;
-								cur_node->next = new_node;
-								return;
-							}
-							--_index;
+						++_index;
+					}
+				} else {
+					size_t _index = mLength - 2;
+					Node* cur_node = tail;
+					Node* next_node;
+					while (true) {
+						next_node = cur_node;
+						cur_node = cur_node->last;
+						if (_index == index) {
+							next_node->last = new_node;
+							new_node->next = next_node;
+							new_node->last = cur_node;
+							cur_node->next = new_node;
+							return;
 						}
+						--_index;
 					}
 				}
-				if (index == 0) {
-					new_node->next = head;
-					head->last = new_node;
-					head = new_node;
-					return;
-				}
-				if (index == mLength) {
-					tail->next = new_node;
-					new_node->last = tail;
-					tail = new_node;
-					return;
-				}
-#ifdef DEBUG
 			}
-			if (mLength && index > mLength)
-				throw std::invalid_argument("Invalid index, out of range");
-			throw std::runtime_error("Linked list is empty and uninitialised, use append instead");
-#endif
+			if (index == 0) {
+				new_node->next = head;
+				head->last = new_node;
+				head = new_node;
+				return;
+			}
+			if (index + 1 == mLength) {
+				tail->next = new_node;
+				new_node->last = tail;
+				tail = new_node;
+				return;
+			}
 		}
 
 		/**
 		 * Allocates memory for and inserts an element to the beginning of the list, by calling insert() with the
-		 * data forwarded and the index of 0.
+		 * data forwarded and the index of 0, or append() if the list is empty.
 		 * **Time Complexity** = *O(1)*.
 		 * @param data - the data to be copied into a new node at the beginning of the list.
 		 */
 		void push_front(const T& data) {
-			insert(data, 0);
+			tracing::Scope scope(tracing::Operation::Insert);
+			if (mLength)
+				insert(data, 0);
+			else
+				append(data);
 		}
 
 		/**
 		 * Allocates memory for and inserts an element to the beginning of the list, by calling insert() with the
-		 * data forwarded and the index of 0.
+		 * data forwarded and the index of 0, or append() if the list is empty.
 		 * **Time Complexity** = *O(1)*.
 		 * @param data - an *r-value reference* to the data to be moved into a new node at the beginning of the list.
 		 */
 		void push_front(T&& data) {
-			insert(std::move(data), 0);
+			tracing::Scope scope(tracing::Operation::Insert);
+			if (mLength)
+				insert(std::move(data), 0);
+			else
+				append(std::move(data));
 		}
 
 		/**
@@ -761,6 +691,7 @@ namespace custom {
 		 * @see <a href="https://en.cppreference.com/w/cpp/container/vector">std::vector</a>
 		 */
 		std::vector<T> contents() const noexcept {
+			tracing::Scope scope(tracing::Operation::Traversal);
 			std::vector<T> elems(mLength);
 			Node* cur_node = head;
 			for (int i = 0; i < mLength; ++i) {
@@ -780,22 +711,17 @@ namespace custom {
 		 * @return - an integer value representing the index of the node with the data.
 		 */
 		[[nodiscard]] int find(const T& data) const {
-#ifdef DEBUG
-			if (mLength) {
-#endif
-				int index = 0;
-				Node* cur_node = head;
-				while (cur_node) {
-					if (cur_node->data == data)
-						return index;
-					cur_node = cur_node->next;
-					++index;
-				}
-				return -1;
-#ifdef DEBUG
+			tracing::Scope scope(tracing::Operation::Lookup);
+			check<std::runtime_error>(mLength != 0, "Linked list is empty and uninitialized, there is nothing to find.");
+			int index = 0;
+			Node* cur_node = head;
+			while (cur_node) {
+				if (cur_node->data == data)
+					return index;
+				cur_node = cur_node->next;
+				++index;
 			}
-			throw std::runtime_error("Linked list is empty and uninitialized, there is nothing to find.");
-#endif
+			return -1;
 		}
 
 		/**
@@ -807,17 +733,11 @@ namespace custom {
 		 * @see <a href="https://en.cppreference.com/w/cpp/io/cout">std::cout</a>
 		 */
 		void display() const {
-#ifdef DEBUG
-			if (mLength) {
-#endif
-				std::vector<T> vals = contents();
-				for (const T& i: vals)
-					std::cout << i << "\t";
-				std::cout << "\n";
-#ifdef DEBUG
-			} else
-				throw std::runtime_error("Error: Linked list is empty");
-#endif
+			check<std::runtime_error>(mLength != 0, "Error: Linked list is empty");
+			std::vector<T> vals = contents();
+			for (const T& i: vals)
+				std::cout << i << "\t";
+			std::cout << "\n";
 		}
 
 		/**
@@ -838,6 +758,56 @@ namespace custom {
 			return mLength == 0;
 		}
 
+		/**
+		 * Returns a breakdown of the memory held by the list: the data of the elements is the payload, while the pointers
+		 * to the next and previous node, the padding of each node and the list object itself are structural overhead.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - a MemoryUsage object with the bytes of payload, structure and estimated allocator overhead.
+		 */
+		[[nodiscard]] MemoryUsage memory_usage() const noexcept {
+			MemoryUsage usage;
+			usage.structure = sizeof(*this);
+			memory_detail::add_blocks(usage, mLength, sizeof(Node), sizeof(T));
+			return usage;
+		}
+
+		/**
+		 * Serializes the list in the binary format of Serialization.h, from the head to the tail.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the list.
+		 * @param out - the serialization::Writer to append the list to.
+		 */
+		void serialize(serialization::Writer& out) const {
+			out.header<T>(serialization::Kind::DoublyLinkedList, mLength);
+			for (Node* node = head; node; node = node->next)
+				out.value(node->data);
+		}
+
+		/**
+		 * Deserializes a list written by serialize(). If the data does not hold a serialized DoublyLinkedList of `T`, a
+		 * `runtime_error` exception is thrown.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the list.
+		 * @param in - the serialization::Reader to read the list from.
+		 * @return - the list.
+		 */
+		static DoublyLinkedList deserialize(serialization::Reader& in) {
+			size_t count = in.header<T>(serialization::Kind::DoublyLinkedList).count;
+			DoublyLinkedList result;
+			for (size_t i = 0; i < count; ++i)
+				result.append(in.value<T>());
+			return result;
+		}
+
+		/**
+		 * Returns a read-only view of the elements of a list written by serialize(), in place in the data, from the
+		 * head to the tail. Only available for trivially copyable elements.
+		 * **Time Complexity** = *O(1)*.
+		 * @param in - the serialization::Reader to read the list from.
+		 * @return - a span of the elements, valid as long as the data.
+		 */
+		static std::span<const T> view(serialization::Reader& in) requires serialization::Codec<T>::raw {
+			return in.view<T>(in.header<T>(serialization::Kind::DoublyLinkedList).count);
+		}
+
 		/**
 		 * Conversion operator for boolean type. Evaluates to `true` if the size of the list is not 0, otherwise
 		 * it evaluates to `false`.
@@ -856,7 +826,7 @@ namespace custom {
 		 * @param other - a DoublyLinkedList object of the same type `T`, whose data to compare against.
 		 * @return - a boolean value indicating whether the two lists contain the same data.
 		 */
-		[[nodiscard]] bool operator==(const DoublyLinkedList<T>& other) const noexcept {
+		[[nodiscard]] bool operator==(const DoublyLinkedList& other) const noexcept {
 			if (mLength != other.mLength)
 				return false;
 			Node* cur = head;
@@ -878,7 +848,7 @@ namespace custom {
 		 * @param other - a DoublyLinkedList object of the same type `T`, whose data to compare against.
 		 * @return - a boolean value indicating whether the two lists contain different data.
 		 */
-		[[nodiscard]] bool operator!=(const DoublyLinkedList<T>& other) const noexcept {
+		[[nodiscard]] bool operator!=(const DoublyLinkedList& other) const noexcept {
 			return !(*this == other);
 		}
 
@@ -891,58 +861,29 @@ namespace custom {
 		 * @param index - an unsigned integer specifying the index of the element to be removed.
 		 */
 		void erase(const size_t& index) {
-#ifdef DEBUG
-			if (mLength && index < mLength) {
-#endif
-				if (index != 0) {
-					if (index < mLength / 2) {
-						size_t cur_index = 1;
-						Node* cur_node = head;
-						while (true) {
-							Node* last_node = cur_node;
-							cur_node = cur_node->next;
-							if (cur_index == index) {
-								last_node->next = cur_node->next;
-								if (last_node->next == nullptr) {
-									tail = last_node;
-								}
-								delete cur_node;
-								--mLength;
-								return;
-							}
-							++cur_index;
-						}
-					} else {
-						size_t cur_index = mLength - 1;
-						Node* cur_node = tail;
-						while (true) {
-							Node* next_node = cur_node;
-							cur_node = cur_node->last;
-							if (cur_index == index) {
-								next_node->last = cur_node->last;
-								if (next_node->last == nullptr) {
-									head = next_node;
-								}
-								delete cur_node;
-								--mLength;
-								return;
-							}
-							--cur_index;
-						}
-					}
-				} else {
-					Node* head_cpy = head;
-					head = head->next;
-					delete head_cpy;
-					--mLength;
-					return;
-				}
-#ifdef DEBUG
+			tracing::Scope scope(tracing::Operation::Erase);
+			check<std::runtime_error>(mLength != 0, "Error: Linked list is empty, there is nothing to erase");
+			check<std::invalid_argument>(index < mLength, "Invalid index, out of range");
+			Node* cur_node;
+			if (index < mLength / 2) {
+				cur_node = head;
+				for (size_t cur_index = 0; cur_index < index; ++cur_index)
+					cur_node = cur_node->next;
+			} else {
+				cur_node = tail;
+				for (size_t cur_index = mLength - 1; cur_index > index; --cur_index)
+					cur_node = cur_node->last;
 			}
-			if (mLength && index >= mLength)
-				throw std::invalid_argument("Invalid index, out of range");
-			throw std::runtime_error("Error: Linked list is empty, there is nothing to erase");
-#endif
+			if (cur_node->last)
+				cur_node->last->next = cur_node->next;
+			else
+				head = cur_node->next;
+			if (cur_node->next)
+				cur_node->next->last = cur_node->last;
+			else
+				tail = cur_node->last;
+			destroy_node(cur_node);
+			--mLength;
 		}
 
 		/**
@@ -954,7 +895,7 @@ namespace custom {
 			Node* cur_node = head;
 			while (cur_node) {
 				cur_node = cur_node->next;
-				delete head;
+				destroy_node(head);
 				head = cur_node;
 			}
 			head = nullptr;
@@ -970,39 +911,33 @@ namespace custom {
 		 * @param index - an unsigned integer specifying the index of the element whose data to retrieve.
 		 * @return - a reference to the data of the element at the specified index.
 		 */
-		[[nodiscard]] T& get(const size_t& index) {
-#ifdef DEBUG
-			if (index < mLength) {
-#endif
-				if (index == 0)
-					return head->data;
-				if (index == mLength - 1)
-					return tail->data;
-				if (index < mLength / 2) {
-					size_t cur_index = 1;
-					Node* cur_node = head;
-					while (true) {
-						cur_node = cur_node->next;
-						if (cur_index == index)
-							return cur_node->data;
-						++cur_index;
-					}
-				} else {
-					size_t cur_index = mLength - 1;
-					Node* cur_node = tail;
-					while (true) {
-						cur_node = cur_node->last;
-						if (cur_index == index)
-							return cur_node->data;
-						--cur_index;
-					}
+		[[nodiscard]] T& get(const size_t& index) noexcept(!checks_throw) {
+			tracing::Scope scope(tracing::Operation::Lookup);
+			check<std::runtime_error>(mLength != 0, "Linked list is empty and uninitialized, there is nothing to get.");
+			check<std::invalid_argument>(index < mLength, "Invalid index, out of range");
+			if (index == 0)
+				return head->data;
+			if (index == mLength - 1)
+				return tail->data;
+			if (index < mLength / 2) {
+				size_t cur_index = 1;
+				Node* cur_node = head;
+				while (true) {
+					cur_node = cur_node->next;
+					if (cur_index == index)
+						return cur_node->data;
+					++cur_index;
+				}
+			} else {
+				size_t cur_index = mLength - 2;
+				Node* cur_node = tail;
+				while (true) {
+					cur_node = cur_node->last;
+					if (cur_index == index)
+						return cur_node->data;
+					--cur_index;
 				}
-#ifdef DEBUG
 			}
-			if (mLength && index >= mLength)
-				throw std::invalid_argument("Invalid index, out of range");
-			throw std::runtime_error("Linked list is empty and uninitialized, there is nothing to get.");
-#endif
 		}
 
 		/**
@@ -1013,39 +948,33 @@ namespace custom {
 		 * @param index - an unsigned integer specifying the index of the element whose data to retrieve.
 		 * @return - a const reference to the data of the element at the specified index.
 		 */
-		[[nodiscard]] const T& get(const size_t& index) const {
-#ifdef DEBUG
-			if (index < mLength) {
-#endif
-				if (index == 0)
-					return head->data;
-				if (index == mLength - 1)
-					return tail->data;
-				if (index < mLength / 2) {
-					size_t cur_index = 1;
-					Node* cur_node = head;
-					while (true) {
-						cur_node = cur_node->next;
-						if (cur_index == index)
-							return cur_node->data;
-						++cur_index;
-					}
-				} else {
-					size_t cur_index = mLength - 1;
-					Node* cur_node = tail;
-					while (true) {
-						cur_node = cur_node->last;
-						if (cur_index == index)
-							return cur_node->data;
-						--cur_index;
-					}
+		[[nodiscard]] const T& get(const size_t& index) const noexcept(!checks_throw) {
+			tracing::Scope scope(tracing::Operation::Lookup);
+			check<std::runtime_error>(mLength != 0, "Linked list is empty and uninitialized, there is nothing to get.");
+			check<std::invalid_argument>(index < mLength, "Invalid index, out of range");
+			if (index == 0)
+				return head->data;
+			if (index == mLength - 1)
+				return tail->data;
+			if (index < mLength / 2) {
+				size_t cur_index = 1;
+				Node* cur_node = head;
+				while (true) {
+					cur_node = cur_node->next;
+					if (cur_index == index)
+						return cur_node->data;
+					++cur_index;
+				}
+			} else {
+				size_t cur_index = mLength - 2;
+				Node* cur_node = tail;
+				while (true) {
+					cur_node = cur_node->last;
+					if (cur_index == index)
+						return cur_node->data;
+					--cur_index;
 				}
-#ifdef DEBUG
 			}
-			if (mLength && index >= mLength)
-				throw std::invalid_argument("Invalid index, out of range");
-			throw std::runtime_error("Linked list is empty and uninitialized, there is nothing to get.");
-#endif
 		}
 
 		/**
@@ -1054,12 +983,9 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 * @return - a reference of the data of the element at the beginning of the list.
 		 */
-		T& front() {
-#ifdef DEBUG
-			if (mLength)
-#endif
-				return head->data;
-			throw std::runtime_error("List is empty, there is nothing at front");
+		T& front() noexcept(!checks_throw) {
+			check<std::runtime_error>(mLength != 0, "List is empty, there is nothing at front");
+			return head->data;
 		}
 
 		/**
@@ -1068,12 +994,9 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 * @return - a const reference of the data of the element at the beginning of the list.
 		 */
-		const T& front() const {
-#ifdef DEBUG
-			if (mLength)
-#endif
-				return head->data;
-			throw std::runtime_error("List is empty, there is nothing at front");
+		const T& front() const noexcept(!checks_throw) {
+			check<std::runtime_error>(mLength != 0, "List is empty, there is nothing at front");
+			return head->data;
 		}
 
 		/**
@@ -1082,12 +1005,9 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 * @return - a reference of the data of the element at the end of the list.
 		 */
-		T& back() {
-#ifdef DEBUG
-			if (mLength)
-#endif
-				return tail->data;
-			throw std::runtime_error("List is empty, there is nothing at back");
+		T& back() noexcept(!checks_throw) {
+			check<std::runtime_error>(mLength != 0, "List is empty, there is nothing at back");
+			return tail->data;
 		}
 
 		/**
@@ -1096,12 +1016,9 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 * @return - a const reference of the data of the element at the end of the list.
 		 */
-		const T& back() const {
-#ifdef DEBUG
-			if (mLength)
-#endif
-				return tail->data;
-			throw std::runtime_error("List is empty, there is nothing at back");
+		const T& back() const noexcept(!checks_throw) {
+			check<std::runtime_error>(mLength != 0, "List is empty, there is nothing at back");
+			return tail->data;
 		}
 
 		/**
@@ -1109,20 +1026,17 @@ namespace custom {
 		 * member pointer is `nullptr`, a `runtime_error` exception is thrown.
 		 * **Time Complexity** = *O(1)*.
 		 */
-		void pop_front() {
-#ifdef DEBUG
-			if (mLength) {
-#endif
-				Node* temp = head;
-				head = head->next;
-				if (head)
-					head->last = nullptr;
-				delete temp;
-				--mLength;
-#ifdef DEBUG
-			} else
-				throw std::runtime_error("List is empty, there is nothing to pop front");
-#endif
+		void pop_front() noexcept(!checks_throw) {
+			tracing::Scope scope(tracing::Operation::Erase);
+			check<std::runtime_error>(mLength != 0, "List is empty, there is nothing to pop front");
+			Node* temp = head;
+			head = head->next;
+			if (head)
+				head->last = nullptr;
+			else
+				tail = nullptr;
+			destroy_node(temp);
+			--mLength;
 		}
 
 		/**
@@ -1130,20 +1044,17 @@ namespace custom {
 		 * member pointer is `nullptr`, a `runtime_error` exception is thrown.
 		 * **Time Complexity** = *O(1)*.
 		 */
-		void pop_back() {
-#ifdef DEBUG
-			if (mLength) {
-#endif
-				Node* temp = tail;
-				tail = tail->last;
-				if (tail)
-					tail->next = nullptr;
-				delete temp;
-				--mLength;
-#ifdef DEBUG
-			} else
-				throw std::runtime_error("List is empty, there is nothing to pop back");
-#endif
+		void pop_back() noexcept(!checks_throw) {
+			tracing::Scope scope(tracing::Operation::Erase);
+			check<std::runtime_error>(mLength != 0, "List is empty, there is nothing to pop back");
+			Node* temp = tail;
+			tail = tail->last;
+			if (tail)
+				tail->next = nullptr;
+			else
+				head = nullptr;
+			destroy_node(temp);
+			--mLength;
 		}
 
 		/**
@@ -1152,24 +1063,18 @@ namespace custom {
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the list.
 		 */
 		void reverse_order() {
-#ifdef DEBUG
-			if (mLength) {
-#endif
-				Node* temp = nullptr;
-				Node* cur_node = head;
-				tail = head;
-				while (cur_node) {
-					temp = cur_node->last;
-					cur_node->last = cur_node->next;
-					cur_node->next = temp;
-					cur_node = cur_node->last;
-				}
-				if (temp)
-					head = temp->last;
-#ifdef DEBUG
-			} else
-				throw std::runtime_error("Error: linked list is empty and so cannot be reversed");
-#endif
+			check<std::runtime_error>(mLength != 0, "Error: linked list is empty and so cannot be reversed");
+			Node* temp = nullptr;
+			Node* cur_node = head;
+			tail = head;
+			while (cur_node) {
+				temp = cur_node->last;
+				cur_node->last = cur_node->next;
+				cur_node->next = temp;
+				cur_node = cur_node->last;
+			}
+			if (temp)
+				head = temp->last;
 		}
 
 		/**
@@ -1181,7 +1086,7 @@ namespace custom {
 		 * @param index - an unsigned integer specifying the index of the element whose data to retrieve.
 		 * @return - a reference to the data of the element at the specified index.
 		 */
-		[[nodiscard]] T& operator[](const size_t& index) {
+		[[nodiscard]] T& operator[](const size_t& index) noexcept(!checks_throw) {
 			return get(index);
 		}
 
@@ -1194,7 +1099,7 @@ namespace custom {
 		 * @param index - an unsigned integer specifying the index of the element whose data to retrieve.
 		 * @return - a const reference to the data of the element at the specified index.
 		 */
-		[[nodiscard]] const T& operator[](const size_t index) const {
+		[[nodiscard]] const T& operator[](const size_t index) const noexcept(!checks_throw) {
 			return get(index);
 		}
 
@@ -1204,10 +1109,10 @@ namespace custom {
 		 * @param right - s DoublyLinkedList object of type `T` to append to the current list.
 		 * @return - a copy of the current list object.
 		 */
-		[[nodiscard]] DoublyLinkedList<T> operator+(DoublyLinkedList<T>& right) const noexcept {
+		[[nodiscard]] DoublyLinkedList operator+(DoublyLinkedList& right) const noexcept {
 			if (right.mLength) {
 				std::vector<T> right_data = right.contents();
-				DoublyLinkedList<T> res(*this);
+				DoublyLinkedList res(*this);
 				for (const T& i: right_data)
 					res.append(i);
 				return res;
@@ -1221,10 +1126,10 @@ namespace custom {
 		 * @param right - s LinkedList object of type `T` to append to the current list.
 		 * @return - a copy of the current list object.
 		 */
-		[[nodiscard]] DoublyLinkedList<T> operator+(LinkedList<T>& right) const noexcept {
+		[[nodiscard]] DoublyLinkedList operator+(LinkedList<T>& right) const noexcept {
 			if (right.mLength) {
 				std::vector<T> right_data = right.contents();
-				DoublyLinkedList<T> res(*this);
+				DoublyLinkedList res(*this);
 				for (const T& i: right_data)
 					res.append(i);
 				return res;
@@ -1232,6 +1137,15 @@ namespace custom {
 			return *this;
 		}
 
+		/**
+		 * Returns a copy of the allocator the nodes are allocated with.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - the allocator of the list.
+		 */
+		[[nodiscard]] Allocator get_allocator() const noexcept {
+			return mAllocator;
+		}
+
 		/**
 		 * Creates and returns an iterator with the position of the beginning of the list.
 		 * **Time Complexity** = *O(1)*.
@@ -1263,7 +1177,7 @@ namespace custom {
 		/**
 		 * A node structure to contain the data at each element and a pointer to the next and previous nodes in the list.
 		 */
-		struct Node {
+		struct Node : allocation_tracking::TrackedNode<ContainerType::DoublyLinkedList> {
 			T data;  /**< The data of type `T` of each element node. */
 			Node* next = nullptr;  /**< A pointer to the next node object in the list. */
 			Node* last = nullptr;  /**< A pointer to the previous node object in the list. */
@@ -1284,7 +1198,36 @@ namespace custom {
 		Node* head;  /**< A pointer to the first node element of the list. */
 		Node* tail;  /**< A pointer to the last node element of the list.  */
 		size_t mLength;  /**< An unsigned integer specifying the number of elements in the list. */
+		[[no_unique_address]] Allocator mAllocator;  /**< The allocator the nodes are allocated with. */
+
+		/**
+		 * Allocates and constructs a node with the allocator of the list.
+		 * @param data - the data of the node, copied or moved into it.
+		 * @return - a pointer to the new node.
+		 */
+		template<typename Data>
+		Node* create_node(Data&& data) noexcept {
+			return allocation_tracking::create_node<ContainerType::DoublyLinkedList, Node>(mAllocator,
+			                                                                             std::forward<Data>(data));
+		}
+
+		/**
+		 * Destroys and deallocates a node from create_node().
+		 * @param node - a pointer to the node.
+		 */
+		void destroy_node(Node* node) noexcept {
+			allocation_tracking::destroy_node<ContainerType::DoublyLinkedList>(mAllocator, node);
+		}
 	};
+
+	namespace pmr {
+		/**
+		 * A DoublyLinkedList whose nodes are allocated from a `std::pmr::memory_resource`.
+		 * @tparam T - the type of the data to be stored in each node.
+		 */
+		template<typename T>
+		using DoublyLinkedList = custom::DoublyLinkedList<T, std::pmr::polymorphic_allocator<T>>;
+	}// namespace pmr
 }// namespace custom
 
 #endif// DOUBLY_LINKED_LIST_H
\ No newline at end of file
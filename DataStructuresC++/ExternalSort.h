@@ -0,0 +1,481 @@
+#ifndef EXTERNAL_SORT_H
+#define EXTERNAL_SORT_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "SortingAlgorithms.h"
+
+namespace custom {
+	/**
+	 * An enum of the phases of an external sort, as reported to its progress callback.
+	 * **RunGeneration** reads the input one memory budget at a time, sorting each part into a run file.
+	 * **Merge** merges the runs, in several passes if there are more runs than the maximum fan-in.
+	 * **Done** is reported once the sorted output has been written.
+	 */
+	enum class ExternalSortPhase : unsigned int {
+		RunGeneration = 0U,
+		Merge,
+		Done
+	};
+
+	/**
+	 * A snapshot of the progress and counters of an external sort.
+	 */
+	struct ExternalSortStats {
+		ExternalSortPhase phase = ExternalSortPhase::RunGeneration;  /**< The current phase of the sort. */
+		size_t records = 0;  /**< The number of records in the input. */
+		size_t records_done = 0;  /**< The number of records written by the current phase or merge pass. */
+		size_t runs = 0;  /**< The number of sorted runs written by the run generation. */
+		size_t merge_passes = 0;  /**< The number of merge passes started, including the final one. */
+		size_t bytes_read = 0;  /**< The number of bytes read from the input and the run files. */
+		size_t bytes_written = 0;  /**< The number of bytes written to the run files and the output. */
+		double seconds = 0.0;  /**< The time elapsed since the sort started. */
+
+		/**
+		 * Returns the I/O throughput of the sort so far, i.e. the bytes read and written per second.
+		 * @return - a double representing the throughput in bytes per second, 0 before any time has elapsed.
+		 */
+		[[nodiscard]] double throughput() const noexcept {
+			return seconds > 0.0 ? static_cast<double>(bytes_read + bytes_written) / seconds : 0.0;
+		}
+	};
+
+	/**
+	 * Configuration options of an external sort.
+	 */
+	struct ExternalSortOptions {
+		size_t memory_budget = size_t(256) << 20;  /**< The bytes of records held in memory at once. */
+		std::filesystem::path temp_directory = {};  /**< Where run files are created, empty for the system default. */
+		size_t max_fan_in = 64;  /**< The largest number of runs merged at once. */
+		std::function<void(const ExternalSortStats&)> progress = {};  /**< Called as runs and merged blocks are written. */
+	};
+
+	namespace external_detail {
+		// A file read and written in large blocks, with the buffering of the C library turned off
+		class File {
+		public:
+			File(const std::filesystem::path& path, const char* mode) : mPath(path),
+			                                                           mFile(std::fopen(path.string().c_str(), mode)) {
+				if (!mFile)
+					throw std::runtime_error("Error: could not open " + path.string());
+				std::setvbuf(mFile, nullptr, _IONBF, 0);
+			}
+
+			File(const File&) = delete;
+
+			File& operator=(const File&) = delete;
+
+			~File() {
+				if (mFile)
+					std::fclose(mFile);
+			}
+
+			// Reads up to the number of bytes given, returning the number of bytes read, which is only smaller at the
+			// end of the file
+			size_t read(void* data, size_t bytes) {
+				size_t done = std::fread(data, 1, bytes, mFile);
+				if (done < bytes && std::ferror(mFile))
+					throw std::runtime_error("Error: could not read from " + mPath.string());
+				return done;
+			}
+
+			void write(const void* data, size_t bytes) {
+				if (std::fwrite(data, 1, bytes, mFile) != bytes)
+					throw std::runtime_error("Error: could not write to " + mPath.string());
+			}
+
+			void close() {
+				FILE* file = std::exchange(mFile, nullptr);
+				if (std::fclose(file) != 0)
+					throw std::runtime_error("Error: could not write to " + mPath.string());
+			}
+
+		private:
+			std::filesystem::path mPath;
+			FILE* mFile;
+		};
+
+		// A uniquely named directory holding the run files, removed with everything in it on destruction
+		class TempDirectory {
+		public:
+			explicit TempDirectory(const std::filesystem::path& parent) : mCount(0) {
+				std::filesystem::path base = parent.empty() ? std::filesystem::temp_directory_path() : parent;
+				std::random_device device;
+				std::mt19937_64 generator((static_cast<std::uint64_t>(device()) << 32) ^ device());
+				for (int attempt = 0; attempt < 100; ++attempt) {
+					mPath = base / ("custom-external-sort-" + std::to_string(generator()));
+					if (std::filesystem::create_directory(mPath))
+						return;
+				}
+				throw std::runtime_error("Error: could not create a temporary directory in " + base.string());
+			}
+
+			TempDirectory(const TempDirectory&) = delete;
+
+			TempDirectory& operator=(const TempDirectory&) = delete;
+
+			~TempDirectory() {
+				std::error_code error;
+				std::filesystem::remove_all(mPath, error);
+			}
+
+			std::filesystem::path next_run() {
+				return mPath / ("run-" + std::to_string(mCount++));
+			}
+
+		private:
+			std::filesystem::path mPath;
+			size_t mCount;
+		};
+
+		// Reports the progress of a sort, keeping the clock of the stats up to date
+		class Progress {
+		public:
+			explicit Progress(const ExternalSortOptions& options) : mCallback(options.progress),
+			                                                        mStart(std::chrono::steady_clock::now()) {}
+
+			ExternalSortStats stats;
+
+			void report() {
+				stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - mStart).count();
+				if (mCallback)
+					mCallback(stats);
+			}
+
+		private:
+			const std::function<void(const ExternalSortStats&)>& mCallback;
+			std::chrono::steady_clock::time_point mStart;
+		};
+
+		// Reads the records of a run in blocks, reading the next block in the background while the current one is
+		// consumed
+		template<typename T>
+		class RunReader {
+		public:
+			RunReader(const std::filesystem::path& path, size_t block, Progress& progress) :
+					mFile(path, "rb"), mCurrent(block), mNext(block), mPosition(0), mSize(0), mProgress(progress) {
+				mSize = read_block(mCurrent);
+				mProgress.stats.bytes_read += mSize * sizeof(T);
+				if (mSize == mCurrent.size())
+					prefetch();
+			}
+
+			[[nodiscard]] bool empty() const noexcept {
+				return mPosition == mSize;
+			}
+
+			[[nodiscard]] const T& front() const noexcept {
+				return mCurrent[mPosition];
+			}
+
+			void pop() {
+				if (++mPosition == mSize && mSize == mCurrent.size()) {
+					size_t size = mPending.get();
+					mProgress.stats.bytes_read += size * sizeof(T);
+					std::swap(mCurrent, mNext);
+					mPosition = 0;
+					mSize = size;
+					if (mSize == mCurrent.size())
+						prefetch();
+				}
+			}
+
+		private:
+			File mFile;
+			std::vector<T> mCurrent;
+			std::vector<T> mNext;
+			size_t mPosition;
+			size_t mSize;
+			Progress& mProgress;
+			// Declared last so that a pending read is waited for before the buffers and the file are destroyed
+			std::future<size_t> mPending;
+
+			size_t read_block(std::vector<T>& buffer) {
+				size_t bytes = mFile.read(buffer.data(), buffer.size() * sizeof(T));
+				if (bytes % sizeof(T))
+					throw std::runtime_error("Error: run file ends with a partial record");
+				return bytes / sizeof(T);
+			}
+
+			void prefetch() {
+				mPending = std::async(std::launch::async, [this] { return read_block(mNext); });
+			}
+		};
+
+		// Writes records in blocks, writing a full block in the background while the next one is filled
+		template<typename T>
+		class BlockWriter {
+		public:
+			BlockWriter(const std::filesystem::path& path, size_t block, Progress& progress) :
+					mFile(path, "wb"), mCurrent(), mNext(), mProgress(progress) {
+				mCurrent.reserve(block);
+				mNext.reserve(block);
+			}
+
+			void push(const T& record) {
+				mCurrent.push_back(record);
+				if (mCurrent.size() == mCurrent.capacity())
+					flush();
+			}
+
+			// Writes the remaining records and waits for every write to complete
+			void close() {
+				flush();
+				wait();
+				mFile.close();
+			}
+
+		private:
+			File mFile;
+			std::vector<T> mCurrent;
+			std::vector<T> mNext;
+			Progress& mProgress;
+			std::future<void> mPending;
+
+			void wait() {
+				if (mPending.valid())
+					mPending.get();
+			}
+
+			void flush() {
+				if (mCurrent.empty())
+					return;
+				wait();
+				std::swap(mCurrent, mNext);
+				mCurrent.clear();
+				mPending = std::async(std::launch::async, [this] { mFile.write(mNext.data(), mNext.size() * sizeof(T)); });
+				mProgress.stats.records_done += mNext.size();
+				mProgress.stats.bytes_written += mNext.size() * sizeof(T);
+				mProgress.report();
+			}
+		};
+
+		/**
+		 * A tournament tree over the heads of k runs, whose internal nodes hold the loser of the match played there
+		 * and whose root holds the overall winner. Replacing the winner with the next record of its run only replays
+		 * the matches on the path from its leaf to the root, i.e. log2(k) comparisons, against the losers stored
+		 * there, which is half the comparisons of sifting down a binary heap. Exhausted runs lose every match.
+		 */
+		template<typename T, typename Compare>
+		class LoserTree {
+		public:
+			LoserTree(std::deque<RunReader<T>>& runs, Compare& comp) : mRuns(runs), mComp(comp),
+			                                                           mTree(runs.size(), vacant) {
+				const size_t k = mRuns.size();
+				for (size_t leaf = 0; leaf < k; ++leaf) {
+					size_t winner = leaf;
+					size_t node = (leaf + k) / 2;
+					for (; node > 0; node /= 2) {
+						if (mTree[node] == vacant) {
+							mTree[node] = winner;
+							break;
+						}
+						if (beats(mTree[node], winner))
+							std::swap(mTree[node], winner);
+					}
+					if (node == 0)
+						mTree[0] = winner;
+				}
+			}
+
+			[[nodiscard]] bool empty() const noexcept {
+				return mRuns[mTree[0]].empty();
+			}
+
+			[[nodiscard]] const T& top() const noexcept {
+				return mRuns[mTree[0]].front();
+			}
+
+			void pop() {
+				size_t winner = mTree[0];
+				mRuns[winner].pop();
+				for (size_t node = (winner + mRuns.size()) / 2; node > 0; node /= 2)
+					if (beats(mTree[node], winner))
+						std::swap(mTree[node], winner);
+				mTree[0] = winner;
+			}
+
+		private:
+			static constexpr size_t vacant = static_cast<size_t>(-1);
+
+			std::deque<RunReader<T>>& mRuns;
+			Compare& mComp;
+			std::vector<size_t> mTree;
+
+			// Whether the head of the first run comes before the head of the second, ties going to the earlier run
+			bool beats(size_t a, size_t b) const {
+				if (mRuns[a].empty())
+					return false;
+				if (mRuns[b].empty())
+					return true;
+				if (mComp(mRuns[a].front(), mRuns[b].front()))
+					return true;
+				return !mComp(mRuns[b].front(), mRuns[a].front()) && a < b;
+			}
+		};
+
+		template<typename T, typename Compare>
+		void merge_runs(const std::vector<std::filesystem::path>& runs, const std::filesystem::path& output,
+		                Compare& comp, size_t budget, Progress& progress) {
+			// Every run and the output are double buffered
+			size_t block = std::max<size_t>(1, budget / (2 * (runs.size() + 1)) / sizeof(T));
+			// Readers are never moved, as their background reads refer to them
+			std::deque<RunReader<T>> readers;
+			for (const std::filesystem::path& run: runs)
+				readers.emplace_back(run, block, progress);
+			BlockWriter<T> writer(output, block, progress);
+			LoserTree<T, Compare> tree(readers, comp);
+			while (!tree.empty()) {
+				writer.push(tree.top());
+				tree.pop();
+			}
+			writer.close();
+		}
+	}
+
+	/**
+	 * Sorts a binary file of fixed-size records which may be larger than the memory available, writing the sorted
+	 * records to another file, which may be the input file itself.
+	 *
+	 * The input is read one memory budget at a time, half of it holding the records being sorted with pdq_sort while
+	 * the other half is filled by reading the next part of the input in the background. Each sorted part is written to
+	 * a run file in a temporary directory. The runs are then merged through a loser tree, up to the maximum fan-in at
+	 * a time, in as many passes as needed to leave a single run, the last pass writing to the output. The memory
+	 * budget is split into a pair of blocks for each run being merged and for the output, so every file is accessed
+	 * sequentially in large blocks, with the next block of each run read and the last block of the output written in
+	 * the background while the merge goes on. An input which fits in the memory budget is sorted in memory without any
+	 * run file. The sort is not stable.
+	 *
+	 * \note
+	 * The records are read and written with their in-memory representation, so the files are only portable between
+	 * machines with the same layout of the record type. The temporary directory is removed when the sort ends, even if
+	 * it throws. A failure to open, read or write a file throws a `runtime_error`, an input whose size is not a
+	 * multiple of the record size throws an `invalid_argument`.
+	 *
+	 * **Time Complexity** = *O(n log n)* comparisons, and *O(n (1 + log_k(n / m)))* records read and written where k
+	 * is the maximum fan-in and m is the number of records fitting in half the memory budget.
+	 * @tparam T - the type of the records, which must be trivially copyable and default constructible.
+	 * @tparam Compare - the type of the comparison object, returning `true` if its first argument should come first.
+	 * @tparam Projection - the type of the projection applied to the records before they are compared.
+	 * @param input - the path of the file to sort.
+	 * @param output - the path of the file the sorted records are written to, replaced if it exists.
+	 * @param options - the memory budget, temporary directory, maximum fan-in and progress callback of the sort.
+	 * @param comp - the comparison object, defaults to `std::less<>` which sorts in ascending order.
+	 * @param proj - the projection, e.g. a pointer to a member to sort by, defaults to the record itself.
+	 * @return - the final stats of the sort.
+	 * @see <a href="https://en.wikipedia.org/wiki/External_sorting">External sorting</a>
+	 */
+	template<typename T, typename Compare = std::less<>, typename Projection = std::identity>
+	requires std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+	ExternalSortStats external_sort(const std::filesystem::path& input, const std::filesystem::path& output,
+	                                const ExternalSortOptions& options = {}, Compare comp = {}, Projection proj = {}) {
+		using namespace external_detail;
+		if (options.max_fan_in < 2)
+			throw std::invalid_argument("Error: the maximum fan-in of an external sort must be at least 2");
+		const size_t input_bytes = std::filesystem::file_size(input);
+		if (input_bytes % sizeof(T))
+			throw std::invalid_argument("Error: the size of " + input.string() + " is not a multiple of the record size");
+
+		auto&& compare = sort_detail::projected(comp, proj);
+		Progress progress(options);
+		progress.stats.records = input_bytes / sizeof(T);
+
+		// Run generation, reading the next part of the input while the current one is sorted and written
+		const size_t chunk = std::max<size_t>(1, options.memory_budget / 2 / sizeof(T));
+		std::vector<T> current(std::min(chunk, std::max<size_t>(1, progress.stats.records)));
+		std::vector<T> next;
+		std::vector<std::filesystem::path> runs;
+		std::optional<TempDirectory> directory;
+		{
+			File file(input, "rb");
+			auto read = [&file](std::vector<T>& buffer) {
+				return file.read(buffer.data(), buffer.size() * sizeof(T)) / sizeof(T);
+			};
+			size_t size = read(current);
+			progress.stats.bytes_read += size * sizeof(T);
+			if (size == progress.stats.records) {
+				// The whole input fits in memory
+				file.close();
+				auto begin = sort_detail::unwrap(current.begin());
+				sort_detail::pdq_sort(begin, begin + static_cast<std::ptrdiff_t>(size), compare);
+				File out(output, "wb");
+				out.write(current.data(), size * sizeof(T));
+				out.close();
+				progress.stats.records_done = size;
+				progress.stats.bytes_written += size * sizeof(T);
+				progress.stats.phase = ExternalSortPhase::Done;
+				progress.report();
+				return progress.stats;
+			}
+
+			directory.emplace(options.temp_directory);
+			next.resize(chunk);
+			while (size > 0) {
+				std::future<size_t> pending = std::async(std::launch::async, [&read, &next] { return read(next); });
+				try {
+					auto begin = sort_detail::unwrap(current.begin());
+					sort_detail::pdq_sort(begin, begin + static_cast<std::ptrdiff_t>(size), compare);
+					runs.push_back(directory->next_run());
+					File run(runs.back(), "wb");
+					run.write(current.data(), size * sizeof(T));
+					run.close();
+				} catch (...) {
+					pending.wait();
+					throw;
+				}
+				progress.stats.records_done += size;
+				progress.stats.bytes_written += size * sizeof(T);
+				progress.stats.runs = runs.size();
+				progress.report();
+				size = pending.get();
+				progress.stats.bytes_read += size * sizeof(T);
+				std::swap(current, next);
+			}
+		}
+		std::vector<T>().swap(current);
+		std::vector<T>().swap(next);
+
+		// Merge passes, each one merging groups of up to the maximum fan-in runs, until a single group is left
+		progress.stats.phase = ExternalSortPhase::Merge;
+		while (true) {
+			++progress.stats.merge_passes;
+			progress.stats.records_done = 0;
+			if (runs.size() <= options.max_fan_in) {
+				merge_runs<T>(runs, output, compare, options.memory_budget, progress);
+				break;
+			}
+			std::vector<std::filesystem::path> merged;
+			for (size_t first = 0; first < runs.size(); first += options.max_fan_in) {
+				std::vector<std::filesystem::path> group(runs.begin() + static_cast<std::ptrdiff_t>(first),
+				                                         runs.begin() + static_cast<std::ptrdiff_t>(
+						                                         std::min(first + options.max_fan_in, runs.size())));
+				merged.push_back(directory->next_run());
+				merge_runs<T>(group, merged.back(), compare, options.memory_budget, progress);
+				for (const std::filesystem::path& run: group)
+					std::filesystem::remove(run);
+			}
+			runs = std::move(merged);
+		}
+		progress.stats.phase = ExternalSortPhase::Done;
+		progress.report();
+		return progress.stats;
+	}
+}// namespace custom
+
+#endif// EXTERNAL_SORT_H
@@ -0,0 +1,389 @@
+#ifndef DATA_STRUCTURES_CPP_FIXEDVECTOR_H
+#define DATA_STRUCTURES_CPP_FIXEDVECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "Checking.h"
+#include "MemoryUsage.h"
+#include "Serialization.h"
+#include "Vector.h"
+
+namespace custom {
+	/**
+	 * A templated vector class with a fixed capacity, whose elements are stored in the object itself rather than in
+	 * an array on the heap. It never allocates, so it can be built, modified and read in constant expressions, and a
+	 * `constexpr` FixedVector is placed in the read-only data of the program. The slots past the last element hold
+	 * value-initialised objects, so `T` must be default constructible, and removed elements are reset to `T()`.
+	 * A FixedVector is serialized in the same format as a Vector, so either can read the data of the other.
+	 * @tparam T - the type of the object to be stored in the vector.
+	 * @tparam max_size - an unsigned integer representing the capacity of the vector.
+	 */
+	template<typename T, size_t max_size>
+	class FixedVector {
+	public:
+		using Type = T;  /**< An alias for the type of data `T` to be used by external utility classes. */
+		using Iterator = VectorIterator<FixedVector>;  /**< An alias for the vector iterator class. */
+
+		friend class VectorIterator<FixedVector>;  /**< Friend vector iterator class, allowing it to access private members. */
+
+	public:
+		/**
+		 * Default FixedVector constructor which initialises an empty vector.
+		 */
+		constexpr FixedVector() noexcept : data{}, mSize{0} {}
+
+		/**
+		 * Overloaded initializer list constructor which adds the elements of the initializer list to the vector, in
+		 * order. If the initializer list has more elements than the capacity of the vector, a `length_error`
+		 * exception is thrown, which fails the compilation in a constant expression.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the initialiser list.
+		 * @param init - the initialiser list whose contents will be added to the vector.
+		 * @see <a href="https://en.cppreference.com/w/cpp/utility/initializer_list">std::initializer_list</a>
+		 */
+		constexpr FixedVector(std::initializer_list<T> init) noexcept(!checks_throw) : data{}, mSize{0} {
+			check<std::length_error>(init.size() <= max_size, "Too many elements for the capacity of the FixedVector");
+			for (const T& value: init)
+				data[mSize++] = value;
+		}
+
+		/**
+		 * FixedVector copy constructor, which copies the elements of another vector into this vector.
+		 * **Time Complexity** = *O(n)* where n is the capacity of the vector.
+		 * @param other - a FixedVector object of the same type to be copied.
+		 */
+		constexpr FixedVector(const FixedVector& other) = default;
+
+		/**
+		 * Copy assignment operator which copies another vector's elements into the current vector.
+		 * **Time Complexity** = *O(n)* where n is the capacity of the vector.
+		 * @param other - the FixedVector object to copy from.
+		 * @return - a reference to the current vector.
+		 */
+		constexpr FixedVector& operator=(const FixedVector& other) = default;
+
+		/**
+		 * FixedVector move constructor, which moves the elements of another vector into this vector and leaves the
+		 * other vector empty.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the other vector.
+		 * @param other - an `r-value reference` to the vector to be moved.
+		 */
+		constexpr FixedVector(FixedVector&& other) noexcept : data{}, mSize{0} {
+			*this = std::move(other);
+		}
+
+		/**
+		 * Move assignment operator which moves another vector's elements into the current vector and leaves the
+		 * other vector empty.
+		 * \note
+		 * If the current object, that is being moved into, is not empty, **it will be cleared**.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in both vectors.
+		 * @param other - an `r-value reference` to the vector to be moved.
+		 * @return - a reference to the current vector.
+		 */
+		constexpr FixedVector& operator=(FixedVector&& other) noexcept {
+			if (this != &other) {
+				clear();
+				for (size_t i = 0; i < other.mSize; ++i)
+					data[i] = std::move(other.data[i]);
+				mSize = other.mSize;
+				other.clear();
+			}
+			return *this;
+		}
+
+		/**
+		 * Copies an element to the end of the vector. If the vector is full, a `length_error` exception is thrown, or
+		 * the program is terminated if the library is built with the assert-only checking policy.
+		 * **Time Complexity** = *O(1)*.
+		 * @param value - an element of the type `T` to be added to the end of the vector.
+		 */
+		constexpr void push_back(const T& value) noexcept(!checks_throw) {
+			check<std::length_error>(mSize < max_size, "FixedVector is full, cannot add another element.");
+			data[mSize++] = value;
+		}
+
+		/**
+		 * Moves an element to the end of the vector. If the vector is full, a `length_error` exception is thrown, or
+		 * the program is terminated if the library is built with the assert-only checking policy.
+		 * **Time Complexity** = *O(1)*.
+		 * @param value - an *r-value reference* to move to the end of the vector.
+		 */
+		constexpr void push_back(T&& value) noexcept(!checks_throw) {
+			check<std::length_error>(mSize < max_size, "FixedVector is full, cannot add another element.");
+			data[mSize++] = std::move(value);
+		}
+
+		/**
+		 * Constructs an element of type `T` from the arguments provided and moves it to the end of the vector. If
+		 * the vector is full, a `length_error` exception is thrown, or the program is terminated if the library is
+		 * built with the assert-only checking policy.
+		 * **Time Complexity** = *O(1)*.
+		 * @tparam Ts - dummy template parameters to hold the arguments for the object constructor.
+		 * @param args - the arguments to be forwarded to the object of type `T`'s constructor.
+		 * @return - a reference to the element added.
+		 */
+		template<typename... Ts>
+		constexpr T& emplace_back(Ts&& ... args) noexcept(!checks_throw) {
+			check<std::length_error>(mSize < max_size, "FixedVector is full, cannot add another element.");
+			data[mSize] = T(std::forward<Ts>(args)...);
+			return data[mSize++];
+		}
+
+		/**
+		 * Removes the element at the end of the vector, resetting it to `T()`. If the vector is empty, a
+		 * `runtime_error` exception is thrown.
+		 * **Time Complexity** = *O(1)*.
+		 */
+		constexpr void pop_back() {
+			check<std::runtime_error>(mSize != 0, "FixedVector is empty, there is nothing to pop.");
+			data[--mSize] = T();
+		}
+
+		/**
+		 * Returns a reference to the element at the beginning of the vector. If the vector is empty, a
+		 * `runtime_error` exception is thrown.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - a reference to the object of type `T` at the beginning of the vector.
+		 */
+		constexpr T& front() noexcept(!checks_throw) {
+			check<std::runtime_error>(mSize != 0, "FixedVector is empty, there is nothing at the front.");
+			return data[0];
+		}
+
+		/**
+		 * Returns a const reference to the element at the beginning of the vector. If the vector is empty, a
+		 * `runtime_error` exception is thrown.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - a const reference to the object of type `T` at the beginning of the vector.
+		 */
+		constexpr const T& front() const noexcept(!checks_throw) {
+			check<std::runtime_error>(mSize != 0, "FixedVector is empty, there is nothing at the front.");
+			return data[0];
+		}
+
+		/**
+		 * Returns a reference to the element at the end of the vector. If the vector is empty, a `runtime_error`
+		 * exception is thrown.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - a reference to the object of type `T` at the end of the vector.
+		 */
+		constexpr T& back() noexcept(!checks_throw) {
+			check<std::runtime_error>(mSize != 0, "FixedVector is empty, there is nothing at the back");
+			return data[mSize - 1];
+		}
+
+		/**
+		 * Returns a const reference to the element at the end of the vector. If the vector is empty, a
+		 * `runtime_error` exception is thrown.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - a const reference to the object of type `T` at the end of the vector.
+		 */
+		constexpr const T& back() const noexcept(!checks_throw) {
+			check<std::runtime_error>(mSize != 0, "FixedVector is empty, there is nothing at the back");
+			return data[mSize - 1];
+		}
+
+		/**
+		 * Square bracket operator which allows for access to the element at the specified index in the vector. If
+		 * the index is not that of an element, an `out_of_range` exception is thrown, or the program is terminated
+		 * if the library is built with the assert-only checking policy.
+		 * **Time Complexity** = *O(1)*.
+		 * @param index - an unsigned integer representing the index of the element to access.
+		 * @return - a reference to the data at the specified index.
+		 */
+		[[nodiscard]] constexpr T& operator[](const size_t& index) noexcept(!checks_throw) {
+			check<std::out_of_range>(index < mSize, "Invalid index, out of range");
+			return data[index];
+		}
+
+		/**
+		 * Square bracket operator which allows for access to the element at the specified index in the vector. If
+		 * the index is not that of an element, an `out_of_range` exception is thrown, or the program is terminated
+		 * if the library is built with the assert-only checking policy.
+		 * **Time Complexity** = *O(1)*.
+		 * @param index - an unsigned integer representing the index of the element to access.
+		 * @return - a const reference to the data at the specified index.
+		 */
+		[[nodiscard]] constexpr const T& operator[](const size_t& index) const noexcept(!checks_throw) {
+			check<std::out_of_range>(index < mSize, "Invalid index, out of range");
+			return data[index];
+		}
+
+		/**
+		 * Equivalence operator which compares two vectors, element-wise, and returns a boolean value indicating
+		 * whether the two objects contain the same data.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the vectors.
+		 * @param other - a FixedVector object of the same type, whose data to compare against.
+		 * @return - a boolean value indicating whether the two vectors contain the same data.
+		 */
+		constexpr bool operator==(const FixedVector& other) const noexcept {
+			if (mSize != other.mSize)
+				return false;
+			for (size_t i = 0; i < mSize; ++i) {
+				if (data[i] != other.data[i])
+					return false;
+			}
+			return true;
+		}
+
+		/**
+		 * Not-equivalence operator which compares two vectors, element-wise, and returns a boolean value indicating
+		 * whether the two objects contain different data.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the vectors.
+		 * @param other - a FixedVector object of the same type, whose data to compare against.
+		 * @return - a boolean value indicating whether the two vectors contain different data.
+		 */
+		constexpr bool operator!=(const FixedVector& other) const noexcept {
+			return !(*this == other);
+		}
+
+		/**
+		 * Conversion operator for boolean type. Evaluates to `true` if the vector is not empty, otherwise it
+		 * evaluates to `false`.
+		 * @return - the boolean value of whether the vector has elements.
+		 */
+		constexpr explicit operator bool() const noexcept {
+			return mSize != 0;
+		}
+
+		/**
+		 * Returns the number of elements in the vector.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - an unsigned integer representing the number of elements in the vector.
+		 */
+		[[nodiscard]] constexpr size_t size() const noexcept {
+			return mSize;
+		}
+
+		/**
+		 * Returns the number of elements the vector can hold.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - the capacity of the vector, `max_size`.
+		 */
+		[[nodiscard]] static constexpr size_t capacity() noexcept {
+			return max_size;
+		}
+
+		/**
+		 * Returns a boolean value that indicates whether the vector is empty.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - a boolean value that indicates whether the vector is empty.
+		 */
+		[[nodiscard]] constexpr bool empty() const noexcept {
+			return mSize == 0;
+		}
+
+		/**
+		 * Returns a boolean value that indicates whether the vector is at its capacity.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - a boolean value that indicates whether another element can not be added.
+		 */
+		[[nodiscard]] constexpr bool full() const noexcept {
+			return mSize == max_size;
+		}
+
+		/**
+		 * Removes every element of the vector, resetting them to `T()`.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the vector.
+		 */
+		constexpr void clear() noexcept {
+			for (size_t i = 0; i < mSize; ++i)
+				data[i] = T();
+			mSize = 0;
+		}
+
+		/**
+		 * Returns a breakdown of the memory held by the vector: the elements are the payload, while the unused slots
+		 * and the size are structural overhead. The vector never allocates.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - a MemoryUsage object with the bytes of payload and structure.
+		 */
+		[[nodiscard]] constexpr MemoryUsage memory_usage() const noexcept {
+			MemoryUsage usage;
+			usage.payload = mSize * sizeof(T);
+			usage.structure = sizeof(*this) - usage.payload;
+			return usage;
+		}
+
+		/**
+		 * Serializes the vector in the binary format of Serialization.h, as a Vector, copying the elements in one
+		 * block if they are trivially copyable.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the vector.
+		 * @param out - the serialization::Writer to append the vector to.
+		 */
+		void serialize(serialization::Writer& out) const {
+			out.header<T>(serialization::Kind::Vector, mSize);
+			out.values(data, mSize);
+		}
+
+		/**
+		 * Deserializes a vector written by serialize(), or by Vector::serialize(). If the data does not hold a
+		 * serialized Vector of `T` with at most `max_size` elements, a `runtime_error` exception is thrown.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the vector.
+		 * @param in - the serialization::Reader to read the vector from.
+		 * @return - the vector.
+		 */
+		static FixedVector deserialize(serialization::Reader& in) {
+			size_t count = in.header<T>(serialization::Kind::Vector).count;
+			if (count > max_size)
+				throw std::runtime_error("Error: the serialized Vector has " + std::to_string(count) +
+				                         " elements, more than the capacity of " + std::to_string(max_size));
+			FixedVector result;
+			if constexpr (serialization::Codec<T>::raw)
+				in.values(result.data, count);
+			else {
+				for (size_t i = 0; i < count; ++i)
+					result.data[i] = in.value<T>();
+			}
+			result.mSize = count;
+			return result;
+		}
+
+		/**
+		 * Returns a read-only view of the elements of a vector written by serialize(), in place in the data. Only
+		 * available for trivially copyable elements.
+		 * **Time Complexity** = *O(1)*.
+		 * @param in - the serialization::Reader to read the vector from.
+		 * @return - a span of the elements, valid as long as the data.
+		 */
+		static std::span<const T> view(serialization::Reader& in) requires serialization::Codec<T>::raw {
+			return in.view<T>(in.header<T>(serialization::Kind::Vector).count);
+		}
+
+		/**
+		 * Creates and returns an iterator with the position of the beginning of the vector.
+		 * @return - a VectorIterator object with the position of the beginning element of the vector.
+		 */
+		constexpr Iterator begin() const noexcept {
+			return Iterator(elements(), elements(), elements() + mSize);
+		}
+
+		/**
+		 * Creates and returns an iterator with the position past the end of the vector.
+		 * @return - a VectorIterator object with the position past the ending element of the vector.
+		 */
+		constexpr Iterator end() const noexcept {
+			return Iterator(elements() + mSize, elements(), elements() + mSize);
+		}
+
+	private:
+		T data[max_size];  /**< The slots of the vector, of which the first `mSize` hold its elements. */
+		size_t mSize;  /**< An unsigned integer representing the number of elements in the vector. */
+
+		/**
+		 * Returns a pointer to the first element for the iterators, which, as for the Vector, can modify the elements
+		 * of a const vector.
+		 * @return - a pointer to the beginning of the vector.
+		 */
+		constexpr T* elements() const noexcept {
+			return const_cast<T*>(data);
+		}
+	};
+}
+
+#endif//DATA_STRUCTURES_CPP_FIXEDVECTOR_H
@@ -2,12 +2,23 @@
 #define GRAPH_H
 
 #include <algorithm>
+#include <cstdint>
 #include <deque>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <stack>
+#include <stdexcept>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "AllocationTracking.h"
+#include "Checking.h"
+#include "MemoryUsage.h"
+#include "Serialization.h"
+#include "Tracing.h"
+
 namespace custom {
 	/**
 	 * A template implementation of a graph data structure. Each node element has an ID with the type `ID_Type`
@@ -17,16 +28,27 @@ namespace custom {
 	 * implementation uses an adjacency list to store the nodes and their connections.
 	 * @tparam T - the type of the data of each node in the graph.
 	 * @tparam ID_Type - the type of the ID used to identify each node in the graph.
+	 * @tparam Allocator - the allocator the nodes, the node list and the adjacency list are allocated with,
+	 * `std::allocator` by default, see pmr::Graph.
 	 * @see <a href="https://en.wikipedia.org/wiki/Graph_(abstract_data_type)">Graph data structure</a>
 	 */
-	template<typename T, typename ID_Type>
+	template<typename T, typename ID_Type, typename Allocator = std::allocator<T>>
 	class Graph {
 	public:
+		using allocator_type = Allocator;  /**< An alias for the allocator the graph is allocated with. */
+
 		/**
 		 * Default Graph constructor which initializes an empty adjacency list, node list and sets the node number to 0.
 		 */
 		Graph() noexcept: adj_list({}), node_list({}), node_num(0) {}
 
+		/**
+		 * Overloaded Graph constructor which initializes an empty graph whose nodes, node list and adjacency list will
+		 * be allocated with the allocator provided.
+		 * @param allocator - the allocator to allocate the graph with.
+		 */
+		explicit Graph(const Allocator& allocator) noexcept: adj_list(allocator), node_list(allocator), node_num(0) {}
+
 		/**
 		 * Overloaded Graph constructor which allocates memory for a node with the ID and data provided and adds
 		 * the node to the adjacency and node lists.
@@ -34,9 +56,9 @@ namespace custom {
 		 * @param id - ID of type `ID_Type`, to be copied into the node and used to identify the node.
 		 */
 		explicit Graph(const T& data, const ID_Type& id) noexcept: node_num(1) {
-			Node* new_node = new Node(data, id);
+			Node* new_node = create_node(data, id);
 			node_list.push_back(new_node);
-			adj_list.push_back(std::vector<Node*> {new_node});
+			adj_list.emplace_back(1, new_node);
 		}
 
 		/**
@@ -46,24 +68,26 @@ namespace custom {
 		 * @param id - an *r-value reference* to the ID of type `ID_Type`, to be moved into the node and used to identify the node.
 		 */
 		explicit Graph(T&& data, ID_Type&& id) noexcept: node_num(1) {
-			Node* new_node = new Node(std::move(data), std::move(id));
+			Node* new_node = create_node(std::move(data), std::move(id));
 			node_list.push_back(new_node);
-			adj_list.push_back(std::vector<Node*> {new_node});
+			adj_list.emplace_back(1, new_node);
 		}
 
 		/**
 		 * Copy constructor for a Graph which will perform a deep copy, element-wise, of another Graph
-		 * object of the same types `T` and `ID_Type`, including its edges.
+		 * object of the same types `T` and `ID_Type`, including its edges, with the allocator the allocator of the
+		 * other graph selects for a copy.
 		 * **Time Complexity** = *O(n)* where n is the number of nodes in the other graph.
 		 * @param other - another Graph object of the same types `T` and `ID_Type` to be copied.
 		 */
-		Graph(const Graph<T, ID_Type>& other) noexcept {
+		Graph(const Graph& other) noexcept: Graph(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+				other.get_allocator())) {
 			node_list = {};
 			adj_list = {};
 			node_num = 0;
 			for (Node*& node: other.node_list)
 				add_node(node->data);
-			for (std::vector<Node*> link: other.adj_list) {
+			for (const Links& link: other.adj_list) {
 				ID_Type first = link[0]->id;
 				for (int i = 1; i < link.size(); ++i) {
 					Node* last_node = nullptr;
@@ -86,7 +110,7 @@ namespace custom {
 
 		/**
 		 * Copy assignment operator for the Graph which will copy another Graph object of the same types
-		 * `T` and `ID_Type` into the current object, including its edges.
+		 * `T` and `ID_Type` into the current object, including its edges. The current object keeps its allocator.
 		 * \note
 		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
 		 * **Time Complexity** = *O(n)* where n is the number of nodes in the other graph + the number of nodes
@@ -94,7 +118,7 @@ namespace custom {
 		 * @param other - another Graph object of the same types `T` and `ID_Type` to be copied.
 		 * @return - a reference to the current object.
 		 */
-		Graph<T, ID_Type>& operator=(const Graph<T, ID_Type>& other) noexcept {
+		Graph& operator=(const Graph& other) noexcept {
 			if (this != &other) {
 				if (node_num)
 					clear();
@@ -103,7 +127,7 @@ namespace custom {
 				node_num = 0;
 				for (Node*& node: other.node_list)
 					add_node(node->data);
-				for (std::vector<Node*> link: other.adj_list) {
+				for (const Links& link: other.adj_list) {
 					ID_Type first = link[0]->id;
 					for (int i = 1; i < link.size(); ++i)
 						add_edge(first, link[i]->id);
@@ -114,14 +138,13 @@ namespace custom {
 
 		/**
 		 * Move constructor for a Graph which will take the data from another Graph object of the same types
-		 * `T` and `ID_Type` and set the other object to its default state of not have any data.
+		 * `T` and `ID_Type`, along with its allocator, and set the other object to its default state of not have any
+		 * data.
 		 * **Time Complexity** = *O(1)*.
 		 * @param other - an *r-value reference* to a Graph object of types `T` and `ID_Type` to be moved.
 		 */
-		Graph(Graph<T, ID_Type>&& other) noexcept {
-			node_list = other.node_list;
-			adj_list = other.adj_list;
-			node_num = other.node_num;
+		Graph(Graph&& other) noexcept: adj_list(std::move(other.adj_list)), node_list(std::move(other.node_list)),
+		                               node_num(other.node_num) {
 			other.node_num = 0;
 			other.node_list.clear();
 			other.adj_list.clear();
@@ -129,24 +152,16 @@ namespace custom {
 
 		/**
 		 * Move assignment operator for the Graph which will move another Graph object of types `T` and `ID_Type` into
-		 * the current object.
+		 * the current object, which keeps its allocator, see take().
 		 * \note
 		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
-		 * **Time Complexity** = *O(1)*.
+		 * **Time Complexity** = *O(1)*, or *O(n + e)* if the allocators differ.
 		 * @param other - an *r-value reference* to a Graph object of types `T` and `ID_Type` to be moved.
 		 * @return - a reference to the current object.
 		 */
-		Graph<T, ID_Type>& operator=(Graph<T, ID_Type>&& other) noexcept {
-			if (this != &other) {
-				if (node_num)
-					clear();
-				node_list = other.node_list;
-				adj_list = other.adj_list;
-				node_num = other.node_num;
-				other.node_num = 0;
-				other.node_list.clear();
-				other.adj_list.clear();
-			}
+		Graph& operator=(Graph&& other) noexcept {
+			if (this != &other)
+				take(other);
 			return *this;
 		}
 
@@ -157,10 +172,11 @@ namespace custom {
 		 * @param id - ID of type `ID_Type`, to be copied into the node and used to identify the node.
 		 */
 		void add_node(const T& data, const ID_Type& id) noexcept {
-			Node* new_node = new Node(data, id);
+			tracing::Scope scope(tracing::Operation::Insert);
+			Node* new_node = create_node(data, id);
 			++node_num;
 			node_list.push_back(new_node);
-			adj_list.push_back(std::vector<Node*> {new_node});
+			adj_list.emplace_back(1, new_node);
 		}
 
 		/**
@@ -170,10 +186,11 @@ namespace custom {
 		 * @param id - an *r-value reference* to the ID of type `ID_Type`, to be moved into the node and used to identify the node.
 		 */
 		void add_node(T&& data, ID_Type&& id) noexcept {
-			Node* new_node = new Node(std::move(data), std::move(id));
+			tracing::Scope scope(tracing::Operation::Insert);
+			Node* new_node = create_node(std::move(data), std::move(id));
 			++node_num;
 			node_list.push_back(new_node);
-			adj_list.push_back(std::vector<Node*> {new_node});
+			adj_list.emplace_back(1, new_node);
 		}
 
 		/**
@@ -184,10 +201,11 @@ namespace custom {
 		 * @param next - the ID of type `ID_Type` of the second node.
 		 */
 		virtual void add_edge(const ID_Type& last, const ID_Type& next) {
+			tracing::Scope scope(tracing::Operation::Insert);
 			Node* last_node = nullptr;
 			Node* next_node = nullptr;
-			int last_index;
-			int next_index;
+			int last_index = -1;
+			int next_index = -1;
 			for (int i = 0; i < node_list.size(); ++i) {
 				if (node_list[i]->id == last) {
 					last_node = node_list[i];
@@ -197,11 +215,10 @@ namespace custom {
 					next_index = i;
 				}
 			}
-			if (last_node && next_node) {
-				adj_list[last_index].push_back(next_node);
-				adj_list[next_index].push_back(last_node);
-			} else
+			if (!last_node || !next_node)
 				throw std::runtime_error("Invalid node IDs, cannot add edge");
+			adj_list[last_index].push_back(next_node);
+			adj_list[next_index].push_back(last_node);
 		}
 
 		/**
@@ -212,13 +229,10 @@ namespace custom {
 		 * @param data - the data of type `T` to change the node's data to.
 		 */
 		void change(const ID_Type& id, const T& data) {
-			for (Node*& node: node_list) {
-				if (node->id == id) {
-					node->data = data;
-					return;
-				}
-			}
-			throw std::runtime_error("Invalid node ID");
+			int index = find_node_index(id);
+			if (index == -1)
+				throw std::runtime_error("Invalid node ID");
+			node_list[index]->data = data;
 		}
 
 		/**
@@ -239,6 +253,48 @@ namespace custom {
 			return node_num == 0;
 		}
 
+		/**
+		 * Provides a breakdown of the memory held by the graph: the data and ID of the nodes are the payload, while
+		 * the padding of each node, the vector of nodes, the adjacency list and the graph object itself are structural
+		 * overhead.
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the graph.
+		 * @return - a MemoryUsage object with the bytes of payload, structure and estimated allocator overhead.
+		 */
+		[[nodiscard]] MemoryUsage memory_usage() const noexcept {
+			MemoryUsage usage;
+			usage.structure = sizeof(*this);
+			memory_detail::add_blocks(usage, node_list.size(), sizeof(Node), sizeof(T) + sizeof(ID_Type));
+			memory_detail::add_vector(usage, node_list);
+			memory_detail::add_vector(usage, adj_list);
+			for (const Links& links: adj_list)
+				memory_detail::add_vector(usage, links);
+			return usage;
+		}
+
+		/**
+		 * Serializes the graph in the binary format of Serialization.h, as the ID and data of its nodes followed by
+		 * the edges of each node, stored as the indices of the nodes they lead to.
+		 * **Time Complexity** = *O(n + e)* where n is the number of nodes and e is the number of edges in the graph.
+		 * @param out - the serialization::Writer to append the graph to.
+		 */
+		virtual void serialize(serialization::Writer& out) const {
+			write_graph(out, serialization::Kind::Graph);
+		}
+
+		/**
+		 * Deserializes a graph written by serialize(), with the same nodes, in the same order, and the same edges. If
+		 * the data does not hold a serialized Graph of `T` data and `ID_Type` IDs, a `runtime_error` exception is
+		 * thrown.
+		 * **Time Complexity** = *O(n + e)* where n is the number of nodes and e is the number of edges in the graph.
+		 * @param in - the serialization::Reader to read the graph from.
+		 * @return - the graph.
+		 */
+		static Graph deserialize(serialization::Reader& in) {
+			Graph result;
+			result.read_graph(in, serialization::Kind::Graph);
+			return result;
+		}
+
 		/**
 		 * Conversion operator for boolean type. Evaluates to `true` if the number of nodes in the graph is not 0, otherwise
 		 * it evaluates to `false`.
@@ -256,7 +312,8 @@ namespace custom {
 		 * @return - a boolean value indicating whether a node with the ID provided exists in the graph.
 		 */
 		[[nodiscard]] bool contains(const ID_Type& id) const noexcept {
-			for (Node*& node: node_list) {
+			tracing::Scope scope(tracing::Operation::Lookup);
+			for (Node* node: node_list) {
 				if (node->id == id)
 					return true;
 			}
@@ -271,6 +328,7 @@ namespace custom {
 		 * @return - a boolean value indicating whether an edge exists between the two nodes.
 		 */
 		[[nodiscard]] bool find_edge(const ID_Type& last, const ID_Type& next) const noexcept {
+			tracing::Scope scope(tracing::Operation::Lookup);
 			int last_index = -1;
 			for (int i = 0; i < node_list.size(); ++i) {
 				if (node_list[i]->id == last) {
@@ -297,8 +355,9 @@ namespace custom {
 		 * @see <a href="https://en.cppreference.com/w/cpp/utility/pair">std::pair</a>
 		 */
 		[[nodiscard]] std::vector<std::pair<ID_Type, T>> contents() const noexcept {
+			tracing::Scope scope(tracing::Operation::Traversal);
 			std::vector<std::pair<ID_Type, T>> contents = {};
-			for (Node*& node: node_list) {
+			for (Node* node: node_list) {
 				contents.push_back({node->id, node->data});
 			}
 			return contents;
@@ -315,6 +374,7 @@ namespace custom {
 		 * @see <a href="https://en.wikipedia.org/wiki/Depth-first_search">Depth-first search</a>
 		 */
 		[[nodiscard]] std::vector<ID_Type> dfs(const ID_Type& id) const {
+			tracing::Scope scope(tracing::Operation::Traversal);
 			std::vector<ID_Type> ret;
 			std::unordered_map<Node*, bool> visited;
 			std::stack<Node*> stack;
@@ -350,6 +410,7 @@ namespace custom {
 		 * @see <a href="https://en.wikipedia.org/wiki/Breadth-first_search">Breadth-first search</a>
 		 */
 		[[nodiscard]] std::vector<ID_Type> bfs(const ID_Type& id) const {
+			tracing::Scope scope(tracing::Operation::Traversal);
 			std::vector<ID_Type> ret;
 			std::unordered_map<Node*, bool> visited;
 			std::deque<Node*> queue;
@@ -402,16 +463,14 @@ namespace custom {
 		 * @see <a href="https://en.cppreference.com/w/cpp/io/cout">std::cout</a>
 		 */
 		void print() const {
-			if (node_num) {
-				for (std::vector<Node*> links: adj_list) {
-					for (Node*& node: links) {
-						std::cout << node->id << " : " << node->data << "\t->\t";
-					}
-					std::cout << "END\n";
+			check<std::runtime_error>(node_num != 0, "Graph is empty, there is nothing to print");
+			for (const Links& links: adj_list) {
+				for (Node* node: links) {
+					std::cout << node->id << " : " << node->data << "\t->\t";
 				}
-				std::cout << std::endl;
-			} else
-				throw std::runtime_error("Graph is empty, there is nothing to print");
+				std::cout << "END\n";
+			}
+			std::cout << std::endl;
 		}
 
 		/**
@@ -422,29 +481,23 @@ namespace custom {
 		 * @param id - the ID of type `ID_Type` of the node to be removed.
 		 */
 		void remove(const ID_Type& id) {
-			if (node_num) {
-				Node* node = nullptr;
-				for (int i = 0; i < node_list.size(); ++i) {
-					if (node_list[i]->id == id) {
-						node = node_list[i];
-						adj_list.erase(adj_list.begin() + i);
-						node_list.erase(node_list.begin() + i);
-						--node_num;
-						break;
-					}
-				}
-				if (!node)
-					throw std::invalid_argument("Invalid id, this id does not exist");
-				for (std::vector<Node*>& links: adj_list) {
-					for (int i = 0; i < links.size(); i++) {
-						if (links[i]->id == id) {
-							links.erase(links.begin() + i);
-						}
-					}
+			tracing::Scope scope(tracing::Operation::Erase);
+			check<std::runtime_error>(node_num != 0, "Graph is empty, there is nothing to remove");
+			Node* node = nullptr;
+			for (int i = 0; i < node_list.size(); ++i) {
+				if (node_list[i]->id == id) {
+					node = node_list[i];
+					adj_list.erase(adj_list.begin() + i);
+					node_list.erase(node_list.begin() + i);
+					--node_num;
+					break;
 				}
-				delete node;
-			} else
-				throw std::runtime_error("Graph is empty, there is nothing to remove");
+			}
+			if (!node)
+				throw std::invalid_argument("Invalid id, this id does not exist");
+			for (Links& links: adj_list)
+				std::erase(links, node);
+			destroy_node(node);
 		}
 
 		/**
@@ -454,13 +507,22 @@ namespace custom {
 		 */
 		void clear() noexcept {
 			for (Node*& node: node_list) {
-				delete node;
+				destroy_node(node);
 			}
 			node_list.clear();
 			adj_list.clear();
 			node_num = 0;
 		}
 
+		/**
+		 * Returns a copy of the allocator the graph is allocated with.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - the allocator of the graph.
+		 */
+		[[nodiscard]] Allocator get_allocator() const noexcept {
+			return Allocator(node_list.get_allocator());
+		}
+
 		/**
 		 * Graph destructor which clears the graph and frees any allocated memory.
 		 * **Time Complexity** = *O(n)* where n is the number of nodes in the graph.
@@ -474,7 +536,7 @@ namespace custom {
 		/**
 		 * A node structure to contain the data and ID of each node in the graph.
 		 */
-		struct Node {
+		struct Node : allocation_tracking::TrackedNode<ContainerType::Graph> {
 			T data;  /**< The data of type `T` of each node. */
 			ID_Type id;  /**< The ID of type `ID_Type` of each node. */
 
@@ -493,10 +555,81 @@ namespace custom {
 			Node(T&& data, ID_Type&& id) noexcept: data(std::move(data)), id(std::move(id)) {}
 		};
 
-		std::vector<std::vector<Node*>> adj_list;  /**< An adjacency list comprised of a `std::vector` of `std::vector` of node pointers, specifying the edges of each node. */
-		std::vector<Node*> node_list;  /**< A `std::vector` of nodes containing pointers to the nodes in the graph. */
+		/**
+		 * The allocator of the graph rebound to the type allocated.
+		 * @tparam Element - the type allocated.
+		 */
+		template<typename Element>
+		using InnerAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Element>;
+		using Links = std::vector<Node*, InnerAllocator<Node*>>;  /**< The list of a node followed by the nodes its edges lead to. */
+
+		std::vector<Links, InnerAllocator<Links>> adj_list;  /**< An adjacency list comprised of a `std::vector` of `std::vector` of node pointers, specifying the edges of each node. */
+		std::vector<Node*, InnerAllocator<Node*>> node_list;  /**< A `std::vector` of nodes containing pointers to the nodes in the graph. */
 		size_t node_num;  /**< An unsigned integer specifying the number of nodes in the graph. */
 
+		/**
+		 * Protected helper function which allocates and constructs a node with the allocator of the graph.
+		 * @param data - the data of the node, copied or moved into it.
+		 * @param id - the ID of the node, copied or moved into it.
+		 * @return - a pointer to the new node.
+		 */
+		template<typename Data, typename ID>
+		Node* create_node(Data&& data, ID&& id) noexcept {
+			Allocator allocator = get_allocator();
+			return allocation_tracking::create_node<ContainerType::Graph, Node>(allocator, std::forward<Data>(data),
+			                                                                    std::forward<ID>(id));
+		}
+
+		/**
+		 * Protected helper function which destroys and deallocates a node from create_node().
+		 * @param node - a pointer to the node.
+		 */
+		void destroy_node(Node* node) noexcept {
+			Allocator allocator = get_allocator();
+			allocation_tracking::destroy_node<ContainerType::Graph>(allocator, node);
+		}
+
+		/**
+		 * Protected helper function which clears the current graph and takes over the nodes and edges of another
+		 * graph, leaving it empty. If the allocators of the graphs do not compare equal, e.g.
+		 * `std::pmr::polymorphic_allocator` objects of different memory resources, the current graph keeps its
+		 * allocator and the data and IDs of the nodes are moved into new nodes, with the same edges.
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the current graph, + the number of nodes and
+		 * edges in the other graph if the allocators differ.
+		 * @param other - the graph to take the nodes and edges of.
+		 */
+		void take(Graph& other) noexcept {
+			if (node_num)
+				clear();
+			if constexpr (!std::allocator_traits<Allocator>::is_always_equal::value) {
+				if (get_allocator() != other.get_allocator()) {
+					std::unordered_map<const Node*, Node*> moved;
+					moved.reserve(other.node_list.size());
+					node_list.reserve(other.node_list.size());
+					for (Node* node: other.node_list) {
+						node_list.push_back(create_node(std::move(node->data), std::move(node->id)));
+						moved.emplace(node, node_list.back());
+					}
+					adj_list.reserve(other.adj_list.size());
+					for (const Links& links: other.adj_list) {
+						Links& copy = adj_list.emplace_back();
+						copy.reserve(links.size());
+						for (Node* node: links)
+							copy.push_back(moved.at(node));
+					}
+					node_num = other.node_num;
+					other.clear();
+					return;
+				}
+			}
+			node_list = std::move(other.node_list);
+			adj_list = std::move(other.adj_list);
+			node_num = other.node_num;
+			other.node_num = 0;
+			other.node_list.clear();
+			other.adj_list.clear();
+		}
+
 		/**
 		 * Protected helper function to find the index, in the node list, of a given node ID. If a node with the ID
 		 * provided is not found, a value of **-1** is returned.
@@ -512,6 +645,60 @@ namespace custom {
 			return -1;
 		}
 
+		/**
+		 * Protected helper function which serializes the nodes and edges of the graph, shared by Graph and DirectedGraph
+		 * which only differ in the kind of container recorded.
+		 * **Time Complexity** = *O(n + e)* where n is the number of nodes and e is the number of edges in the graph.
+		 * @param out - the serialization::Writer to append the graph to.
+		 * @param kind - the kind of container to record in the header.
+		 */
+		void write_graph(serialization::Writer& out, serialization::Kind kind) const {
+			out.header<std::pair<ID_Type, T>>(kind, node_list.size());
+			std::unordered_map<const Node*, std::uint64_t> indices;
+			indices.reserve(node_list.size());
+			for (size_t i = 0; i < node_list.size(); ++i) {
+				out.value(std::pair<ID_Type, T>(node_list[i]->id, node_list[i]->data));
+				indices.emplace(node_list[i], i);
+			}
+			for (const Links& links: adj_list) {
+				// The first node of each list is the node whose edges it holds
+				out.value(static_cast<std::uint64_t>(links.size() - 1));
+				for (size_t i = 1; i < links.size(); ++i)
+					out.value(indices.at(links[i]));
+			}
+		}
+
+		/**
+		 * Protected helper function which deserializes the nodes and edges written by write_graph() into the current
+		 * graph, which must be empty.
+		 * **Time Complexity** = *O(n + e)* where n is the number of nodes and e is the number of edges in the graph.
+		 * @param in - the serialization::Reader to read the graph from.
+		 * @param kind - the kind of container expected in the header.
+		 */
+		void read_graph(serialization::Reader& in, serialization::Kind kind) {
+			size_t count = in.header<std::pair<ID_Type, T>>(kind).count;
+			node_list.reserve(count);
+			adj_list.reserve(count);
+			for (size_t i = 0; i < count; ++i) {
+				auto [id, data] = in.value<std::pair<ID_Type, T>>();
+				node_list.push_back(create_node(std::move(data), std::move(id)));
+				adj_list.emplace_back(1, node_list.back());
+				++node_num;
+			}
+			for (Links& links: adj_list) {
+				auto degree = in.value<std::uint64_t>();
+				if (degree > in.remaining() / sizeof(std::uint64_t))
+					throw std::runtime_error("Error: the serialized data is truncated");
+				links.reserve(degree + 1);
+				for (std::uint64_t i = 0; i < degree; ++i) {
+					auto index = in.value<std::uint64_t>();
+					if (index >= count)
+						throw std::runtime_error("Error: an edge of the serialized graph leads to a missing node");
+					links.push_back(node_list[index]);
+				}
+			}
+		}
+
 		/**
 		 * Protected helper function for has_path() for the case of depth-first search. If the nodes with the two IDs
 		 * provided are not found, an `invalid_argument` exception is thrown.
@@ -584,14 +771,23 @@ namespace custom {
 	 * stated above.
 	 * @tparam T - the type of data to be stored in each node of the directed graph.
 	 * @tparam ID_Type - the type of the ID used to identify each node in the directed graph.
+	 * @tparam Allocator - the allocator the graph is allocated with, `std::allocator` by default, see
+	 * pmr::DirectedGraph.
 	 */
-	template<typename T, typename ID_Type>
-	class DirectedGraph : public Graph<T, ID_Type> {
+	template<typename T, typename ID_Type, typename Allocator = std::allocator<T>>
+	class DirectedGraph : public Graph<T, ID_Type, Allocator> {
 	public:
 		/**
 		 * Default DirectedGraph constructor calls the base Graph constructor.
 		 */
-		DirectedGraph() noexcept: Graph<T, ID_Type>() {}
+		DirectedGraph() noexcept: Graph<T, ID_Type, Allocator>() {}
+
+		/**
+		 * Overloaded DirectedGraph constructor which calls the complementary base Graph constructor, passing the
+		 * allocator provided.
+		 * @param allocator - the allocator to allocate the graph with.
+		 */
+		explicit DirectedGraph(const Allocator& allocator) noexcept: Graph<T, ID_Type, Allocator>(allocator) {}
 
 		/**
 		 * Overloaded DirectedGraph constructor which calls the complementary base Graph constructor, passing and
@@ -599,7 +795,7 @@ namespace custom {
 		 * @param data - data of type `T` to be copied into the node.
 		 * @param id - ID of type `ID_Type`, to be copied into the node and used to identify the node.
 		 */
-		explicit DirectedGraph(const T& data, const ID_Type& id) noexcept: Graph<T, ID_Type>(data, id) {}
+		explicit DirectedGraph(const T& data, const ID_Type& id) noexcept: Graph<T, ID_Type, Allocator>(data, id) {}
 
 		/**
 		 * Overloaded DirectedGraph constructor which calls the complementary base Graph constructor, passing and
@@ -607,7 +803,7 @@ namespace custom {
 		 * an *r-value reference* to the data of type `T` to be moved into the node.
 		 * @param id - an *r-value reference* to the ID of type `ID_Type`, to be moved into the node and used to identify the node.
 		 */
-		explicit DirectedGraph(T&& data, ID_Type&& id) noexcept: Graph<T, ID_Type>(std::move(data), std::move(id)) {}
+		explicit DirectedGraph(T&& data, ID_Type&& id) noexcept: Graph<T, ID_Type, Allocator>(std::move(data), std::move(id)) {}
 
 		/**
 		 * Copy constructor for the DirectedGraph class which will perform a deep copy, element-wise, of another DirectedGraph
@@ -615,13 +811,15 @@ namespace custom {
 		 * **Time Complexity** = *O(n)* where n is the number of nodes in the other graph.
 		 * @param other - another DirectedGraph object of the same types `T` and `ID_Type` to be copied.
 		 */
-		DirectedGraph(const DirectedGraph<T, ID_Type>& other) noexcept {
+		DirectedGraph(const DirectedGraph& other) noexcept:
+				Graph<T, ID_Type, Allocator>(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+						other.get_allocator())) {
 			node_list = {};
 			adj_list = {};
 			node_num = 0;
 			for (Node*& node: other.node_list)
 				add_node(node->data);
-			for (std::vector<Node*> link: other.adj_list) {
+			for (const Links& link: other.adj_list) {
 				ID_Type first = link[0]->id;
 				for (int i = 1; i < link.size(); ++i)
 					add_edge(first, link[i]->id);
@@ -638,7 +836,7 @@ namespace custom {
 		 * @param other - another Graph object of the same types `T` and `ID_Type` to be copied.
 		 * @return - a reference to the current object.
 		 */
-		DirectedGraph<T, ID_Type>& operator=(const DirectedGraph<T, ID_Type>& other) noexcept {
+		DirectedGraph& operator=(const DirectedGraph& other) noexcept {
 			if (this != &other) {
 				if (node_num)
 					clear();
@@ -647,7 +845,7 @@ namespace custom {
 				node_num = 0;
 				for (Node*& node: other.node_list)
 					add_node(node->data);
-				for (std::vector<Node*> link: other.adj_list) {
+				for (const Links& link: other.adj_list) {
 					ID_Type first = link[0]->id;
 					for (int i = 1; i < link.size(); ++i)
 						add_edge(first, link[i]->id);
@@ -662,7 +860,7 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 * @param other - an *r-value reference* to a Graph object of types `T` and `ID_Type` to be moved.
 		 */
-		DirectedGraph(DirectedGraph<T, ID_Type>&& other) noexcept: Graph<T, ID_Type>(std::move(other)) {}
+		DirectedGraph(DirectedGraph&& other) noexcept: Graph<T, ID_Type, Allocator>(std::move(other)) {}
 
 		/**
 		 * Move assignment operator for the DirectedGraph class which will move another DirectedGraph object of
@@ -673,17 +871,9 @@ namespace custom {
 		 * @param other - an *r-value reference* to a Graph object of types `T` and `ID_Type` to be moved.
 		 * @return - a reference to the current object.
 		 */
-		DirectedGraph<T, ID_Type>& operator=(DirectedGraph<T, ID_Type>&& other) noexcept {
-			if (this != &other) {
-				if (node_num)
-					clear();
-				node_list = other.node_list;
-				adj_list = other.adj_list;
-				node_num = other.node_num;
-				other.node_num = 0;
-				other.node_list.clear();
-				other.adj_list.clear();
-			}
+		DirectedGraph& operator=(DirectedGraph&& other) noexcept {
+			if (this != &other)
+				this->take(other);
 			return *this;
 		}
 
@@ -696,6 +886,7 @@ namespace custom {
 		 * @param next - the ID of type `ID_Type` of the destination node.
 		 */
 		void add_edge(const ID_Type& last, const ID_Type& next) override {
+			tracing::Scope scope(tracing::Operation::Insert);
 			Node* last_node = nullptr;
 			Node* next_node = nullptr;
 			int last_index = -1;
@@ -707,10 +898,9 @@ namespace custom {
 					next_node = node_list[i];
 				}
 			}
-			if (last_node && next_node) {
-				adj_list[last_index].push_back(next_node);
-			} else
+			if (!last_node || !next_node)
 				throw std::runtime_error("Invalid node IDs, cannot add edge");
+			adj_list[last_index].push_back(next_node);
 		}
 
 		/**
@@ -723,13 +913,55 @@ namespace custom {
 				clear();
 		}
 
+		/**
+		 * This is an override of the base Graph class serialize() method which records the graph as a DirectedGraph.
+		 * **Time Complexity** = *O(n + e)* where n is the number of nodes and e is the number of edges in the graph.
+		 * @param out - the serialization::Writer to append the graph to.
+		 */
+		void serialize(serialization::Writer& out) const override {
+			this->write_graph(out, serialization::Kind::DirectedGraph);
+		}
+
+		/**
+		 * Deserializes a directed graph written by serialize(), with the same nodes, in the same order, and the same
+		 * edges. If the data does not hold a serialized DirectedGraph of `T` data and `ID_Type` IDs, a `runtime_error`
+		 * exception is thrown.
+		 * **Time Complexity** = *O(n + e)* where n is the number of nodes and e is the number of edges in the graph.
+		 * @param in - the serialization::Reader to read the graph from.
+		 * @return - the directed graph.
+		 */
+		static DirectedGraph deserialize(serialization::Reader& in) {
+			DirectedGraph result;
+			result.read_graph(in, serialization::Kind::DirectedGraph);
+			return result;
+		}
+
 	private:
-		using typename Graph<T, ID_Type>::Node;  /**< An alias used to easily access the Node structure in the base class. */
-		using Graph<T, ID_Type>::adj_list;  /**< An alias used to easily access the adj_list member in the base class. */
-		using Graph<T, ID_Type>::node_list;  /**< An alias used to easily access the node_list member in the base class. */
-		using Graph<T, ID_Type>::node_num;  /**< An alias used to easily access the node_num member in the base class. */
-		using Graph<T, ID_Type>::clear;  /**< An alias used to easily access the clear() method in the base class. */
+		using typename Graph<T, ID_Type, Allocator>::Node;  /**< An alias used to easily access the Node structure in the base class. */
+		using Graph<T, ID_Type, Allocator>::adj_list;  /**< An alias used to easily access the adj_list member in the base class. */
+		using Graph<T, ID_Type, Allocator>::node_list;  /**< An alias used to easily access the node_list member in the base class. */
+		using Graph<T, ID_Type, Allocator>::node_num;  /**< An alias used to easily access the node_num member in the base class. */
+		using Graph<T, ID_Type, Allocator>::clear;  /**< An alias used to easily access the clear() method in the base class. */
+		using typename Graph<T, ID_Type, Allocator>::Links;  /**< An alias used to easily access the list of edges of a node in the base class. */
 	};
+
+	namespace pmr {
+		/**
+		 * A Graph whose nodes, node list and adjacency list are allocated from a `std::pmr::memory_resource`.
+		 * @tparam T - the type of the data of each node in the graph.
+		 * @tparam ID_Type - the type of the ID used to identify each node in the graph.
+		 */
+		template<typename T, typename ID_Type>
+		using Graph = custom::Graph<T, ID_Type, std::pmr::polymorphic_allocator<T>>;
+
+		/**
+		 * A DirectedGraph whose nodes, node list and adjacency list are allocated from a `std::pmr::memory_resource`.
+		 * @tparam T - the type of the data of each node in the directed graph.
+		 * @tparam ID_Type - the type of the ID used to identify each node in the directed graph.
+		 */
+		template<typename T, typename ID_Type>
+		using DirectedGraph = custom::DirectedGraph<T, ID_Type, std::pmr::polymorphic_allocator<T>>;
+	}// namespace pmr
 }// namespace custom
 
 #endif// GRAPH_H
\ No newline at end of file
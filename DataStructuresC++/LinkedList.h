@@ -3,9 +3,17 @@
 
 #include <initializer_list>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <vector>
 
+#include "AllocationTracking.h"
+#include "Checking.h"
+#include "MemoryUsage.h"
+#include "Serialization.h"
+#include "Tracing.h"
+
 namespace custom {
 	/**
 	 * An iterator class for forwards iterating over the elements of a LinkedList. Provides functionality for incrementing
@@ -75,16 +83,10 @@ namespace custom {
 		 * `out_of_range` exception if an invalid iterator, one whose member pointer is nullptr, is incremented.
 		 * @return - a reference to the current object after incrementing.
 		 */
-		ListIterator& operator++() {
-#ifdef DEBUG
-			if (mPtr) {
-#endif
-				mPtr = mPtr->next;
-				return *this;
-#ifdef DEBUG
-			}
-			throw std::out_of_range("Cannot increment list iterator past end of list");
-#endif
+		ListIterator& operator++() noexcept(!checks_throw) {
+			check<std::out_of_range>(mPtr != nullptr, "Cannot increment list iterator past end of list");
+			mPtr = mPtr->next;
+			return *this;
 		}
 
 		/**
@@ -93,17 +95,10 @@ namespace custom {
 		 * whose member pointer is nullptr, is incremented.
 		 * @return - a copy ListIterator object at the position before incrementing.
 		 */
-		const ListIterator operator++(int) {
-#ifdef DEBUG
-			if (mPtr) {
-#endif
-				ListIterator temp(*this);
-				++*this;
-				return temp;
-#ifdef DEBUG
-			}
-			throw std::out_of_range("Cannot increment list iterator past end of list");
-#endif
+		const ListIterator operator++(int) noexcept(!checks_throw) {
+			ListIterator temp(*this);
+			++*this;
+			return temp;
 		}
 
 		/**
@@ -116,24 +111,15 @@ namespace custom {
 		 * @param distance - an unsigned integer to represent the number of positions to advance.
 		 * @return - a reference to the current object.
 		 */
-		ListIterator& advance(const size_t& distance) {
-#ifdef DEBUG
-			if (mPtr) {
-#endif
-				size_t moved = 0;
-				while (mPtr && moved < distance) {
-					++*this;
-					++moved;
-				}
-#ifdef DEBUG
-				if (moved != distance)
-					throw std::invalid_argument("Distance out of range of iterator");
-#endif
-				return *this;
+		ListIterator& advance(const size_t& distance) noexcept(!checks_throw) {
+			check<std::runtime_error>(mPtr != nullptr, "Iterator is at an invalid position, cannot advance");
+			size_t moved = 0;
+			while (mPtr && moved < distance) {
+				mPtr = mPtr->next;
+				++moved;
 			}
-#ifdef DEBUG
-			throw std::runtime_error("Iterator is at an invalid position, cannot advance");
-#endif
+			check<std::invalid_argument>(moved == distance, "Distance out of range of iterator");
+			return *this;
 		}
 
 		/**
@@ -141,14 +127,8 @@ namespace custom {
 		 * to nullptr, an `out_of_range` exception is thrown.
 		 * @return - a copy of the incremented object.
 		 */
-		ListIterator next() const {
-#ifdef DEBUG
-			if (mPtr)
-#endif
-				return ++ListIterator(*this);
-#ifdef DEBUG
-			throw std::out_of_range("Cannot increment list iterator past end of list");
-#endif
+		ListIterator next() const noexcept(!checks_throw) {
+			return ++ListIterator(*this);
 		}
 
 		/**
@@ -157,23 +137,10 @@ namespace custom {
 		 * @param amount - an unsigned integer to represent the distance to advance the iterator by.
 		 * @return - a copy of the advanced object.
 		 */
-		ListIterator operator+(const size_t& amount) {
+		ListIterator operator+(const size_t& amount) noexcept(!checks_throw) {
 			ListIterator result(*this);
-#ifdef DEBUG
-			size_t moved = 0;
-			while (result.mPtr && moved < amount) {
-				result.mPtr = result.mPtr->next;
-				++moved;
-			}
-			if (moved == amount)
-				return result;
-			throw std::out_of_range("Cannot increment list iterator past end of list");
-#endif
-#ifdef RELEASE
-			for (size_t i = 0; i < amount; ++i)
-				result.mPtr = result.mPtr->next;
+			result += amount;
 			return result;
-#endif
 		}
 
 		/**
@@ -182,22 +149,12 @@ namespace custom {
 		 * @param amount - an unsigned integer to represent the distance to advance the iterator by.
 		 * @return - a reference to the advanced object.
 		 */
-		ListIterator& operator+=(const size_t& amount) {
-#ifdef DEBUG
-			size_t moved = 0;
-			while (mPtr && moved < amount) {
+		ListIterator& operator+=(const size_t& amount) noexcept(!checks_throw) {
+			for (size_t i = 0; i < amount; ++i) {
+				check<std::out_of_range>(mPtr != nullptr, "Cannot increment list iterator past end of list");
 				mPtr = mPtr->next;
-				++moved;
 			}
-			if (moved == amount)
-				return *this;
-			throw std::out_of_range("Cannot increment list iterator past end of list");
-#endif
-#ifdef RELEASE
-			for (size_t i = 0; i < amount; ++i)
-				mPtr = mPtr->next;
 			return *this;
-#endif
 		}
 
 		/**
@@ -223,14 +180,9 @@ namespace custom {
 		 * to an invalid position, a `runtime_error` exception is thrown.
 		 * @return - A reference to the data at the current iterator position.
 		 */
-		ValueType& operator*() const {
-#ifdef DEBUG
-			if (mPtr)
-#endif
-				return mPtr->data;
-#ifdef DEBUG
-			throw std::runtime_error("Iterator does not point to a valid position, cannot dereference");
-#endif
+		ValueType& operator*() const noexcept(!checks_throw) {
+			check<std::runtime_error>(mPtr != nullptr, "Iterator does not point to a valid position, cannot dereference");
+			return mPtr->data;
 		}
 
 		/**
@@ -269,12 +221,14 @@ namespace custom {
 	 * to continue running.
 	 *
 	 * @tparam T - the type of the data to be stored in each node.
+	 * @tparam Allocator - the allocator the nodes are allocated with, `std::allocator` by default, see pmr::LinkedList.
 	 * @see <a href="https://en.wikipedia.org/wiki/Linked_list">Linked list</a>
 	 */
-	template<typename T>
+	template<typename T, typename Allocator = std::allocator<T>>
 	class LinkedList {
 	public:
 		using ValueType = T;  /**< An alias for the type of data `T` to be used by external utility classes. */
+		using allocator_type = Allocator;  /**< An alias for the allocator the nodes are allocated with. */
 		using Iterator = ListIterator<LinkedList>;  /**< An alias for the LinkedList iterator class. */
 
 		friend class ListIterator<LinkedList>;  /**< Friend LinkedList iterator class, allowing it to access private members. */
@@ -286,13 +240,21 @@ namespace custom {
 		 */
 		LinkedList() noexcept: head(nullptr), tail(nullptr), mLength(0) {}
 
+		/**
+		 * Overloaded LinkedList constructor which initialises an empty list whose nodes will be allocated with the
+		 * allocator provided.
+		 * @param allocator - the allocator to allocate the nodes with.
+		 */
+		explicit LinkedList(const Allocator& allocator) noexcept: head(nullptr), tail(nullptr), mLength(0),
+		                                                          mAllocator(allocator) {}
+
 		/**
 		 * Overloaded LinkedList constructor which allocates memory for one element node and copies the data provided.
 		 * This constructor is explicit, meaning implicit conversion is not supported.
 		 * @param data - data of type `T` to be copied into the head node of the LinkedList.
 		 */
 		explicit LinkedList(const T& data) noexcept: mLength(1) {
-			head = new Node(data);
+			head = create_node(data);
 			tail = head;
 		}
 
@@ -302,7 +264,7 @@ namespace custom {
 		 * @param data - an *r-value reference* to data of type `T`, to be moved into the head node of the LinkedList.
 		 */
 		explicit LinkedList(T&& data) noexcept: mLength(1) {
-			head = new Node(std::move(data));
+			head = create_node(std::move(data));
 			tail = head;
 		}
 
@@ -311,26 +273,30 @@ namespace custom {
 		 * its arguments to the list.
 		 * **Time Complexity** = *O(n)* where n is the number elements in the initialiser list.
 		 * @param init - an initialiser list of type `T` whose contents will be added to the list.
+		 * @param allocator - the allocator to allocate the nodes with.
 		 * @see <a href="https://en.cppreference.com/w/cpp/utility/initializer_list">std::initializer_list</a>
 		 */
-		LinkedList(std::initializer_list<T> init) noexcept: mLength(0) {
+		LinkedList(std::initializer_list<T> init, const Allocator& allocator = Allocator()) noexcept:
+				head(nullptr), tail(nullptr), mLength(0), mAllocator(allocator) {
 			for (auto it = init.begin(); it != init.end(); ++it)
 				append(std::move(*it));
 		}
 
 		/**
 		 * Copy constructor for a LinkedList which will perform a deep copy, element-wise, of another LinkedList
-		 * object of the same type `T`.
+		 * object of the same type `T`, with the allocator the allocator of the other list selects for a copy.
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the other list.
 		 * @param other - another LinkedList object of the same type `T` to be copied.
 		 */
-		LinkedList(LinkedList<T>& other) noexcept: mLength(other.mLength) {
+		LinkedList(LinkedList& other) noexcept: mLength(other.mLength),
+		                                        mAllocator(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+				                                        other.mAllocator)) {
 			if (other.mLength) {
-				head = new Node(other.head->data);
+				head = create_node(other.head->data);
 				tail = head;
 				Node* other_node = other.head->next;
 				while (other_node) {
-					tail->next = new Node(other_node->data);
+					tail->next = create_node(other_node->data);
 					tail = tail->next;
 					other_node = other_node->next;
 				}
@@ -343,7 +309,7 @@ namespace custom {
 
 		/**
 		 * Copy assignment operator for the LinkedList which will copy another LinkedList object of the same type
-		 * `T` into the current object.
+		 * `T` into the current object, which keeps its allocator.
 		 * \note
 		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the other list + the number of elements
@@ -351,17 +317,17 @@ namespace custom {
 		 * @param other - another LinkedList object of the same type `T` to be copied.
 		 * @return - a reference to the current object.
 		 */
-		LinkedList<T>& operator=(const LinkedList<T>& other) noexcept {
+		LinkedList& operator=(const LinkedList& other) noexcept {
 			if (this != &other) {
 				if (mLength)
 					clear();
 				if (other.mLength) {
-					head = new Node(other.head->data);
+					head = create_node(other.head->data);
 					mLength = other.mLength;
 					tail = head;
 					Node* other_node = other.head->next;
 					while (other_node) {
-						tail->next = new Node(other_node->data);
+						tail->next = create_node(other_node->data);
 						tail = tail->next;
 						other_node = other_node->next;
 					}
@@ -376,11 +342,12 @@ namespace custom {
 
 		/**
 		 * Move constructor for a LinkedList which will take the data from another LinkedList object of the same type
-		 * `T` and set the other object to its default state of not have any data.
+		 * `T`, along with its allocator, and set the other object to its default state of not have any data.
 		 * **Time Complexity** = *O(1)*.
 		 * @param other - an *r-value reference* to a LinkedList object of type `T` to be moved.
 		 */
-		LinkedList(LinkedList<T>&& other) noexcept: head(other.head), tail(other.tail), mLength(other.mLength) {
+		LinkedList(LinkedList&& other) noexcept: head(other.head), tail(other.tail), mLength(other.mLength),
+		                                         mAllocator(other.mAllocator) {
 			other.head = nullptr;
 			other.tail = nullptr;
 			other.mLength = 0;
@@ -388,17 +355,25 @@ namespace custom {
 
 		/**
 		 * Move assignment operator for the LinkedList which will move another LinkedList object of type `T` into
-		 * the current object.
+		 * the current object, which keeps its allocator. If the allocators do not compare equal, e.g.
+		 * `std::pmr::polymorphic_allocator` objects of different memory resources, the elements are moved one by one.
 		 * \note
 		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
-		 * **Time Complexity** = *O(1)*.
+		 * **Time Complexity** = *O(1)*, or *O(n)* where n is the number of elements in the other list if the
+		 * allocators differ.
 		 * @param other - an *r-value reference* to a LinkedList object of type `T` to be moved.
 		 * @return - a reference to the current object.
 		 */
-		LinkedList<T>& operator=(LinkedList<T>&& other) noexcept {
+		LinkedList& operator=(LinkedList&& other) noexcept {
 			if (this != &other) {
 				if (mLength)
 					clear();
+				if (!std::allocator_traits<Allocator>::is_always_equal::value && mAllocator != other.mAllocator) {
+					for (Node* node = other.head; node; node = node->next)
+						append(std::move(node->data));
+					other.clear();
+					return *this;
+				}
 				head = other.head;
 				tail = other.tail;
 				mLength = other.mLength;
@@ -416,7 +391,8 @@ namespace custom {
 		 * @param data - the data to be copied into the end of the list.
 		 */
 		void append(const T& data) noexcept {
-			Node* new_node = new Node(data);
+			tracing::Scope scope(tracing::Operation::Insert);
+			Node* new_node = create_node(data);
 			if (mLength) {
 				++mLength;
 				tail->next = new_node;
@@ -435,7 +411,8 @@ namespace custom {
 		 * @param data - an *r-value reference* to the data to be moved into the end of the list.
 		 */
 		void append(T&& data) noexcept {
-			Node* new_node = new Node(std::move(data));
+			tracing::Scope scope(tracing::Operation::Insert);
+			Node* new_node = create_node(std::move(data));
 			if (mLength) {
 				++mLength;
 				tail->next = new_node;
@@ -485,40 +462,34 @@ namespace custom {
 		 * @param index - an unsigned integer to represent the index of the list to insert into.
 		 */
 		void insert(const T& data, const size_t& index) {
-#ifdef DEBUG
-			if (mLength && index <= mLength) {
-#endif
-				Node* new_node = new Node(data);
-				++mLength;
-				if (index == 0) {
-					new_node->next = head;
-					head = new_node;
-					return;
-				}
-				if (index == mLength) {
-					tail->next = new_node;
-					tail = new_node;
+			tracing::Scope scope(tracing::Operation::Insert);
+			check<std::runtime_error>(mLength != 0, "Linked list is empty and uninitialised, use append instead");
+			check<std::invalid_argument>(index <= mLength, "Invalid index, out of range");
+			Node* new_node = create_node(data);
+			++mLength;
+			if (index == 0) {
+				new_node->next = head;
+				head = new_node;
+				return;
+			}
+			if (index + 1 == mLength) {
+				tail->next = new_node;
+				tail = new_node;
+				return;
+			}
+			size_t _index = 1;
+			Node* cur_node = head;
+			Node* last_node;
+			while (true) {
+				last_node = cur_node;
+				cur_node = cur_node->next;
+				if (_index == index) {
+					last_node->next = new_node;
+					new_node->next = cur_node;
 					return;
 				}
-				size_t _index = 1;
-				Node* cur_node = head;
-				Node* last_node;
-				while (true) {
-					last_node = cur_node;
-					cur_node = cur_node->next;
-					if (_index == index) {
-						last_node->next = new_node;
-						new_node->next = cur_node;
-						return;
-					}
-					++_index;
-				}
-#ifdef DEBUG
+				++_index;
 			}
-			if (index > mLength)
-				throw std::invalid_argument("Invalid index, out of range");
-			throw std::runtime_error("Linked list is empty and uninitialised, use append instead");
-#endif
 		}
 
 		/**
@@ -530,40 +501,34 @@ namespace custom {
 		 * @param index - an unsigned integer to represent the index of the list to insert into.
 		 */
 		void insert(T&& data, const size_t& index) {
-#ifdef DEBUG
-			if (mLength && index <= mLength) {
-#endif
-				Node* new_node = new Node(std::move(data));
-				++mLength;
-				if (index == 0) {
-					new_node->next = head;
-					head = new_node;
-					return;
-				}
-				if (index == mLength) {
-					tail->next = new_node;
-					tail = new_node;
+			tracing::Scope scope(tracing::Operation::Insert);
+			check<std::runtime_error>(mLength != 0, "Linked list is empty and uninitialised, use append instead");
+			check<std::invalid_argument>(index <= mLength, "Invalid index, out of range");
+			Node* new_node = create_node(std::move(data));
+			++mLength;
+			if (index == 0) {
+				new_node->next = head;
+				head = new_node;
+				return;
+			}
+			if (index + 1 == mLength) {
+				tail->next = new_node;
+				tail = new_node;
+				return;
+			}
+			size_t _index = 1;
+			Node* cur_node = head;
+			Node* last_node;
+			while (true) {
+				last_node = cur_node;
+				cur_node = cur_node->next;
+				if (_index == index) {
+					last_node->next = new_node;
+					new_node->next = cur_node;
 					return;
 				}
-				size_t _index = 1;
-				Node* cur_node = head;
-				Node* last_node;
-				while (true) {
-					last_node = cur_node;
-					cur_node = cur_node->next;
-					if (_index == index) {
-						last_node->next = new_node;
-						new_node->next = cur_node;
-						return;
-					}
-					++_index;
-				}
-#ifdef DEBUG
+				++_index;
 			}
-			if (mLength && index > mLength)
-				throw std::invalid_argument("Invalid index, out of range");
-			throw std::runtime_error("Linked list is empty and uninitialised, use append instead");
-#endif
 		}
 
 		/**
@@ -573,10 +538,13 @@ namespace custom {
 		 * @param data - the data to be copied into a new node at the beginning of the list.
 		 */
 		void push_front(const T& data) noexcept {
-			Node* new_node = new Node(data);
+			tracing::Scope scope(tracing::Operation::Insert);
+			Node* new_node = create_node(data);
 			++mLength;
 			new_node->next = head;
 			head = new_node;
+			if (mLength == 1)
+				tail = new_node;
 		}
 
 		/**
@@ -586,10 +554,13 @@ namespace custom {
 		 * @param data - an *r-value reference* to the data to be moved into a new node at the beginning of the list.
 		 */
 		void push_front(T&& data) noexcept {
-			Node* new_node = new Node(std::move(data));
+			tracing::Scope scope(tracing::Operation::Insert);
+			Node* new_node = create_node(std::move(data));
 			++mLength;
 			new_node->next = head;
 			head = new_node;
+			if (mLength == 1)
+				tail = new_node;
 		}
 
 		/**
@@ -599,6 +570,7 @@ namespace custom {
 		 * @see <a href="https://en.cppreference.com/w/cpp/container/vector">std::vector</a>
 		 */
 		[[nodiscard]] std::vector<T> contents() const noexcept {
+			tracing::Scope scope(tracing::Operation::Traversal);
 			std::vector<T> elems(mLength);
 			Node* cur_node = head;
 			for (int i = 0; i < mLength; ++i) {
@@ -618,22 +590,17 @@ namespace custom {
 		 * @return - an integer value representing the index of the node with the data.
 		 */
 		[[nodiscard]] int find(const T& data) const {
-#ifdef DEBUG
-			if (mLength) {
-#endif
-				int index = 0;
-				Node* cur_node = head;
-				while (cur_node) {
-					if (cur_node->data == data)
-						return index;
-					cur_node = cur_node->next;
-					++index;
-				}
-				return -1;
-#ifdef DEBUG
+			tracing::Scope scope(tracing::Operation::Lookup);
+			check<std::runtime_error>(mLength != 0, "Error: Linked list is empty, there is no content to search");
+			int index = 0;
+			Node* cur_node = head;
+			while (cur_node) {
+				if (cur_node->data == data)
+					return index;
+				cur_node = cur_node->next;
+				++index;
 			}
-			throw std::runtime_error("Error: Linked list is empty, there is no content to search");
-#endif
+			return -1;
 		}
 
 		/**
@@ -645,17 +612,11 @@ namespace custom {
 		 * @see <a href="https://en.cppreference.com/w/cpp/io/cout">std::cout</a>
 		 */
 		void display() const {
-#ifdef DEBUG
-			if (mLength) {
-#endif
-				std::vector<T> vals = contents();
-				for (const T& i: vals)
-					std::cout << i << "\t";
-				std::cout << "\n";
-#ifdef DEBUG
-			} else
-				throw std::runtime_error("Error: Linked list is empty, nothing to display");
-#endif
+			check<std::runtime_error>(mLength != 0, "Error: Linked list is empty, nothing to display");
+			std::vector<T> vals = contents();
+			for (const T& i: vals)
+				std::cout << i << "\t";
+			std::cout << "\n";
 		}
 
 		/**
@@ -676,6 +637,56 @@ namespace custom {
 			return mLength == 0;
 		}
 
+		/**
+		 * Returns a breakdown of the memory held by the list: the data of the elements is the payload, while the pointer
+		 * to the next node, the padding of each node and the list object itself are structural overhead.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - a MemoryUsage object with the bytes of payload, structure and estimated allocator overhead.
+		 */
+		[[nodiscard]] MemoryUsage memory_usage() const noexcept {
+			MemoryUsage usage;
+			usage.structure = sizeof(*this);
+			memory_detail::add_blocks(usage, mLength, sizeof(Node), sizeof(T));
+			return usage;
+		}
+
+		/**
+		 * Serializes the list in the binary format of Serialization.h, from the head to the tail.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the list.
+		 * @param out - the serialization::Writer to append the list to.
+		 */
+		void serialize(serialization::Writer& out) const {
+			out.header<T>(serialization::Kind::LinkedList, mLength);
+			for (Node* node = head; node; node = node->next)
+				out.value(node->data);
+		}
+
+		/**
+		 * Deserializes a list written by serialize(). If the data does not hold a serialized LinkedList of `T`, a
+		 * `runtime_error` exception is thrown.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the list.
+		 * @param in - the serialization::Reader to read the list from.
+		 * @return - the list.
+		 */
+		static LinkedList deserialize(serialization::Reader& in) {
+			size_t count = in.header<T>(serialization::Kind::LinkedList).count;
+			LinkedList result;
+			for (size_t i = 0; i < count; ++i)
+				result.append(in.value<T>());
+			return result;
+		}
+
+		/**
+		 * Returns a read-only view of the elements of a list written by serialize(), in place in the data, from the
+		 * head to the tail. Only available for trivially copyable elements.
+		 * **Time Complexity** = *O(1)*.
+		 * @param in - the serialization::Reader to read the list from.
+		 * @return - a span of the elements, valid as long as the data.
+		 */
+		static std::span<const T> view(serialization::Reader& in) requires serialization::Codec<T>::raw {
+			return in.view<T>(in.header<T>(serialization::Kind::LinkedList).count);
+		}
+
 		/**
 		 * Conversion operator for boolean type. Evaluates to `true` if the size of the list is not 0, otherwise
 		 * it evaluates to `false`.
@@ -694,7 +705,7 @@ namespace custom {
 		 * @param other - a LinkedList object of the same type `T`, whose data to compare against.
 		 * @return - a boolean value indicating whether the two lists contain the same data.
 		 */
-		[[nodiscard]] bool operator==(const LinkedList<T>& other) const noexcept {
+		[[nodiscard]] bool operator==(const LinkedList& other) const noexcept {
 			if (mLength != other.mLength)
 				return false;
 			Node* cur = head;
@@ -716,7 +727,7 @@ namespace custom {
 		 * @param other - a LinkedList object of the same type `T`, whose data to compare against.
 		 * @return - a boolean value indicating whether the two lists contain different data.
 		 */
-		[[nodiscard]] bool operator!=(const LinkedList<T>& other) const noexcept {
+		[[nodiscard]] bool operator!=(const LinkedList& other) const noexcept {
 			return !(*this == other);
 		}
 
@@ -727,38 +738,33 @@ namespace custom {
 		 * @param index - an unsigned integer specifying the index of the element to be removed.
 		 */
 		void erase(const size_t& index) {
-#ifdef DEBUG
-			if (mLength && index < mLength) {
-#endif
-				if (index == 0) {
-					Node* head_cpy = head;
-					head = head->next;
-					delete head_cpy;
+			tracing::Scope scope(tracing::Operation::Erase);
+			check<std::runtime_error>(mLength != 0, "Error: Linked list is empty, there is nothing to erase");
+			check<std::invalid_argument>(index < mLength, "Invalid index, out of range");
+			if (index == 0) {
+				Node* head_cpy = head;
+				head = head->next;
+				destroy_node(head_cpy);
+				if (--mLength == 0)
+					tail = nullptr;
+				return;
+			}
+			size_t cur_index = 1;
+			Node* cur_node = head;
+			while (true) {
+				Node* last_node = cur_node;
+				cur_node = cur_node->next;
+				if (cur_index == index) {
+					last_node->next = cur_node->next;
+					if (last_node->next == nullptr) {
+						tail = last_node;
+					}
+					destroy_node(cur_node);
 					--mLength;
 					return;
 				}
-				size_t cur_index = 1;
-				Node* cur_node = head;
-				while (true) {
-					Node* last_node = cur_node;
-					cur_node = cur_node->next;
-					if (cur_index == index) {
-						last_node->next = cur_node->next;
-						if (last_node->next == nullptr) {
-							tail = last_node;
-						}
-						delete cur_node;
-						--mLength;
-						return;
-					}
-					++cur_index;
-				}
-#ifdef DEBUG
+				++cur_index;
 			}
-			if (mLength && index >= mLength)
-				throw std::invalid_argument("Invalid index, out of range");
-			throw std::runtime_error("Error: Linked list is empty, there is nothing to erase");
-#endif
 		}
 
 		/**
@@ -770,7 +776,7 @@ namespace custom {
 			Node* cur_node = head;
 			while (cur_node) {
 				cur_node = cur_node->next;
-				delete head;
+				destroy_node(head);
 				head = cur_node;
 			}
 			head = nullptr;
@@ -785,26 +791,20 @@ namespace custom {
 		 * @param index - an unsigned integer specifying the index of the element whose data to retrieve.
 		 * @return - a reference to the data of the element at the specified index.
 		 */
-		[[nodiscard]] T& get(const size_t& index) {
-#ifdef DEBUG
-			if (index < mLength) {
-#endif
-				if (index == 0)
-					return head->data;
-				size_t cur_index = 1;
-				Node* cur_node = head;
-				while (true) {
-					cur_node = cur_node->next;
-					if (cur_index == index)
-						return cur_node->data;
-					++cur_index;
-				}
-#ifdef DEBUG
+		[[nodiscard]] T& get(const size_t& index) noexcept(!checks_throw) {
+			tracing::Scope scope(tracing::Operation::Lookup);
+			check<std::runtime_error>(mLength != 0, "Error: Linked list is empty, there is nothing to get");
+			check<std::invalid_argument>(index < mLength, "Invalid index, out of range");
+			if (index == 0)
+				return head->data;
+			size_t cur_index = 1;
+			Node* cur_node = head;
+			while (true) {
+				cur_node = cur_node->next;
+				if (cur_index == index)
+					return cur_node->data;
+				++cur_index;
 			}
-			if (mLength && index >= mLength)
-				throw std::invalid_argument("Invalid index, out of range");
-			throw std::runtime_error("Error: Linked list is empty, there is nothing to get");
-#endif
 		}
 
 		/**
@@ -814,26 +814,20 @@ namespace custom {
 		 * @param index - an unsigned integer specifying the index of the element whose data to retrieve.
 		 * @return - a const reference to the data of the element at the specified index.
 		 */
-		[[nodiscard]] const T& get(const size_t& index) const {
-#ifdef DEBUG
-			if (index < mLength) {
-#endif
-				if (index == 0)
-					return head->data;
-				size_t cur_index = 1;
-				Node* cur_node = head;
-				while (true) {
-					cur_node = cur_node->next;
-					if (cur_index == index)
-						return cur_node->data;
-					++cur_index;
-				}
-#ifdef DEBUG
+		[[nodiscard]] const T& get(const size_t& index) const noexcept(!checks_throw) {
+			tracing::Scope scope(tracing::Operation::Lookup);
+			check<std::runtime_error>(mLength != 0, "Error: Linked list is empty, there is nothing to get");
+			check<std::invalid_argument>(index < mLength, "Invalid index, out of range");
+			if (index == 0)
+				return head->data;
+			size_t cur_index = 1;
+			Node* cur_node = head;
+			while (true) {
+				cur_node = cur_node->next;
+				if (cur_index == index)
+					return cur_node->data;
+				++cur_index;
 			}
-			if (mLength && index >= mLength)
-				throw std::invalid_argument("Invalid index, out of range");
-			throw std::runtime_error("Error: Linked list is empty, there is nothing to get");
-#endif
 		}
 
 		/**
@@ -842,12 +836,9 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 * @return - a reference of the data of the element at the beginning of the list.
 		 */
-		T& front() {
-#ifdef DEBUG
-			if (mLength)
-#endif
-				return head->data;
-			throw std::runtime_error("List is empty, there is nothing at front");
+		T& front() noexcept(!checks_throw) {
+			check<std::runtime_error>(mLength != 0, "List is empty, there is nothing at front");
+			return head->data;
 		}
 
 		/**
@@ -856,12 +847,9 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 * @return - a const reference of the data of the element at the beginning of the list.
 		 */
-		const T& front() const {
-#ifdef DEBUG
-			if (mLength)
-#endif
-				return head->data;
-			throw std::runtime_error("List is empty, there is nothing at front");
+		const T& front() const noexcept(!checks_throw) {
+			check<std::runtime_error>(mLength != 0, "List is empty, there is nothing at front");
+			return head->data;
 		}
 
 		/**
@@ -870,12 +858,9 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 * @return - a reference of the data of the element at the end of the list.
 		 */
-		T& back() {
-#ifdef DEBUG
-			if (mLength)
-#endif
-				return tail->data;
-			throw std::runtime_error("List is empty, there is nothing at back");
+		T& back() noexcept(!checks_throw) {
+			check<std::runtime_error>(mLength != 0, "List is empty, there is nothing at back");
+			return tail->data;
 		}
 
 		/**
@@ -884,12 +869,9 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 * @return - a const reference of the data of the element at the end of the list.
 		 */
-		const T& back() const {
-#ifdef DEBUG
-			if (mLength)
-#endif
-				return tail->data;
-			throw std::runtime_error("List is empty, there is nothing at back");
+		const T& back() const noexcept(!checks_throw) {
+			check<std::runtime_error>(mLength != 0, "List is empty, there is nothing at back");
+			return tail->data;
 		}
 
 		/**
@@ -897,18 +879,14 @@ namespace custom {
 		 * member pointer is `nullptr`, a `runtime_error` exception is thrown.
 		 * **Time Complexity** = *O(1)*.
 		 */
-		void pop_front() {
-#ifdef DEBUG
-			if (mLength) {
-#endif
-				Node* temp = head;
-				head = head->next;
-				delete temp;
-				--mLength;
-#ifdef DEBUG
-			} else
-				throw std::runtime_error("List is empty, there is nothing to pop front");
-#endif
+		void pop_front() noexcept(!checks_throw) {
+			tracing::Scope scope(tracing::Operation::Erase);
+			check<std::runtime_error>(mLength != 0, "List is empty, there is nothing to pop front");
+			Node* temp = head;
+			head = head->next;
+			destroy_node(temp);
+			if (--mLength == 0)
+				tail = nullptr;
 		}
 
 		/**
@@ -917,14 +895,9 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 */
 		void pop_back() {
-#ifdef DEBUG
-			if (mLength)
-#endif
-				erase(mLength - 1);
-#ifdef DEBUG
-			else
-				throw std::runtime_error("List is empty, there is nothing to pop back");
-#endif
+			tracing::Scope scope(tracing::Operation::Erase);
+			check<std::runtime_error>(mLength != 0, "List is empty, there is nothing to pop back");
+			erase(mLength - 1);
 		}
 
 		/**
@@ -933,24 +906,18 @@ namespace custom {
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the list.
 		 */
 		void reverse_order() {
-#ifdef DEBUG
-			if (mLength) {
-#endif
-				Node* cur_node = head;
-				tail = head;
-				Node* last = nullptr;
-				Node* next;
-				while (cur_node) {
-					next = cur_node->next;
-					cur_node->next = last;
-					last = cur_node;
-					cur_node = next;
-				}
-				head = last;
-#ifdef DEBUG
-			} else
-				throw std::runtime_error("Error: linked list is empty and so cannot be reversed");
-#endif
+			check<std::runtime_error>(mLength != 0, "Error: linked list is empty and so cannot be reversed");
+			Node* cur_node = head;
+			tail = head;
+			Node* last = nullptr;
+			Node* next;
+			while (cur_node) {
+				next = cur_node->next;
+				cur_node->next = last;
+				last = cur_node;
+				cur_node = next;
+			}
+			head = last;
 		}
 
 		/**
@@ -960,7 +927,7 @@ namespace custom {
 		 * @param index - an unsigned integer specifying the index of the element whose data to retrieve.
 		 * @return - a reference to the data of the element at the specified index.
 		 */
-		[[nodiscard]] T& operator[](const size_t& index) {
+		[[nodiscard]] T& operator[](const size_t& index) noexcept(!checks_throw) {
 			return get(index);
 		}
 
@@ -971,7 +938,7 @@ namespace custom {
 		 * @param index - an unsigned integer specifying the index of the element whose data to retrieve.
 		 * @return - a const reference to the data of the element at the specified index.
 		 */
-		[[nodiscard]] const T& operator[](const size_t index) const {
+		[[nodiscard]] const T& operator[](const size_t index) const noexcept(!checks_throw) {
 			return get(index);
 		}
 
@@ -981,10 +948,10 @@ namespace custom {
 		 * @param right - a LinkedList object of type `T` to append to the current list.
 		 * @return - a copy of the current list object.
 		 */
-		[[nodiscard]] LinkedList<T> operator+(LinkedList<T>& right) noexcept {
+		[[nodiscard]] LinkedList operator+(LinkedList& right) noexcept {
 			if (right.mLength) {
 				std::vector<T> right_data = right.contents();
-				LinkedList<T> res(*this);
+				LinkedList res(*this);
 				for (const T& i: right_data)
 					res.append(i);
 				return res;
@@ -992,6 +959,15 @@ namespace custom {
 			return *this;
 		}
 
+		/**
+		 * Returns a copy of the allocator the nodes are allocated with.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - the allocator of the list.
+		 */
+		[[nodiscard]] Allocator get_allocator() const noexcept {
+			return mAllocator;
+		}
+
 		/**
 		 * Creates and returns an iterator with the position of the beginning of the list.
 		 * **Time Complexity** = *O(1)*.
@@ -1023,7 +999,7 @@ namespace custom {
 		/**
 		 * A node structure to contain the data at each element and a pointer to the next node in the list.
 		 */
-		struct Node {
+		struct Node : allocation_tracking::TrackedNode<ContainerType::LinkedList> {
 			T data;  /**< The data of type `T` of each element node. */
 			Node* next = nullptr;  /**< A pointer to the next node object in the list. */
 
@@ -1043,7 +1019,35 @@ namespace custom {
 		Node* head;  /**< A pointer to the first node element of the list. */
 		Node* tail;  /**< A pointer to the last node element of the list.  */
 		size_t mLength;  /**< An unsigned integer specifying the number of elements in the list. */
+		[[no_unique_address]] Allocator mAllocator;  /**< The allocator the nodes are allocated with. */
+
+		/**
+		 * Allocates and constructs a node with the allocator of the list.
+		 * @param data - the data of the node, copied or moved into it.
+		 * @return - a pointer to the new node.
+		 */
+		template<typename Data>
+		Node* create_node(Data&& data) noexcept {
+			return allocation_tracking::create_node<ContainerType::LinkedList, Node>(mAllocator, std::forward<Data>(data));
+		}
+
+		/**
+		 * Destroys and deallocates a node from create_node().
+		 * @param node - a pointer to the node.
+		 */
+		void destroy_node(Node* node) noexcept {
+			allocation_tracking::destroy_node<ContainerType::LinkedList>(mAllocator, node);
+		}
 	};
+
+	namespace pmr {
+		/**
+		 * A LinkedList whose nodes are allocated from a `std::pmr::memory_resource`.
+		 * @tparam T - the type of the data to be stored in each node.
+		 */
+		template<typename T>
+		using LinkedList = custom::LinkedList<T, std::pmr::polymorphic_allocator<T>>;
+	}// namespace pmr
 }// namespace custom
 
 #endif// LINKED_LIST_H
\ No newline at end of file
@@ -1,14 +1,24 @@
 #ifndef MAP_H
 #define MAP_H
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <iterator>
 #include <list>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "AllocationTracking.h"
+#include "MemoryUsage.h"
+#include "Serialization.h"
+#include "Tracing.h"
+
 namespace custom {
 	/**
 	 * A template implementation of an unordered map, also known as a hash table, data structure. Each element of the
@@ -19,12 +29,16 @@ namespace custom {
 	 * @tparam U - the type of the key used to access an element's value.
 	 * @tparam T - the type of the value of each element.
 	 * @tparam hasher - the hashing function used on the key of type `U`, set by default to `std::hash<U>`.
+	 * @tparam Allocator - the allocator the hash table and its buckets are allocated with, `std::allocator` by
+	 * default, see pmr::Map.
 	 * @see <a href="https://en.cppreference.com/w/cpp/utility/hash">std::hash</a>
 	 * @see <a href="https://en.wikipedia.org/wiki/Hash_table">Hash table</a>
 	 */
-	template<typename U, typename T, typename hasher = std::hash<U>>
+	template<typename U, typename T, typename hasher = std::hash<U>, typename Allocator = std::allocator<std::pair<U, T>>>
 	class Map {
 	public:
+		using allocator_type = Allocator;  /**< An alias for the allocator the hash table is allocated with. */
+
 		/**
 		 * Default Map constructor which sets the number of hash buckets with the specified value of capacity, which
 		 * has a default value of 12, and initializes the hash table to an empty `std::vector` object, of type
@@ -33,6 +47,22 @@ namespace custom {
 		 */
 		explicit Map(size_t cap = 12) noexcept: capacity(cap), mSize(0), hash_table(cap) {}
 
+		/**
+		 * Overloaded Map constructor which sets the number of hash buckets with the specified value of capacity, and
+		 * allocates the hash table, and the elements in its buckets, with the allocator provided.
+		 * @param cap - an unsigned integer specifying the initial capacity of the hash table.
+		 * @param allocator - the allocator to allocate the hash table with.
+		 */
+		Map(size_t cap, const Allocator& allocator) noexcept: capacity(cap), mSize(0),
+		                                                      hash_table(cap, TableAllocator(allocator)) {}
+
+		/**
+		 * Overloaded Map constructor which allocates the hash table, of the default capacity of 12, and the elements
+		 * in its buckets, with the allocator provided.
+		 * @param allocator - the allocator to allocate the hash table with.
+		 */
+		explicit Map(const Allocator& allocator) noexcept: Map(12, allocator) {}
+
 		/**
 		 * Overloaded Map constructor which adds an element to the map with the key and value specified and sets the
 		 * capacity, i.e. number of hash buckets, of the map to the specified value, with a default value of 12.
@@ -44,8 +74,7 @@ namespace custom {
 		                                                           hash_table(cap) {
 			size_t hash_value = hash(id) %
 			                    capacity;  // Calculate the index of the element. using its hash value and the map capacity.
-			hash_table[hash_value].push_back(
-					{id, data});  // Adds a pair containing the key and value to the list at the hash index.
+			hash_table[hash_value].emplace_back(id, data);  // Adds a pair containing the key and value to the list at the hash index.
 		}
 
 		/**
@@ -56,23 +85,26 @@ namespace custom {
 		 * @param cap - an unsigned integer specifying the initial capacity of the hash table.
 		 */
 		Map(U&& id, T&& data, size_t cap = 12) noexcept: capacity(cap), mSize(1), hash_table(cap) {
-			size_t hash_value = hash(std::move(id)) % capacity;
-			hash_table[hash_value].push_back({id, data});
+			size_t hash_value = hash(id) % capacity;
+			hash_table[hash_value].emplace_back(std::move(id), std::move(data));
 		}
 
 		/**
-		 * Map copy constructor which performs a deep copy of another map object of the same types `U` and `T`.
+		 * Map copy constructor which performs a deep copy of another map object of the same types `U` and `T`, with
+		 * the allocator the allocator of the other map selects for a copy.
 		 *
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the other map.
 		 *
 		 * @param other - another map object of the same types `U` and `T` to copy.
 		 */
-		Map(const Map<U, T>& other) noexcept: capacity(other.capacity), mSize(other.mSize),
-		                                      hash_table(other.hash_table.begin(), other.hash_table.end()) {}
+		Map(const Map& other) noexcept:
+				capacity(other.capacity), mSize(other.mSize),
+				hash_table(other.hash_table, std::allocator_traits<TableAllocator>::select_on_container_copy_construction(
+						other.hash_table.get_allocator())) {}
 
 		/**
 		 * Map copy assignment operator which copies another Map object of the same types `U` and `T` into the current
-		 * object.
+		 * object, which keeps its allocator.
 		 *
 		 * \note
 		 * If the current object is initialized, it will be cleared before copying the other object.
@@ -82,7 +114,7 @@ namespace custom {
 		 * @param other - another map object of the same types `U` and `T` to copy.
 		 * @return - a reference to the current object.
 		 */
-		Map& operator=(const Map<U, T>& other) {
+		Map& operator=(const Map& other) {
 			if (this != &other) {
 				if (!hash_table.empty())
 					clear();
@@ -94,24 +126,25 @@ namespace custom {
 		}
 
 		/**
-		 * Map move constructor which moves another map object of the same types `U` and `T` to this new map object.
+		 * Map move constructor which moves another map object of the same types `U` and `T`, along with its
+		 * allocator, to this new map object.
 		 *
-		 * **Time Complexity** = *O(n)* where n is the number of elements in the other map.
+		 * **Time Complexity** = *O(1)*.
 		 *
 		 * @param other - a *r-value reference* to another map object of the same types `U` and `T` to move.
 		 */
-		Map(Map<U, T>&& other) noexcept: capacity(other.capacity), mSize(other.mSize),
-		                                 hash_table(other.capacity) {
-			hash_table.insert(hash_table.end(), std::make_move_iterator(other.hash_table.begin()),
-			                  std::make_move_iterator(other.hash_table.end()));
+		Map(Map&& other) noexcept: capacity(other.capacity), mSize(other.mSize),
+		                           hash_table(std::move(other.hash_table)) {
 			other.hash_table.clear();
 			other.hash_table.shrink_to_fit();// Frees memory allocated to the vector
 			other.capacity = 0;
+			other.mSize = 0;
 		}
 
 		/**
 		 * Map move assignment operator which moves another Map object of the same types `U` and `T` into the current
-		 * object.
+		 * object, which keeps its allocator. If the allocators do not compare equal, e.g.
+		 * `std::pmr::polymorphic_allocator` objects of different memory resources, the elements are moved one by one.
 		 *
 		 * \note
 		 * If the current object is initialized, it will be cleared before copying the other object.
@@ -121,7 +154,7 @@ namespace custom {
 		 * @param other - a *r-value reference* to another map object of the same types `U` and `T` to move.
 		 * @return - a reference to the current object.
 		 */
-		Map& operator=(Map<U, T>&& other) noexcept {
+		Map& operator=(Map&& other) noexcept {
 			if (this != &other) {
 				if (!hash_table.empty())
 					clear();
@@ -147,9 +180,10 @@ namespace custom {
 		 * @param data - value of type `T` to be copied into the hash table.
 		 */
 		void add(const U& id, const T& data) {
+			tracing::Scope scope(tracing::Operation::Insert);
 			if (!exists(id)) {
 				size_t hash_value = hash(id) % capacity;
-				hash_table[hash_value].push_back({id, data});
+				hash_table[hash_value].emplace_back(id, data);
 				++mSize;
 				return;
 			}
@@ -167,9 +201,10 @@ namespace custom {
 		 * @param data - a *r-value reference* to a value of type `T` to be moved into the hash table.
 		 */
 		void add(U&& id, T&& data) {
+			tracing::Scope scope(tracing::Operation::Insert);
 			if (!exists(id)) {
 				size_t hash_value = hash(id) % capacity;
-				hash_table[hash_value].push_back({id, data});
+				hash_table[hash_value].emplace_back(std::move(id), std::move(data));
 				++mSize;
 				return;
 			}
@@ -187,6 +222,7 @@ namespace custom {
 		 * @return - a reference to the value, of type `T`, at the specified key.
 		 */
 		[[nodiscard]] T& at(const U& id) {
+			tracing::Scope scope(tracing::Operation::Lookup);
 			size_t hash_value = hash(id) % capacity;
 			auto it = std::find_if(hash_table[hash_value].begin(), hash_table[hash_value].end(),
 			                       [&](const auto& element) {
@@ -209,6 +245,7 @@ namespace custom {
 		 * @return - a const reference to the value, of type `T`, at the specified key.
 		 */
 		[[nodiscard]] const T& at(const U& id) const {
+			tracing::Scope scope(tracing::Operation::Lookup);
 			size_t hash_value = hash(id) % capacity;
 			auto it = std::find_if(hash_table[hash_value].begin(), hash_table[hash_value].end(),
 			                       [&](const auto& element) {
@@ -228,6 +265,7 @@ namespace custom {
 		 * @return - a boolean value indicating whether an element with the given key exists.
 		 */
 		[[nodiscard]] bool exists(const U& id) const noexcept {
+			tracing::Scope scope(tracing::Operation::Lookup);
 			if (mSize) {
 				size_t hash_value = hash(id) % capacity;
 				return std::find_if(hash_table[hash_value].begin(), hash_table[hash_value].end(),
@@ -271,6 +309,66 @@ namespace custom {
 			return mSize;
 		}
 
+		/**
+		 * Returns a breakdown of the memory held by the map: the keys and values of the elements are the payload,
+		 * while the vector of buckets, the pointers and padding of each bucket node and the map object itself are
+		 * structural overhead.
+		 *
+		 * **Time Complexity** = *O(1)*.
+		 *
+		 * @return - a MemoryUsage object with the bytes of payload, structure and estimated allocator overhead.
+		 */
+		[[nodiscard]] MemoryUsage memory_usage() const noexcept {
+			MemoryUsage usage;
+			usage.structure = sizeof(*this);
+			memory_detail::add_vector(usage, hash_table);
+			memory_detail::add_blocks(usage, mSize, sizeof(memory_detail::ListNode<std::pair<U, T>>),
+			                          sizeof(std::pair<U, T>));
+			return usage;
+		}
+
+		/**
+		 * Serializes the map in the binary format of Serialization.h, as its number of buckets followed by its key-value
+		 * pairs in the order of the hash table.
+		 *
+		 * **Time Complexity** = *O(n + c)* where n is the number of elements and c is the capacity of the map.
+		 *
+		 * @param out - the serialization::Writer to append the map to.
+		 */
+		void serialize(serialization::Writer& out) const {
+			out.header<std::pair<U, T>>(serialization::Kind::Map, mSize, capacity);
+			for (const Bucket& bucket: hash_table) {
+				for (const std::pair<U, T>& element: bucket)
+					out.value(element);
+			}
+		}
+
+		/**
+		 * Deserializes a map written by serialize(), with the same number of buckets. If the data does not hold a
+		 * serialized Map of `U` keys and `T` values, holds a key more than once, or has no buckets or more than 64
+		 * for each element (or for each of the 12 default buckets, for a smaller map), an exception is thrown.
+		 *
+		 * **Time Complexity** = *O(n + c)* where n is the number of elements and c is the capacity of the map.
+		 *
+		 * @param in - the serialization::Reader to read the map from.
+		 * @return - the map.
+		 */
+		static Map deserialize(serialization::Reader& in) {
+			serialization::Header header = in.header<std::pair<U, T>>(serialization::Kind::Map);
+			if (!header.extra)
+				throw std::runtime_error("Error: the serialized Map has no buckets");
+			// The table never grows, so a sparse one is plausible, but a corrupt bucket count is rejected before
+			// memory is reserved for it: up to 64 buckets for each element, or for each of the default 12 buckets
+			if (header.extra / 64 > std::max<std::uint64_t>(header.count, 12))
+				throw std::runtime_error("Error: the serialized Map has more buckets than its elements can fill");
+			Map result(header.extra);
+			for (size_t i = 0; i < header.count; ++i) {
+				auto element = in.value<std::pair<U, T>>();
+				result.add(std::move(element.first), std::move(element.second));
+			}
+			return result;
+		}
+
 		/**
 		 * Changes the value, of type `T`, for a given key, of type `U`.
 		 *
@@ -327,6 +425,7 @@ namespace custom {
 		 * @return - a reference to the value of the key specified.
 		 */
 		T& operator[](const U& id) noexcept {
+			tracing::Scope scope(tracing::Operation::Lookup);
 			size_t hash_value = hash(id) % capacity;
 			auto it = std::find_if(hash_table[hash_value].begin(), hash_table[hash_value].end(),
 			                       [&](const auto& element) {
@@ -346,6 +445,7 @@ namespace custom {
 		 * @return - a `std::vector` containing a `std::pair` of the key and value of each element.
 		 */
 		[[nodiscard]] std::vector<std::pair<U, T>> contents() const noexcept {
+			tracing::Scope scope(tracing::Operation::Traversal);
 			std::vector<std::pair<U, T>> ret = {};
 			if (mSize) {
 				for (int i = 0; i < capacity; ++i) {
@@ -389,6 +489,7 @@ namespace custom {
 		 * @param id - the key, of type `U`, of the element to remove.
 		 */
 		void remove(const U& id) {
+			tracing::Scope scope(tracing::Operation::Erase);
 			if (mSize) {
 				size_t hash_value = hash(id) % capacity;
 				auto it = std::find_if(hash_table[hash_value].begin(), hash_table[hash_value].end(),
@@ -406,6 +507,20 @@ namespace custom {
 			throw std::invalid_argument("Id provided not found");
 		}
 
+		/**
+		 * Returns a copy of the allocator the hash table is allocated with.
+		 *
+		 * **Time Complexity** = *O(1)*.
+		 *
+		 * @return - the allocator of the map.
+		 */
+		[[nodiscard]] Allocator get_allocator() const noexcept {
+			if constexpr (allocation_tracking::default_allocator<Allocator>)
+				return Allocator();
+			else
+				return Allocator(hash_table.get_allocator());
+		}
+
 		/**
 		 * Clears the hash table of the map.
 		 */
@@ -424,7 +539,20 @@ namespace custom {
 	private:
 		size_t capacity;  /**< An unsigned integer representing the number of buckets in the hash table. */
 		size_t mSize;  /**< An unsigned integer representing the number of elements in the map. */
-		std::vector<std::list<std::pair<U, T>>> hash_table; /**< The hash table containing all the elements of the map, stored in their hashed indices. */
+		/**
+		 * The allocator of the hash table and its buckets, rebound to the type allocated. With `std::allocator` it is
+		 * the allocator recording allocations for the map, otherwise the allocator of the map rebound, which a
+		 * `std::pmr::polymorphic_allocator` passes on to every bucket of the hash table.
+		 * @tparam Element - the type allocated.
+		 */
+		template<typename Element>
+		using InnerAllocator = std::conditional_t<allocation_tracking::default_allocator<Allocator>,
+		                                          allocation_tracking::Allocator<Element, ContainerType::Map>,
+		                                          typename std::allocator_traits<Allocator>::template rebind_alloc<Element>>;
+		using Bucket = std::list<std::pair<U, T>, InnerAllocator<std::pair<U, T>>>;  /**< A bucket of the hash table, holding the elements whose keys hash to its index. */
+		using TableAllocator = InnerAllocator<Bucket>;  /**< The allocator of the hash table. */
+
+		std::vector<Bucket, TableAllocator> hash_table; /**< The hash table containing all the elements of the map, stored in their hashed indices. */
 		hasher hash;  /**< A hash object created from the `hasher` template argument, which can act as a functor to hash a given id. */
 
 		/**
@@ -438,11 +566,22 @@ namespace custom {
 		 */
 		T& add_op(const U& id, T&& data) noexcept {
 			size_t hash_value = hash(id) % capacity;
-			hash_table[hash_value].push_back({id, data});
+			hash_table[hash_value].emplace_back(id, std::move(data));
 			++mSize;
 			return hash_table[hash_value].back().second;
 		}
 	};
+
+	namespace pmr {
+		/**
+		 * A Map whose hash table and elements are allocated from a `std::pmr::memory_resource`.
+		 * @tparam U - the type of the key used to access an element's value.
+		 * @tparam T - the type of the value of each element.
+		 * @tparam hasher - the hashing function used on the key of type `U`, set by default to `std::hash<U>`.
+		 */
+		template<typename U, typename T, typename hasher = std::hash<U>>
+		using Map = custom::Map<U, T, hasher, std::pmr::polymorphic_allocator<std::pair<U, T>>>;
+	}// namespace pmr
 }// namespace custom
 
 #endif// MAP_H
\ No newline at end of file
@@ -0,0 +1,94 @@
+#ifndef MEMORY_USAGE_H
+#define MEMORY_USAGE_H
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace custom {
+	/**
+	 * A breakdown of the memory held by a container, as returned by the `memory_usage()` function of each container.
+	 * The payload is measured shallowly, as `sizeof` the elements, so memory owned by the elements themselves, e.g.
+	 * the characters of a long `std::string`, is not included.
+	 */
+	struct MemoryUsage {
+		size_t payload = 0;  /**< The bytes holding the elements, and the keys or IDs stored with them. */
+		size_t structure = 0;  /**< The bytes the container uses beyond the payload: the container object itself, the links of its nodes, unused capacity and its index structures. */
+		size_t allocator = 0;  /**< An estimate of the bytes the allocator uses beyond the blocks requested, for its block headers and its rounding of block sizes. */
+		size_t allocations = 0;  /**< The number of heap blocks held by the container. */
+
+		/**
+		 * Returns the total number of bytes the container costs, including the estimated allocator overhead.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - an unsigned integer representing the total number of bytes.
+		 */
+		[[nodiscard]] constexpr size_t total() const noexcept {
+			return payload + structure + allocator;
+		}
+
+		/**
+		 * Returns the share of the total bytes which hold the payload, between 0 and 1.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - the ratio of the payload to the total, or 0 if the total is 0.
+		 */
+		[[nodiscard]] constexpr double efficiency() const noexcept {
+			return total() ? static_cast<double>(payload) / static_cast<double>(total()) : 0.0;
+		}
+
+		/**
+		 * Adds the memory usage of another container or part of a container to this one.
+		 * **Time Complexity** = *O(1)*.
+		 * @param other - the memory usage to add.
+		 * @return - a reference to the current object.
+		 */
+		constexpr MemoryUsage& operator+=(const MemoryUsage& other) noexcept {
+			payload += other.payload;
+			structure += other.structure;
+			allocator += other.allocator;
+			allocations += other.allocations;
+			return *this;
+		}
+	};
+
+	namespace memory_detail {
+		// Models glibc malloc: an 8-byte header, 16-byte granularity and a 32-byte minimum for small blocks, and
+		// page-rounded mappings with a 16-byte header from the 128 KiB mmap threshold upwards
+		constexpr size_t allocator_overhead(size_t bytes) noexcept {
+			if (bytes == 0)
+				return 0;
+			if (bytes >= 128 * 1024)
+				return ((bytes + 16 + 4095) & ~size_t{4095}) - bytes;
+			size_t block = (bytes + sizeof(size_t) + 15) & ~size_t{15};
+			return (block < 32 ? 32 : block) - bytes;
+		}
+
+		// Adds `count` heap blocks of `bytes` bytes, of which `payload` bytes hold elements
+		constexpr void add_blocks(MemoryUsage& usage, size_t count, size_t bytes, size_t payload) noexcept {
+			usage.payload += count * payload;
+			usage.structure += count * (bytes - payload);
+			usage.allocator += count * allocator_overhead(bytes);
+			usage.allocations += count;
+		}
+
+		// Adds the heap block of a std::vector used as part of the structure of a container
+		template<typename T, typename Allocator>
+		void add_vector(MemoryUsage& usage, const std::vector<T, Allocator>& vector) noexcept {
+			if (vector.capacity())
+				add_blocks(usage, 1, vector.capacity() * sizeof(T), 0);
+		}
+
+		// The size of a node of std::list, which adds a pointer to the next and previous node to the element
+		template<typename T>
+		struct ListNode {
+			void* next;
+			void* prev;
+			T data;
+		};
+
+		// The bytes new[] stores before an array to record its length, when its elements need destroying
+		template<typename T>
+		inline constexpr size_t array_cookie = std::is_trivially_destructible_v<T> ? 0 : sizeof(size_t);
+	}
+}// namespace custom
+
+#endif// MEMORY_USAGE_H
@@ -0,0 +1,309 @@
+#ifndef MULTI_QUEUE_H
+#define MULTI_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace custom {
+	/**
+	 * A template implementation of a relaxed concurrent priority queue, following the MultiQueue design. The elements
+	 * are spread over `c * p` sequential binary heaps, where p is the number of threads using the queue and c a small
+	 * factor, each guarded by its own try-lock. A push inserts into a random heap and a pop removes the better of the
+	 * tops of two random heaps, so threads rarely contend for the same lock.
+	 *
+	 * The order is relaxed: a pop may return an element which is not the best one in the queue, but the expected
+	 * rank of the element returned, i.e. the number of better elements left in the queue, is `O(c * p)`. The rank
+	 * error of a sequence of pops can be measured with rank_error().
+	 *
+	 * \note
+	 * Every method may be called concurrently from any number of threads. length() and empty() are only exact when
+	 * no other thread is modifying the queue.
+	 *
+	 * @tparam T - the type of the elements stored in the queue.
+	 * @tparam Compare - the type of the comparison object, the element which compares less than every other element
+	 * is the best one, i.e. the default `std::less<T>` makes a min-priority queue.
+	 * @see <a href="https://arxiv.org/abs/1411.1209">MultiQueues: Simple Relaxed Concurrent Priority Queues</a>
+	 */
+	template<typename T, typename Compare = std::less<T>>
+	class MultiQueue {
+	public:
+		/**
+		 * Constructs an empty MultiQueue with `factor * threads` heaps, at least two.
+		 * @param threads - the number of threads expected to use the queue concurrently.
+		 * @param factor - the number of heaps per thread, a larger factor lowers contention but raises the rank error.
+		 * @param compare - the comparison object deciding the priority of the elements.
+		 */
+		explicit MultiQueue(size_t threads = std::max(1U, std::thread::hardware_concurrency()), size_t factor = 2,
+		                    Compare compare = Compare()) : mCount(std::max<size_t>(2, threads * factor)),
+		                                                   mHeaps(std::make_unique<Heap[]>(mCount)),
+		                                                   mCompare(std::move(compare)) {}
+
+		MultiQueue(const MultiQueue&) = delete;
+
+		MultiQueue& operator=(const MultiQueue&) = delete;
+
+		/**
+		 * Copies an element into a random heap.
+		 * **Time Complexity** = *O(log n)* where n is the number of elements in the heap.
+		 * @param data - the element to be copied into the queue.
+		 */
+		void push(const T& data) {
+			emplace(data);
+		}
+
+		/**
+		 * Moves an element into a random heap.
+		 * **Time Complexity** = *O(log n)* where n is the number of elements in the heap.
+		 * @param data - an *r-value reference* to the element to be moved into the queue.
+		 */
+		void push(T&& data) {
+			emplace(std::move(data));
+		}
+
+		/**
+		 * Constructs an element in place in a random heap. Heaps which are locked by another thread are skipped.
+		 * **Time Complexity** = *O(log n)* where n is the number of elements in the heap.
+		 * @tparam Args - the types of the arguments forwarded to the constructor of `T`.
+		 * @param args - the arguments forwarded to the constructor of `T`.
+		 */
+		template<typename... Args>
+		void emplace(Args&& ... args) {
+			std::uint64_t& seed = this_seed();
+			for (size_t failures = 1;; ++failures) {
+				Heap& heap = mHeaps[next_random(seed) % mCount];
+				if (!heap.try_lock()) {
+					if (failures % mCount == 0)
+						std::this_thread::yield();
+					continue;
+				}
+				std::lock_guard<Heap> unlock(heap, std::adopt_lock);  // Unlocks the heap even if `T` or the comparison throws
+				heap.elements.emplace_back(std::forward<Args>(args)...);
+				std::push_heap(heap.elements.begin(), heap.elements.end(), Reversed{mCompare});
+				heap.size.store(heap.elements.size(), std::memory_order_relaxed);
+				return;
+			}
+		}
+
+		/**
+		 * Removes an element, usually among the best in the queue, and passes an *r-value reference* to it to the
+		 * function provided while the heap it was taken from is still locked. Ordering the pops of several threads by
+		 * a counter incremented within the function gives a valid linearisation, e.g. to measure the rank error.
+		 * Returns `false` only if the queue was found to be empty.
+		 * **Time Complexity** = *O(log n)* where n is the number of elements in the heap.
+		 * @tparam Function - the type of the callable, invocable with an *r-value reference* to `T`.
+		 * @param function - the callable to pass the element removed to.
+		 * @return - a boolean value indicating whether an element was removed.
+		 */
+		template<typename Function>
+		bool try_pop(Function&& function) {
+			std::uint64_t& seed = this_seed();
+			for (size_t attempt = 0; attempt < 2 * mCount; ++attempt) {
+				size_t first = next_random(seed) % mCount;
+				size_t second = next_random(seed) % (mCount - 1);
+				second += second >= first;
+				if (mHeaps[first].size.load(std::memory_order_relaxed) == 0)
+					std::swap(first, second);
+				if (mHeaps[first].size.load(std::memory_order_relaxed) == 0 || !mHeaps[first].try_lock())
+					continue;
+				Heap* best = &mHeaps[first];
+				Heap& other = mHeaps[second];
+				if (other.size.load(std::memory_order_relaxed) != 0 && other.try_lock()) {
+					if (best->elements.empty() ||
+					    (!other.elements.empty() && mCompare(other.elements.front(), best->elements.front()))) {
+						best->unlock();
+						best = &other;
+					} else
+						other.unlock();
+				}
+				if (!best->elements.empty()) {
+					pop_locked(*best, function);
+					return true;
+				}
+				best->unlock();
+			}
+			// The random probes kept finding empty heaps, fall back to scanning every heap in turn
+			for (size_t i = 0; i < mCount; ++i) {
+				Heap& heap = mHeaps[i];
+				if (heap.size.load(std::memory_order_relaxed) == 0)
+					continue;
+				heap.lock();
+				if (!heap.elements.empty()) {
+					pop_locked(heap, function);
+					return true;
+				}
+				heap.unlock();
+			}
+			return false;
+		}
+
+		/**
+		 * Removes an element, usually among the best in the queue, and returns it, or `std::nullopt` if the queue was
+		 * found to be empty.
+		 * **Time Complexity** = *O(log n)* where n is the number of elements in the heap.
+		 * @return - the element removed, if any.
+		 */
+		std::optional<T> try_pop() {
+			std::optional<T> result;
+			try_pop([&result](T&& data) { result.emplace(std::move(data)); });
+			return result;
+		}
+
+		/**
+		 * Provides a value for the number of elements in the queue, summed over every heap without locking them.
+		 * **Time Complexity** = *O(c * p)*.
+		 * @return - an unsigned integer representing the number of elements in the queue.
+		 */
+		[[nodiscard]] size_t length() const noexcept {
+			size_t total = 0;
+			for (size_t i = 0; i < mCount; ++i)
+				total += mHeaps[i].size.load(std::memory_order_relaxed);
+			return total;
+		}
+
+		/**
+		 * Provides a boolean value that indicates whether the queue contains any elements.
+		 * **Time Complexity** = *O(c * p)*.
+		 * @return - a boolean value that indicates whether the queue is empty or not.
+		 */
+		[[nodiscard]] bool empty() const noexcept {
+			return length() == 0;
+		}
+
+		/**
+		 * Provides the number of sequential heaps the elements are spread over.
+		 * @return - an unsigned integer representing the number of heaps, `c * p`.
+		 */
+		[[nodiscard]] size_t heap_count() const noexcept {
+			return mCount;
+		}
+
+	private:
+		/**
+		 * A sequential binary heap guarded by a spin lock, padded to its own cache line.
+		 */
+		struct alignas(64) Heap {
+			std::atomic<bool> locked{false};  /**< Whether a thread currently owns the heap. */
+			std::atomic<size_t> size{0};  /**< The number of elements in the heap, read without locking. */
+			std::vector<T> elements;  /**< The elements of the heap, the best one at the front. */
+
+			bool try_lock() noexcept {
+				return !locked.load(std::memory_order_relaxed) && !locked.exchange(true, std::memory_order_acquire);
+			}
+
+			void lock() noexcept {
+				while (!try_lock())
+					std::this_thread::yield();
+			}
+
+			void unlock() noexcept {
+				locked.store(false, std::memory_order_release);
+			}
+		};
+
+		/**
+		 * Adapts the comparison object to the max-heap algorithms of the standard library, so the best element is kept
+		 * at the front of each heap.
+		 */
+		struct Reversed {
+			const Compare& compare;
+
+			bool operator()(const T& left, const T& right) const {
+				return compare(right, left);
+			}
+		};
+
+		size_t mCount;  /**< The number of heaps. */
+		std::unique_ptr<Heap[]> mHeaps;  /**< The heaps the elements are spread over. */
+		Compare mCompare;  /**< The comparison object deciding the priority of the elements. */
+
+		/**
+		 * Removes the best element of a locked, non-empty heap, passes it to the function provided and unlocks the heap,
+		 * even if the function throws.
+		 */
+		template<typename Function>
+		void pop_locked(Heap& heap, Function& function) {
+			std::lock_guard<Heap> unlock(heap, std::adopt_lock);
+			std::pop_heap(heap.elements.begin(), heap.elements.end(), Reversed{mCompare});
+			T data = std::move(heap.elements.back());
+			heap.elements.pop_back();
+			heap.size.store(heap.elements.size(), std::memory_order_relaxed);
+			function(std::move(data));
+		}
+
+		static std::uint64_t& this_seed() noexcept {
+			thread_local std::uint64_t seed = 0x9E3779B97F4A7C15ULL ^ std::hash<std::thread::id>()(std::this_thread::get_id());
+			return seed;
+		}
+
+		static std::uint64_t next_random(std::uint64_t& state) noexcept {
+			// xorshift64*
+			state ^= state >> 12;
+			state ^= state << 25;
+			state ^= state >> 27;
+			return state * 0x2545F4914F6CDD1DULL;
+		}
+	};
+
+	/**
+	 * The rank error of a sequence of pops from a relaxed priority queue.
+	 */
+	struct RankError {
+		double mean = 0.0;  /**< The average rank of the elements popped. */
+		size_t max = 0;  /**< The largest rank of any element popped. */
+	};
+
+	/**
+	 * Measures the rank error of the order in which the elements of a priority queue were popped, where the queue held
+	 * every element before the first pop and none were pushed in between. The rank of a popped element is the number
+	 * of elements still in the queue which compare less than it, so a strict priority queue has a rank error of 0.
+	 * **Time Complexity** = *O(n log n)* where n is the number of elements popped.
+	 * @tparam RandomIt - the type of the random-access iterators over the elements, in the order they were popped.
+	 * @tparam Compare - the type of the comparison object used by the queue.
+	 * @param first - an iterator to the first element popped.
+	 * @param last - an iterator past the last element popped.
+	 * @param compare - the comparison object used by the queue.
+	 * @return - the mean and maximum rank of the elements popped.
+	 */
+	template<typename RandomIt, typename Compare = std::less<>>
+	RankError rank_error(RandomIt first, RandomIt last, Compare compare = Compare()) {
+		auto count = static_cast<size_t>(std::distance(first, last));
+		RankError result;
+		if (count == 0)
+			return result;
+		// Position of each pop in sorted order, ties broken by pop order so equal elements never count as better
+		std::vector<size_t> order(count);
+		for (size_t i = 0; i < count; ++i)
+			order[i] = i;
+		std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return compare(first[a], first[b]); });
+		std::vector<size_t> rank_of(count);
+		for (size_t i = 0; i < count; ++i)
+			rank_of[order[i]] = i;
+		// A Fenwick tree counting the elements already popped with a lower rank
+		std::vector<size_t> tree(count + 1, 0);
+		double total = 0.0;
+		for (size_t i = 0; i < count; ++i) {
+			size_t popped_before = 0;
+			for (size_t j = rank_of[i]; j > 0; j -= j & (~j + 1))
+				popped_before += tree[j];
+			size_t rank = rank_of[i] - popped_before;
+			total += static_cast<double>(rank);
+			result.max = std::max(result.max, rank);
+			for (size_t j = rank_of[i] + 1; j <= count; j += j & (~j + 1))
+				++tree[j];
+		}
+		result.mean = total / static_cast<double>(count);
+		return result;
+	}
+}// namespace custom
+
+#endif// MULTI_QUEUE_H
@@ -0,0 +1,388 @@
+#ifndef PARALLEL_SORT_H
+#define PARALLEL_SORT_H
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "SortingAlgorithms.h"
+#include "ThreadPool.h"
+
+namespace custom {
+	namespace sort_detail {
+		// Ranges with fewer elements than this are sorted sequentially
+		inline constexpr std::ptrdiff_t parallel_sort_cutoff = 1 << 14;
+		// Merges with fewer elements than this are performed sequentially
+		inline constexpr std::ptrdiff_t parallel_merge_cutoff = 1 << 13;
+		// The number of samples taken per bucket by the sample sort to choose its splitters
+		inline constexpr size_t sample_sort_oversampling = 32;
+
+		// Runs both callables, the first one as a task on the pool, and waits for both to complete even if one throws
+		template<typename Left, typename Right>
+		void fork_join(ThreadPool& pool, Left&& left, Right&& right) {
+			WaitGroup group;
+			pool.spawn(group, std::forward<Left>(left));
+			std::exception_ptr exception;
+			try {
+				right();
+			} catch (...) {
+				exception = std::current_exception();
+			}
+			pool.sync(group);
+			if (exception)
+				std::rethrow_exception(exception);
+		}
+
+		// Stable merge of the sorted ranges [first1, last1) and [first2, last2) into out. The larger range is split at
+		// its middle element and the other one at the matching bound, the two halves then being merged in parallel.
+		// Ties go to the first range, which holds the earlier elements
+		template<typename In, typename Out, typename Compare>
+		void parallel_merge(ThreadPool& pool, In first1, In last1, In first2, In last2, Out out, Compare& comp) {
+			std::ptrdiff_t size1 = last1 - first1;
+			std::ptrdiff_t size2 = last2 - first2;
+			if (size1 + size2 <= parallel_merge_cutoff) {
+				std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+				           std::make_move_iterator(first2), std::make_move_iterator(last2), out, comp);
+				return;
+			}
+			In middle1, middle2;
+			if (size1 >= size2) {
+				middle1 = first1 + size1 / 2;
+				middle2 = std::lower_bound(first2, last2, *middle1, comp);
+			} else {
+				middle2 = first2 + size2 / 2;
+				middle1 = std::upper_bound(first1, last1, *middle2, comp);
+			}
+			Out middle_out = out + (middle1 - first1) + (middle2 - first2);
+			fork_join(pool,
+			          [&] { parallel_merge(pool, first1, middle1, first2, middle2, out, comp); },
+			          [&] { parallel_merge(pool, middle1, last1, middle2, last2, middle_out, comp); });
+		}
+
+		// Sorts [first, first + size) stably, leaving the result in the range itself or, if to_buffer is set, in the
+		// buffer. Each half is sorted into the other location so the final merge lands where it is wanted
+		template<typename Iter, typename T, typename Compare>
+		void parallel_merge_sort(ThreadPool& pool, Iter first, T* buffer, std::ptrdiff_t size, bool to_buffer,
+		                         Compare& comp) {
+			if (size <= parallel_sort_cutoff) {
+				std::stable_sort(first, first + size, comp);
+				if (to_buffer)
+					std::move(first, first + size, buffer);
+				return;
+			}
+			std::ptrdiff_t half = size / 2;
+			fork_join(pool,
+			          [&] { parallel_merge_sort(pool, first, buffer, half, !to_buffer, comp); },
+			          [&] { parallel_merge_sort(pool, first + half, buffer + half, size - half, !to_buffer, comp); });
+			if (to_buffer)
+				parallel_merge(pool, first, first + half, first + half, first + size, buffer, comp);
+			else
+				parallel_merge(pool, buffer, buffer + half, buffer + half, buffer + size, first, comp);
+		}
+
+		// Sample sort: the elements are distributed into buckets delimited by splitters chosen from a sorted random
+		// sample, the buckets then being sorted independently with pdq_sort
+		template<typename Iter, typename Compare>
+		void parallel_sample_sort(ThreadPool& pool, Iter first, std::ptrdiff_t size, Compare& comp) {
+			using T = typename std::iterator_traits<Iter>::value_type;
+			auto count = static_cast<size_t>(size);
+			size_t buckets = std::clamp<size_t>(4 * pool.size(), 2, 4096);
+			buckets = std::min(buckets, count / (parallel_sort_cutoff / 4));
+			size_t blocks = std::min(buckets, std::max<size_t>(1, count / parallel_sort_cutoff));
+			size_t block_size = (count + blocks - 1) / blocks;
+
+			// Choose the splitters from a sorted, oversampled random sample
+			std::vector<T> sample;
+			sample.reserve(buckets * sample_sort_oversampling);
+			std::uint64_t seed = 0x9E3779B97F4A7C15ULL ^ count;
+			for (size_t i = 0; i < buckets * sample_sort_oversampling; ++i) {
+				seed ^= seed << 13;
+				seed ^= seed >> 7;
+				seed ^= seed << 17;
+				sample.push_back(first[static_cast<std::ptrdiff_t>(seed % count)]);
+			}
+			sort_detail::pdq_sort(sample.data(), sample.data() + sample.size(), comp);
+			std::vector<T> splitters;
+			splitters.reserve(buckets - 1);
+			for (size_t i = 1; i < buckets; ++i)
+				splitters.push_back(std::move(sample[i * sample_sort_oversampling - 1]));
+			sample = std::vector<T>();
+
+			// Classify every element, counting the elements of each block falling in each bucket
+			std::vector<std::uint16_t> bucket_of(count);
+			std::vector<size_t> offsets(blocks * buckets, 0);
+			pool.parallel_for(0, blocks, 1, [&](size_t block) {
+				size_t* counts = &offsets[block * buckets];
+				size_t end = std::min(count, (block + 1) * block_size);
+				for (size_t i = block * block_size; i < end; ++i) {
+					auto bucket = std::upper_bound(splitters.begin(), splitters.end(),
+					                               first[static_cast<std::ptrdiff_t>(i)], comp) - splitters.begin();
+					bucket_of[i] = static_cast<std::uint16_t>(bucket);
+					++counts[bucket];
+				}
+			});
+
+			// Turn the counts into the position each block writes its elements of each bucket to, bucket by bucket
+			std::vector<size_t> bucket_start(buckets + 1, 0);
+			size_t position = 0;
+			for (size_t bucket = 0; bucket < buckets; ++bucket) {
+				bucket_start[bucket] = position;
+				for (size_t block = 0; block < blocks; ++block) {
+					size_t elements = offsets[block * buckets + bucket];
+					offsets[block * buckets + bucket] = position;
+					position += elements;
+				}
+			}
+			bucket_start[buckets] = position;
+
+			// Scatter the elements into the buffer, then sort every bucket and move it back
+			std::vector<T> buffer(count);
+			pool.parallel_for(0, blocks, 1, [&](size_t block) {
+				size_t* next = &offsets[block * buckets];
+				size_t end = std::min(count, (block + 1) * block_size);
+				for (size_t i = block * block_size; i < end; ++i)
+					buffer[next[bucket_of[i]]++] = std::move(first[static_cast<std::ptrdiff_t>(i)]);
+			});
+			pool.parallel_for(0, buckets, 1, [&](size_t bucket) {
+				T* begin = buffer.data() + bucket_start[bucket];
+				T* end = buffer.data() + bucket_start[bucket + 1];
+				sort_detail::pdq_sort(begin, end, comp);
+				std::move(begin, end, first + static_cast<std::ptrdiff_t>(bucket_start[bucket]));
+			});
+		}
+
+		// Least significant digit radix sort where each pass is split into blocks which are counted and scattered in
+		// parallel, the blocks writing to disjoint slices of each bucket in block order so the sort stays stable
+		template<typename Iter, typename KeyFn>
+		void parallel_lsd_radix_sort(ThreadPool& pool, Iter first, std::ptrdiff_t size, KeyFn& key) {
+			using Bits = decltype(radix_bits(std::declval<radix_key_t<Iter, KeyFn>>()));
+			constexpr size_t digits = sizeof(Bits);
+			auto count = static_cast<size_t>(size);
+			size_t blocks = std::min<size_t>(4 * pool.size(), std::max<size_t>(1, count / parallel_sort_cutoff));
+			size_t block_size = (count + blocks - 1) / blocks;
+			auto block_begin = [&](size_t block) {
+				return static_cast<std::ptrdiff_t>(std::min(count, block * block_size));
+			};
+
+			// The pre-pass gathers the histograms of every digit for every block, which are also the histograms of
+			// the first pass as no element has moved yet
+			std::vector<size_t> histograms(blocks * digits * radix_buckets, 0);
+			pool.parallel_for(0, blocks, 1, [&](size_t block) {
+				size_t* histogram = &histograms[block * digits * radix_buckets];
+				for (std::ptrdiff_t i = block_begin(block); i < block_begin(block + 1); ++i) {
+					Bits bits = radix_bits(std::invoke(key, first[i]));
+					for (size_t digit = 0; digit < digits; ++digit)
+						++histogram[digit * radix_buckets + radix_digit(bits, digit)];
+				}
+			});
+
+			std::vector<typename std::iterator_traits<Iter>::value_type> buffer;
+			std::vector<size_t> offsets(blocks * radix_buckets);
+			bool in_buffer = false;
+			bool moved = false;
+			for (size_t digit = 0; digit < digits; ++digit) {
+				// Skip the digit if every element falls in the same bucket
+				std::array<size_t, radix_buckets> totals{};
+				for (size_t block = 0; block < blocks; ++block)
+					for (size_t bucket = 0; bucket < radix_buckets; ++bucket)
+						totals[bucket] += histograms[(block * digits + digit) * radix_buckets + bucket];
+				if (std::find(totals.begin(), totals.end(), count) != totals.end())
+					continue;
+				if (buffer.empty())
+					buffer.resize(count);
+
+				auto pass = [&](auto from, auto to) {
+					if (moved) {
+						pool.parallel_for(0, blocks, 1, [&](size_t block) {
+							size_t* histogram = &offsets[block * radix_buckets];
+							std::fill(histogram, histogram + radix_buckets, 0);
+							for (std::ptrdiff_t i = block_begin(block); i < block_begin(block + 1); ++i)
+								++histogram[radix_digit(radix_bits(std::invoke(key, from[i])), digit)];
+						});
+					} else {
+						for (size_t block = 0; block < blocks; ++block)
+							std::copy_n(&histograms[(block * digits + digit) * radix_buckets], radix_buckets,
+							            &offsets[block * radix_buckets]);
+					}
+					size_t position = 0;
+					for (size_t bucket = 0; bucket < radix_buckets; ++bucket)
+						for (size_t block = 0; block < blocks; ++block)
+							position += std::exchange(offsets[block * radix_buckets + bucket], position);
+					pool.parallel_for(0, blocks, 1, [&](size_t block) {
+						std::ptrdiff_t begin = block_begin(block);
+						radix_scatter(from + begin, block_begin(block + 1) - begin, to, digit,
+						              &offsets[block * radix_buckets], key);
+					});
+				};
+				if (in_buffer)
+					pass(buffer.data(), first);
+				else
+					pass(first, buffer.data());
+				in_buffer = !in_buffer;
+				moved = true;
+			}
+			if (in_buffer) {
+				pool.parallel_for(0, blocks, 1, [&](size_t block) {
+					std::move(buffer.begin() + block_begin(block), buffer.begin() + block_begin(block + 1),
+					          first + block_begin(block));
+				});
+			}
+		}
+
+		// American flag sort whose first partition, by the first byte of the keys, is sequential while the buckets it
+		// produces are sorted in parallel
+		template<typename Iter, typename KeyFn>
+		void parallel_american_flag_sort(ThreadPool& pool, Iter first, std::ptrdiff_t size, KeyFn& key) {
+			std::array<size_t, radix_buckets + 2> bounds;
+			string_partition(first, size, 0, key, bounds);
+			pool.parallel_for(1, radix_buckets + 1, 1, [&](size_t bucket) {
+				auto count = static_cast<std::ptrdiff_t>(bounds[bucket + 1] - bounds[bucket]);
+				if (count > 1)
+					american_flag_sort(first + static_cast<std::ptrdiff_t>(bounds[bucket]), count, 1, key);
+			});
+		}
+	}
+
+	/**
+	 * Sorts the elements in the range [first, last) in parallel on the thread pool provided, using a sample sort.
+	 * The elements are distributed into one bucket per range of values, the ranges being chosen from a random sample,
+	 * and the buckets are then sorted independently with pdq_sort(). Ranges below a cutoff, or sorted on a pool with a
+	 * single worker, are sorted sequentially. The sort is not stable.
+	 *
+	 * \note
+	 * The type of the elements must be default constructible, as the sort uses a buffer as large as the range.
+	 *
+	 * **Time Complexity** = *O(n log n / p)* where p is the number of workers, for inputs with few duplicate elements.
+	 * @tparam RandomIt - the type of the random-access iterators over the elements.
+	 * @tparam Compare - the type of the comparison object, returning `true` if its first argument should come first.
+	 * @tparam Projection - the type of the projection applied to the elements before they are compared.
+	 * @param pool - the thread pool to sort on, the calling thread may or may not be one of its workers.
+	 * @param first - an iterator to the first element to sort.
+	 * @param last - an iterator past the last element to sort.
+	 * @param comp - the comparison object, defaults to `std::less<>` which sorts in ascending order.
+	 * @param proj - the projection, e.g. a pointer to a member to sort by, defaults to the element itself.
+	 * @see <a href="https://en.wikipedia.org/wiki/Samplesort">Samplesort</a>
+	 */
+	template<typename RandomIt, typename Compare = std::less<>, typename Projection = std::identity>
+	requires std::random_access_iterator<RandomIt>
+	void parallel_sort(ThreadPool& pool, RandomIt first, RandomIt last, Compare comp = {}, Projection proj = {}) {
+		std::ptrdiff_t size = last - first;
+		if (size <= sort_detail::parallel_sort_cutoff || pool.size() == 1) {
+			pdq_sort(first, last, std::move(comp), std::move(proj));
+			return;
+		}
+		auto&& compare = sort_detail::projected(comp, proj);
+		auto begin = sort_detail::unwrap(first);
+		sort_detail::parallel_sample_sort(pool, begin, size, compare);
+	}
+
+	/**
+	 * Sorts every element of a container with random-access iterators, such as Vector or Array, in parallel.
+	 * @see parallel_sort(ThreadPool&, RandomIt, RandomIt, Compare, Projection)
+	 */
+	template<typename Container, typename Compare = std::less<>, typename Projection = std::identity>
+	requires (!std::random_access_iterator<Container>) &&
+	         std::random_access_iterator<decltype(std::begin(std::declval<Container&>()))>
+	void parallel_sort(ThreadPool& pool, Container& container, Compare comp = {}, Projection proj = {}) {
+		parallel_sort(pool, std::begin(container), std::end(container), std::move(comp), std::move(proj));
+	}
+
+	/**
+	 * Sorts the elements in the range [first, last) in parallel on the thread pool provided, keeping equal elements in
+	 * their original order. A parallel merge sort is used: both halves of the range are sorted in parallel, then merged
+	 * by splitting the merge itself into independent halves with a binary search, so the merges scale as well. Ranges
+	 * below a cutoff are sorted sequentially with `std::stable_sort`.
+	 *
+	 * \note
+	 * The type of the elements must be default constructible, as the sort uses a buffer as large as the range.
+	 *
+	 * **Time Complexity** = *O(n log n / p + log^3 n)* where p is the number of workers.
+	 * @tparam RandomIt - the type of the random-access iterators over the elements.
+	 * @tparam Compare - the type of the comparison object, returning `true` if its first argument should come first.
+	 * @tparam Projection - the type of the projection applied to the elements before they are compared.
+	 * @param pool - the thread pool to sort on, the calling thread may or may not be one of its workers.
+	 * @param first - an iterator to the first element to sort.
+	 * @param last - an iterator past the last element to sort.
+	 * @param comp - the comparison object, defaults to `std::less<>` which sorts in ascending order.
+	 * @param proj - the projection, e.g. a pointer to a member to sort by, defaults to the element itself.
+	 */
+	template<typename RandomIt, typename Compare = std::less<>, typename Projection = std::identity>
+	requires std::random_access_iterator<RandomIt>
+	void parallel_stable_sort(ThreadPool& pool, RandomIt first, RandomIt last, Compare comp = {},
+	                          Projection proj = {}) {
+		std::ptrdiff_t size = last - first;
+		auto&& compare = sort_detail::projected(comp, proj);
+		auto begin = sort_detail::unwrap(first);
+		if (size <= sort_detail::parallel_sort_cutoff || pool.size() == 1) {
+			std::stable_sort(begin, begin + size, compare);
+			return;
+		}
+		std::vector<typename std::iterator_traits<RandomIt>::value_type> buffer(static_cast<size_t>(size));
+		sort_detail::parallel_merge_sort(pool, begin, buffer.data(), size, false, compare);
+	}
+
+	/**
+	 * Sorts every element of a container with random-access iterators, such as Vector or Array, in parallel, keeping
+	 * equal elements in their original order.
+	 * @see parallel_stable_sort(ThreadPool&, RandomIt, RandomIt, Compare, Projection)
+	 */
+	template<typename Container, typename Compare = std::less<>, typename Projection = std::identity>
+	requires (!std::random_access_iterator<Container>) &&
+	         std::random_access_iterator<decltype(std::begin(std::declval<Container&>()))>
+	void parallel_stable_sort(ThreadPool& pool, Container& container, Compare comp = {}, Projection proj = {}) {
+		parallel_stable_sort(pool, std::begin(container), std::end(container), std::move(comp), std::move(proj));
+	}
+
+	/**
+	 * Sorts the elements in the range [first, last) by a key extracted from each element with a radix sort running in
+	 * parallel on the thread pool provided. Numeric keys are sorted with a stable least significant digit radix sort
+	 * whose passes are each split into blocks counted and scattered in parallel. String keys are sorted with an
+	 * American flag sort which partitions the elements by the first byte of their keys, then sorts each partition in
+	 * parallel, so the parallelism is limited when most keys share their first byte. Ranges below a cutoff, or sorted
+	 * on a pool with a single worker, are sorted sequentially.
+	 * **Time Complexity** = *O(n * w / p)* where w is the number of bytes of the keys and p the number of workers.
+	 * @tparam RandomIt - the type of the random-access iterators over the elements.
+	 * @tparam KeyFn - the type of the key extractor, invocable with an element.
+	 * @param pool - the thread pool to sort on, the calling thread may or may not be one of its workers.
+	 * @param first - an iterator to the first element to sort.
+	 * @param last - an iterator past the last element to sort.
+	 * @param key - the key extractor, e.g. a pointer to a member, defaults to the element itself.
+	 * @see radix_sort(RandomIt, RandomIt, KeyFn)
+	 */
+	template<typename RandomIt, typename KeyFn = std::identity>
+	requires std::random_access_iterator<RandomIt>
+	void parallel_radix_sort(ThreadPool& pool, RandomIt first, RandomIt last, KeyFn key = {}) {
+		std::ptrdiff_t size = last - first;
+		auto begin = sort_detail::unwrap(first);
+		if (size <= sort_detail::parallel_sort_cutoff || pool.size() == 1) {
+			sort_detail::radix_sort(begin, size, key);
+			return;
+		}
+		if constexpr (sort_detail::radix_string<sort_detail::radix_key_t<decltype(begin), KeyFn>>)
+			sort_detail::parallel_american_flag_sort(pool, begin, size, key);
+		else
+			sort_detail::parallel_lsd_radix_sort(pool, begin, size, key);
+	}
+
+	/**
+	 * Sorts every element of a container with random-access iterators, such as Vector or Array, by a key extracted
+	 * from each element with a radix sort running in parallel.
+	 * @see parallel_radix_sort(ThreadPool&, RandomIt, RandomIt, KeyFn)
+	 */
+	template<typename Container, typename KeyFn = std::identity>
+	requires (!std::random_access_iterator<Container>) &&
+	         std::random_access_iterator<decltype(std::begin(std::declval<Container&>()))>
+	void parallel_radix_sort(ThreadPool& pool, Container& container, KeyFn key = {}) {
+		parallel_radix_sort(pool, std::begin(container), std::end(container), std::move(key));
+	}
+}// namespace custom
+
+#endif// PARALLEL_SORT_H
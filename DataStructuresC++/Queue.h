@@ -1,217 +1,562 @@
 #ifndef QUEUE_H
 #define QUEUE_H
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include "AllocationTracking.h"
+#include "Checking.h"
+#include "MemoryUsage.h"
+#include "Serialization.h"
+#include "Tracing.h"
+
 namespace custom {
 	/**
-	 * A template implementation of a queue data structure. Elements are stored in order of insertion and the
-	 * FIFO (first-in-first-out) idea is followed, where the first element added to the queue is the first element
-	 * to be removed, resembling a real-life queue. This is a linked list implementation of the queue.
-	 *
-	 * \note
-	 * Methods where exceptions are not to be thrown are all explicitly marked noexcept, therefore extreme exceptions
-	 * such as <a href="https://en.cppreference.com/w/cpp/memory/new/bad_alloc">`std::bad_alloc`</a> will terminate
-	 * the program. Otherwise, exceptions are used when the class is used incorrectly so as to allow for the program
-	 * to continue running.
-	 *
-	 * @tparam T - the type of data to be stored in each node of the queue.
-	 * @see <a href="https://en.wikipedia.org/wiki/Queue_(abstract_data_type)">Queue data structure</a>
+	 * A node structure to contain the data at each element and a pointer to the next node in a queue. It is shared by
+	 * every queue of the same type `T`, so that the nodes of one queue can be handed over to another of a different
+	 * kind, e.g. when moving a PriorityQueue into a Queue.
+	 * @tparam T - the type of data stored in the node.
 	 */
 	template<typename T>
-	class Queue {
-	public:
+	struct QueueNode : allocation_tracking::TrackedNode<ContainerType::Queue> {
+		T data;  /**< The data of type `T` of each element node. */
+		QueueNode* next = nullptr;  /**< A pointer to the next node object in the queue. */
+
 		/**
-		 * Default Queue constructor which initialises the head and tail pointer members to nullptr and
-		 * the length to 0.
+		 * Constructor which copies the data provided into the node object.
+		 * @param data - data of type `T` to copy into the node object.
 		 */
-		Queue() noexcept: head(nullptr), tail(nullptr), mLength(0) {}
+		explicit QueueNode(const T& data) noexcept: data(data) {}
 
 		/**
-		 * Overloaded Queue constructor which allocates memory for one element node and copies the data provided.
-		 * This constructor is explicit, meaning implicit conversion is not supported.
-		 * @param data - data of type `T` to be copied into the head node of the Queue.
+		 * Constructor which moves the data provided into the node object.
+		 * @param data - an *r-value reference* to data of type `T` to move into the node object.
 		 */
-		explicit Queue(const T& data) noexcept: mLength(1) {
-			head = new Node(data);
-			tail = head;
-		}
+		explicit QueueNode(T&& data) noexcept: data(std::move(data)) {}
+	};
 
+	/**
+	 * The policies which configure Queue and PriorityQueue at compile time. A storage policy decides how the nodes of
+	 * a queue are allocated and an ordering policy decides where a PriorityQueue inserts a new element. As the
+	 * policies are template arguments, every call into them is resolved at compile time and can be inlined.
+	 */
+	namespace queue_policy {
 		/**
-		 * Overloaded Queue constructor which allocates memory for one element node and moves the data provided.
-		 * This constructor is explicit, meaning implicit conversion is not supported.
-		 * @param data - an *r-value reference* to data of type `T`, to be moved into the head node of the Queue.
+		 * A storage policy where nodes are allocated in chunks and recycled through a free list as elements are
+		 * dequeued, so the cost of allocation is amortised over many elements. The chunks are released when the queue
+		 * is cleared or destroyed.
+		 * @tparam Allocator - the allocator the chunks, and the list of chunks, are allocated with, rebound to the
+		 * node type.
 		 */
-		explicit Queue(T&& data) noexcept: mLength(1) {
-			head = new Node(std::move(data));
-			tail = head;
-		}
+		template<typename Allocator = std::allocator<std::byte>>
+		struct BasicPooledNodes {
+			using allocator_type = Allocator;  /**< An alias for the allocator the nodes are allocated with. */
+
+			/**
+			 * The node storage owned by a single queue.
+			 * @tparam Node - the type of the nodes of the queue.
+			 */
+			template<typename Node>
+			class Pool {
+			public:
+				Pool() noexcept = default;
+
+				/**
+				 * Constructs an empty pool whose chunks will be allocated with the allocator provided.
+				 * @param allocator - the allocator to allocate the chunks with.
+				 */
+				explicit Pool(const Allocator& allocator) noexcept: node_allocator(allocator), chunks(allocator) {}
+
+				Pool(const Pool&) = delete;
+
+				Pool& operator=(const Pool&) = delete;
+
+				/**
+				 * Takes ownership of the chunks of another pool, along with its allocator, whose nodes have all been
+				 * handed over.
+				 * @param other - an *r-value reference* to the pool to take the chunks of.
+				 */
+				Pool(Pool&& other) noexcept: node_allocator(other.node_allocator), free_nodes(other.free_nodes),
+				                             free_count(other.free_count), chunks(std::move(other.chunks)) {
+					other.free_nodes = nullptr;
+					other.free_count = 0;
+					other.chunks.clear();
+				}
+
+				/**
+				 * Releases the chunks of this pool, which must not hold any nodes, and takes ownership of the chunks of
+				 * another pool, whose nodes have all been handed over. The allocators of the pools must compare equal.
+				 * @param other - an *r-value reference* to the pool to take the chunks of.
+				 * @return - a reference to the current pool.
+				 */
+				Pool& operator=(Pool&& other) noexcept {
+					if (this != &other) {
+						release();
+						free_nodes = other.free_nodes;
+						free_count = other.free_count;
+						chunks = std::move(other.chunks);
+						other.free_nodes = nullptr;
+						other.free_count = 0;
+						other.chunks.clear();
+					}
+					return *this;
+				}
+
+				~Pool() {
+					release();
+				}
+
+				/**
+				 * Constructs a node in an unused slot, allocating a new chunk of slots if none are available.
+				 * **Time Complexity** = *O(1)* amortised.
+				 * @tparam Args - the types of the arguments forwarded to the constructor of the node.
+				 * @param args - the arguments forwarded to the constructor of the node.
+				 * @return - a pointer to the new node.
+				 */
+				template<typename... Args>
+				Node* create(Args&& ... args) noexcept {
+					if (!free_nodes)
+						reserve(1, 0);
+					FreeNode* slot = free_nodes;
+					free_nodes = slot->next;
+					--free_count;
+					return new(static_cast<void*>(slot)) Node(std::forward<Args>(args)...);
+				}
+
+				/**
+				 * Destroys a node and returns its slot to the free list.
+				 * **Time Complexity** = *O(1)*.
+				 * @param node - a pointer to the node to destroy.
+				 */
+				void destroy(Node* node) noexcept {
+					node->~Node();
+					free_nodes = new(static_cast<void*>(node)) FreeNode{free_nodes};
+					++free_count;
+				}
+
+				/**
+				 * Destroys every node of a chain and deallocates every chunk, as the chain must hold all the nodes
+				 * created from this pool.
+				 * **Time Complexity** = *O(n)* where n is the number of nodes in the chain.
+				 * @param node - a pointer to the first node of the chain.
+				 */
+				void destroy_all(Node* node) noexcept {
+					while (node) {
+						Node* next = node->next;
+						node->~Node();
+						node = next;
+					}
+					release();
+				}
+
+				/**
+				 * Ensures at least `count` unused node slots are available, allocating them as a single chunk if
+				 * necessary. The chunk grows with the length of the queue up to `max_chunk` slots, so the number of
+				 * allocations is logarithmic in the length of a short queue and linear, one per `max_chunk` elements,
+				 * in the length of a long one.
+				 * This method is noexcept, like the queue operations which call it, so a failure to allocate the chunk,
+				 * or to record it in the list of chunks, terminates the program.
+				 * **Time Complexity** = *O(n)* where n is the number of slots allocated.
+				 * @param count - the number of slots required.
+				 * @param length - the number of elements currently in the queue.
+				 */
+				void reserve(size_t count, size_t length) noexcept {
+					if (free_count >= count)
+						return;
+					size_t size = std::max(count - free_count, std::clamp(length, min_chunk, max_chunk));
+					Node* chunk = node_allocator.allocate(size);
+					allocation_tracking::record_allocation(ContainerType::Queue, size * sizeof(Node));
+					chunks.emplace_back(chunk, size);
+					for (size_t i = size; i > 0; --i)
+						free_nodes = new(static_cast<void*>(chunk + i - 1)) FreeNode{free_nodes};
+					free_count += size;
+				}
+
+				/**
+				 * Returns the memory held by the pool, with every chunk and the list of chunks counted as structure.
+				 * **Time Complexity** = *O(c)* where c is the number of chunks.
+				 * @return - a MemoryUsage object with the bytes of the chunks and the estimated allocator overhead.
+				 */
+				[[nodiscard]] MemoryUsage memory_usage(size_t) const noexcept {
+					MemoryUsage usage;
+					for (const auto& [chunk, size]: chunks)
+						memory_detail::add_blocks(usage, 1, size * sizeof(Node), 0);
+					memory_detail::add_vector(usage, chunks);
+					return usage;
+				}
+
+				/**
+				 * Returns a copy of the allocator the chunks are allocated with.
+				 * @return - the allocator of the pool.
+				 */
+				[[nodiscard]] Allocator get_allocator() const noexcept {
+					return Allocator(node_allocator);
+				}
+
+			private:
+				/**
+				 * The layout of an unused node slot in the free list, which reuses the storage of a destroyed node.
+				 */
+				struct FreeNode {
+					FreeNode* next;  /**< A pointer to the next unused node slot. */
+				};
+
+				static constexpr size_t min_chunk = 16;  /**< The minimum number of nodes allocated per chunk. */
+				static constexpr size_t max_chunk = 4096;  /**< The number of nodes above which chunks stop growing with the queue. */
+
+				using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;  /**< The allocator rebound to the node type. */
+				using Chunk = std::pair<Node*, size_t>;  /**< A chunk of node storage and its size. */
+				using ChunkAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Chunk>;  /**< The allocator rebound to the chunk type. */
+
+				[[no_unique_address]] NodeAllocator node_allocator;  /**< The allocator the chunks are allocated with. */
+				FreeNode* free_nodes = nullptr;  /**< A pointer to the first unused node slot available for reuse. */
+				size_t free_count = 0;  /**< An unsigned integer specifying the number of unused node slots. */
+				std::vector<Chunk, ChunkAllocator> chunks;  /**< The chunks of node storage owned by the pool and their sizes. */
+
+				/**
+				 * Deallocates every chunk of node storage. Must only be called once all nodes have been destroyed.
+				 */
+				void release() noexcept {
+					for (auto& [chunk, size]: chunks) {
+						allocation_tracking::record_deallocation(ContainerType::Queue, size * sizeof(Node));
+						node_allocator.deallocate(chunk, size);
+					}
+					chunks.clear();
+					free_nodes = nullptr;
+					free_count = 0;
+				}
+			};
+		};
 
 		/**
-		 * Overloaded Queue constructor which takes an argument of an initialiser list of type `T` and appends
-		 * its arguments to the queue.
-		 * **Time Complexity** = *O(n)* where n is the number elements in the initialiser list.
-		 * @param init - an initialiser list of type `T` whose contents will be added to the queue.
-		 * @see <a href="https://en.cppreference.com/w/cpp/utility/initializer_list">std::initializer_list</a>
+		 * The default storage policy, allocating nodes in chunks with `std::allocator`.
 		 */
-		Queue(std::initializer_list<T> init) noexcept: mLength(0) {
-			for (auto it = init.begin(); it != init.end(); ++it)
-				enqueue(std::move(*it));
-		}
+		using PooledNodes = BasicPooledNodes<>;
 
 		/**
-		 * Copy constructor for a Queue which will perform a deep copy, element-wise, of another Queue
-		 * object of the same type `T`.
-		 * **Time Complexity** = *O(n)* where n is the number of elements in the other queue.
-		 * @param other - another Queue object of the same type `T` to be copied.
+		 * A storage policy which allocates every node individually and frees it as soon as it is removed. It holds no
+		 * memory beyond the elements of the queue.
+		 * @tparam Allocator - the allocator the nodes are allocated with, rebound to the node type. With
+		 * `std::allocator`, nodes are allocated with `new` and freed with `delete`.
+		 */
+		template<typename Allocator = std::allocator<std::byte>>
+		struct BasicHeapNodes {
+			using allocator_type = Allocator;  /**< An alias for the allocator the nodes are allocated with. */
+
+			/**
+			 * The node storage of a single queue, which only holds the allocator.
+			 * @tparam Node - the type of the nodes of the queue.
+			 */
+			template<typename Node>
+			class Pool {
+			public:
+				Pool() noexcept = default;
+
+				explicit Pool(const Allocator& allocator) noexcept: allocator(allocator) {}
+
+				template<typename... Args>
+				Node* create(Args&& ... args) noexcept {
+					return allocation_tracking::create_node<ContainerType::Queue, Node>(allocator,
+					                                                                 std::forward<Args>(args)...);
+				}
+
+				void destroy(Node* node) noexcept {
+					allocation_tracking::destroy_node<ContainerType::Queue>(allocator, node);
+				}
+
+				void destroy_all(Node* node) noexcept {
+					while (node) {
+						Node* next = node->next;
+						destroy(node);
+						node = next;
+					}
+				}
+
+				void reserve(size_t, size_t) noexcept {}
+
+				[[nodiscard]] MemoryUsage memory_usage(size_t length) const noexcept {
+					MemoryUsage usage;
+					memory_detail::add_blocks(usage, length, sizeof(Node), 0);
+					return usage;
+				}
+
+				[[nodiscard]] Allocator get_allocator() const noexcept {
+					return allocator;
+				}
+
+			private:
+				[[no_unique_address]] Allocator allocator;  /**< The allocator the nodes are allocated with. */
+			};
+		};
+
+		/**
+		 * A storage policy which allocates every node individually with `new` and frees it with `delete`.
+		 */
+		using HeapNodes = BasicHeapNodes<>;
+
+		/**
+		 * An ordering policy fixed at compile time. A new element is placed after every element which does not
+		 * compare greater than it under `Compare`, so elements which compare equal stay in order of insertion.
+		 * @tparam Compare - the type of the strict weak ordering, `std::less<>` orders the queue in ascending order.
 		 */
-		Queue(const Queue<T>& other) noexcept: mLength(other.mLength) {
-			head = new Node(other.head->data);
-			tail = head;
-			Node* other_node = other.head->next;
-			while (other_node) {
-				tail->next = new Node(other_node->data);
-				tail = tail->next;
-				other_node = other_node->next;
+		template<typename Compare>
+		struct Ordered {
+			[[no_unique_address]] Compare compare;  /**< The comparison object. */
+
+			/**
+			 * Provides a boolean value that indicates whether elements are kept in order of insertion.
+			 * @return - `false`, as this policy always orders the elements.
+			 */
+			static constexpr bool unordered() noexcept {
+				return false;
 			}
-		}
+
+			/**
+			 * Provides a boolean value that indicates whether an element already in the queue is to remain ahead of
+			 * a new element.
+			 * @tparam T - the type of the elements.
+			 * @param existing - the element already in the queue.
+			 * @param incoming - the element being added to the queue.
+			 * @return - a boolean value indicating whether `existing` stays ahead of `incoming`.
+			 */
+			template<typename T>
+			bool precedes(const T& existing, const T& incoming) const {
+				return !compare(incoming, existing);
+			}
+		};
+
+		using Ascending = Ordered<std::less<>>;  /**< Orders the queue so that the smallest element is at the front. */
+		using Descending = Ordered<std::greater<>>;  /**< Orders the queue so that the largest element is at the front. */
 
 		/**
-		 * Copy assignment operator for the Queue which will copy another Queue object of the same type
-		 * `T` into the current object.
-		 * \note
-		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
-		 * **Time Complexity** = *O(n)* where n is the number of elements in the other queue + the number of elements
-		 * in the current queue.
-		 * @param other - another Queue object of the same type `T` to be copied.
-		 * @return - a reference to the current object.
+		 * The default ordering policy, chosen when the PriorityQueue is constructed. It is implicitly constructible
+		 * from an unsigned integer, so a priority type can be passed directly to the constructors of PriorityQueue.
 		 */
-		Queue<T>& operator=(const Queue<T>& other) noexcept {
-			if (this != &other) {
-				if (mLength > 0)
-					clear();
-				if (other.mLength) {
-					head = new Node(other.head->data);
-					mLength = other.mLength;
-					tail = head;
-					Node* other_node = other.head->next;
-					while (other_node) {
-						tail->next = new Node(other_node->data);
-						tail = tail->next;
-						other_node = other_node->next;
-					}
-				} else {
-					head = nullptr;
-					tail = head;
-					mLength = 0;
+		struct RuntimePriority {
+			/**
+			 * An enum containing the possible priority types for the queue.
+			 * **0** indicates no order.
+			 * **1** indicates ascending order.
+			 * **2** indicates descending order.
+			 */
+			enum Priority : unsigned int {
+				None = 0U,
+				Ascending,
+				Descending
+			};
+
+			unsigned int value;  /**< An unsigned integer to track the type of the priority applied to the queue. */
+
+			constexpr RuntimePriority(unsigned int priority = None) noexcept: value(priority) {}
+
+			/**
+			 * Provides a boolean value that indicates whether elements are kept in order of insertion.
+			 * @return - `true` if the priority type is `None`.
+			 */
+			[[nodiscard]] bool unordered() const noexcept {
+				return value == None;
+			}
+
+			/**
+			 * Provides a boolean value that indicates whether an element already in the queue is to remain ahead of
+			 * a new element.
+			 * @tparam T - the type of the elements.
+			 * @param existing - the element already in the queue.
+			 * @param incoming - the element being added to the queue.
+			 * @return - a boolean value indicating whether `existing` stays ahead of `incoming`.
+			 */
+			template<typename T>
+			bool precedes(const T& existing, const T& incoming) const {
+				switch (value) {
+					case Ascending:
+						return existing <= incoming;
+					case Descending:
+						return existing >= incoming;
+					default:
+						return true;
 				}
 			}
-			return *this;
+		};
+	}// namespace queue_policy
+
+	/**
+	 * The common implementation of Queue and PriorityQueue, using the CRTP (curiously recurring template pattern) in
+	 * place of virtual functions. The only step which differs between the two, linking a new node into the queue, is
+	 * resolved at compile time through the `Derived` type, so no call made on a queue goes through a vtable and
+	 * queue objects carry no vptr. It cannot be constructed or destroyed on its own.
+	 *
+	 * \note
+	 * Methods where exceptions are not to be thrown are all explicitly marked noexcept, therefore extreme exceptions
+	 * such as <a href="https://en.cppreference.com/w/cpp/memory/new/bad_alloc">`std::bad_alloc`</a> will terminate
+	 * the program. Otherwise, exceptions are used when the class is used incorrectly so as to allow for the program
+	 * to continue running.
+	 *
+	 * @tparam Derived - the queue type inheriting from this class.
+	 * @tparam T - the type of data to be stored in each node of the queue.
+	 * @tparam Storage - the storage policy deciding how nodes are allocated.
+	 * @see <a href="https://en.wikipedia.org/wiki/Curiously_recurring_template_pattern">CRTP</a>
+	 */
+	template<typename Derived, typename T, typename Storage>
+	class QueueBase {
+	public:
+		using allocator_type = typename Storage::allocator_type;  /**< An alias for the allocator the nodes are allocated with. */
+
+		/**
+		 * Allocates memory for a new element node with the data provided and adds the element to the queue.
+		 * If the queue is empty, it initialises the head of the queue with the data provided.
+		 * **Time Complexity** = *O(1)* for a Queue, *O(n)* for an ordered PriorityQueue.
+		 * @param data - the data to be copied into the queue.
+		 */
+		void enqueue(const T& data) noexcept {
+			tracing::Scope scope(tracing::Operation::Insert);
+			derived().link_node(nodes.create(data));
 		}
 
 		/**
-		 * Move constructor for a Queue which will take the data from another Queue object of the same type
-		 * `T` and set the other object to its default state of not have any data.
-		 * **Time Complexity** = *O(1)*.
-		 * @param other - an *r-value reference* to a Queue object of type `T` to be moved.
+		 * Allocates memory for a new element node with the data provided and adds the element to the queue.
+		 * If the queue is empty, it initialises the head of the queue with the data provided.
+		 * **Time Complexity** = *O(1)* for a Queue, *O(n)* for an ordered PriorityQueue.
+		 * @param data - an *r-value reference* to the data to be moved into the queue.
 		 */
-		Queue(Queue<T>&& other) noexcept: head(other.head), tail(other.tail), mLength(other.mLength) {
-			other.head = nullptr;
-			other.tail = nullptr;
-			other.mLength = 0;
+		void enqueue(T&& data) noexcept {
+			tracing::Scope scope(tracing::Operation::Insert);
+			derived().link_node(nodes.create(std::move(data)));
 		}
 
 		/**
-		 * Move assignment operator for the Queue which will move another Queue object of type `T` into
-		 * the current object.
-		 * \note
-		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
-		 * **Time Complexity** = *O(1)*.
-		 * @param other - an *r-value reference* to a Queue object of type `T` to be moved.
-		 * @return - a reference to the current object.
+		 * Adds elements from an initialiser list, in order, to the queue.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the initialiser list.
+		 * @param list - the initialiser list whose elements will be added to the queue.
+		 * @see <a href="https://en.cppreference.com/w/cpp/utility/initializer_list">std::initializer_list</a>
 		 */
-		Queue<T>& operator=(Queue<T>&& other) noexcept {
-			if (this != &other) {
-				if (mLength > 0)
-					clear();
-				head = other.head;
-				tail = other.tail;
-				mLength = other.mLength;
-				other.head = nullptr;
-				other.tail = nullptr;
-				other.mLength = 0;
-			}
-			return *this;
+		void enqueue(std::initializer_list<T> list) noexcept {
+			enqueue_range(list.begin(), list.end());
 		}
 
 		/**
-		 * Allocates memory for a new element node with the data provided and adds the element to the end of the queue.
-		 * If the queue is empty, it initialises the head of the queue with the data provided.
-		 * **Time Complexity** = *O(1)*.
-		 * @param data - the data to be copied into the end of the queue.
+		 * Adds the elements in the range [first, last), in order, to the queue. When the size of the range can be
+		 * computed up front, i.e. for forward iterators, the nodes for all the elements are allocated at once and, if
+		 * the queue does not order its elements, the whole range is linked before being attached to the queue. A range
+		 * of move iterators will move the elements into the queue.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the range, *O(n * m)* for an ordered
+		 * PriorityQueue where m is the number of elements in the queue.
+		 * @tparam InputIt - the type of the iterators, which must dereference to a type convertible to `T`.
+		 * @param first - an iterator to the first element of the range.
+		 * @param last - an iterator past the last element of the range.
 		 */
-		virtual void enqueue(const T& data) noexcept {
-			Node* new_node = new Node(data);
-			if (mLength) {
-				tail->next = new_node;
-				tail = new_node;
-				++mLength;
-				return;
+		template<typename InputIt>
+		void enqueue_range(InputIt first, InputIt last) noexcept {
+			tracing::Scope scope(tracing::Operation::Insert);
+			if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+			                                typename std::iterator_traits<InputIt>::iterator_category>) {
+				auto count = static_cast<size_t>(std::distance(first, last));
+				if (count == 0)
+					return;
+				nodes.reserve(count, mLength);
+				if (!derived().unordered()) {
+					for (; first != last; ++first)
+						derived().link_node(nodes.create(*first));
+					return;
+				}
+				Node* chain_head = nodes.create(*first);
+				Node* chain_tail = chain_head;
+				for (++first; first != last; ++first) {
+					chain_tail->next = nodes.create(*first);
+					chain_tail = chain_tail->next;
+				}
+				if (mLength)
+					tail->next = chain_head;
+				else
+					head = chain_head;
+				tail = chain_tail;
+				mLength += count;
+			} else {
+				for (; first != last; ++first)
+					derived().link_node(nodes.create(*first));
 			}
-			head = new_node;
-			tail = head;
-			mLength = 1;
 		}
 
 		/**
-		 * Allocates memory for a new element node with the data provided and adds the element to the end of the queue.
-		 * If the queue is empty, it initialises the head of the queue with the data provided.
+		 * Removes the element at the front of the queue and returns its data, which is moved out of the queue. If the
+		 * queue is empty, a `runtime_error` exception is thrown.
 		 * **Time Complexity** = *O(1)*.
-		 * @param data - an *r-value reference* to the data to be moved into the end of the queue.
+		 * @return - the data of the element at the front of the queue.
 		 */
-		virtual void enqueue(T&& data) noexcept {
-			Node* new_node = new Node(std::move(data));
-			if (mLength) {
-				tail->next = new_node;
-				tail = new_node;
-				++mLength;
-				return;
-			}
-			head = new_node;
-			tail = head;
-			mLength = 1;
+		T dequeue() {
+			tracing::Scope scope(tracing::Operation::Erase);
+			check<std::runtime_error>(mLength != 0, "Error: queue is empty, there is nothing to dequeue");
+			Node* first = head;
+			head = head->next;
+			T data = std::move(first->data);
+			nodes.destroy(first);
+			if (--mLength == 0)
+				tail = nullptr;
+			return data;
 		}
 
 		/**
-		 * Adds elements from an initialiser list, in order, to the end of the queue.
-		 * **Time Complexity** = *O(n)* where n is the number of elements in the initialiser list.
-		 * @param list - the initialiser list whose elements will be appended to the queue.
-		 * @see <a href="https://en.cppreference.com/w/cpp/utility/initializer_list">std::initializer_list</a>
+		 * Removes up to `count` elements from the front of the queue, in order, moving their data into the output
+		 * iterator provided. Unlike dequeue(), this does not throw if the queue holds fewer elements than requested.
+		 * **Time Complexity** = *O(n)* where n is the number of elements removed.
+		 * @tparam OutputIt - the type of the output iterator, which must accept an *r-value reference* to `T`.
+		 * @param out - the output iterator to write the elements to.
+		 * @param count - the maximum number of elements to remove.
+		 * @return - the number of elements removed from the queue.
 		 */
-		virtual void enqueue(std::initializer_list<T> list) noexcept {
-			for (auto it = list.begin(); it != list.end(); ++it)
-				enqueue(std::move(*it));
+		template<typename OutputIt>
+		size_t dequeue_n(OutputIt out, size_t count) {
+			tracing::Scope scope(tracing::Operation::Erase);
+			size_t removed = 0;
+			while (removed < count && head) {
+				Node* first = head;
+				*out = std::move(first->data);
+				++out;
+				head = head->next;
+				nodes.destroy(first);
+				--mLength;
+				++removed;
+			}
+			if (mLength == 0)
+				tail = nullptr;
+			return removed;
 		}
 
 		/**
-		 * Removes the element at the front of the queue and returns a copy of its data. If the queue is empty, a
-		 * `runtime_error` exception is thrown.
-		 * **Time Complexity** = *O(1)*.
-		 * @return - a copy of the data of the element at the front of the queue.
+		 * Removes every element from the queue, in order, passing an *r-value reference* to each element's data to the
+		 * function provided. If the function throws, the elements which have already been passed to it are removed
+		 * and the rest remain in the queue.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the queue.
+		 * @tparam Function - the type of the callable, invocable with an *r-value reference* to `T`.
+		 * @param function - the callable to pass each element to.
+		 * @return - the number of elements removed from the queue.
 		 */
-		T dequeue() {
-			if (mLength) {
+		template<typename Function>
+		size_t drain(Function&& function) {
+			tracing::Scope scope(tracing::Operation::Traversal);
+			size_t removed = 0;
+			while (head) {
 				Node* first = head;
 				head = head->next;
-				T data = first->data;
-				delete first;
 				--mLength;
-				return data;
+				++removed;
+				struct Release {
+					QueueBase* queue;
+					Node* node;
+					~Release() { queue->nodes.destroy(node); }
+				} release{this, first};
+				function(std::move(first->data));
 			}
-			throw std::runtime_error("Error: queue is empty, there is nothing to dequeue");
+			tail = nullptr;
+			return removed;
 		}
 
 		/**
@@ -220,10 +565,9 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 * @return - a reference of the data of the element at the beginning of the queue.
 		 */
-		[[nodiscard]] T& peek() {
-			if (mLength)
-				return head->data;
-			throw std::runtime_error("Error: queue is empty, there is nothing to peek");
+		[[nodiscard]] T& peek() noexcept(!checks_throw) {
+			check<std::runtime_error>(mLength != 0, "Error: queue is empty, there is nothing to peek");
+			return head->data;
 		}
 
 		/**
@@ -232,10 +576,9 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 * @return - a const reference of the data of the element at the beginning of the queue.
 		 */
-		[[nodiscard]] const T& peek() const {
-			if (mLength)
-				return head->data;
-			throw std::runtime_error("Error: queue is empty, there is nothing to peek");
+		[[nodiscard]] const T& peek() const noexcept(!checks_throw) {
+			check<std::runtime_error>(mLength != 0, "Error: queue is empty, there is nothing to peek");
+			return head->data;
 		}
 
 		/**
@@ -256,6 +599,31 @@ namespace custom {
 			return mLength == 0;
 		}
 
+		/**
+		 * Returns a breakdown of the memory held by the queue: the data of the elements is the payload, while the
+		 * pointer to the next node, the padding of each node, the unused slots of pooled chunks and the queue object
+		 * itself are structural overhead.
+		 * **Time Complexity** = *O(1)*, or *O(c)* where c is the number of chunks for pooled nodes.
+		 * @return - a MemoryUsage object with the bytes of payload, structure and estimated allocator overhead.
+		 */
+		[[nodiscard]] MemoryUsage memory_usage() const noexcept {
+			MemoryUsage usage = nodes.memory_usage(mLength);
+			usage.payload = mLength * sizeof(T);
+			usage.structure = usage.structure - usage.payload + sizeof(Derived);
+			return usage;
+		}
+
+		/**
+		 * Serializes the queue in the binary format of Serialization.h, from the front to the back.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the queue.
+		 * @param out - the serialization::Writer to append the queue to.
+		 */
+		void serialize(serialization::Writer& out) const {
+			out.header<T>(Derived::kind, mLength);
+			for (const Node* cur = head; cur; cur = cur->next)
+				out.value(cur->data);
+		}
+
 		/**
 		 * Conversion operator for boolean type. Evaluates to `true` if the size of the queue is not 0, otherwise
 		 * it evaluates to `false`.
@@ -267,14 +635,16 @@ namespace custom {
 		}
 
 		/**
-		 * Equivalence operator which compares two Queue objects of the same type `T`, element-wise, and returns
-		 * a boolean value indicating whether the two objects contain the same data.
+		 * Equivalence operator which compares two queues of the same type `T`, element-wise, and returns a boolean
+		 * value indicating whether the two objects contain the same data. The queues may be of different kinds, e.g.
+		 * a Queue and a PriorityQueue.
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the current queue + the number of elements
 		 * in the other queue.
-		 * @param other - a Queue object of the same type `T`, whose data to compare against.
+		 * @param other - a queue of the same type `T`, whose data to compare against.
 		 * @return - a boolean value indicating whether the two queues contain the same data.
 		 */
-		virtual bool operator==(const Queue<T>& other) const noexcept {
+		template<typename OtherDerived, typename OtherStorage>
+		[[nodiscard]] bool operator==(const QueueBase<OtherDerived, T, OtherStorage>& other) const noexcept {
 			if (mLength != other.mLength)
 				return false;
 			Node* cur = head;
@@ -289,14 +659,15 @@ namespace custom {
 		}
 
 		/**
-		 * Not-equivalence operator which compares two Queue objects of the same type `T`, element-wise, and returns
+		 * Not-equivalence operator which compares two queues of the same type `T`, element-wise, and returns
 		 * a boolean value indicating whether the two objects contain different data.
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the current queue + the number of elements
 		 * in the other queue.
-		 * @param other - a Queue object of the same type `T`, whose data to compare against.
+		 * @param other - a queue of the same type `T`, whose data to compare against.
 		 * @return - a boolean value indicating whether the two queues contain different data.
 		 */
-		[[nodiscard]] bool operator!=(const Queue<T>& other) const noexcept {
+		template<typename OtherDerived, typename OtherStorage>
+		[[nodiscard]] bool operator!=(const QueueBase<OtherDerived, T, OtherStorage>& other) const noexcept {
 			return !(*this == other);
 		}
 
@@ -308,36 +679,32 @@ namespace custom {
 		 * @return - a boolean value indicating whether an element with the data specified exists.
 		 */
 		bool contains(const T& data) const {
-			if (mLength) {
-				Node* cur_node = head;
-				while (cur_node) {
-					if (cur_node->data == data)
-						return true;
-					cur_node = cur_node->next;
-				}
-				return false;
+			tracing::Scope scope(tracing::Operation::Lookup);
+			check<std::runtime_error>(mLength != 0, "Error: queue is empty, cannot check for contents");
+			Node* cur_node = head;
+			while (cur_node) {
+				if (cur_node->data == data)
+					return true;
+				cur_node = cur_node->next;
 			}
-			throw std::runtime_error("Error: queue is empty, cannot check for contents");
+			return false;
 		}
 
 		/**
-		 * Plus operator which appends another Queue object of type `T` to the current queue.
-		 * **Time Complexity** = *O(n)* where n is the number of elements in the other queue.
-		 * @param right - a Queue object of type `T` to append to the current queue.
-		 * @return - a copy of the current queue object.
-		 */
-		[[nodiscard]] Queue<T> operator+(Queue<T>& right) const noexcept {
-			if (right.mLength) {
-				std::vector<T> data = contents();
-				std::vector<T> right_data = right.contents();
-				for (T& i: right_data)
-					data.push_back(i);
-				Queue<T> res;
-				for (const T& i: data)
-					res.enqueue(i);
-				return res;
-			}
-			return *this;
+		 * Plus operator which adds the elements of another queue of type `T` to a copy of the current queue, in the
+		 * same way as enqueue().
+		 * **Time Complexity** = *O(n)* where n is the number of elements in this queue + the number of elements
+		 * in the other queue.
+		 * @param right - a queue of type `T` whose elements to add to the copy of the current queue.
+		 * @return - a copy of the current queue object with the elements of `right` added.
+		 */
+		template<typename OtherDerived, typename OtherStorage>
+		[[nodiscard]] Derived operator+(const QueueBase<OtherDerived, T, OtherStorage>& right) const noexcept {
+			Derived res(derived());
+			res.nodes.reserve(right.mLength, res.mLength);
+			for (const Node* cur = right.head; cur; cur = cur->next)
+				res.enqueue(cur->data);
+			return res;
 		}
 
 		/**
@@ -347,6 +714,7 @@ namespace custom {
 		 * @see <a href="https://en.cppreference.com/w/cpp/container/vector">std::vector</a>
 		 */
 		[[nodiscard]] std::vector<T> contents() const noexcept {
+			tracing::Scope scope(tracing::Operation::Traversal);
 			std::vector<T> elems(mLength);
 			Node* cur_node = head;
 			for (size_t i = 0; i < mLength; ++i) {
@@ -365,14 +733,12 @@ namespace custom {
 		 * @see <a href="https://en.cppreference.com/w/cpp/io/cout">std::cout</a>
 		 */
 		void display() const {
-			if (mLength) {
-				std::vector<T> data = contents();
-				for (const T& i: data) {
-					std::cout << i << "\t";
-				}
-				std::cout << "\n";
-			} else
-				throw std::runtime_error("Error: queue is empty, there is nothing to display");
+			check<std::runtime_error>(mLength != 0, "Error: queue is empty, there is nothing to display");
+			std::vector<T> data = contents();
+			for (const T& i: data) {
+				std::cout << i << "\t";
+			}
+			std::cout << "\n";
 		}
 
 		/**
@@ -381,397 +747,507 @@ namespace custom {
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the queue.
 		 */
 		void clear() noexcept {
-			Node* cur_node = head;
-			while (cur_node) {
-				cur_node = cur_node->next;
-				delete head;
-				head = cur_node;
-			}
+			nodes.destroy_all(head);
 			head = nullptr;
+			tail = nullptr;
 			mLength = 0;
 		}
 
 		/**
-		 * Queue destructor which clears the queue and releases any memory allocated for each element.
-		 * **Time Complexity** = *O(n)* where n is the number of elements in the queue.
+		 * Returns a copy of the allocator the nodes are allocated with.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - the allocator of the storage of the queue.
 		 */
-		virtual ~Queue() {
-			if (mLength)
-				clear();
+		[[nodiscard]] allocator_type get_allocator() const noexcept {
+			return nodes.get_allocator();
 		}
 
 	protected:
-		/**
-		 * A node structure to contain the data at each element and a pointer to the next node in the queue.
-		 */
-		struct Node {
-			T data;  /**< The data of type `T` of each element node. */
-			Node* next = nullptr;  /**< A pointer to the next node object in the queue. */
+		template<typename, typename, typename> friend class QueueBase;
 
-			/**
-			 * Constructor which copies the data provided into the node object.
-			 * @param data - data of type `T` to copy into the node object.
-			 */
-			explicit Node(const T& data) noexcept: data(data) {}
+		using Node = QueueNode<T>;  /**< The type of the element nodes of the queue. */
 
-			/**
-			 * Constructor which moves the data provided into the node object.
-			 * @param data - an *r-value reference* to data of type `T` to move into the node object.
-			 */
-			explicit Node(T&& data) noexcept: data(std::move(data)) {}
-		};
+		Node* head = nullptr;  /**< A pointer to the first node element of the queue, this will be the first element to be removed. */
+		Node* tail = nullptr;  /**< A pointer to the last node element of the queue, this will be the last element to be removed.  */
+		size_t mLength = 0;  /**< An unsigned integer specifying the number of elements in the queue. */
+		[[no_unique_address]] typename Storage::template Pool<Node> nodes;  /**< The storage the nodes of the queue are allocated from. */
 
-		Node* head;  /**< A pointer to the first node element of the queue, this will be the first element to be removed. */
-		Node* tail;  /**< A pointer to the last node element of the queue, this will be the last element to be removed.  */
-		size_t mLength;  /**< An unsigned integer specifying the number of elements in the queue. */
-	};
+		QueueBase() noexcept = default;
 
-	/**
-	 * A specialised version of the Queue class, where the elements in the queue are ordered using a provided condition.
-	 * It inherits all the methods from the Queue class while overriding some to meet the requirement described above.
-	 *
-	 * \note
-	 * The type `T` **must** have a valid comparison operator functions.
-	 *
-	 * @tparam T - the type of data to be stored in each node of the priority queue.
-	 * @see <a href="https://en.wikipedia.org/wiki/Priority_queue">Priority Queue</a>
-	 */
-	template<typename T>
-	class PriorityQueue : public Queue<T> {
-	public:
 		/**
-		 * Default PriorityQueue constructor which initialises the priority value to `None` meaning there is no order,
-		 * and calls the default Queue() constructor.
+		 * Constructor which initialises an empty queue whose nodes will be allocated with the allocator provided.
+		 * @param allocator - the allocator to allocate the nodes with.
 		 */
-		PriorityQueue() noexcept: priority_val(None), Queue<T>() {}
+		explicit QueueBase(const allocator_type& allocator) noexcept: nodes(allocator) {}
+
+		QueueBase(const QueueBase&) = delete;
+
+		QueueBase& operator=(const QueueBase&) = delete;
 
 		/**
-		 * Overloaded Queue constructor which allocates memory for one element node and copies the data provided and
-		 * sets the priority type to use, which by default is `None`.
-		 * This constructor is explicit, meaning implicit conversion is not supported.
-		 * @param data -  data of type `T` to be copied into the head node of the Queue.
-		 * @param priority - the priority type of the PriorityQueue.
-		 * @see Priority.
+		 * Destructor which clears the queue and releases any memory allocated for each element. It is not virtual, as
+		 * queues are never destroyed through a pointer to this class.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the queue.
 		 */
-		explicit PriorityQueue(const T& data, unsigned int priority = None) noexcept: priority_val(priority),
-		                                                                              Queue<T>(data) {}
+		~QueueBase() {
+			clear();
+		}
 
 		/**
-		 * Overloaded Queue constructor which allocates memory for one element node and moves the data provided and
-		 * sets the priority type to use, which by default is `None`.
-		 * This constructor is explicit, meaning implicit conversion is not supported.
-		 * @param data -  an *r-value reference* to the data of type `T` to be moved into the head node of the Queue.
-		 * @param priority - the priority type of the PriorityQueue.
-		 * @see Priority.
+		 * Casts the current object to the queue type inheriting from this class.
+		 * @return - a reference to the current object as the derived queue type.
 		 */
-		explicit PriorityQueue(T&& data, unsigned int priority = None) noexcept: priority_val(priority),
-		                                                                         Queue<T>(std::move(data)) {}
+		Derived& derived() noexcept {
+			return static_cast<Derived&>(*this);
+		}
 
 		/**
-		 * Copy constructor for PriorityQueue which will perform a deep copy, element-wise, of another PriorityQueue
-		 * object of the same type `T`, by calling the base copy constructor. It also copies its priority type.
+		 * Casts the current object to the queue type inheriting from this class.
+		 * @return - a const reference to the current object as the derived queue type.
+		 */
+		const Derived& derived() const noexcept {
+			return static_cast<const Derived&>(*this);
+		}
+
+		/**
+		 * Links a node to the end of the queue.
+		 * **Time Complexity** = *O(1)*.
+		 * @param node - a pointer to the node to link.
+		 */
+		void link_back(Node* node) noexcept {
+			if (mLength)
+				tail->next = node;
+			else
+				head = node;
+			tail = node;
+			++mLength;
+		}
+
+		/**
+		 * Adds copies of the elements of another queue to the current queue, in the same way as enqueue(). If the
+		 * current queue does not order its elements, they are appended in their order in the other queue.
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the other queue.
-		 * @param other - another PriorityQueue object of the same type `T` to be copied.
+		 * @param other - a queue of type `T` whose elements to copy.
 		 */
-		PriorityQueue(const PriorityQueue<T>& other) noexcept: Queue<T>(other), priority_val(other.priority_val) {}
+		template<typename OtherDerived, typename OtherStorage>
+		void append_copy(const QueueBase<OtherDerived, T, OtherStorage>& other) noexcept {
+			if (other.mLength == 0)
+				return;
+			nodes.reserve(other.mLength, mLength);
+			for (const Node* cur = other.head; cur; cur = cur->next)
+				derived().link_node(nodes.create(cur->data));
+		}
 
 		/**
-		 * Copy constructor for PriorityQueue which will perform a deep copy, element-wise, of a Queue
-		 * object of the same type `T`, by calling the base copy constructor. It sets the priority type to `None`.
+		 * Moves the elements of another queue into the current queue, in the same way as enqueue(), and clears the
+		 * other queue.
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the other queue.
-		 * @param other - a Queue object of the same type `T` to be copied.
+		 * @param other - a queue of type `T` whose elements to move.
 		 */
-		explicit PriorityQueue(const Queue<T>& other) noexcept: Queue<T>(other), priority_val(None) {}
+		template<typename OtherDerived, typename OtherStorage>
+		void append_move(QueueBase<OtherDerived, T, OtherStorage>& other) noexcept {
+			nodes.reserve(other.mLength, mLength);
+			for (Node* cur = other.head; cur; cur = cur->next)
+				derived().link_node(nodes.create(std::move(cur->data)));
+			other.clear();
+		}
 
 		/**
-		 * Copy assignment operator for the PriorityQueue which will copy another PriorityQueue object of the same type
-		 * `T` into the current object, in its order along with its priority type.
+		 * Clears the current queue and takes over the nodes of another queue, along with their storage, keeping their
+		 * order. The other queue is left empty. If the allocators of the queues do not compare equal, e.g.
+		 * `std::pmr::polymorphic_allocator` objects of different memory resources, the current queue keeps its
+		 * allocator and the elements are moved one by one instead.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the current queue, + the number of
+		 * elements in the other queue if the allocators differ.
+		 * @param other - a queue of type `T`, with the same storage policy, to take the nodes of.
+		 */
+		template<typename OtherDerived>
+		void take(QueueBase<OtherDerived, T, Storage>& other) noexcept {
+			clear();
+			if constexpr (!std::allocator_traits<allocator_type>::is_always_equal::value) {
+				if (get_allocator() != other.get_allocator()) {
+					append_move(other);
+					return;
+				}
+			}
+			head = other.head;
+			tail = other.tail;
+			mLength = other.mLength;
+			nodes = std::move(other.nodes);
+			other.head = nullptr;
+			other.tail = nullptr;
+			other.mLength = 0;
+		}
+
+		/**
+		 * Reads the elements of a queue written by serialize() and adds them to the current queue, in the same way as
+		 * enqueue(). The nodes are reserved up front.
+		 * **Time Complexity** = *O(n)* where n is the number of elements read.
+		 * @param in - the serialization::Reader to read the elements from.
+		 * @param count - the number of elements, from the header of the serialized queue.
+		 */
+		void read_elements(serialization::Reader& in, size_t count) {
+			if (count == 0)
+				return;
+			nodes.reserve(count, mLength);
+			for (size_t i = 0; i < count; ++i)
+				derived().link_node(nodes.create(in.value<T>()));
+		}
+	};
+
+	/**
+	 * A template implementation of a queue data structure. Elements are stored in order of insertion and the
+	 * FIFO (first-in-first-out) idea is followed, where the first element added to the queue is the first element
+	 * to be removed, resembling a real-life queue. This is a linked list implementation of the queue.
+	 *
+	 * \note
+	 * Methods where exceptions are not to be thrown are all explicitly marked noexcept, therefore extreme exceptions
+	 * such as <a href="https://en.cppreference.com/w/cpp/memory/new/bad_alloc">`std::bad_alloc`</a> will terminate
+	 * the program. Otherwise, exceptions are used when the class is used incorrectly so as to allow for the program
+	 * to continue running.
+	 *
+	 * By default, nodes are allocated in chunks and recycled through a free list as elements are dequeued, so the cost
+	 * of allocation is amortised over many elements. The chunks are released when the queue is cleared or destroyed.
+	 *
+	 * @tparam T - the type of data to be stored in each node of the queue.
+	 * @tparam Storage - the storage policy deciding how nodes are allocated, see queue_policy::PooledNodes and
+	 * queue_policy::HeapNodes, or pmr::Queue for nodes allocated from a `std::pmr::memory_resource`.
+	 * @see <a href="https://en.wikipedia.org/wiki/Queue_(abstract_data_type)">Queue data structure</a>
+	 */
+	template<typename T, typename Storage = queue_policy::PooledNodes>
+	class Queue : public QueueBase<Queue<T, Storage>, T, Storage> {
+		using Base = QueueBase<Queue<T, Storage>, T, Storage>;  /**< An alias for the base class. */
+
+	public:
+		/**
+		 * Default Queue constructor which initialises the head and tail pointer members to nullptr and
+		 * the length to 0.
+		 */
+		Queue() noexcept = default;
+
+		/**
+		 * Overloaded Queue constructor which initialises an empty queue whose nodes will be allocated with the
+		 * allocator provided.
+		 * @param allocator - the allocator to allocate the nodes with.
+		 */
+		explicit Queue(const typename Base::allocator_type& allocator) noexcept: Base(allocator) {}
+
+		/**
+		 * Overloaded Queue constructor which allocates memory for one element node and copies the data provided.
+		 * This constructor is explicit, meaning implicit conversion is not supported.
+		 * @param data - data of type `T` to be copied into the head node of the Queue.
+		 */
+		explicit Queue(const T& data) noexcept {
+			this->enqueue(data);
+		}
+
+		/**
+		 * Overloaded Queue constructor which allocates memory for one element node and moves the data provided.
+		 * This constructor is explicit, meaning implicit conversion is not supported.
+		 * @param data - an *r-value reference* to data of type `T`, to be moved into the head node of the Queue.
+		 */
+		explicit Queue(T&& data) noexcept {
+			this->enqueue(std::move(data));
+		}
+
+		/**
+		 * Overloaded Queue constructor which takes an argument of an initialiser list of type `T` and appends
+		 * its arguments to the queue.
+		 * **Time Complexity** = *O(n)* where n is the number elements in the initialiser list.
+		 * @param init - an initialiser list of type `T` whose contents will be added to the queue.
+		 * @param allocator - the allocator to allocate the nodes with.
+		 * @see <a href="https://en.cppreference.com/w/cpp/utility/initializer_list">std::initializer_list</a>
+		 */
+		Queue(std::initializer_list<T> init,
+		      const typename Base::allocator_type& allocator = typename Base::allocator_type()) noexcept: Base(allocator) {
+			this->enqueue_range(init.begin(), init.end());
+		}
+
+		/**
+		 * Copy constructor for a Queue which will perform a deep copy, element-wise, of another Queue
+		 * object of the same type `T`, with the allocator the allocator of the other queue selects for a copy.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the other queue.
+		 * @param other - another Queue object of the same type `T` to be copied.
+		 */
+		Queue(const Queue& other) noexcept: Base(std::allocator_traits<typename Base::allocator_type>::
+		                                         select_on_container_copy_construction(other.get_allocator())) {
+			this->append_copy(other);
+		}
+
+		/**
+		 * Copy constructor for a Queue which will perform a deep copy, element-wise, of any other queue of the
+		 * same type `T`, e.g. a PriorityQueue, keeping the order of its elements.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the other queue.
+		 * @param other - a queue of the same type `T` to be copied.
+		 */
+		template<typename OtherDerived, typename OtherStorage>
+		Queue(const QueueBase<OtherDerived, T, OtherStorage>& other) noexcept {
+			this->append_copy(other);
+		}
+
+		/**
+		 * Copy assignment operator for the Queue which will copy another Queue object of the same type
+		 * `T` into the current object.
 		 * \note
 		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the other queue + the number of elements
 		 * in the current queue.
-		 * @param other - another PriorityQueue object of the same type `T` to be copied.
+		 * @param other - another Queue object of the same type `T` to be copied.
 		 * @return - a reference to the current object.
 		 */
-		PriorityQueue<T>& operator=(const PriorityQueue<T>& other) noexcept {
+		Queue& operator=(const Queue& other) noexcept {
 			if (this != &other) {
-				if (mLength > 0)
-					clear();
-				if (other.mLength) {
-					head = new Node(other.head->data);
-					mLength = other.mLength;
-					priority_val = other.priority_val;
-					tail = head;
-					Node* other_node = other.head->next;
-					while (other_node) {
-						tail->next = new Node(other_node->data);
-						tail = tail->next;
-						other_node = other_node->next;
-					}
-				} else {
-					head = nullptr;
-					tail = head;
-					mLength = 0;
-				}
+				this->clear();
+				this->append_copy(other);
 			}
 			return *this;
 		}
 
 		/**
-		 * Move constructor for a PriorityQueue which will take the data from another PriorityQueue object of the same type
-		 * `T` and set the other object to its default state of not have any data.
+		 * Move constructor for a Queue which will take the data from another Queue object of the same type
+		 * `T`, along with its allocator, and set the other object to its default state of not have any data.
 		 * **Time Complexity** = *O(1)*.
-		 * @param other - an *r-value reference* to a PriorityQueue object of type `T` to be moved.
+		 * @param other - an *r-value reference* to a Queue object of type `T` to be moved.
 		 */
-		PriorityQueue(PriorityQueue<T>&& other) noexcept: Queue<T>(std::move(other)),
-		                                                  priority_val(other.priority_val) {}
+		Queue(Queue&& other) noexcept: Base(other.get_allocator()) {
+			this->take(other);
+		}
 
 		/**
-		 * Move constructor for a PriorityQueue which will take the data from a Queue object of the same type
-		 * `T` and set the other object to its default state of not have any data. The priority type will be set to `None`,
-		 * and the original order will be maintained.
+		 * Move constructor for a Queue which will take the data from any other queue of the same type `T` and storage
+		 * policy, e.g. a PriorityQueue, and set the other object to its default state of not have any data. The order
+		 * of its elements is kept.
 		 * **Time Complexity** = *O(1)*.
-		 * @param other - an *r-value reference* to a Queue object of type `T` to be moved.
+		 * @param other - an *r-value reference* to a queue of type `T` to be moved.
 		 */
-		explicit PriorityQueue(Queue<T>&& other) noexcept: Queue<T>(std::move(other)), priority_val(None) {}
+		template<typename OtherDerived>
+		Queue(QueueBase<OtherDerived, T, Storage>&& other) noexcept: Base(other.get_allocator()) {
+			this->take(other);
+		}
 
 		/**
-		 * Move assignment operator for the PriorityQueue which will move another PriorityQueue object of type `T` into
+		 * Move assignment operator for the Queue which will move another Queue object of type `T` into
 		 * the current object.
 		 * \note
 		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
 		 * **Time Complexity** = *O(1)*.
-		 * @param other - an *r-value reference* to a PriorityQueue object of type `T` to be moved.
+		 * @param other - an *r-value reference* to a Queue object of type `T` to be moved.
 		 * @return - a reference to the current object.
 		 */
-		PriorityQueue<T>& operator=(PriorityQueue<T>&& other) noexcept {
-			if (this != &other) {
-				if (mLength > 0)
-					clear();
-				head = other.head;
-				tail = other.tail;
-				mLength = other.mLength;
-				priority_val = other.priority_val;
-				other.head = nullptr;
-				other.tail = nullptr;
-				other.mLength = 0;
-				other.priority_val = None;
-			}
+		Queue& operator=(Queue&& other) noexcept {
+			if (this != &other)
+				this->take(other);
 			return *this;
 		}
 
 		/**
-		 * This is an override for the base class Queue enqueue() method. Allocates memory for a new element node
-		 * with the data provided and adds it to the queue positioned at an index based on the priority type. If the queue
-		 * is empty, it initialises the head of the queue with the data provided.
+		 * Queue destructor which clears the queue and releases any memory allocated for each element.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the queue.
+		 */
+		~Queue() = default;
+
+		/**
+		 * Deserializes a queue written by serialize(). If the data does not hold a serialized Queue of `T`, a
+		 * `runtime_error` exception is thrown.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the queue.
+		 * @param in - the serialization::Reader to read the queue from.
+		 * @return - the queue.
+		 */
+		static Queue deserialize(serialization::Reader& in) {
+			Queue result;
+			result.read_elements(in, in.header<T>(serialization::Kind::Queue).count);
+			return result;
+		}
+
+		/**
+		 * Returns a read-only view of the elements of a queue written by serialize(), in place in the data, from the
+		 * front to the back. Only available for trivially copyable elements.
 		 * **Time Complexity** = *O(1)*.
-		 * @param data - the data to be copied into the end of the queue.
+		 * @param in - the serialization::Reader to read the queue from.
+		 * @return - a span of the elements, valid as long as the data.
 		 */
-		void enqueue(const T& data) noexcept override {
-			Node* new_node = new Node(data);
-			if (priority_val == None && mLength) {
-				tail->next = new_node;
-				tail = new_node;
-				++mLength;
-				return;
-			}
-			if (mLength) {
-				Node* cur_node = head;
-				size_t index = 0;
-				switch (priority_val) {
-					case Ascending:
-						while (cur_node && cur_node->data <= data) {
-							cur_node = cur_node->next;
-							++index;
-						}
-						break;
+		static std::span<const T> view(serialization::Reader& in) requires serialization::Codec<T>::raw {
+			return in.view<T>(in.header<T>(serialization::Kind::Queue).count);
+		}
 
-					case Descending:
-						while (cur_node && cur_node->data >= data) {
-							cur_node = cur_node->next;
-							++index;
-						}
-						break;
-				}
-				if (index == 0) {
-					new_node->next = head;
-					if (head == tail)
-						tail = new_node->next;
-					head = new_node;
-					++mLength;
-					return;
-				}
-				size_t _index = 1;
-				cur_node = head;
-				Node* last_node = nullptr;
-				while (true) {
-					last_node = cur_node;
-					cur_node = cur_node->next;
-					if (_index == index) {
-						last_node->next = new_node;
-						new_node->next = cur_node;
-						++mLength;
-						return;
-					}
-					++_index;
-				}
-			}
-			head = new_node;
-			tail = head;
-			mLength = 1;
+	private:
+		friend Base;
+
+		static constexpr serialization::Kind kind = serialization::Kind::Queue;  /**< The kind of container in the serialization format. */
+
+		/**
+		 * Provides a boolean value that indicates whether elements are kept in order of insertion.
+		 * @return - `true`, as a Queue always keeps its elements in order of insertion.
+		 */
+		static constexpr bool unordered() noexcept {
+			return true;
 		}
 
 		/**
-		 * This is an override for the base class Queue enqueue() method. Allocates memory for a new element node
-		 * with the data provided and adds it to the queue positioned at an index based on the priority type. If the queue
-		 * is empty, it initialises the head of the queue with the data provided.
+		 * Links a new node to the end of the queue.
 		 * **Time Complexity** = *O(1)*.
-		 * @param data - an *r-value reference* to the data to be moved into the end of the queue.
+		 * @param node - a pointer to the node to link.
 		 */
-		void enqueue(T&& data) noexcept override {
-			Node* new_node = new Node(std::move(data));
-			if (priority_val == None && mLength) {
-				tail->next = new_node;
-				tail = new_node;
-				++mLength;
-				return;
-			}
-			if (mLength) {
-				Node* cur_node = head;
-				size_t index = 0;
-				switch (priority_val) {
-					case Ascending:
-						while (cur_node && cur_node->data <= data) {
-							cur_node = cur_node->next;
-							++index;
-						}
-						break;
+		void link_node(typename Base::Node* node) noexcept {
+			this->link_back(node);
+		}
+	};
 
-					case Descending:
-						while (cur_node && cur_node->data >= data) {
-							cur_node = cur_node->next;
-							++index;
-						}
-						break;
-				}
-				if (index == 0) {
-					new_node->next = head;
-					if (head == tail)
-						tail = new_node->next;
-					head = new_node;
-					++mLength;
-					return;
-				}
-				size_t _index = 1;
-				cur_node = head;
-				Node* last_node = nullptr;
-				while (true) {
-					last_node = cur_node;
-					cur_node = cur_node->next;
-					if (_index == index) {
-						last_node->next = new_node;
-						new_node->next = cur_node;
-						++mLength;
-						return;
-					}
-					++_index;
-				}
-			}
-			head = new_node;
-			tail = head;
-			mLength = 1;
+	/**
+	 * A specialised version of the Queue class, where the elements in the queue are ordered using a provided condition.
+	 * It shares all the methods of the Queue class, with enqueue() placing each element according to the ordering
+	 * policy instead of at the end of the queue.
+	 *
+	 * By default, the priority type is chosen at run time and may be `None`, meaning no order, `Ascending` or
+	 * `Descending`, see queue_policy::RuntimePriority. The order can instead be fixed at compile time with
+	 * queue_policy::Ascending, queue_policy::Descending or queue_policy::Ordered with any comparison object.
+	 *
+	 * \note
+	 * The type `T` **must** have a valid comparison operator functions.
+	 *
+	 * \note
+	 * A PriorityQueue is not derived from Queue, as both share QueueBase instead of virtual functions, so it cannot be
+	 * bound to a `Queue<T>&` or a `Queue<T>*`. It converts implicitly to a `Queue<T>` by copy or by move, keeping the
+	 * order of its elements, and code which accepts either kind of queue by reference can take a
+	 * `QueueBase<Derived, T, Storage>&`. `PriorityQueue<T>` keeps the run-time priority types, which are still
+	 * available as `PriorityQueue<T>::None`, `PriorityQueue<T>::Ascending` and `PriorityQueue<T>::Descending`.
+	 *
+	 * @tparam T - the type of data to be stored in each node of the priority queue.
+	 * @tparam Ordering - the ordering policy deciding where new elements are placed.
+	 * @tparam Storage - the storage policy deciding how nodes are allocated.
+	 * @see <a href="https://en.wikipedia.org/wiki/Priority_queue">Priority Queue</a>
+	 */
+	template<typename T, typename Ordering = queue_policy::RuntimePriority, typename Storage = queue_policy::PooledNodes>
+	class PriorityQueue : public QueueBase<PriorityQueue<T, Ordering, Storage>, T, Storage> {
+		using Base = QueueBase<PriorityQueue<T, Ordering, Storage>, T, Storage>;  /**< An alias for the base class. */
+
+	public:
+		using Priority = queue_policy::RuntimePriority::Priority;  /**< An alias for the run-time priority types. */
+		using enum queue_policy::RuntimePriority::Priority;
+
+		/**
+		 * Default PriorityQueue constructor which initialises the ordering policy to its default, which for the
+		 * run-time priority type is `None` meaning there is no order.
+		 */
+		PriorityQueue() noexcept = default;
+
+		/**
+		 * Overloaded PriorityQueue constructor which initialises an empty queue whose nodes will be allocated with the
+		 * allocator provided, and sets the priority type to use, which by default is `None`.
+		 * @param allocator - the allocator to allocate the nodes with.
+		 * @param priority - the priority type of the PriorityQueue.
+		 */
+		explicit PriorityQueue(const typename Base::allocator_type& allocator, Ordering priority = Ordering()) noexcept:
+				Base(allocator), order(priority) {}
+
+		/**
+		 * Overloaded PriorityQueue constructor which allocates memory for one element node and copies the data
+		 * provided and sets the priority type to use, which by default is `None`.
+		 * This constructor is explicit, meaning implicit conversion is not supported.
+		 * @param data -  data of type `T` to be copied into the head node of the Queue.
+		 * @param priority - the priority type of the PriorityQueue.
+		 * @see queue_policy::RuntimePriority.
+		 */
+		explicit PriorityQueue(const T& data, Ordering priority = Ordering()) noexcept: order(priority) {
+			this->enqueue(data);
 		}
 
 		/**
-		 * This is an override for the base class Queue enqueue() method. Adds each element from an initialiser list,
-		 * to the queue positioned at an index based on the priority type.
-		 * **Time Complexity** = *O(n)* where n is the number of elements in the initialiser list.
-		 * @param list - the initialiser list whose elements will be added to the queue.
-		 * @see <a href="https://en.cppreference.com/w/cpp/utility/initializer_list">std::initializer_list</a>
+		 * Overloaded PriorityQueue constructor which allocates memory for one element node and moves the data
+		 * provided and sets the priority type to use, which by default is `None`.
+		 * This constructor is explicit, meaning implicit conversion is not supported.
+		 * @param data -  an *r-value reference* to the data of type `T` to be moved into the head node of the Queue.
+		 * @param priority - the priority type of the PriorityQueue.
+		 * @see queue_policy::RuntimePriority.
 		 */
-		void enqueue(std::initializer_list<T> list) noexcept override {
-			for (auto it = list.begin(); it != list.end(); ++it)
-				enqueue(std::move(*it));
+		explicit PriorityQueue(T&& data, Ordering priority = Ordering()) noexcept: order(priority) {
+			this->enqueue(std::move(data));
 		}
 
 		/**
-		 * Equivalence operator which compares two PriorityQueue objects of the same type `T`, element-wise, and returns
-		 * a boolean value indicating whether the two objects contain the same data.
-		 * **Time Complexity** = *O(n)* where n is the number of elements in the current queue + the number of elements
-		 * in the other queue.
-		 * @param other - a PriorityQueue object of the same type `T`, whose data to compare against.
-		 * @return - a boolean value indicating whether the two queues contain the same data.
+		 * Copy constructor for PriorityQueue which will perform a deep copy, element-wise, of another PriorityQueue
+		 * object of the same type `T`. It also copies its priority type, and the allocator the allocator of the other
+		 * queue selects for a copy.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the other queue.
+		 * @param other - another PriorityQueue object of the same type `T` to be copied.
 		 */
-		[[nodiscard]] bool operator==(const PriorityQueue<T>& other) const noexcept {
-			if (mLength != other.mLength)
-				return false;
-			Node* cur = head;
-			Node* other_cur = other.head;
-			while (cur) {
-				if (cur->data != other_cur->data)
-					return false;
-				cur = cur->next;
-				other_cur = other_cur->next;
-			}
-			return true;
+		PriorityQueue(const PriorityQueue& other) noexcept:
+				Base(std::allocator_traits<typename Base::allocator_type>::select_on_container_copy_construction(
+						other.get_allocator())), order(other.order) {
+			this->append_copy(other);
 		}
 
 		/**
-		 * This is an override for the base Queue class operator== function. This is an equivalence operator which
-		 * compares this PriorityQueue to a Queue object, both of the same type `T`, element-wise, and returns
-		 * a boolean value indicating whether the two objects contain the same data.
-		 * **Time Complexity** = *O(n)* where n is the number of elements in the current queue + the number of elements
-		 * in the other queue.
-		 * @param other - a Queue object of the same type `T`, whose data to compare against.
-		 * @return - a boolean value indicating whether the two queues contain the same data.
+		 * Copy constructor for PriorityQueue which will perform a deep copy, element-wise, of any other queue
+		 * of the same type `T`, e.g. a Queue. The ordering policy is set to its default, so with the run-time
+		 * priority type the original order is maintained.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the other queue.
+		 * @param other - a queue of the same type `T` to be copied.
 		 */
-		[[nodiscard]] bool operator==(const Queue<T>& other) const noexcept override {
-			PriorityQueue<T> temp(other);
-			if (mLength != temp.mLength)
-				return false;
-			Node* cur = head;
-			Node* other_cur = temp.head;
-			while (cur) {
-				if (cur->data != other_cur->data)
-					return false;
-				cur = cur->next;
-				other_cur = other_cur->next;
-			}
-			return true;
+		template<typename OtherDerived, typename OtherStorage>
+		explicit PriorityQueue(const QueueBase<OtherDerived, T, OtherStorage>& other) noexcept {
+			this->append_copy(other);
 		}
 
 		/**
-		 * Plus operator which appends another PriorityQueue object of type `T` to the current queue.
-		 * **Time Complexity** = *O(n)* where n is the number of elements in this queue + the number of elements
-		 * in the other queue.
-		 * @param right - a PriorityQueue object of type `T` to append to the current queue.
-		 * @return - a copy of the current queue object.
-		 */
-		[[nodiscard]] PriorityQueue<T> operator+(PriorityQueue<T>& right) noexcept {
-			if (right.mLength) {
-				std::vector<T> right_data = right.contents();
-				PriorityQueue<T> res(*this);
-				for (const T& i: right_data)
-					res.enqueue(i);
-				return res;
+		 * Copy assignment operator for the PriorityQueue which will copy another PriorityQueue object of the same type
+		 * `T` into the current object, in its order along with its priority type.
+		 * \note
+		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the other queue + the number of elements
+		 * in the current queue.
+		 * @param other - another PriorityQueue object of the same type `T` to be copied.
+		 * @return - a reference to the current object.
+		 */
+		PriorityQueue& operator=(const PriorityQueue& other) noexcept {
+			if (this != &other) {
+				this->clear();
+				order = other.order;
+				this->append_copy(other);
 			}
 			return *this;
 		}
 
 		/**
-		 * Plus operator which appends a Queue object of type `T` to the current priority queue.
-		 * **Time Complexity** = *O(n)* where n is the number of elements in this queue + the number of elements
-		 * in the other queue.
-		 * @param right - a Queue object of type `T` to append to the current queue.
-		 * @return - a copy of the current queue object.
-		 */
-		[[nodiscard]] PriorityQueue<T> operator+(Queue<T>& right) noexcept {
-			if (right.mLength) {
-				std::vector<T> right_data = right.contents();
-				PriorityQueue<T> res(*this);
-				for (const T& i: right_data)
-					res.enqueue(i);
-				return res;
+		 * Move constructor for a PriorityQueue which will take the data from another PriorityQueue object of the same
+		 * type `T`, along with its allocator, and set the other object to its default state of not have any data.
+		 * **Time Complexity** = *O(1)*.
+		 * @param other - an *r-value reference* to a PriorityQueue object of type `T` to be moved.
+		 */
+		PriorityQueue(PriorityQueue&& other) noexcept: Base(other.get_allocator()), order(other.order) {
+			this->take(other);
+		}
+
+		/**
+		 * Move constructor for a PriorityQueue which will take the data from any other queue of the same type `T` and
+		 * storage policy, e.g. a Queue, and set the other object to its default state of not have any data. The
+		 * ordering policy is set to its default, so with the run-time priority type the original order is maintained
+		 * in *O(1)*, otherwise each element is moved into its position.
+		 * **Time Complexity** = *O(1)* for the run-time priority type.
+		 * @param other - an *r-value reference* to a queue of type `T` to be moved.
+		 */
+		template<typename OtherDerived>
+		explicit PriorityQueue(QueueBase<OtherDerived, T, Storage>&& other) noexcept: Base(other.get_allocator()) {
+			if (order.unordered())
+				this->take(other);
+			else
+				this->append_move(other);
+		}
+
+		/**
+		 * Move assignment operator for the PriorityQueue which will move another PriorityQueue object of type `T` into
+		 * the current object.
+		 * \note
+		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
+		 * **Time Complexity** = *O(1)*.
+		 * @param other - an *r-value reference* to a PriorityQueue object of type `T` to be moved.
+		 * @return - a reference to the current object.
+		 */
+		PriorityQueue& operator=(PriorityQueue&& other) noexcept {
+			if (this != &other) {
+				order = other.order;
+				this->take(other);
+				other.order = Ordering();
 			}
 			return *this;
 		}
@@ -780,34 +1256,88 @@ namespace custom {
 		 * PriorityQueue destructor which clears the queue and releases any memory allocated for each element.
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the queue.
 		 */
-		virtual ~PriorityQueue() {
-			if (mLength)
-				clear();
-		}
+		~PriorityQueue() = default;
 
-	public:
-		using Queue<T>::clear;  /**< An alias used to cleanly access clear member function in the base class. */
-		using Queue<T>::contents;  /**< An alias used to cleanly access contents member function in the base class. */
+		/**
+		 * Deserializes a priority queue written by serialize(). The ordering policy is not part of the data, so the
+		 * elements are placed with the one given, keeping their serialized order if it is the same as when they were
+		 * written. If the data does not hold a serialized PriorityQueue of `T`, a `runtime_error` exception is thrown.
+		 * **Time Complexity** = *O(n)* when the order is unchanged, otherwise *O(n^2)*, where n is the number of
+		 * elements in the queue.
+		 * @param in - the serialization::Reader to read the priority queue from.
+		 * @param priority - the ordering policy of the PriorityQueue.
+		 * @return - the priority queue.
+		 */
+		static PriorityQueue deserialize(serialization::Reader& in, Ordering priority = Ordering()) {
+			PriorityQueue result;
+			result.order = priority;
+			result.read_elements(in, in.header<T>(serialization::Kind::PriorityQueue).count);
+			return result;
+		}
 
 	private:
-		using typename Queue<T>::Node;  /**< An alias used to easily access the Node structure in the base class. */
-		using Queue<T>::head;  /**< An alias used to cleanly access head member in the base class. */
-		using Queue<T>::tail;  /**< An alias used to cleanly access tail member in the base class. */
-		using Queue<T>::mLength;  /**< An alias used to cleanly access mLength member in the base class. */
-
-		unsigned int priority_val;  /**< An unsigned integer to track the type of the priority applied to the queue. */
-		/**
-		 * An enum containing the possible priority types for the queue.
-		 * **0** indicates no order.
-		 * **1** indicates ascending order.
-		 * **2** indicates descending order.
-		 */
-		enum Priority : unsigned int {
-			None = 0U,
-			Ascending,
-			Descending
-		};
+		friend Base;
+
+		static constexpr serialization::Kind kind = serialization::Kind::PriorityQueue;  /**< The kind of container in the serialization format. */
+
+		using typename Base::Node;  /**< An alias used to easily access the Node structure in the base class. */
+		using Base::head;  /**< An alias used to cleanly access head member in the base class. */
+		using Base::tail;  /**< An alias used to cleanly access tail member in the base class. */
+		using Base::mLength;  /**< An alias used to cleanly access mLength member in the base class. */
+
+		[[no_unique_address]] Ordering order;  /**< The ordering policy deciding where new elements are placed. */
+
+		/**
+		 * Provides a boolean value that indicates whether elements are kept in order of insertion.
+		 * @return - a boolean value indicating whether the ordering policy leaves the elements unordered.
+		 */
+		[[nodiscard]] bool unordered() const noexcept {
+			return order.unordered();
+		}
+
+		/**
+		 * Links a new node into the queue, after every element which the ordering policy keeps ahead of it. Nodes
+		 * belonging at the end of the queue are linked in *O(1)*.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the queue.
+		 * @param node - a pointer to the node to link.
+		 */
+		void link_node(Node* node) noexcept {
+			if (!mLength || order.unordered() || order.precedes(tail->data, node->data)) {
+				this->link_back(node);
+				return;
+			}
+			if (!order.precedes(head->data, node->data)) {
+				node->next = head;
+				head = node;
+				++mLength;
+				return;
+			}
+			Node* cur_node = head;
+			while (order.precedes(cur_node->next->data, node->data))
+				cur_node = cur_node->next;
+			node->next = cur_node->next;
+			cur_node->next = node;
+			++mLength;
+		}
 	};
+
+	namespace pmr {
+		/**
+		 * A Queue whose nodes are pooled in chunks allocated from a `std::pmr::memory_resource`.
+		 * @tparam T - the type of data to be stored in each node of the queue.
+		 */
+		template<typename T>
+		using Queue = custom::Queue<T, queue_policy::BasicPooledNodes<std::pmr::polymorphic_allocator<std::byte>>>;
+
+		/**
+		 * A PriorityQueue whose nodes are pooled in chunks allocated from a `std::pmr::memory_resource`.
+		 * @tparam T - the type of data to be stored in each node of the priority queue.
+		 * @tparam Ordering - the ordering policy deciding where new elements are placed.
+		 */
+		template<typename T, typename Ordering = queue_policy::RuntimePriority>
+		using PriorityQueue = custom::PriorityQueue<T, Ordering,
+		                                            queue_policy::BasicPooledNodes<std::pmr::polymorphic_allocator<std::byte>>>;
+	}// namespace pmr
 }// namespace custom
 
-#endif// QUEUE_H
\ No newline at end of file
+#endif// QUEUE_H
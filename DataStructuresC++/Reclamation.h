@@ -0,0 +1,626 @@
+#ifndef RECLAMATION_H
+#define RECLAMATION_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace custom {
+	/**
+	 * A snapshot of the counters of a reclamation domain.
+	 */
+	struct ReclamationStats {
+		size_t retired = 0;  /**< The number of objects retired so far. */
+		size_t reclaimed = 0;  /**< The number of retired objects which have been freed. */
+		size_t pending = 0;  /**< The number of retired objects waiting to be freed, i.e. reclamation pending. */
+	};
+
+	/**
+	 * The common part of EpochDomain and HazardDomain: the counters, the list of objects left behind by threads which
+	 * have exited, and the bookkeeping which gives every thread its own record in every domain it uses. A thread's
+	 * records are handed back to their domains when the thread exits, unless the domain has already been destroyed.
+	 * It cannot be constructed on its own.
+	 */
+	class ReclamationDomain {
+	public:
+		ReclamationDomain(const ReclamationDomain&) = delete;
+
+		ReclamationDomain& operator=(const ReclamationDomain&) = delete;
+
+		/**
+		 * Provides the counters of the domain. The values are read without synchronisation, so they may be slightly
+		 * out of date while other threads retire or reclaim objects.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - the number of objects retired, reclaimed and pending reclamation.
+		 */
+		[[nodiscard]] ReclamationStats stats() const noexcept {
+			ReclamationStats result;
+			result.reclaimed = mReclaimed.load(std::memory_order_relaxed);
+			result.retired = std::max(mRetired.load(std::memory_order_relaxed), result.reclaimed);
+			result.pending = result.retired - result.reclaimed;
+			return result;
+		}
+
+	protected:
+		/**
+		 * An object which has been unlinked from a data structure and must be freed once no thread can access it.
+		 */
+		struct Retired {
+			void* pointer;  /**< A pointer to the object. */
+			void (*deleter)(void*);  /**< The function which frees the object. */
+			std::uint64_t epoch;  /**< The epoch in which the object was retired, only used by EpochDomain. */
+		};
+
+		std::mutex mOrphanMutex;  /**< A mutex guarding the list of orphaned objects. */
+		std::vector<Retired> mOrphans;  /**< Objects retired by threads which have since exited. */
+		std::atomic<size_t> mRetired{0};  /**< The number of objects retired so far. */
+		std::atomic<size_t> mReclaimed{0};  /**< The number of retired objects which have been freed. */
+
+		ReclamationDomain() {
+			std::lock_guard<std::mutex> lock(registry_mutex());
+			static std::uint64_t next_id = 0;
+			mId = ++next_id;
+			live_ids().push_back(mId);
+		}
+
+		~ReclamationDomain() {
+			unregister();
+		}
+
+		/**
+		 * Deletes an object of type `T` through a type-erased pointer.
+		 */
+		template<typename T>
+		static void delete_object(void* pointer) {
+			delete static_cast<T*>(pointer);
+		}
+
+		/**
+		 * Stops threads which exit from handing their records back to the domain. Derived domains call this before
+		 * freeing their records.
+		 */
+		void unregister() noexcept {
+			std::lock_guard<std::mutex> lock(registry_mutex());
+			auto& ids = live_ids();
+			ids.erase(std::remove(ids.begin(), ids.end(), mId), ids.end());
+		}
+
+		/**
+		 * Returns the record the calling thread registered with this domain, or `nullptr` if it has none.
+		 */
+		void* local_record() const noexcept {
+			auto& entries = thread_entries().entries;
+			for (auto it = entries.rbegin(); it != entries.rend(); ++it)
+				if (it->id == mId)
+					return it->record;
+			return nullptr;
+		}
+
+		/**
+		 * Registers a record for the calling thread, to be passed to `release` when the thread exits.
+		 */
+		void add_local_record(void* record, void (*release)(ReclamationDomain*, void*)) {
+			auto& entries = thread_entries().entries;
+			{
+				// Forget the records of domains which have been destroyed since the thread last registered one
+				std::lock_guard<std::mutex> lock(registry_mutex());
+				const auto& ids = live_ids();
+				entries.erase(std::remove_if(entries.begin(), entries.end(), [&ids](const ThreadEntry& entry) {
+					return std::find(ids.begin(), ids.end(), entry.id) == ids.end();
+				}), entries.end());
+			}
+			entries.push_back(ThreadEntry{mId, this, record, release});
+		}
+
+		/**
+		 * Frees every object of a list for which `safe` returns `true` and removes it from the list.
+		 * @return - the number of objects freed.
+		 */
+		template<typename Predicate>
+		size_t reclaim_if(std::vector<Retired>& list, Predicate&& safe) {
+			auto kept = std::stable_partition(list.begin(), list.end(),
+			                                  [&safe](const Retired& retired) { return !safe(retired); });
+			std::vector<Retired> reclaimable(kept, list.end());
+			list.erase(kept, list.end());
+			for (const Retired& retired: reclaimable)
+				retired.deleter(retired.pointer);
+			mReclaimed.fetch_add(reclaimable.size(), std::memory_order_relaxed);
+			return reclaimable.size();
+		}
+
+		/**
+		 * Moves the objects a thread retired, but did not free, into the list of orphaned objects.
+		 */
+		void adopt(std::vector<Retired>& list) {
+			std::lock_guard<std::mutex> lock(mOrphanMutex);
+			mOrphans.insert(mOrphans.end(), list.begin(), list.end());
+			list.clear();
+		}
+
+	private:
+		/**
+		 * A record a thread registered with a domain.
+		 */
+		struct ThreadEntry {
+			std::uint64_t id;  /**< The unique id of the domain, never reused. */
+			ReclamationDomain* domain;  /**< The domain the record belongs to. */
+			void* record;  /**< The record of the thread. */
+			void (*release)(ReclamationDomain*, void*);  /**< Hands the record back to its domain. */
+		};
+
+		/**
+		 * The records of a thread, handed back to the domains which are still alive when the thread exits.
+		 */
+		struct ThreadEntries {
+			std::vector<ThreadEntry> entries;
+
+			~ThreadEntries() {
+				std::lock_guard<std::mutex> lock(registry_mutex());
+				const auto& ids = live_ids();
+				for (const ThreadEntry& entry: entries)
+					if (std::find(ids.begin(), ids.end(), entry.id) != ids.end())
+						entry.release(entry.domain, entry.record);
+			}
+		};
+
+		std::uint64_t mId;  /**< The unique id of the domain. */
+
+		static std::mutex& registry_mutex() {
+			static std::mutex mutex;
+			return mutex;
+		}
+
+		static std::vector<std::uint64_t>& live_ids() {
+			static std::vector<std::uint64_t> ids;
+			return ids;
+		}
+
+		static ThreadEntries& thread_entries() {
+			thread_local ThreadEntries entries;
+			return entries;
+		}
+	};
+
+	/**
+	 * An implementation of epoch-based reclamation (EBR). Threads pin the domain with an EpochDomain::Guard for as long
+	 * as they hold pointers into a shared data structure, and retire objects once they have unlinked them. A global
+	 * epoch advances when every pinned thread has observed it, and an object retired in epoch e is freed once the
+	 * epoch reaches e + 2, when no thread pinned before it was retired can still be pinned.
+	 *
+	 * Pinning only writes to the thread's own record, so it is much cheaper than protecting every pointer with a
+	 * hazard pointer. However, a thread which stays pinned stops the epoch from advancing, and with it all
+	 * reclamation, so the garbage is only bounded while pinned sections are short.
+	 *
+	 * \note
+	 * The domain must outlive every guard and must not be destroyed while other threads are using it. Objects still
+	 * retired when it is destroyed are freed by its destructor.
+	 *
+	 * @see <a href="https://www.cl.cam.ac.uk/techreports/UCAM-CL-TR-579.pdf">Practical lock-freedom, K. Fraser</a>
+	 */
+	class EpochDomain : public ReclamationDomain {
+		struct Record;
+
+	public:
+		/**
+		 * An RAII guard which pins the domain for the calling thread from its construction until its destruction.
+		 * Guards may be nested, the thread stays pinned until the outermost one is destroyed.
+		 */
+		class Guard {
+		public:
+			explicit Guard(EpochDomain& domain) : mDomain(&domain), mRecord(&domain.this_record()) {
+				if (mRecord->nesting++ == 0) {
+					mRecord->state.store((domain.mEpoch.load(std::memory_order_relaxed) << 1) | 1,
+					                     std::memory_order_relaxed);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+				}
+			}
+
+			Guard(Guard&& other) noexcept: mDomain(std::exchange(other.mDomain, nullptr)), mRecord(other.mRecord) {}
+
+			Guard(const Guard&) = delete;
+
+			Guard& operator=(const Guard&) = delete;
+
+			Guard& operator=(Guard&&) = delete;
+
+			~Guard() {
+				if (mDomain && --mRecord->nesting == 0)
+					mRecord->state.store(0, std::memory_order_release);
+			}
+
+		private:
+			EpochDomain* mDomain;  /**< The domain pinned, or `nullptr` once the guard has been moved from. */
+			Record* mRecord;  /**< The record of the thread in the domain. */
+		};
+
+		/**
+		 * Constructs an EpochDomain.
+		 * @param threshold - the number of objects a thread retires before it tries to advance the epoch and free
+		 * them.
+		 */
+		explicit EpochDomain(size_t threshold = 128) : mThreshold(std::max<size_t>(1, threshold)) {}
+
+		/**
+		 * EpochDomain destructor which frees every object still retired.
+		 */
+		~EpochDomain() {
+			unregister();
+			Record* record = mRecords.load(std::memory_order_acquire);
+			while (record) {
+				Record* next = record->next;
+				reclaim_if(record->retired, [](const Retired&) { return true; });
+				delete record;
+				record = next;
+			}
+			reclaim_if(mOrphans, [](const Retired&) { return true; });
+		}
+
+		/**
+		 * Pins the domain for the calling thread.
+		 * @return - a guard keeping the domain pinned until it is destroyed.
+		 */
+		[[nodiscard]] Guard pin() {
+			return Guard(*this);
+		}
+
+		/**
+		 * Retires an object which has been unlinked from the data structure, to be deleted once no thread pinned
+		 * before this call is still pinned.
+		 * **Time Complexity** = *O(1)* amortised.
+		 * @tparam T - the type of the object, which must have been allocated with `new`.
+		 * @param pointer - a pointer to the object.
+		 */
+		template<typename T>
+		void retire(T* pointer) {
+			retire(pointer, &delete_object<T>);
+		}
+
+		/**
+		 * Retires an object which has been unlinked from the data structure, to be freed with the function provided
+		 * once no thread pinned before this call is still pinned.
+		 * **Time Complexity** = *O(1)* amortised.
+		 * @param pointer - a pointer to the object.
+		 * @param deleter - the function which frees the object.
+		 */
+		void retire(void* pointer, void (*deleter)(void*)) {
+			Record& record = this_record();
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			record.retired.push_back(Retired{pointer, deleter, mEpoch.load(std::memory_order_relaxed)});
+			mRetired.fetch_add(1, std::memory_order_relaxed);
+			if (record.retired.size() >= mThreshold)
+				collect(record);
+		}
+
+		/**
+		 * Tries to advance the epoch and frees the objects retired by the calling thread, and by threads which have
+		 * exited, which are safe to free.
+		 * **Time Complexity** = *O(t + n)* where t is the number of threads and n the number of objects retired.
+		 */
+		void collect() {
+			collect(this_record());
+		}
+
+		/**
+		 * Provides the current global epoch.
+		 * @return - an unsigned integer representing the global epoch.
+		 */
+		[[nodiscard]] std::uint64_t epoch() const noexcept {
+			return mEpoch.load(std::memory_order_relaxed);
+		}
+
+	private:
+		/**
+		 * The state of a thread in the domain, padded to its own cache line.
+		 */
+		struct alignas(64) Record {
+			std::atomic<std::uint64_t> state{0};  /**< The epoch the thread is pinned in shifted left by one, ORed with 1 while pinned. */
+			std::atomic<bool> in_use{true};  /**< Whether the record belongs to a thread. */
+			Record* next = nullptr;  /**< The next record of the domain. */
+			size_t nesting = 0;  /**< The number of guards of the thread alive. */
+			std::vector<Retired> retired;  /**< The objects retired by the thread and not yet freed. */
+		};
+
+		alignas(64) std::atomic<std::uint64_t> mEpoch{0};  /**< The global epoch. */
+		std::atomic<Record*> mRecords{nullptr};  /**< The records of every thread which used the domain. */
+		size_t mThreshold;  /**< The number of objects retired by a thread before it collects. */
+
+		/**
+		 * Returns the record of the calling thread, taking over a released record or allocating a new one on first use.
+		 */
+		Record& this_record() {
+			if (void* record = local_record())
+				return *static_cast<Record*>(record);
+			Record* record = mRecords.load(std::memory_order_acquire);
+			for (; record; record = record->next) {
+				bool expected = false;
+				if (!record->in_use.load(std::memory_order_relaxed) &&
+				    record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+					break;
+			}
+			if (!record) {
+				record = new Record();
+				record->next = mRecords.load(std::memory_order_relaxed);
+				while (!mRecords.compare_exchange_weak(record->next, record, std::memory_order_release,
+				                                       std::memory_order_relaxed)) {}
+			}
+			add_local_record(record, &release_record);
+			return *record;
+		}
+
+		static void release_record(ReclamationDomain* domain, void* pointer) {
+			auto* record = static_cast<Record*>(pointer);
+			record->nesting = 0;
+			record->state.store(0, std::memory_order_relaxed);
+			static_cast<EpochDomain*>(domain)->adopt(record->retired);
+			record->in_use.store(false, std::memory_order_release);
+		}
+
+		/**
+		 * Advances the epoch if every pinned thread has observed the current one.
+		 */
+		bool try_advance() noexcept {
+			std::uint64_t epoch = mEpoch.load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			for (Record* record = mRecords.load(std::memory_order_acquire); record; record = record->next) {
+				std::uint64_t state = record->state.load(std::memory_order_relaxed);
+				if ((state & 1) && (state >> 1) != epoch)
+					return false;
+			}
+			std::atomic_thread_fence(std::memory_order_acquire);
+			return mEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_release,
+			                                      std::memory_order_relaxed);
+		}
+
+		void collect(Record& record) {
+			try_advance();
+			std::uint64_t epoch = mEpoch.load(std::memory_order_acquire);
+			auto safe = [epoch](const Retired& retired) { return retired.epoch + 2 <= epoch; };
+			reclaim_if(record.retired, safe);
+			std::unique_lock<std::mutex> lock(mOrphanMutex, std::try_to_lock);
+			if (lock.owns_lock() && !mOrphans.empty())
+				reclaim_if(mOrphans, safe);
+		}
+	};
+
+	/**
+	 * An implementation of hazard pointers. Before dereferencing a pointer loaded from a shared data structure, a
+	 * thread publishes it in a hazard pointer with HazardDomain::Guard::protect(), and objects which have been retired
+	 * are only freed once no hazard pointer refers to them.
+	 *
+	 * Protecting a pointer costs a store and a full fence, more than pinning an EpochDomain, but a stalled thread can
+	 * only keep the objects it protects alive, so the number of objects pending reclamation is bounded by
+	 * *O(t * (h + r))* where t is the number of threads, h the number of hazard pointers per thread and r the
+	 * threshold.
+	 *
+	 * \note
+	 * The domain must outlive every guard and must not be destroyed while other threads are using it. Objects still
+	 * retired when it is destroyed are freed by its destructor.
+	 *
+	 * @see <a href="https://ieeexplore.ieee.org/document/1291819">Hazard Pointers: Safe Memory Reclamation for Lock-Free Objects, M. Michael</a>
+	 */
+	class HazardDomain : public ReclamationDomain {
+		struct Record;
+
+	public:
+		/**
+		 * An RAII guard owning one hazard pointer of the calling thread, which is cleared and made available again when
+		 * the guard is destroyed.
+		 */
+		class Guard {
+		public:
+			explicit Guard(HazardDomain& domain) : mRecord(&domain.this_record()), mSlot(0) {
+				std::uint64_t free = ~mRecord->used & (domain.mSlots == 64 ? ~0ULL : (1ULL << domain.mSlots) - 1);
+				if (!free)
+					throw std::runtime_error("Error: every hazard pointer of the thread is in use");
+				while (!(free & (1ULL << mSlot)))
+					++mSlot;
+				mRecord->used |= 1ULL << mSlot;
+			}
+
+			Guard(Guard&& other) noexcept: mRecord(std::exchange(other.mRecord, nullptr)), mSlot(other.mSlot) {}
+
+			Guard(const Guard&) = delete;
+
+			Guard& operator=(const Guard&) = delete;
+
+			Guard& operator=(Guard&&) = delete;
+
+			~Guard() {
+				if (mRecord) {
+					reset();
+					mRecord->used &= ~(1ULL << mSlot);
+				}
+			}
+
+			/**
+			 * Loads a pointer from an atomic variable and protects it, retrying until the hazard pointer is published
+			 * before the variable changes, so the object pointed to cannot be freed while it is protected.
+			 * **Time Complexity** = *O(1)* without contention.
+			 * @tparam T - the type of the object pointed to.
+			 * @param source - the atomic variable to load the pointer from.
+			 * @return - the pointer loaded, which stays valid until the guard protects another pointer or is destroyed.
+			 */
+			template<typename T>
+			T* protect(const std::atomic<T*>& source) noexcept {
+				T* pointer = source.load(std::memory_order_relaxed);
+				while (true) {
+					mRecord->hazards[mSlot].store(pointer, std::memory_order_relaxed);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					T* current = source.load(std::memory_order_acquire);
+					if (current == pointer)
+						return pointer;
+					pointer = current;
+				}
+			}
+
+			/**
+			 * Clears the hazard pointer, so the object it protected may be freed.
+			 */
+			void reset() noexcept {
+				mRecord->hazards[mSlot].store(nullptr, std::memory_order_release);
+			}
+
+		private:
+			Record* mRecord;  /**< The record of the thread, or `nullptr` once the guard has been moved from. */
+			size_t mSlot;  /**< The index of the hazard pointer owned by the guard. */
+		};
+
+		/**
+		 * Constructs a HazardDomain. If the number of hazard pointers per thread is 0 or more than 64, an
+		 * `invalid_argument` exception is thrown.
+		 * @param slots - the number of hazard pointers per thread, i.e. the number of guards a thread may hold at once.
+		 * @param threshold - the number of objects a thread retires before it scans the hazard pointers and frees the
+		 * objects which are not protected.
+		 */
+		explicit HazardDomain(size_t slots = 4, size_t threshold = 128) : mSlots(slots),
+		                                                                  mThreshold(std::max<size_t>(1, threshold)) {
+			if (slots == 0 || slots > 64)
+				throw std::invalid_argument("Error: a thread must have between 1 and 64 hazard pointers");
+		}
+
+		/**
+		 * HazardDomain destructor which frees every object still retired.
+		 */
+		~HazardDomain() {
+			unregister();
+			Record* record = mRecords.load(std::memory_order_acquire);
+			while (record) {
+				Record* next = record->next;
+				reclaim_if(record->retired, [](const Retired&) { return true; });
+				delete record;
+				record = next;
+			}
+			reclaim_if(mOrphans, [](const Retired&) { return true; });
+		}
+
+		/**
+		 * Acquires a hazard pointer of the calling thread. If every hazard pointer of the thread is in use, a
+		 * `runtime_error` exception is thrown.
+		 * @return - a guard owning the hazard pointer.
+		 */
+		[[nodiscard]] Guard guard() {
+			return Guard(*this);
+		}
+
+		/**
+		 * Retires an object which has been unlinked from the data structure, to be deleted once no hazard pointer
+		 * protects it.
+		 * **Time Complexity** = *O(1)* amortised.
+		 * @tparam T - the type of the object, which must have been allocated with `new`.
+		 * @param pointer - a pointer to the object.
+		 */
+		template<typename T>
+		void retire(T* pointer) {
+			retire(pointer, &delete_object<T>);
+		}
+
+		/**
+		 * Retires an object which has been unlinked from the data structure, to be freed with the function provided
+		 * once no hazard pointer protects it.
+		 * **Time Complexity** = *O(1)* amortised.
+		 * @param pointer - a pointer to the object.
+		 * @param deleter - the function which frees the object.
+		 */
+		void retire(void* pointer, void (*deleter)(void*)) {
+			Record& record = this_record();
+			record.retired.push_back(Retired{pointer, deleter, 0});
+			mRetired.fetch_add(1, std::memory_order_relaxed);
+			size_t hazards = mSlots * mRecordCount.load(std::memory_order_relaxed);
+			if (record.retired.size() >= std::max(mThreshold, 2 * hazards))
+				collect(record);
+		}
+
+		/**
+		 * Scans the hazard pointers of every thread and frees the objects retired by the calling thread, and by threads
+		 * which have exited, which are not protected.
+		 * **Time Complexity** = *O(t * h * log(t * h) + n)* where t is the number of threads, h the number of hazard
+		 * pointers per thread and n the number of objects retired.
+		 */
+		void collect() {
+			collect(this_record());
+		}
+
+	private:
+		/**
+		 * The hazard pointers and retired objects of a thread, padded to its own cache line.
+		 */
+		struct alignas(64) Record {
+			std::unique_ptr<std::atomic<void*>[]> hazards;  /**< The hazard pointers of the thread. */
+			std::uint64_t used = 0;  /**< A bit mask of the hazard pointers owned by a guard. */
+			std::atomic<bool> in_use{true};  /**< Whether the record belongs to a thread. */
+			Record* next = nullptr;  /**< The next record of the domain. */
+			std::vector<Retired> retired;  /**< The objects retired by the thread and not yet freed. */
+
+			explicit Record(size_t slots) : hazards(new std::atomic<void*>[slots]) {
+				for (size_t i = 0; i < slots; ++i)
+					hazards[i].store(nullptr, std::memory_order_relaxed);
+			}
+		};
+
+		std::atomic<Record*> mRecords{nullptr};  /**< The records of every thread which used the domain. */
+		std::atomic<size_t> mRecordCount{0};  /**< The number of records of the domain. */
+		size_t mSlots;  /**< The number of hazard pointers per thread. */
+		size_t mThreshold;  /**< The minimum number of objects retired by a thread before it collects. */
+
+		/**
+		 * Returns the record of the calling thread, taking over a released record or allocating a new one on first use.
+		 */
+		Record& this_record() {
+			if (void* record = local_record())
+				return *static_cast<Record*>(record);
+			Record* record = mRecords.load(std::memory_order_acquire);
+			for (; record; record = record->next) {
+				bool expected = false;
+				if (!record->in_use.load(std::memory_order_relaxed) &&
+				    record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+					break;
+			}
+			if (!record) {
+				record = new Record(mSlots);
+				record->next = mRecords.load(std::memory_order_relaxed);
+				while (!mRecords.compare_exchange_weak(record->next, record, std::memory_order_release,
+				                                       std::memory_order_relaxed)) {}
+				mRecordCount.fetch_add(1, std::memory_order_relaxed);
+			}
+			add_local_record(record, &release_record);
+			return *record;
+		}
+
+		static void release_record(ReclamationDomain* domain, void* pointer) {
+			auto* record = static_cast<Record*>(pointer);
+			auto* hazard_domain = static_cast<HazardDomain*>(domain);
+			for (size_t i = 0; i < hazard_domain->mSlots; ++i)
+				record->hazards[i].store(nullptr, std::memory_order_relaxed);
+			record->used = 0;
+			hazard_domain->adopt(record->retired);
+			record->in_use.store(false, std::memory_order_release);
+		}
+
+		void collect(Record& record) {
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			std::vector<void*> protected_pointers;
+			for (Record* other = mRecords.load(std::memory_order_acquire); other; other = other->next) {
+				for (size_t i = 0; i < mSlots; ++i) {
+					if (void* hazard = other->hazards[i].load(std::memory_order_acquire))
+						protected_pointers.push_back(hazard);
+				}
+			}
+			std::sort(protected_pointers.begin(), protected_pointers.end());
+			auto safe = [&protected_pointers](const Retired& retired) {
+				return !std::binary_search(protected_pointers.begin(), protected_pointers.end(), retired.pointer);
+			};
+			reclaim_if(record.retired, safe);
+			std::unique_lock<std::mutex> lock(mOrphanMutex, std::try_to_lock);
+			if (lock.owns_lock() && !mOrphans.empty())
+				reclaim_if(mOrphans, safe);
+		}
+	};
+}// namespace custom
+
+#endif// RECLAMATION_H
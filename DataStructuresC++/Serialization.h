@@ -0,0 +1,550 @@
+#ifndef SERIALIZATION_H
+#define SERIALIZATION_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * The binary format shared by the `serialize()` and `deserialize()` functions of the containers. Every container is
+ * written as a 32-byte header followed by its elements, in little-endian byte order:
+ *  - the magic number "CSER", the version of the format as 2 bytes, the Kind of container and a flags byte whose
+ *    lowest bit is set when the elements are stored raw,
+ *  - the size of a raw element as 4 bytes, or 0, then 4 reserved bytes,
+ *  - the number of elements as 8 bytes,
+ *  - 8 bytes whose meaning depends on the container, e.g. the number of buckets of a Map.
+ * The header starts at a multiple of 16 bytes from the beginning of the buffer, so several containers can be written
+ * one after another and the elements of each one stay aligned.
+ *
+ * Trivially copyable elements are stored raw, as their object representation, and copied in bulk with `memcpy`
+ * where the container stores them contiguously. The raw elements of the sequence containers can also be read in place
+ * through the `view()` functions, e.g. from a file mapped into memory by MappedFile, without copying them. Raw
+ * elements are only portable between platforms which agree on the layout of `T`, which always holds for the
+ * fixed-size integer and floating point types. Strings, pairs and the containers themselves are stored element by
+ * element, and other types can be supported by specialising serialization::Codec.
+ */
+namespace custom::serialization {
+	inline constexpr std::uint32_t magic = 0x52455343;  /**< The magic number starting every header, "CSER" in little-endian byte order. */
+	inline constexpr std::uint16_t version = 1;  /**< The version of the format written, data of a later version is rejected. */
+	inline constexpr size_t header_size = 32;  /**< The size of a header in bytes. */
+	inline constexpr size_t header_alignment = 16;  /**< The alignment of each header, and of the raw elements following it, from the start of the buffer. */
+
+	/**
+	 * The kinds of container in the format. The values are stored in the data, so they must never change.
+	 */
+	enum class Kind : std::uint8_t {
+		Vector = 1,
+		Array = 2,
+		LinkedList = 3,
+		DoublyLinkedList = 4,
+		Stack = 5,
+		Queue = 6,
+		PriorityQueue = 7,
+		Map = 8,
+		BinarySearchTree = 9,
+		BinaryTree = 10,
+		Tree = 11,
+		Graph = 12,
+		DirectedGraph = 13
+	};
+
+	/**
+	 * Returns the name of a kind of container, used in the messages of exceptions.
+	 * @param kind - the kind of container.
+	 * @return - the name of the container class.
+	 */
+	constexpr const char* name(Kind kind) noexcept {
+		constexpr std::array<const char*, 14> names = {"unknown container", "Vector", "Array", "LinkedList",
+		                                               "DoublyLinkedList", "Stack", "Queue", "PriorityQueue", "Map",
+		                                               "BinarySearchTree", "BinaryTree", "Tree", "Graph",
+		                                               "DirectedGraph"};
+		auto index = static_cast<size_t>(kind);
+		return index < names.size() ? names[index] : names[0];
+	}
+
+	/**
+	 * The fields of a header which describe the container, as returned by Reader::header().
+	 */
+	struct Header {
+		std::uint64_t count = 0;  /**< The number of elements, nodes or key-value pairs of the container. */
+		std::uint64_t extra = 0;  /**< The field whose meaning depends on the container. */
+	};
+
+	class Writer;
+	class Reader;
+
+	/**
+	 * Writes and reads values of type `T`. A specialisation provides a `raw` constant, true if values are stored as
+	 * their object representation and so can be copied and viewed in bulk, a static `write(Writer&, const T&)`
+	 * function and a static `read(Reader&)` function returning a `T`. Specialisations are provided for trivially
+	 * copyable types, strings, pairs and the containers of the library, and can be added for other types.
+	 * @tparam T - the type of the values.
+	 */
+	template<typename T>
+	struct Codec;
+
+	/**
+	 * Appends values in the format to a buffer of bytes.
+	 */
+	class Writer {
+	public:
+		Writer() noexcept = default;
+
+		/**
+		 * Appends bytes to the buffer.
+		 * **Time Complexity** = *O(n)* where n is the number of bytes.
+		 * @param data - a pointer to the bytes to append.
+		 * @param size - the number of bytes to append.
+		 */
+		void bytes(const void* data, size_t size) {
+			auto first = static_cast<const std::byte*>(data);
+			mBuffer.insert(mBuffer.end(), first, first + size);
+		}
+
+		/**
+		 * Appends a value with its Codec.
+		 * @tparam T - the type of the value.
+		 * @param value - the value to append.
+		 */
+		template<typename T>
+		void value(const T& value) {
+			Codec<T>::write(*this, value);
+		}
+
+		/**
+		 * Appends an array of values, in one copy if they are stored raw.
+		 * **Time Complexity** = *O(n)* where n is the number of values.
+		 * @tparam T - the type of the values.
+		 * @param data - a pointer to the first value.
+		 * @param count - the number of values.
+		 */
+		template<typename T>
+		void values(const T* data, size_t count) {
+			if constexpr (Codec<T>::raw)
+				bytes(data, count * sizeof(T));
+			else {
+				for (size_t i = 0; i < count; ++i)
+					value(data[i]);
+			}
+		}
+
+		/**
+		 * Appends the header of a container, preceded by the padding which aligns it.
+		 * @tparam T - the type of the elements of the container.
+		 * @param kind - the kind of container.
+		 * @param count - the number of elements, nodes or key-value pairs of the container.
+		 * @param extra - the field whose meaning depends on the container.
+		 */
+		template<typename T>
+		void header(Kind kind, std::uint64_t count, std::uint64_t extra = 0) {
+			mBuffer.resize((mBuffer.size() + header_alignment - 1) / header_alignment * header_alignment);
+			value(magic);
+			value(version);
+			value(static_cast<std::uint8_t>(kind));
+			value(static_cast<std::uint8_t>(Codec<T>::raw ? 1 : 0));
+			value(static_cast<std::uint32_t>(Codec<T>::raw ? sizeof(T) : 0));
+			value(std::uint32_t{0});
+			value(count);
+			value(extra);
+		}
+
+		/**
+		 * Returns the bytes written so far.
+		 * @return - a const reference to the buffer.
+		 */
+		[[nodiscard]] const std::vector<std::byte>& buffer() const noexcept {
+			return mBuffer;
+		}
+
+		/**
+		 * Moves the bytes written out of the writer, leaving it empty.
+		 * @return - the buffer.
+		 */
+		[[nodiscard]] std::vector<std::byte> take() noexcept {
+			return std::exchange(mBuffer, {});
+		}
+
+	private:
+		std::vector<std::byte> mBuffer;  /**< The bytes written. */
+	};
+
+	/**
+	 * Reads values in the format from a buffer of bytes, which it does not own. If the buffer ends before a value or
+	 * does not hold what is expected, a `runtime_error` exception is thrown.
+	 */
+	class Reader {
+	public:
+		/**
+		 * Creates a reader of the bytes given, starting at the first one.
+		 * @param data - the bytes to read, which must outlive the reader and any view into them.
+		 */
+		explicit Reader(std::span<const std::byte> data) noexcept: mData(data), mPosition(0) {}
+
+		/**
+		 * Copies the next bytes out of the buffer.
+		 * **Time Complexity** = *O(n)* where n is the number of bytes.
+		 * @param data - a pointer to the memory to copy the bytes into.
+		 * @param size - the number of bytes to read.
+		 */
+		void bytes(void* data, size_t size) {
+			if (size == 0)
+				return;
+			std::memcpy(data, take(size), size);
+		}
+
+		/**
+		 * Reads a value with its Codec.
+		 * @tparam T - the type of the value.
+		 * @return - the value read.
+		 */
+		template<typename T>
+		T value() {
+			return Codec<T>::read(*this);
+		}
+
+		/**
+		 * Reads an array of values which are stored raw in one copy, into memory which may be uninitialised.
+		 * **Time Complexity** = *O(n)* where n is the number of values.
+		 * @tparam T - the type of the values.
+		 * @param data - a pointer to the memory to copy the values into.
+		 * @param count - the number of values.
+		 */
+		template<typename T>
+		void values(T* data, size_t count) {
+			static_assert(Codec<T>::raw, "Only values stored raw are read in bulk");
+			bytes(data, count * sizeof(T));
+		}
+
+		/**
+		 * Returns a read-only view of an array of values stored raw, in place in the buffer. If the values are not
+		 * aligned for `T` in memory, a `runtime_error` exception is thrown, in which case the data must be
+		 * deserialized or copied to an aligned buffer instead.
+		 * **Time Complexity** = *O(1)*.
+		 * @tparam T - the type of the values.
+		 * @param count - the number of values.
+		 * @return - a span of the values, valid as long as the buffer.
+		 */
+		template<typename T>
+		std::span<const T> view(size_t count) {
+			static_assert(Codec<T>::raw, "Only values stored raw can be viewed in place");
+			const std::byte* data = take(count * sizeof(T));
+			if (reinterpret_cast<std::uintptr_t>(data) % alignof(T) != 0)
+				throw std::runtime_error("Error: serialized elements are not aligned, so cannot be viewed in place");
+			return {reinterpret_cast<const T*>(data), count};
+		}
+
+		/**
+		 * Reads the header of a container, after the padding which aligns it, and checks that it describes a
+		 * container of the kind expected with elements of type `T`, written in a version of the format which can be
+		 * read and whose elements fit in the rest of the buffer.
+		 * @tparam T - the type of the elements of the container.
+		 * @param kind - the kind of container expected.
+		 * @return - the number of elements and the extra field of the header.
+		 */
+		template<typename T>
+		Header header(Kind kind) {
+			take((header_alignment - mPosition % header_alignment) % header_alignment);
+			if (value<std::uint32_t>() != magic)
+				throw std::runtime_error("Error: the data is not a serialized container");
+			if (value<std::uint16_t>() > version)
+				throw std::runtime_error("Error: the data was serialized by a later version of the format");
+			auto stored = static_cast<Kind>(value<std::uint8_t>());
+			if (stored != kind)
+				throw std::runtime_error(std::string("Error: the data is a serialized ") + name(stored) + ", not a " +
+				                         name(kind));
+			bool raw = value<std::uint8_t>() & 1;
+			std::uint32_t element_size = value<std::uint32_t>();
+			if (raw != Codec<T>::raw || (raw && element_size != sizeof(T)))
+				throw std::runtime_error("Error: the elements of the serialized container are of a different type");
+			value<std::uint32_t>();
+			Header header;
+			header.count = value<std::uint64_t>();
+			header.extra = value<std::uint64_t>();
+			// Every element takes at least one byte, so a corrupt count is caught before memory is reserved for it
+			if (header.count > remaining() / (raw ? sizeof(T) : 1))
+				throw std::runtime_error("Error: the serialized data is truncated");
+			return header;
+		}
+
+		/**
+		 * Returns the number of bytes left to read.
+		 * @return - an unsigned integer representing the number of unread bytes.
+		 */
+		[[nodiscard]] size_t remaining() const noexcept {
+			return mData.size() - mPosition;
+		}
+
+	private:
+		std::span<const std::byte> mData;  /**< The bytes read. */
+		size_t mPosition;  /**< The index of the next byte to read. */
+
+		// Returns a pointer to the next bytes, moving past them
+		const std::byte* take(size_t size) {
+			if (size > remaining())
+				throw std::runtime_error("Error: the serialized data is truncated");
+			const std::byte* data = mData.data() + mPosition;
+			mPosition += size;
+			return data;
+		}
+	};
+
+	/**
+	 * Stores trivially copyable values raw. Arithmetic and enum values are byte-swapped on big-endian platforms, which
+	 * cannot store other types raw.
+	 */
+	template<typename T> requires std::is_trivially_copyable_v<T>
+	struct Codec<T> {
+		static constexpr bool raw = std::endian::native == std::endian::little || sizeof(T) == 1;  /**< Whether values are stored as their object representation. */
+
+		static_assert(raw || std::is_arithmetic_v<T> || std::is_enum_v<T>,
+		              "Only arithmetic and enum types can be serialized on big-endian platforms");
+
+		static void write(Writer& out, const T& value) {
+			auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+			if constexpr (!raw)
+				std::reverse(bytes.begin(), bytes.end());
+			out.bytes(bytes.data(), bytes.size());
+		}
+
+		static T read(Reader& in) {
+			std::array<std::byte, sizeof(T)> bytes;
+			in.bytes(bytes.data(), bytes.size());
+			if constexpr (!raw)
+				std::reverse(bytes.begin(), bytes.end());
+			return std::bit_cast<T>(bytes);
+		}
+	};
+
+	/**
+	 * Stores a string as its length followed by its characters.
+	 */
+	template<typename Char, typename Traits, typename Allocator>
+	struct Codec<std::basic_string<Char, Traits, Allocator>> {
+		static constexpr bool raw = false;  /**< Whether values are stored as their object representation. */
+
+		static void write(Writer& out, const std::basic_string<Char, Traits, Allocator>& value) {
+			out.value(static_cast<std::uint64_t>(value.size()));
+			out.values(value.data(), value.size());
+		}
+
+		static std::basic_string<Char, Traits, Allocator> read(Reader& in) {
+			auto size = in.value<std::uint64_t>();
+			if (size > in.remaining() / sizeof(Char))
+				throw std::runtime_error("Error: the serialized data is truncated");
+			std::basic_string<Char, Traits, Allocator> value(size, Char());
+			for (Char& c: value)
+				c = in.value<Char>();
+			return value;
+		}
+	};
+
+	/**
+	 * Stores a pair as its first value followed by its second value.
+	 */
+	template<typename First, typename Second> requires (!std::is_trivially_copyable_v<std::pair<First, Second>>)
+	struct Codec<std::pair<First, Second>> {
+		static constexpr bool raw = false;  /**< Whether values are stored as their object representation. */
+
+		static void write(Writer& out, const std::pair<First, Second>& value) {
+			out.value(value.first);
+			out.value(value.second);
+		}
+
+		static std::pair<First, Second> read(Reader& in) {
+			First first = in.value<First>();
+			return {std::move(first), in.value<Second>()};
+		}
+	};
+
+	/**
+	 * Stores a container of the library with its own `serialize()` and `deserialize()` functions, so containers can
+	 * be nested.
+	 */
+	template<typename T> requires (!std::is_trivially_copyable_v<T>) && requires(const T& container, Writer& out,
+	                                                                            Reader& in) {
+		container.serialize(out);
+		{ T::deserialize(in) } -> std::same_as<T>;
+	}
+	struct Codec<T> {
+		static constexpr bool raw = false;  /**< Whether values are stored as their object representation. */
+
+		static void write(Writer& out, const T& value) {
+			value.serialize(out);
+		}
+
+		static T read(Reader& in) {
+			return T::deserialize(in);
+		}
+	};
+
+	/**
+	 * A file mapped read-only into memory, to deserialize or view containers without reading the file into a buffer
+	 * first. Where memory mapping is not available the file is read into memory instead.
+	 */
+	class MappedFile {
+	public:
+		/**
+		 * Maps a file into memory. If the file cannot be opened or mapped, a `runtime_error` exception is thrown.
+		 * @param path - the path of the file.
+		 */
+		explicit MappedFile(const std::filesystem::path& path) : mData(nullptr), mSize(0) {
+#if defined(__unix__) || defined(__APPLE__)
+			int fd = ::open(path.c_str(), O_RDONLY);
+			struct stat status {};
+			if (fd == -1 || ::fstat(fd, &status) != 0) {
+				if (fd != -1)
+					::close(fd);
+				throw std::runtime_error("Error: could not open " + path.string());
+			}
+			mSize = static_cast<size_t>(status.st_size);
+			if (mSize) {
+				void* data = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+				if (data == MAP_FAILED) {
+					::close(fd);
+					throw std::runtime_error("Error: could not map " + path.string());
+				}
+				mData = static_cast<const std::byte*>(data);
+			}
+			::close(fd);
+#else
+			std::FILE* file = std::fopen(path.string().c_str(), "rb");
+			if (!file)
+				throw std::runtime_error("Error: could not open " + path.string());
+			mBuffer.resize(std::filesystem::file_size(path));
+			mSize = std::fread(mBuffer.data(), 1, mBuffer.size(), file);
+			std::fclose(file);
+			mData = mBuffer.data();
+#endif
+		}
+
+		MappedFile(const MappedFile&) = delete;
+
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/**
+		 * Unmaps the file, invalidating every view into it.
+		 */
+		~MappedFile() {
+#if defined(__unix__) || defined(__APPLE__)
+			if (mData)
+				::munmap(const_cast<std::byte*>(mData), mSize);
+#endif
+		}
+
+		/**
+		 * Returns the contents of the file.
+		 * @return - a span of the bytes of the file, valid as long as the MappedFile.
+		 */
+		[[nodiscard]] std::span<const std::byte> bytes() const noexcept {
+			return {mData, mSize};
+		}
+
+	private:
+		const std::byte* mData;  /**< The first byte of the file in memory. */
+		size_t mSize;  /**< The size of the file in bytes. */
+#if !(defined(__unix__) || defined(__APPLE__))
+		std::vector<std::byte> mBuffer;  /**< The contents of the file, where it cannot be mapped. */
+#endif
+	};
+}// namespace custom::serialization
+
+namespace custom {
+	/**
+	 * Serializes a container into a new buffer of bytes.
+	 * **Time Complexity** = *O(n)* where n is the number of elements in the container.
+	 * @tparam Container - the type of the container.
+	 * @param container - the container to serialize.
+	 * @return - a `std::vector` of the bytes of the serialized container.
+	 */
+	template<typename Container>
+	std::vector<std::byte> serialize(const Container& container) {
+		serialization::Writer out;
+		container.serialize(out);
+		return out.take();
+	}
+
+	/**
+	 * Deserializes a container from a buffer of bytes holding exactly one serialized container. If the buffer holds
+	 * anything else, a `runtime_error` exception is thrown.
+	 * **Time Complexity** = that of the `deserialize()` function of the container.
+	 * @tparam Container - the type of the container.
+	 * @param data - the bytes of the serialized container.
+	 * @return - the container.
+	 */
+	template<typename Container>
+	Container deserialize(std::span<const std::byte> data) {
+		serialization::Reader in(data);
+		Container container = Container::deserialize(in);
+		if (in.remaining())
+			throw std::runtime_error("Error: unexpected data after the serialized container");
+		return container;
+	}
+
+	/**
+	 * Returns a read-only view of the elements of a serialized sequence container, i.e. a Vector, Array, LinkedList,
+	 * DoublyLinkedList, Stack or Queue of trivially copyable elements, in place in a buffer of bytes such as a
+	 * MappedFile. If the buffer does not hold such a container, a `runtime_error` exception is thrown.
+	 * **Time Complexity** = *O(1)*.
+	 * @tparam Container - the type of the container.
+	 * @param data - the bytes of the serialized container.
+	 * @return - a span of the elements, in the order of the `contents()` of the container.
+	 */
+	template<typename Container>
+	auto view(std::span<const std::byte> data) {
+		serialization::Reader in(data);
+		return Container::view(in);
+	}
+
+	/**
+	 * Serializes a container into a file, replacing the file if it exists. If the file cannot be written, a
+	 * `runtime_error` exception is thrown.
+	 * **Time Complexity** = *O(n)* where n is the number of elements in the container.
+	 * @tparam Container - the type of the container.
+	 * @param container - the container to serialize.
+	 * @param path - the path of the file.
+	 */
+	template<typename Container>
+	void save(const Container& container, const std::filesystem::path& path) {
+		std::vector<std::byte> data = serialize(container);
+		std::FILE* file = std::fopen(path.string().c_str(), "wb");
+		if (!file)
+			throw std::runtime_error("Error: could not open " + path.string());
+		bool written = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+		if (std::fclose(file) != 0 || !written)
+			throw std::runtime_error("Error: could not write to " + path.string());
+	}
+
+	/**
+	 * Deserializes a container from a file written by save(), which is mapped into memory rather than read.
+	 * **Time Complexity** = that of the `deserialize()` function of the container.
+	 * @tparam Container - the type of the container.
+	 * @param path - the path of the file.
+	 * @return - the container.
+	 */
+	template<typename Container>
+	Container load(const std::filesystem::path& path) {
+		serialization::MappedFile file(path);
+		return deserialize<Container>(file.bytes());
+	}
+}// namespace custom
+
+#endif// SERIALIZATION_H
@@ -1,65 +1,1900 @@
 #ifndef SORTING_ALGORITHMS_H
 #define SORTING_ALGORITHMS_H
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "LinkedList.h"
+#include "SortingNetworks.h"
 
 namespace custom {
     template<typename T>
-    inline bool ascending(T a, T b) { return a > b; }
+    inline bool ascending(const T& a, const T& b) { return a > b; }
 
-    template<typename ListType>
-    void bubble_sort(ListType& list,
-                     bool (* comparison)(typename ListType::ValueType, typename ListType::ValueType) = &ascending) {
-        size_t list_size = list.length();
-        for (size_t i = 0; i < list_size - 1; ++i) {
+    namespace sort_detail {
+        // The default comparison of the simple sorts, equivalent to ascending() but inlinable for any element type
+        struct Ascending {
+            template<typename T, typename U>
+            constexpr bool operator()(const T& a, const U& b) const { return a > b; }
+        };
+
+        // The number of elements of a container providing either length(), like the lists, or size()
+        template<typename ListType>
+        inline size_t length(const ListType& list) {
+            if constexpr (requires { list.length(); })
+                return list.length();
+            else
+                return list.size();
+        }
+
+        // Applies the comparison to the projections of two elements
+        template<typename Compare, typename Projection, typename T, typename U>
+        inline bool out_of_order(Compare& comparison, Projection& projection, const T& a, const U& b) {
+            return std::invoke(comparison, std::invoke(projection, a), std::invoke(projection, b));
+        }
+
+        // Turns a contiguous iterator into a raw pointer, so the engines skip the bounds checks of container
+        // iterators. Other iterators are returned as they are
+        template<typename Iter>
+        auto unwrap(Iter it) {
+            if constexpr (std::contiguous_iterator<Iter>)
+                return std::to_address(it);
+            else
+                return it;
+        }
+
+        // Folds a projection into a comparison, so the sorting engines only deal with plain comparisons. Without a
+        // projection the comparison itself is returned, keeping its type visible to the engines
+        template<typename Compare, typename Projection>
+        decltype(auto) projected(Compare& comparison, Projection& projection) {
+            if constexpr (std::is_same_v<Projection, std::identity>)
+                return (comparison);
+            else
+                return [&comparison, &projection](const auto& a, const auto& b) -> bool {
+                    return out_of_order(comparison, projection, a, b);
+                };
+        }
+    }
+
+    template<typename ListType, typename Compare = sort_detail::Ascending, typename Projection = std::identity>
+    void bubble_sort(ListType& list, Compare comparison = {}, Projection projection = {}) {
+        size_t list_size = sort_detail::length(list);
+        for (size_t i = 0; i + 1 < list_size; ++i) {
             for (size_t j = 0; j < list_size - i - 1; ++j) {
-                if (comparison(list[j], list[j + 1])) {
-                    auto temp = list[j];
-                    list[j] = list[j + 1];
-                    list[j + 1] = temp;
-                }
+                if (sort_detail::out_of_order(comparison, projection, list[j], list[j + 1]))
+                    std::swap(list[j], list[j + 1]);
             }
         }
     }
 
-    template<typename ListType>
-    void selection_sort(ListType& list,
-                        bool (* comparison)(typename ListType::ValueType, typename ListType::ValueType) = &ascending) {
-        size_t list_size = list.length();
-        for (size_t i = 0; i < list_size - 1; ++i) {
+    template<typename ListType, typename Compare = sort_detail::Ascending, typename Projection = std::identity>
+    void selection_sort(ListType& list, Compare comparison = {}, Projection projection = {}) {
+        size_t list_size = sort_detail::length(list);
+        for (size_t i = 0; i + 1 < list_size; ++i) {
             size_t min = i;
             for (size_t j = i + 1; j < list_size; ++j) {
-                if (comparison(list[min], list[j]))
+                if (sort_detail::out_of_order(comparison, projection, list[min], list[j]))
                     min = j;
             }
-            if (min != i) {
-                auto temp = list[i];
-                list[i] = list[min];
-                list[min] = temp;
-            }
+            if (min != i)
+                std::swap(list[i], list[min]);
         }
     }
 
-    template<typename ListType>
-    void insertion_sort(ListType& list,
-                        bool (* comparison)(typename ListType::ValueType, typename ListType::ValueType) = &ascending) {
-        int list_size = static_cast<int>(list.length());
-        for (int i = 1; i < list_size; ++i) {
-            auto temp = list[i];
-            int j = i - 1;
-            while (j >= 0 && comparison(list[j], temp)) {
-                list[j + 1] = list[j];
+    template<typename ListType, typename Compare = sort_detail::Ascending, typename Projection = std::identity>
+    void insertion_sort(ListType& list, Compare comparison = {}, Projection projection = {}) {
+        size_t list_size = sort_detail::length(list);
+        for (size_t i = 1; i < list_size; ++i) {
+            auto temp = std::move(list[i]);
+            size_t j = i;
+            while (j > 0 && sort_detail::out_of_order(comparison, projection, list[j - 1], temp)) {
+                list[j] = std::move(list[j - 1]);
                 --j;
             }
-            list[j + 1] = temp;
+            list[j] = std::move(temp);
         }
     }
 
-    template<typename ListType>
-    void merge_sort(ListType& list,
-                    bool (* comparison)(typename ListType::ValueType, typename ListType::ValueType) = &ascending) {
+    template<typename ListType, typename Compare = sort_detail::Ascending, typename Projection = std::identity>
+    void merge_sort(ListType& list, Compare comparison = {}, Projection projection = {}) {
+        size_t list_size = sort_detail::length(list);
+        if (list_size < 2)
+            return;
+        using T = std::remove_cvref_t<decltype(list[0])>;
+        // Bottom-up merges of runs of doubling width through a scratch buffer, taking from the left run on ties so
+        // the sort is stable
+        std::vector<T> buffer;
+        buffer.reserve(list_size);
+        for (size_t width = 1; width < list_size; width *= 2) {
+            for (size_t left = 0; left + width < list_size; left += 2 * width) {
+                size_t middle = left + width;
+                size_t right = std::min(middle + width, list_size);
+                if (!sort_detail::out_of_order(comparison, projection, list[middle - 1], list[middle]))
+                    continue;
+                buffer.clear();
+                for (size_t k = left; k < middle; ++k)
+                    buffer.push_back(std::move(list[k]));
+                size_t i = 0, j = middle, k = left;
+                while (i < buffer.size() && j < right) {
+                    if (sort_detail::out_of_order(comparison, projection, buffer[i], list[j]))
+                        list[k++] = std::move(list[j++]);
+                    else
+                        list[k++] = std::move(buffer[i++]);
+                }
+                while (i < buffer.size())
+                    list[k++] = std::move(buffer[i++]);
+            }
+        }
+    }
+
+    namespace sort_detail {
+        // The pattern-defeating quicksort below, from the thresholds to pdq_sort(), is adapted from pdqsort by Orson
+        // Peters, https://github.com/orlp/pdqsort, and altered to sort through comparison references, hand short
+        // ranges to the SIMD sorting networks and detect runs up front. It is used under the zlib licence of the
+        // original, whose notice follows:
+        //
+        // pdqsort.h - Pattern-defeating quicksort.
+        //
+        // Copyright (c) 2021 Orson Peters
+        //
+        // This software is provided 'as-is', without any express or implied warranty. In no event will the authors be
+        // held liable for any damages arising from the use of this software.
+        //
+        // Permission is granted to anyone to use this software for any purpose, including commercial applications, and
+        // to alter it and redistribute it freely, subject to the following restrictions:
+        //
+        // 1. The origin of this software must not be misrepresented; you must not claim that you wrote the original
+        //    software. If you use this software in a product, an acknowledgment in the product documentation would be
+        //    appreciated but is not required.
+        //
+        // 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the
+        //    original software.
+        //
+        // 3. This notice may not be removed or altered from any source distribution.
+
+        // Ranges shorter than this are sorted with insertion sort
+        inline constexpr std::ptrdiff_t insertion_sort_threshold = 24;
+        // Ranges longer than this use the median of three medians of three as pivot
+        inline constexpr std::ptrdiff_t ninther_threshold = 128;
+        // Elements moved by a partial insertion sort before it gives up
+        inline constexpr std::ptrdiff_t partial_insertion_sort_limit = 8;
+        // Elements per block of the branchless partition, each offset must fit in an unsigned char
+        inline constexpr std::ptrdiff_t block_size = 64;
+
+        // Branchless partitioning only pays off when comparisons are cheap and free of side effects
+        template<typename T, typename Compare>
+        inline constexpr bool is_branchless_v = std::is_arithmetic_v<T> &&
+                                                (std::is_same_v<Compare, std::less<T>> ||
+                                                 std::is_same_v<Compare, std::less<>> ||
+                                                 std::is_same_v<Compare, std::greater<T>> ||
+                                                 std::is_same_v<Compare, std::greater<>>);
+
+        // Short contiguous ranges sorted in ascending order by the natural order of a type supported by the SIMD
+        // sorting networks are handed to them
+        template<typename Iter, typename Compare>
+        inline constexpr bool uses_network_v = std::is_pointer_v<Iter> &&
+                                               network_sortable<std::remove_cv_t<std::remove_pointer_t<Iter>>> &&
+                                               (std::is_same_v<Compare, std::less<std::remove_pointer_t<Iter>>> ||
+                                                std::is_same_v<Compare, std::less<>>);
+
+        template<typename Iter, typename Compare>
+        void insertion_sort(Iter begin, Iter end, Compare& comp) {
+            if (begin == end)
+                return;
+            for (Iter cur = begin + 1; cur != end; ++cur) {
+                Iter sift = cur;
+                Iter sift_1 = cur - 1;
+                if (comp(*sift, *sift_1)) {
+                    auto temp = std::move(*sift);
+                    do {
+                        *sift-- = std::move(*sift_1);
+                    } while (sift != begin && comp(temp, *--sift_1));
+                    *sift = std::move(temp);
+                }
+            }
+        }
+
+        // Requires an element before begin which compares less than or equal to every element of the range
+        template<typename Iter, typename Compare>
+        void unguarded_insertion_sort(Iter begin, Iter end, Compare& comp) {
+            if (begin == end)
+                return;
+            for (Iter cur = begin + 1; cur != end; ++cur) {
+                Iter sift = cur;
+                Iter sift_1 = cur - 1;
+                if (comp(*sift, *sift_1)) {
+                    auto temp = std::move(*sift);
+                    do {
+                        *sift-- = std::move(*sift_1);
+                    } while (comp(temp, *--sift_1));
+                    *sift = std::move(temp);
+                }
+            }
+        }
+
+        // Insertion sort which gives up after moving partial_insertion_sort_limit elements, returning whether the
+        // range was sorted
+        template<typename Iter, typename Compare>
+        bool partial_insertion_sort(Iter begin, Iter end, Compare& comp) {
+            if (begin == end)
+                return true;
+            std::ptrdiff_t limit = 0;
+            for (Iter cur = begin + 1; cur != end; ++cur) {
+                Iter sift = cur;
+                Iter sift_1 = cur - 1;
+                if (comp(*sift, *sift_1)) {
+                    auto temp = std::move(*sift);
+                    do {
+                        *sift-- = std::move(*sift_1);
+                    } while (sift != begin && comp(temp, *--sift_1));
+                    *sift = std::move(temp);
+                    limit += cur - sift;
+                }
+                if (limit > partial_insertion_sort_limit)
+                    return false;
+            }
+            return true;
+        }
+
+        template<typename Iter, typename Compare>
+        inline void sort2(Iter a, Iter b, Compare& comp) {
+            if (comp(*b, *a))
+                std::iter_swap(a, b);
+        }
+
+        template<typename Iter, typename Compare>
+        inline void sort3(Iter a, Iter b, Iter c, Compare& comp) {
+            sort2(a, b, comp);
+            sort2(b, c, comp);
+            sort2(a, b, comp);
+        }
+
+        template<typename Iter>
+        inline void swap_offsets(Iter first, Iter last, unsigned char* offsets_l, unsigned char* offsets_r,
+                                 std::ptrdiff_t num, bool use_swaps) {
+            if (use_swaps) {
+                // Needed when the pivot is the only element which ends up in the right place
+                for (std::ptrdiff_t i = 0; i < num; ++i)
+                    std::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+            } else if (num > 0) {
+                Iter l = first + offsets_l[0];
+                Iter r = last - offsets_r[0];
+                auto temp = std::move(*l);
+                *l = std::move(*r);
+                for (std::ptrdiff_t i = 1; i < num; ++i) {
+                    l = first + offsets_l[i];
+                    *r = std::move(*l);
+                    r = last - offsets_r[i];
+                    *l = std::move(*r);
+                }
+                *r = std::move(temp);
+            }
+        }
+
+        // Partitions [begin, end) around the pivot *begin, elements equal to the pivot going to the right. Returns the
+        // position of the pivot and whether the range was already partitioned. Requires a median of three pivot
+        // selection so that an element not less than the pivot exists to the right
+        template<typename Iter, typename Compare>
+        std::pair<Iter, bool> partition_right(Iter begin, Iter end, Compare& comp) {
+            auto pivot = std::move(*begin);
+            Iter first = begin;
+            Iter last = end;
+            // Find the first element greater than or equal to the pivot, guarded by the median of three
+            while (comp(*++first, pivot));
+            // Find the first element strictly smaller than the pivot, guarded if nothing was found before
+            if (first - 1 == begin)
+                while (first < last && !comp(*--last, pivot));
+            else
+                while (!comp(*--last, pivot));
+            bool already_partitioned = first >= last;
+            while (first < last) {
+                std::iter_swap(first, last);
+                while (comp(*++first, pivot));
+                while (!comp(*--last, pivot));
+            }
+            Iter pivot_pos = first - 1;
+            *begin = std::move(*pivot_pos);
+            *pivot_pos = std::move(pivot);
+            return {pivot_pos, already_partitioned};
+        }
+
+        // As partition_right, but processes blocks of comparisons into offset buffers first so the loop has no
+        // data-dependent branches
+        template<typename Iter, typename Compare>
+        std::pair<Iter, bool> partition_right_branchless(Iter begin, Iter end, Compare& comp) {
+            auto pivot = std::move(*begin);
+            Iter first = begin;
+            Iter last = end;
+            while (comp(*++first, pivot));
+            if (first - 1 == begin)
+                while (first < last && !comp(*--last, pivot));
+            else
+                while (!comp(*--last, pivot));
+            bool already_partitioned = first >= last;
+            if (!already_partitioned) {
+                std::iter_swap(first, last);
+                ++first;
+
+                alignas(64) unsigned char offsets_l_storage[block_size];
+                alignas(64) unsigned char offsets_r_storage[block_size];
+                unsigned char* offsets_l = offsets_l_storage;
+                unsigned char* offsets_r = offsets_r_storage;
+                Iter offsets_l_base = first;
+                Iter offsets_r_base = last;
+                std::ptrdiff_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+                while (first < last) {
+                    std::ptrdiff_t num_unknown = last - first;
+                    std::ptrdiff_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+                    std::ptrdiff_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+                    // Fill the offset blocks
+                    if (left_split >= block_size) {
+                        for (std::ptrdiff_t i = 0; i < block_size;) {
+                            offsets_l[num_l] = static_cast<unsigned char>(i++);
+                            num_l += !comp(*first, pivot);
+                            ++first;
+                            offsets_l[num_l] = static_cast<unsigned char>(i++);
+                            num_l += !comp(*first, pivot);
+                            ++first;
+                            offsets_l[num_l] = static_cast<unsigned char>(i++);
+                            num_l += !comp(*first, pivot);
+                            ++first;
+                            offsets_l[num_l] = static_cast<unsigned char>(i++);
+                            num_l += !comp(*first, pivot);
+                            ++first;
+                        }
+                    } else {
+                        for (std::ptrdiff_t i = 0; i < left_split;) {
+                            offsets_l[num_l] = static_cast<unsigned char>(i++);
+                            num_l += !comp(*first, pivot);
+                            ++first;
+                        }
+                    }
+
+                    if (right_split >= block_size) {
+                        for (std::ptrdiff_t i = 0; i < block_size;) {
+                            offsets_r[num_r] = static_cast<unsigned char>(++i);
+                            num_r += comp(*--last, pivot);
+                            offsets_r[num_r] = static_cast<unsigned char>(++i);
+                            num_r += comp(*--last, pivot);
+                            offsets_r[num_r] = static_cast<unsigned char>(++i);
+                            num_r += comp(*--last, pivot);
+                            offsets_r[num_r] = static_cast<unsigned char>(++i);
+                            num_r += comp(*--last, pivot);
+                        }
+                    } else {
+                        for (std::ptrdiff_t i = 0; i < right_split;) {
+                            offsets_r[num_r] = static_cast<unsigned char>(++i);
+                            num_r += comp(*--last, pivot);
+                        }
+                    }
+
+                    // Swap the elements and update the block sizes and first/last boundaries
+                    std::ptrdiff_t num = std::min(num_l, num_r);
+                    swap_offsets(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r, num,
+                                 num_l == num_r);
+                    num_l -= num;
+                    num_r -= num;
+                    start_l += num;
+                    start_r += num;
+
+                    if (num_l == 0) {
+                        start_l = 0;
+                        offsets_l_base = first;
+                    }
+                    if (num_r == 0) {
+                        start_r = 0;
+                        offsets_r_base = last;
+                    }
+                }
+
+                // Some elements may be left in one of the buffers, move them to the boundary
+                if (num_l) {
+                    offsets_l += start_l;
+                    while (num_l--)
+                        std::iter_swap(offsets_l_base + offsets_l[num_l], --last);
+                    first = last;
+                }
+                if (num_r) {
+                    offsets_r += start_r;
+                    while (num_r--)
+                        std::iter_swap(offsets_r_base - offsets_r[num_r], first), ++first;
+                    last = first;
+                }
+            }
+            Iter pivot_pos = first - 1;
+            *begin = std::move(*pivot_pos);
+            *pivot_pos = std::move(pivot);
+            return {pivot_pos, already_partitioned};
+        }
+
+        // Partitions [begin, end) around the pivot *begin, elements equal to the pivot going to the left, returning
+        // the position of the pivot. Used when the pivot equals the element before the range, so every element equal
+        // to it is already in place once the partition is done
+        template<typename Iter, typename Compare>
+        Iter partition_left(Iter begin, Iter end, Compare& comp) {
+            auto pivot = std::move(*begin);
+            Iter first = begin;
+            Iter last = end;
+            while (comp(pivot, *--last));
+            if (last + 1 == end)
+                while (first < last && !comp(pivot, *++first));
+            else
+                while (!comp(pivot, *++first));
+            while (first < last) {
+                std::iter_swap(first, last);
+                while (comp(pivot, *--last));
+                while (!comp(pivot, *++first));
+            }
+            Iter pivot_pos = last;
+            *begin = std::move(*pivot_pos);
+            *pivot_pos = std::move(pivot);
+            return pivot_pos;
+        }
+
+        // Chooses the pivot as the median of three, or the pseudo median of nine for large ranges, and moves it to
+        // the beginning
+        template<typename Iter, typename Compare>
+        inline void choose_pivot(Iter begin, Iter end, Compare& comp) {
+            std::ptrdiff_t size = end - begin;
+            std::ptrdiff_t half = size / 2;
+            if (size > ninther_threshold) {
+                sort3(begin, begin + half, end - 1, comp);
+                sort3(begin + 1, begin + (half - 1), end - 2, comp);
+                sort3(begin + 2, begin + (half + 1), end - 3, comp);
+                sort3(begin + (half - 1), begin + half, begin + (half + 1), comp);
+                std::iter_swap(begin, begin + half);
+            } else
+                sort3(begin + half, begin, end - 1, comp);
+        }
+
+        template<bool Branchless, typename Iter, typename Compare>
+        void pdq_sort_loop(Iter begin, Iter end, Compare& comp, int bad_allowed, bool leftmost = true) {
+            while (true) {
+                std::ptrdiff_t size = end - begin;
+                if constexpr (uses_network_v<Iter, Compare>) {
+                    if (size <= static_cast<std::ptrdiff_t>(network_sort_max)) {
+                        network_detail::network_sort(begin, static_cast<size_t>(size), simd_level());
+                        return;
+                    }
+                }
+                if (size < insertion_sort_threshold) {
+                    if (leftmost)
+                        insertion_sort(begin, end, comp);
+                    else
+                        unguarded_insertion_sort(begin, end, comp);
+                    return;
+                }
+
+                choose_pivot(begin, end, comp);
+
+                // If the pivot equals the element before the range, which is a pivot of an earlier partition, every
+                // element equal to it can be put in place at once, so many duplicates take linear time
+                if (!leftmost && !comp(*(begin - 1), *begin)) {
+                    begin = partition_left(begin, end, comp) + 1;
+                    continue;
+                }
+
+                auto [pivot_pos, already_partitioned] = Branchless ? partition_right_branchless(begin, end, comp)
+                                                                   : partition_right(begin, end, comp);
+
+                std::ptrdiff_t l_size = pivot_pos - begin;
+                std::ptrdiff_t r_size = end - (pivot_pos + 1);
+                bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+                if (highly_unbalanced) {
+                    // Fall back to heap sort after too many bad partitions, guaranteeing O(n log n)
+                    if (--bad_allowed == 0) {
+                        std::make_heap(begin, end, comp);
+                        std::sort_heap(begin, end, comp);
+                        return;
+                    }
+                    // Otherwise swap some elements to break patterns which keep producing bad pivots
+                    if (l_size >= insertion_sort_threshold) {
+                        std::iter_swap(begin, begin + l_size / 4);
+                        std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+                        if (l_size > ninther_threshold) {
+                            std::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+                            std::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+                            std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                            std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                        }
+                    }
+                    if (r_size >= insertion_sort_threshold) {
+                        std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                        std::iter_swap(end - 1, end - r_size / 4);
+                        if (r_size > ninther_threshold) {
+                            std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                            std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                            std::iter_swap(end - 2, end - (1 + r_size / 4));
+                            std::iter_swap(end - 3, end - (2 + r_size / 4));
+                        }
+                    }
+                } else {
+                    // A well balanced partition which swapped nothing hints at a sorted input, try to finish both
+                    // sides with a bounded insertion sort
+                    if (already_partitioned && partial_insertion_sort(begin, pivot_pos, comp) &&
+                        partial_insertion_sort(pivot_pos + 1, end, comp))
+                        return;
+                }
+
+                // Recurse into the left side and loop on the right one
+                pdq_sort_loop<Branchless>(begin, pivot_pos, comp, bad_allowed, leftmost);
+                begin = pivot_pos + 1;
+                leftmost = false;
+            }
+        }
+
+        // Sorts the range unless it is a single non-decreasing or non-increasing run, which is left as it is or
+        // reversed in linear time
+        template<typename Iter, typename Compare>
+        void pdq_sort(Iter begin, Iter end, Compare& comp) {
+            std::ptrdiff_t size = end - begin;
+            if (size < 2)
+                return;
+            Iter run = begin + 1;
+            if (comp(*run, *begin)) {
+                while (run != end && !comp(*(run - 1), *run))
+                    ++run;
+                if (run == end) {
+                    std::reverse(begin, end);
+                    return;
+                }
+            } else {
+                while (run != end && !comp(*run, *(run - 1)))
+                    ++run;
+                if (run == end)
+                    return;
+            }
+            using T = typename std::iterator_traits<Iter>::value_type;
+            int bad_allowed = std::bit_width(static_cast<std::make_unsigned_t<std::ptrdiff_t>>(size));
+            pdq_sort_loop<is_branchless_v<T, Compare>>(begin, end, comp, bad_allowed);
+        }
+    }
+
+    /**
+     * Sorts the elements in the range [first, last) using pattern-defeating quicksort, an introsort which combines
+     * the fast average case of a randomised quicksort with the fast worst case of heap sort, while running in linear
+     * time on inputs with certain patterns. A range which is already sorted, or sorted in reverse, is detected up
+     * front and handled in a single pass. Ranges with many duplicate elements are partitioned in linear time. The sort
+     * is not stable.
+     *
+     * Contiguous ranges, such as those of Vector, Array, `std::vector` or raw arrays, are sorted through raw pointers,
+     * so the bounds checks of the container iterators are only paid once.
+     * **Time Complexity** = *O(n log n)*, *O(n)* for sorted, reverse sorted or all-equal inputs.
+     * @tparam RandomIt - the type of the random-access iterators over the elements.
+     * @tparam Compare - the type of the comparison object, returning `true` if its first argument should come first.
+     * @tparam Projection - the type of the projection applied to the elements before they are compared.
+     * @param first - an iterator to the first element to sort.
+     * @param last - an iterator past the last element to sort.
+     * @param comp - the comparison object, defaults to `std::less<>` which sorts in ascending order.
+     * @param proj - the projection, e.g. a pointer to a member to sort by, defaults to the element itself.
+     * @see <a href="https://arxiv.org/abs/2106.05123">Pattern-defeating Quicksort</a>
+     * @see <a href="https://github.com/orlp/pdqsort">pdqsort</a>, by Orson Peters, from which the implementation is
+     * adapted under the zlib licence.
+     */
+    template<typename RandomIt, typename Compare = std::less<>, typename Projection = std::identity>
+    requires std::random_access_iterator<RandomIt>
+    void pdq_sort(RandomIt first, RandomIt last, Compare comp = {}, Projection proj = {}) {
+        if (first == last)
+            return;
+        auto&& compare = sort_detail::projected(comp, proj);
+        auto begin = sort_detail::unwrap(first);
+        sort_detail::pdq_sort(begin, begin + (last - first), compare);
+    }
+
+    /**
+     * Sorts every element of a container with random-access iterators, such as Vector or Array, using
+     * pattern-defeating quicksort.
+     * **Time Complexity** = *O(n log n)*, *O(n)* for sorted, reverse sorted or all-equal inputs.
+     * @tparam Container - the type of the container.
+     * @tparam Compare - the type of the comparison object, returning `true` if its first argument should come first.
+     * @tparam Projection - the type of the projection applied to the elements before they are compared.
+     * @param container - the container to sort.
+     * @param comp - the comparison object, defaults to `std::less<>` which sorts in ascending order.
+     * @param proj - the projection, e.g. a pointer to a member to sort by, defaults to the element itself.
+     */
+    template<typename Container, typename Compare = std::less<>, typename Projection = std::identity>
+    requires (!std::random_access_iterator<Container>) &&
+             std::random_access_iterator<decltype(std::begin(std::declval<Container&>()))>
+    void pdq_sort(Container& container, Compare comp = {}, Projection proj = {}) {
+        pdq_sort(std::begin(container), std::end(container), std::move(comp), std::move(proj));
+    }
+
+    namespace sort_detail {
+        // Ranges shorter than this are sorted with insertion sort by the radix sorts
+        inline constexpr std::ptrdiff_t radix_insertion_threshold = 64;
+        // The radix sorts distribute the elements by one byte at a time
+        inline constexpr size_t radix_buckets = 256;
+
+        template<typename Key>
+        concept radix_number = (std::integral<Key> || std::floating_point<Key>) && sizeof(Key) <= 8;
+
+        template<typename Key>
+        concept radix_string = std::is_convertible_v<const Key&, std::string_view>;
+
+        // Maps a number to an unsigned integer of the same width whose unsigned order is the order of the numbers.
+        // Signed integers have their sign bit flipped. Negative floating point numbers have every bit flipped, so
+        // larger magnitudes come first, and positive ones only their sign bit, which puts -0.0 before +0.0
+        template<radix_number Key>
+        constexpr auto radix_bits(Key key) noexcept {
+            if constexpr (std::floating_point<Key>) {
+                static_assert(sizeof(Key) == 4 || sizeof(Key) == 8, "Only 32 and 64-bit floating point keys are supported");
+                using Bits = std::conditional_t<sizeof(Key) == 4, std::uint32_t, std::uint64_t>;
+                constexpr Bits sign = Bits(1) << (8 * sizeof(Bits) - 1);
+                auto bits = std::bit_cast<Bits>(key);
+                return static_cast<Bits>(bits & sign ? ~bits : bits | sign);
+            } else if constexpr (std::is_same_v<Key, bool>)
+                return static_cast<std::uint8_t>(key);
+            else {
+                using Bits = std::make_unsigned_t<Key>;
+                if constexpr (std::is_signed_v<Key>)
+                    return static_cast<Bits>(static_cast<Bits>(key) ^ (Bits(1) << (8 * sizeof(Bits) - 1)));
+                else
+                    return static_cast<Bits>(key);
+            }
+        }
+
+        template<typename Bits>
+        constexpr size_t radix_digit(Bits bits, size_t digit) noexcept {
+            return static_cast<size_t>((bits >> (8 * digit)) & 0xFF);
+        }
+
+        // The type of the key extracted from the elements of a range
+        template<typename Iter, typename KeyFn>
+        using radix_key_t = std::remove_cvref_t<std::invoke_result_t<KeyFn&,
+                typename std::iterator_traits<Iter>::reference>>;
+
+        // Moves every element of [from, from + size) to its bucket for the digit, the bucket positions being given by
+        // next, keeping the order of the elements within each bucket
+        template<typename From, typename To, typename KeyFn>
+        void radix_scatter(From from, std::ptrdiff_t size, To to, size_t digit, size_t* next, KeyFn& key) {
+            for (std::ptrdiff_t i = 0; i < size; ++i) {
+                size_t bucket = radix_digit(radix_bits(std::invoke(key, from[i])), digit);
+                to[static_cast<std::ptrdiff_t>(next[bucket]++)] = std::move(from[i]);
+            }
+        }
+
+        // Least significant digit radix sort of numeric keys. The histograms of every digit are gathered in a single
+        // pre-pass, and digits for which every element falls in the same bucket are skipped
+        template<typename Iter, typename KeyFn>
+        void lsd_radix_sort(Iter first, std::ptrdiff_t size, KeyFn& key) {
+            auto compare = [&key](const auto& a, const auto& b) {
+                return radix_bits(std::invoke(key, a)) < radix_bits(std::invoke(key, b));
+            };
+            if (size < radix_insertion_threshold) {
+                // Floating point keys are left to the insertion sort, which orders -0.0 before +0.0
+                if constexpr (std::is_same_v<KeyFn, std::identity> && std::is_integral_v<std::remove_pointer_t<Iter>> &&
+                              uses_network_v<Iter, std::less<>>)
+                    network_detail::network_sort(first, static_cast<size_t>(size), simd_level());
+                else
+                    insertion_sort(first, first + size, compare);
+                return;
+            }
+            using Bits = decltype(radix_bits(std::declval<radix_key_t<Iter, KeyFn>>()));
+            constexpr size_t digits = sizeof(Bits);
+            std::array<size_t, digits * radix_buckets> counts{};
+            for (std::ptrdiff_t i = 0; i < size; ++i) {
+                Bits bits = radix_bits(std::invoke(key, first[i]));
+                for (size_t digit = 0; digit < digits; ++digit)
+                    ++counts[digit * radix_buckets + radix_digit(bits, digit)];
+            }
+
+            std::vector<typename std::iterator_traits<Iter>::value_type> buffer;
+            bool in_buffer = false;
+            for (size_t digit = 0; digit < digits; ++digit) {
+                size_t* count = &counts[digit * radix_buckets];
+                if (std::find(count, count + radix_buckets, static_cast<size_t>(size)) != count + radix_buckets)
+                    continue;
+                if (buffer.empty())
+                    buffer.resize(static_cast<size_t>(size));
+                size_t position = 0;
+                for (size_t bucket = 0; bucket < radix_buckets; ++bucket)
+                    position += std::exchange(count[bucket], position);
+                if (in_buffer)
+                    radix_scatter(buffer.data(), size, first, digit, count, key);
+                else
+                    radix_scatter(first, size, buffer.data(), digit, count, key);
+                in_buffer = !in_buffer;
+            }
+            if (in_buffer)
+                std::move(buffer.begin(), buffer.end(), first);
+        }
+
+        // The byte of a string key at the depth given, shifted by one so that strings ending before the depth come
+        // first in bucket 0
+        template<typename T, typename KeyFn>
+        inline size_t string_bucket(const T& element, size_t depth, KeyFn& key) {
+            const auto& value = std::invoke(key, element);
+            std::string_view view = value;
+            return depth < view.size() ? static_cast<unsigned char>(view[depth]) + 1 : 0;
+        }
+
+        // Permutes [first, first + size) in place so that the elements are grouped by their byte at the depth given,
+        // as in American flag sort. The bounds of bucket b are [bounds[b], bounds[b + 1])
+        template<typename Iter, typename KeyFn>
+        void string_partition(Iter first, std::ptrdiff_t size, size_t depth, KeyFn& key,
+                              std::array<size_t, radix_buckets + 2>& bounds) {
+            std::array<size_t, radix_buckets + 1> next{};
+            for (std::ptrdiff_t i = 0; i < size; ++i)
+                ++next[string_bucket(first[i], depth, key)];
+            size_t position = 0;
+            for (size_t bucket = 0; bucket <= radix_buckets; ++bucket) {
+                bounds[bucket] = position;
+                position += std::exchange(next[bucket], position);
+            }
+            bounds[radix_buckets + 1] = position;
+            // Swap each element into the next free slot of its bucket until every bucket is full
+            for (size_t bucket = 0; bucket <= radix_buckets; ++bucket) {
+                while (next[bucket] < bounds[bucket + 1]) {
+                    Iter current = first + static_cast<std::ptrdiff_t>(next[bucket]);
+                    size_t target = string_bucket(*current, depth, key);
+                    if (target == bucket)
+                        ++next[bucket];
+                    else
+                        std::iter_swap(current, first + static_cast<std::ptrdiff_t>(next[target]++));
+                }
+            }
+        }
+
+        // Most significant digit radix sort of string keys, every element sharing the first depth bytes of its key
+        template<typename Iter, typename KeyFn>
+        void american_flag_sort(Iter first, std::ptrdiff_t size, size_t depth, KeyFn& key) {
+            if (size < radix_insertion_threshold) {
+                auto compare = [&key, depth](const auto& a, const auto& b) {
+                    const auto& left_value = std::invoke(key, a);
+                    const auto& right_value = std::invoke(key, b);
+                    std::string_view left = left_value, right = right_value;
+                    return left.substr(std::min(depth, left.size())) < right.substr(std::min(depth, right.size()));
+                };
+                insertion_sort(first, first + size, compare);
+                return;
+            }
+            std::array<size_t, radix_buckets + 2> bounds;
+            string_partition(first, size, depth, key, bounds);
+            for (size_t bucket = 1; bucket <= radix_buckets; ++bucket) {
+                auto count = static_cast<std::ptrdiff_t>(bounds[bucket + 1] - bounds[bucket]);
+                if (count > 1)
+                    american_flag_sort(first + static_cast<std::ptrdiff_t>(bounds[bucket]), count, depth + 1, key);
+            }
+        }
+
+        template<typename Iter, typename KeyFn>
+        void radix_sort(Iter first, std::ptrdiff_t size, KeyFn& key) {
+            using Key = radix_key_t<Iter, KeyFn>;
+            static_assert(radix_number<Key> || radix_string<Key>,
+                          "The key of a radix sort must be an integer, a floating point number or a string");
+            if constexpr (radix_string<Key>)
+                american_flag_sort(first, size, 0, key);
+            else
+                lsd_radix_sort(first, size, key);
+        }
+    }
+
+    /**
+     * Sorts the elements in the range [first, last) by a key extracted from each element with a radix sort, which
+     * distributes the elements by one byte of their key at a time instead of comparing them.
+     *
+     * Integer and floating point keys, of up to 64 bits, are sorted with a least significant digit radix sort. Signed
+     * and floating point keys are mapped to unsigned integers preserving their order, with -0.0 placed before +0.0 and
+     * NaNs at either end depending on their sign. The byte histograms of every pass are gathered in a single pre-pass,
+     * and passes in which every key has the same byte are skipped, so small keys in wide types cost fewer passes. This
+     * sort is stable.
+     *
+     * String keys, i.e. keys convertible to `std::string_view`, are sorted in place with an American flag sort, a most
+     * significant digit radix sort which only looks at the bytes needed to tell the keys apart. This sort is not stable.
+     *
+     * \note
+     * The numeric sort moves the elements through a buffer as large as the range, so their type must be default
+     * constructible.
+     *
+     * **Time Complexity** = *O(n * w)* where w is the number of bytes of the keys, or the length of the distinguishing
+     * prefix of the string keys.
+     * @tparam RandomIt - the type of the random-access iterators over the elements.
+     * @tparam KeyFn - the type of the key extractor, invocable with an element.
+     * @param first - an iterator to the first element to sort.
+     * @param last - an iterator past the last element to sort.
+     * @param key - the key extractor, e.g. a pointer to a member, defaults to the element itself.
+     * @see <a href="https://en.wikipedia.org/wiki/Radix_sort">Radix sort</a>
+     * @see <a href="https://en.wikipedia.org/wiki/American_flag_sort">American flag sort</a>
+     */
+    template<typename RandomIt, typename KeyFn = std::identity>
+    requires std::random_access_iterator<RandomIt>
+    void radix_sort(RandomIt first, RandomIt last, KeyFn key = {}) {
+        if (last - first < 2)
+            return;
+        sort_detail::radix_sort(sort_detail::unwrap(first), last - first, key);
+    }
+
+    /**
+     * Sorts every element of a container with random-access iterators, such as Vector or Array, by a key extracted
+     * from each element with a radix sort.
+     * @see radix_sort(RandomIt, RandomIt, KeyFn)
+     */
+    template<typename Container, typename KeyFn = std::identity>
+    requires (!std::random_access_iterator<Container>) &&
+             std::random_access_iterator<decltype(std::begin(std::declval<Container&>()))>
+    void radix_sort(Container& container, KeyFn key = {}) {
+        radix_sort(std::begin(container), std::end(container), std::move(key));
+    }
+
+    namespace sort_detail {
+        // Partitions around pivots chosen like pdq_sort until the partition holding the nth element is short enough
+        // for insertion sort. Ranges which keep partitioning badly are handed to pdq_sort, so the worst case stays
+        // O(n log n)
+        template<bool Branchless, typename Iter, typename Compare>
+        void introselect(Iter begin, Iter nth, Iter end, Compare& comp) {
+            const Iter first = begin;
+            int bad_allowed = 2 * std::bit_width(static_cast<std::make_unsigned_t<std::ptrdiff_t>>(end - begin));
+            while (end - begin >= insertion_sort_threshold) {
+                std::ptrdiff_t size = end - begin;
+                choose_pivot(begin, end, comp);
+
+                // As in pdq_sort, a pivot equal to an earlier one, found before the range, puts every element equal
+                // to it in place at once
+                if (begin != first && !comp(*(begin - 1), *begin)) {
+                    Iter equal_end = partition_left(begin, end, comp) + 1;
+                    if (nth < equal_end)
+                        return;
+                    begin = equal_end;
+                    continue;
+                }
+
+                Iter pivot_pos = (Branchless ? partition_right_branchless(begin, end, comp)
+                                             : partition_right(begin, end, comp)).first;
+                if (pivot_pos == nth)
+                    return;
+                std::ptrdiff_t l_size = pivot_pos - begin;
+                if ((l_size < size / 8 || size - l_size - 1 < size / 8) && --bad_allowed == 0) {
+                    pdq_sort(nth < pivot_pos ? begin : pivot_pos + 1, nth < pivot_pos ? pivot_pos : end, comp);
+                    return;
+                }
+                if (nth < pivot_pos)
+                    end = pivot_pos;
+                else
+                    begin = pivot_pos + 1;
+            }
+            insertion_sort(begin, end, comp);
+        }
+
+        template<typename Iter, typename Compare>
+        inline void nth_element(Iter begin, Iter nth, Iter end, Compare& comp) {
+            if (nth == end || end - begin < 2)
+                return;
+            using T = typename std::iterator_traits<Iter>::value_type;
+            introselect<is_branchless_v<T, Compare>>(begin, nth, end, comp);
+        }
+
+        // Blocks of elements filtered against the threshold of a heap selection at once
+        inline constexpr std::ptrdiff_t filter_block = 64;
+        // Selections of fewer elements than this fraction of the range use a heap rather than introselect
+        inline constexpr std::ptrdiff_t heap_select_ratio = 64;
+
+        // Whether any element of a block comes before the threshold, in a branch-free loop the compiler can
+        // vectorise. Arithmetic thresholds are copied so the compiler knows they do not change within the block
+        template<typename Iter, typename T, typename Compare>
+        inline bool any_before(Iter block, const T& threshold, Compare& comp) {
+            std::conditional_t<std::is_arithmetic_v<T>, const T, const T&> value = threshold;
+            unsigned int hits = 0;
+            for (std::ptrdiff_t i = 0; i < filter_block; ++i)
+                hits += comp(block[i], value) ? 1U : 0U;
+            return hits != 0;
+        }
+
+        // Moves a value into the top of a heap whose top has been moved out and sifts it down to its place
+        template<typename Iter, typename T, typename Compare>
+        void replace_heap_top(Iter heap, std::ptrdiff_t size, T&& value, Compare& comp) {
+            std::ptrdiff_t hole = 0;
+            while (true) {
+                std::ptrdiff_t child = 2 * hole + 1;
+                if (child >= size)
+                    break;
+                if (child + 1 < size && comp(heap[child], heap[child + 1]))
+                    ++child;
+                if (!comp(value, heap[child]))
+                    break;
+                heap[hole] = std::move(heap[child]);
+                hole = child;
+            }
+            heap[hole] = std::forward<T>(value);
+        }
+
+        // Offers the elements of [first, last) to a heap holding the elements which come first so far, whose top is
+        // the threshold an element must beat to enter it. Whole blocks losing to the threshold are skipped at once
+        template<typename Iter, typename HeapIter, typename Offer, typename Compare>
+        void filter_into_heap(Iter first, Iter last, HeapIter heap, Offer&& offer, Compare& comp) {
+            for (; last - first >= filter_block; first += filter_block)
+                if (any_before(first, *heap, comp))
+                    for (Iter it = first; it != first + filter_block; ++it)
+                        if (comp(*it, *heap))
+                            offer(it);
+            for (; first != last; ++first)
+                if (comp(*first, *heap))
+                    offer(first);
+        }
+
+        // Sorts the elements which come first into [begin, middle) by keeping them in a heap while the rest of the
+        // range is scanned, the fastest way to select few elements out of many
+        template<typename Iter, typename Compare>
+        void heap_select(Iter begin, Iter middle, Iter end, Compare& comp) {
+            std::ptrdiff_t k = middle - begin;
+            std::make_heap(begin, middle, comp);
+            filter_into_heap(middle, end, begin, [begin, k, &comp](Iter it) {
+                auto value = std::move(*it);
+                *it = std::move(*begin);
+                replace_heap_top(begin, k, std::move(value), comp);
+            }, comp);
+            std::sort_heap(begin, middle, comp);
+        }
+
+        template<typename Iter, typename Compare>
+        void partial_sort(Iter begin, Iter middle, Iter end, Compare& comp) {
+            if ((middle - begin) * heap_select_ratio < end - begin)
+                heap_select(begin, middle, end, comp);
+            else {
+                sort_detail::nth_element(begin, middle, end, comp);
+                pdq_sort(begin, middle, comp);
+            }
+        }
+
+        // Runs an algorithm for random-access ranges on a container which may not have random-access iterators,
+        // such as the lists, by moving its elements through a buffer
+        template<typename Container, typename Algorithm>
+        void through_buffer(Container& container, Algorithm algorithm) {
+            if constexpr (std::random_access_iterator<decltype(std::begin(container))>) {
+                auto begin = unwrap(std::begin(container));
+                algorithm(begin, begin + static_cast<std::ptrdiff_t>(length(container)));
+            } else {
+                std::vector<std::remove_reference_t<decltype(*std::begin(container))>> buffer;
+                buffer.reserve(length(container));
+                for (auto& element: container)
+                    buffer.push_back(std::move(element));
+                algorithm(buffer.begin(), buffer.end());
+                auto element = buffer.begin();
+                for (auto& target: container)
+                    target = std::move(*element++);
+            }
+        }
+    }
+
+    /**
+     * Rearranges the elements in the range [first, last) so that the element at nth is the one which would be there
+     * if the range were sorted, every element before it comes before or is equal to it and every element after it
+     * does not come before it. Uses introselect: a quickselect partitioning only the side holding the nth element,
+     * with the pivots and partitions of pdq_sort, which falls back to pdq_sort on the remaining range after too many
+     * unbalanced partitions.
+     * **Time Complexity** = *O(n)* on average, *O(n log n)* worst case.
+     * @tparam RandomIt - the type of the random-access iterators over the elements.
+     * @tparam Compare - the type of the comparison object, returning `true` if its first argument should come first.
+     * @tparam Projection - the type of the projection applied to the elements before they are compared.
+     * @param first - an iterator to the first element of the range.
+     * @param nth - an iterator to the position of the element to select, nothing is done if it equals last.
+     * @param last - an iterator past the last element of the range.
+     * @param comp - the comparison object, defaults to `std::less<>`.
+     * @param proj - the projection, e.g. a pointer to a member to select by, defaults to the element itself.
+     * @see <a href="https://en.wikipedia.org/wiki/Introselect">Introselect</a>
+     */
+    template<typename RandomIt, typename Compare = std::less<>, typename Projection = std::identity>
+    requires std::random_access_iterator<RandomIt>
+    void nth_element(RandomIt first, RandomIt nth, RandomIt last, Compare comp = {}, Projection proj = {}) {
+        if (first == last)
+            return;
+        auto&& compare = sort_detail::projected(comp, proj);
+        auto begin = sort_detail::unwrap(first);
+        sort_detail::nth_element(begin, begin + (nth - first), begin + (last - first), compare);
+    }
+
+    /**
+     * Rearranges the elements of a container so that the element at index n is the one which would be there if the
+     * container were sorted, with the elements before it coming first. Containers without random-access iterators,
+     * such as LinkedList, are selected through a buffer the elements are moved into and back out of.
+     * **Time Complexity** = *O(n)* on average, *O(n log n)* worst case.
+     * @tparam Container - the type of the container.
+     * @param container - the container to rearrange.
+     * @param n - the index of the element to select, nothing is done if it is not less than the number of elements.
+     * @see nth_element(RandomIt, RandomIt, RandomIt, Compare, Projection)
+     */
+    template<typename Container, typename Compare = std::less<>, typename Projection = std::identity>
+    requires (!std::random_access_iterator<Container>) && requires(Container& c) { std::begin(c); std::end(c); }
+    void nth_element(Container& container, size_t n, Compare comp = {}, Projection proj = {}) {
+        if (n >= sort_detail::length(container))
+            return;
+        auto&& compare = sort_detail::projected(comp, proj);
+        sort_detail::through_buffer(container, [&compare, n](auto begin, auto end) {
+            sort_detail::nth_element(begin, begin + static_cast<std::ptrdiff_t>(n), end, compare);
+        });
+    }
+
+    /**
+     * Rearranges the elements in the range [first, last) so that [first, middle) holds the elements which would be
+     * there if the range were sorted, in sorted order, leaving the other elements in an unspecified order. The range
+     * is first partitioned with nth_element(), then its front is sorted with pdq_sort. When fewer than 1/64 of the
+     * elements are sorted, they are instead kept in a heap while the rest of the range is scanned in blocks, skipping
+     * every block which holds no element coming before the top of the heap. The sort is not stable.
+     * **Time Complexity** = *O(n + k log k)* on average, where k is the number of elements sorted.
+     * @tparam RandomIt - the type of the random-access iterators over the elements.
+     * @tparam Compare - the type of the comparison object, returning `true` if its first argument should come first.
+     * @tparam Projection - the type of the projection applied to the elements before they are compared.
+     * @param first - an iterator to the first element of the range.
+     * @param middle - an iterator past the last element to sort.
+     * @param last - an iterator past the last element of the range.
+     * @param comp - the comparison object, defaults to `std::less<>`.
+     * @param proj - the projection, e.g. a pointer to a member to sort by, defaults to the element itself.
+     */
+    template<typename RandomIt, typename Compare = std::less<>, typename Projection = std::identity>
+    requires std::random_access_iterator<RandomIt>
+    void partial_sort(RandomIt first, RandomIt middle, RandomIt last, Compare comp = {}, Projection proj = {}) {
+        if (first == middle)
+            return;
+        auto&& compare = sort_detail::projected(comp, proj);
+        auto begin = sort_detail::unwrap(first);
+        sort_detail::partial_sort(begin, begin + (middle - first), begin + (last - first), compare);
+    }
+
+    /**
+     * Rearranges the elements of a container so that its first k elements are the ones which would be there if the
+     * container were sorted, in sorted order. Containers without random-access iterators, such as LinkedList, are
+     * sorted through a buffer the elements are moved into and back out of.
+     * **Time Complexity** = *O(n + k log k)* on average.
+     * @tparam Container - the type of the container.
+     * @param container - the container to rearrange.
+     * @param k - the number of elements to sort, every element is sorted if it exceeds their number.
+     * @see partial_sort(RandomIt, RandomIt, RandomIt, Compare, Projection)
+     */
+    template<typename Container, typename Compare = std::less<>, typename Projection = std::identity>
+    requires (!std::random_access_iterator<Container>) && requires(Container& c) { std::begin(c); std::end(c); }
+    void partial_sort(Container& container, size_t k, Compare comp = {}, Projection proj = {}) {
+        auto&& compare = sort_detail::projected(comp, proj);
+        k = std::min(k, sort_detail::length(container));
+        if (k == 0)
+            return;
+        sort_detail::through_buffer(container, [&compare, k](auto begin, auto end) {
+            sort_detail::partial_sort(begin, begin + static_cast<std::ptrdiff_t>(k), end, compare);
+        });
+    }
+
+    /**
+     * A streaming accumulator of the k elements which come first in the order of a comparison, e.g. the k smallest
+     * elements with `std::less<>`, or the k largest with `std::greater<>`, out of any number of elements pushed one at
+     * a time or in ranges, using O(k) memory.
+     *
+     * The elements kept are held in a binary heap whose top is the element which comes last among them, i.e. the
+     * threshold a new element must beat to be kept. Once k elements are kept, most new elements lose to the threshold
+     * and are discarded after a single comparison. Random-access ranges of elements are filtered against the
+     * threshold in blocks of 64, each block first checked for any element beating the threshold by a branch-free loop
+     * which the compiler can vectorise, so blocks without candidates are skipped as a whole.
+     * @tparam T - the type of the elements.
+     * @tparam Compare - the type of the comparison object, returning `true` if its first argument should come first.
+     */
+    template<typename T, typename Compare = std::less<>>
+    class TopK {
+    public:
+        /**
+         * Constructs an empty accumulator keeping up to k elements.
+         * @param k - the number of elements to keep.
+         * @param comp - the comparison object defining which elements come first.
+         */
+        explicit TopK(size_t k, Compare comp = {}) : mK(k), mComp(std::move(comp)) {
+            mHeap.reserve(k);
+        }
+
+        /**
+         * Offers an element to the accumulator, which keeps it if fewer than k elements are kept or if it comes
+         * before the threshold, discarding the threshold in exchange.
+         * **Time Complexity** = *O(log k)* if the element is kept, *O(1)* otherwise.
+         * @param value - the element to offer.
+         */
+        void push(const T& value) {
+            offer(value);
+        }
+
+        /**
+         * Offers an element to the accumulator, moving it in if it is kept.
+         * @param value - the element to offer.
+         */
+        void push(T&& value) {
+            offer(std::move(value));
+        }
+
+        /**
+         * Offers every element of the range [first, last) to the accumulator. Random-access ranges are filtered
+         * against the threshold in blocks.
+         * **Time Complexity** = *O(n + m log k)* where m is the number of elements kept along the way, which is
+         * *O(k log(n / k))* on average for elements in random order.
+         * @tparam Iter - the type of the iterators over the elements.
+         * @tparam Sentinel - the type of the iterator or sentinel marking the end of the elements.
+         * @param first - an iterator to the first element to offer.
+         * @param last - an iterator past the last element to offer.
+         */
+        template<typename Iter, typename Sentinel>
+        void push(Iter first, Sentinel last) {
+            for (; mHeap.size() < mK && first != last; ++first)
+                offer(*first);
+            if constexpr (std::random_access_iterator<Iter> && std::same_as<Iter, Sentinel>) {
+                if (mK > 0)
+                    sort_detail::filter_into_heap(sort_detail::unwrap(first), sort_detail::unwrap(last),
+                                                  mHeap.begin(), [this](auto it) { replace_top(*it); }, mComp);
+            } else
+                for (; first != last; ++first)
+                    offer(*first);
+        }
+
+        /**
+         * Offers every element of a range, such as a Vector, a LinkedList or a `std::vector`, to the accumulator.
+         * @tparam Range - the type of the range.
+         * @param range - the range of elements to offer.
+         */
+        template<typename Range>
+        requires requires(const Range& r) { std::begin(r); std::end(r); }
+        void push_range(const Range& range) {
+            push(std::begin(range), std::end(range));
+        }
+
+        /**
+         * Returns the number of elements kept, which is k once at least k elements have been offered.
+         * @return - an unsigned integer representing the number of elements kept.
+         */
+        [[nodiscard]] size_t size() const noexcept {
+            return mHeap.size();
+        }
+
+        /**
+         * Returns the number of elements the accumulator keeps at most.
+         * @return - an unsigned integer representing k.
+         */
+        [[nodiscard]] size_t capacity() const noexcept {
+            return mK;
+        }
+
+        /**
+         * Returns whether the accumulator keeps no element.
+         * @return - `true` if no element is kept, `false` otherwise.
+         */
+        [[nodiscard]] bool empty() const noexcept {
+            return mHeap.empty();
+        }
+
+        /**
+         * Returns the element which comes last among the elements kept, the one a new element must beat to be kept
+         * once k elements are kept. If no element is kept, a `runtime_error` exception is thrown.
+         * @return - a constant reference to the threshold element.
+         */
+        [[nodiscard]] const T& threshold() const {
+            if (mHeap.empty())
+                throw std::runtime_error("Error: top-k accumulator is empty, there is no threshold");
+            return mHeap.front();
+        }
+
+        /**
+         * Returns a copy of the elements kept, in sorted order.
+         * **Time Complexity** = *O(k log k)*.
+         * @return - a `std::vector` of the elements kept, the first element coming first in the order.
+         */
+        [[nodiscard]] std::vector<T> sorted() const {
+            std::vector<T> result = mHeap;
+            std::sort_heap(result.begin(), result.end(), mComp);
+            return result;
+        }
+
+        /**
+         * Moves the elements kept out of the accumulator in sorted order, leaving it empty.
+         * **Time Complexity** = *O(k log k)*.
+         * @return - a `std::vector` of the elements kept, the first element coming first in the order.
+         */
+        [[nodiscard]] std::vector<T> take() {
+            std::vector<T> result = std::move(mHeap);
+            mHeap.clear();
+            mHeap.reserve(mK);
+            std::sort_heap(result.begin(), result.end(), mComp);
+            return result;
+        }
+
+        /**
+         * Discards every element kept.
+         */
+        void clear() noexcept {
+            mHeap.clear();
+        }
+
+    private:
+        size_t mK;  /**< The number of elements to keep. */
+        Compare mComp;  /**< The comparison object defining which elements come first. */
+        std::vector<T> mHeap;  /**< The elements kept, as a heap with the threshold on top. */
+
+        template<typename U>
+        void offer(U&& value) {
+            if (mHeap.size() < mK) {
+                mHeap.push_back(std::forward<U>(value));
+                std::push_heap(mHeap.begin(), mHeap.end(), mComp);
+            } else if (mK > 0 && mComp(value, mHeap.front()))
+                replace_top(std::forward<U>(value));
+        }
+
+        template<typename U>
+        void replace_top(U&& value) {
+            sort_detail::replace_heap_top(mHeap.begin(), static_cast<std::ptrdiff_t>(mHeap.size()),
+                                          std::forward<U>(value), mComp);
+        }
+    };
+
+    /**
+     * Returns the k elements of a range which come first in the order of a comparison, in sorted order, without
+     * sorting or modifying the range. Works on any range which can be iterated over, such as Vector, LinkedList,
+     * DoublyLinkedList or the standard containers.
+     * **Time Complexity** = *O(n + k log(n / k) log k)* on average for elements in random order.
+     * @tparam Range - the type of the range.
+     * @tparam Compare - the type of the comparison object, returning `true` if its first argument should come first.
+     * @param range - the range of elements.
+     * @param k - the number of elements to return, all of them in sorted order if it exceeds their number.
+     * @param comp - the comparison object, defaults to `std::less<>` which returns the k smallest elements.
+     * @return - a `std::vector` holding copies of the k first elements.
+     * @see TopK
+     */
+    template<typename Range, typename Compare = std::less<>>
+    requires requires(const Range& r) { std::begin(r); std::end(r); }
+    auto top_k(const Range& range, size_t k, Compare comp = {}) {
+        using T = std::remove_cvref_t<decltype(*std::begin(range))>;
+        TopK<T, Compare> accumulator(k, std::move(comp));
+        accumulator.push_range(range);
+        return accumulator.take();
+    }
+
+    /**
+     * A scratch buffer for the merges of tim_sort, which can be kept and passed to many calls so that sorting many
+     * ranges only allocates when a range needs a larger buffer than any before it. The buffer holds raw memory, the
+     * elements only live in it during a merge.
+     * @tparam T - the type of the elements of the ranges sorted with the buffer.
+     */
+    template<typename T>
+    class MergeBuffer {
+    public:
+        /**
+         * Constructs an empty buffer, which allocates on the first merge needing it.
+         */
+        MergeBuffer() noexcept : mData(nullptr), mCapacity(0) {}
+
+        /**
+         * Constructs a buffer with room for the number of elements given.
+         * @param capacity - the number of elements the buffer can hold without growing.
+         */
+        explicit MergeBuffer(size_t capacity) : MergeBuffer() {
+            reserve(capacity);
+        }
+
+        MergeBuffer(const MergeBuffer&) = delete;
+
+        MergeBuffer& operator=(const MergeBuffer&) = delete;
+
+        /**
+         * Move constructor, leaving the other buffer empty.
+         * @param other - the buffer to move into the current object.
+         */
+        MergeBuffer(MergeBuffer&& other) noexcept : mData(std::exchange(other.mData, nullptr)),
+                                                    mCapacity(std::exchange(other.mCapacity, 0)) {}
+
+        /**
+         * Move assignment operator, freeing the memory of the current buffer and leaving the other one empty.
+         * @param other - the buffer to move into the current object.
+         * @return - a reference to the current object.
+         */
+        MergeBuffer& operator=(MergeBuffer&& other) noexcept {
+            if (this != &other) {
+                release();
+                mData = std::exchange(other.mData, nullptr);
+                mCapacity = std::exchange(other.mCapacity, 0);
+            }
+            return *this;
+        }
+
+        ~MergeBuffer() {
+            release();
+        }
+
+        /**
+         * Returns the number of elements the buffer can hold without growing.
+         * @return - an unsigned integer representing the capacity of the buffer.
+         */
+        [[nodiscard]] size_t capacity() const noexcept {
+            return mCapacity;
+        }
+
+        /**
+         * Grows the buffer to hold at least the number of elements given, doing nothing if it already can.
+         * @param capacity - the number of elements the buffer must be able to hold.
+         */
+        void reserve(size_t capacity) {
+            if (capacity <= mCapacity)
+                return;
+            T* data = std::allocator<T>().allocate(capacity);
+            release();
+            mData = data;
+            mCapacity = capacity;
+        }
+
+        /**
+         * Frees the memory of the buffer.
+         */
+        void release() noexcept {
+            if (mData)
+                std::allocator<T>().deallocate(mData, mCapacity);
+            mData = nullptr;
+            mCapacity = 0;
+        }
+
+        /**
+         * Returns the memory of the buffer, grown to hold at least the number of elements given.
+         * @param capacity - the number of elements needed.
+         * @return - a pointer to uninitialised memory for the elements.
+         */
+        [[nodiscard]] T* data(size_t capacity) {
+            reserve(capacity);
+            return mData;
+        }
+
+    private:
+        T* mData;  /**< The uninitialised memory of the buffer. */
+        size_t mCapacity;  /**< The number of elements the memory can hold. */
+    };
+
+    namespace sort_detail {
+        template<typename T>
+        inline constexpr bool is_merge_buffer_v = false;
+
+        template<typename T>
+        inline constexpr bool is_merge_buffer_v<MergeBuffer<T>> = true;
+
+        // Runs are extended to at least this length, between 32 and 64, by binary insertion sort
+        inline constexpr std::ptrdiff_t tim_sort_min_merge = 64;
+        // The number of consecutive wins of one run after which a merge starts galloping
+        inline constexpr std::ptrdiff_t tim_sort_min_gallop = 7;
+        // The runs pending a merge never exceed this, as their lengths grow at least as fast as Fibonacci numbers
+        inline constexpr size_t tim_sort_max_pending = 85;
+
+        // Calls a function when leaving a scope, whether normally or through an exception
+        template<typename Function>
+        struct ScopeExit {
+            Function function;
+
+            ~ScopeExit() { function(); }
+        };
+
+        template<typename Function>
+        ScopeExit(Function) -> ScopeExit<Function>;
+
+        // The length of the run starting at the beginning of the range, reversing it if it is strictly descending.
+        // Only strictly descending runs are reversed, so equal elements never change their order
+        template<typename Iter, typename Compare>
+        std::ptrdiff_t count_run(Iter begin, Iter end, Compare& comp) {
+            Iter run = begin + 1;
+            if (run == end)
+                return 1;
+            if (comp(*run, *begin)) {
+                while (++run != end && comp(*run, *(run - 1)));
+                std::reverse(begin, run);
+            } else
+                while (++run != end && !comp(*run, *(run - 1)));
+            return run - begin;
+        }
+
+        // Inserts the elements of [sorted_end, end) into the sorted prefix [begin, sorted_end) one at a time, after
+        // every element they do not come before, so the sort is stable
+        template<typename Iter, typename Compare>
+        void binary_insertion_sort(Iter begin, Iter sorted_end, Iter end, Compare& comp) {
+            for (Iter it = sorted_end; it != end; ++it) {
+                Iter position = std::upper_bound(begin, it, *it, comp);
+                if (position != it) {
+                    auto value = std::move(*it);
+                    std::move_backward(position, it, it + 1);
+                    *position = std::move(value);
+                }
+            }
+        }
+
+        // The length runs are extended to: the range length shifted down to between 32 and 64, plus one if any bit
+        // shifted out is set, so the range splits into a power of two runs or slightly fewer
+        inline std::ptrdiff_t min_run_length(std::ptrdiff_t size) noexcept {
+            std::ptrdiff_t extra = 0;
+            while (size >= tim_sort_min_merge) {
+                extra |= size & 1;
+                size >>= 1;
+            }
+            return size + extra;
+        }
+
+        // The number of elements of the sorted range [base, base + size) which come before the key, i.e. the position
+        // after which the key would be inserted among them. With Right, elements equal to the key also count, so the
+        // position is after them. The search probes exponentially growing distances from the start or the end of the
+        // range, so its cost grows with the logarithm of the distance of the position from there
+        template<bool Right, typename Iter, typename T, typename Compare>
+        std::ptrdiff_t gallop(const T& key, Iter base, std::ptrdiff_t size, bool from_end, Compare& comp) {
+            auto before = [&key, &comp](const auto& element) {
+                if constexpr (Right)
+                    return !comp(key, element);
+                else
+                    return static_cast<bool>(comp(element, key));
+            };
+            std::ptrdiff_t low = 0, high = size;
+            if (!from_end) {
+                std::ptrdiff_t probe = 0;
+                while (probe < size && before(base[probe])) {
+                    low = probe + 1;
+                    probe = 2 * probe + 1;
+                }
+                high = std::min(probe, size);
+            } else {
+                std::ptrdiff_t distance = 0;
+                while (distance < size && !before(base[size - 1 - distance])) {
+                    high = size - 1 - distance;
+                    distance = 2 * distance + 1;
+                }
+                low = distance < size ? size - distance : 0;
+            }
+            return std::partition_point(base + low, base + high, before) - base;
+        }
+
+        // An adaptive, stable merge sort finding the natural runs of a range and merging them with galloping
+        template<typename Iter, typename T, typename Compare>
+        class TimSort {
+        public:
+            TimSort(MergeBuffer<T>& buffer, Compare& comp) : mBuffer(buffer), mComp(comp), mPending(0),
+                                                              mMinGallop(tim_sort_min_gallop) {}
+
+            void sort(Iter begin, Iter end) {
+                std::ptrdiff_t remaining = end - begin;
+                if (remaining < 2)
+                    return;
+                const std::ptrdiff_t min_run = min_run_length(remaining);
+                while (remaining > 0) {
+                    std::ptrdiff_t length = count_run(begin, end, mComp);
+                    if (length < min_run) {
+                        std::ptrdiff_t forced = std::min(min_run, remaining);
+                        binary_insertion_sort(begin, begin + length, begin + forced, mComp);
+                        length = forced;
+                    }
+                    mRuns[mPending++] = {begin, length};
+                    merge_collapse();
+                    begin += length;
+                    remaining -= length;
+                }
+                while (mPending > 1) {
+                    size_t i = mPending - 2;
+                    if (i > 0 && mRuns[i - 1].second < mRuns[i + 1].second)
+                        --i;
+                    merge_at(i);
+                }
+            }
+
+        private:
+            MergeBuffer<T>& mBuffer;
+            Compare& mComp;
+            std::array<std::pair<Iter, std::ptrdiff_t>, tim_sort_max_pending> mRuns;
+            size_t mPending;
+            std::ptrdiff_t mMinGallop;
+
+            // Merges pending runs until the lengths of the last three decrease faster than Fibonacci numbers,
+            // checking the fourth last as well, which the original invariant missed
+            void merge_collapse() {
+                while (mPending > 1) {
+                    size_t i = mPending - 2;
+                    auto length = [this](size_t run) { return mRuns[run].second; };
+                    if ((i > 0 && length(i - 1) <= length(i) + length(i + 1)) ||
+                        (i > 1 && length(i - 2) <= length(i - 1) + length(i))) {
+                        if (length(i - 1) < length(i + 1))
+                            --i;
+                    } else if (length(i) > length(i + 1))
+                        break;
+                    merge_at(i);
+                }
+            }
+
+            // Merges the pending runs i and i + 1, first skipping the elements already in place at either end
+            void merge_at(size_t i) {
+                auto [base1, length1] = mRuns[i];
+                auto [base2, length2] = mRuns[i + 1];
+                mRuns[i].second = length1 + length2;
+                if (i + 3 == mPending)
+                    mRuns[i + 1] = mRuns[i + 2];
+                --mPending;
+
+                std::ptrdiff_t skipped = gallop<true>(*base2, base1, length1, false, mComp);
+                base1 += skipped;
+                length1 -= skipped;
+                if (length1 == 0)
+                    return;
+                length2 = gallop<false>(*(base1 + (length1 - 1)), base2, length2, true, mComp);
+                if (length2 == 0)
+                    return;
+                if (length1 <= length2)
+                    merge_low(base1, length1, base2, length2);
+                else
+                    merge_high(base1, length1, base2, length2);
+            }
+
+            // Merges two adjacent runs, the first one being the shorter, by moving it to the buffer and merging from
+            // the front. The first element of the second run comes first and the last element of the first run comes
+            // last. The buffer elements left when the merge ends, or when a comparison throws, fill the gap left
+            void merge_low(Iter base1, std::ptrdiff_t length1, Iter base2, std::ptrdiff_t length2) {
+                T* buffer = mBuffer.data(static_cast<size_t>(length1));
+                std::uninitialized_move(base1, base2, buffer);
+                T* cursor1 = buffer;
+                Iter cursor2 = base2;
+                Iter dest = base1;
+                ScopeExit finish{[&, buffer, initial = length1] {
+                    std::move(cursor1, cursor1 + length1, dest);
+                    std::destroy(buffer, buffer + initial);
+                }};
+                // Once the first run is down to its last element, which comes last, the rest of the second one moves
+                // in front of it
+                auto finish_second = [&] {
+                    dest = std::move(cursor2, cursor2 + length2, dest);
+                };
+
+                *dest++ = std::move(*cursor2++);
+                if (--length2 == 0)
+                    return;
+                if (length1 == 1)
+                    return finish_second();
+                while (true) {
+                    std::ptrdiff_t wins1 = 0, wins2 = 0;
+                    // Plain merging, until one run keeps winning
+                    do {
+                        if (mComp(*cursor2, *cursor1)) {
+                            *dest++ = std::move(*cursor2++);
+                            ++wins2;
+                            wins1 = 0;
+                            if (--length2 == 0)
+                                return;
+                        } else {
+                            *dest++ = std::move(*cursor1++);
+                            ++wins1;
+                            wins2 = 0;
+                            if (--length1 == 1)
+                                return finish_second();
+                        }
+                    } while ((wins1 | wins2) < mMinGallop);
+
+                    // Galloping, moving whole stretches of either run at once, until the stretches get short
+                    ++mMinGallop;
+                    do {
+                        --mMinGallop;
+                        wins1 = gallop<true>(*cursor2, cursor1, length1, false, mComp);
+                        if (wins1) {
+                            dest = std::move(cursor1, cursor1 + wins1, dest);
+                            cursor1 += wins1;
+                            length1 -= wins1;
+                            // Only an inconsistent comparison can exhaust the first run here
+                            if (length1 == 1)
+                                return finish_second();
+                            if (length1 == 0)
+                                return;
+                        }
+                        *dest++ = std::move(*cursor2++);
+                        if (--length2 == 0)
+                            return;
+                        wins2 = gallop<false>(*cursor1, cursor2, length2, false, mComp);
+                        if (wins2) {
+                            dest = std::move(cursor2, cursor2 + wins2, dest);
+                            cursor2 += wins2;
+                            length2 -= wins2;
+                            if (length2 == 0)
+                                return;
+                        }
+                        *dest++ = std::move(*cursor1++);
+                        if (--length1 == 1)
+                            return finish_second();
+                    } while (wins1 >= tim_sort_min_gallop || wins2 >= tim_sort_min_gallop);
+                    mMinGallop = std::max<std::ptrdiff_t>(mMinGallop, 0) + 2;
+                }
+            }
+
+            // The mirror image of merge_low, moving the shorter second run to the buffer and merging from the back
+            void merge_high(Iter base1, std::ptrdiff_t length1, Iter base2, std::ptrdiff_t length2) {
+                T* buffer = mBuffer.data(static_cast<size_t>(length2));
+                std::uninitialized_move(base2, base2 + length2, buffer);
+                // The cursors point past the last element of the part of each run left to merge
+                Iter cursor1 = base1 + length1;
+                T* cursor2 = buffer + length2;
+                Iter dest = base2 + length2;
+                ScopeExit finish{[&, buffer, initial = length2] {
+                    std::move_backward(buffer, buffer + length2, dest);
+                    std::destroy(buffer, buffer + initial);
+                }};
+                // Once the second run is down to its first element, which comes first, the rest of the first one
+                // moves behind it
+                auto finish_first = [&] {
+                    dest = std::move_backward(cursor1 - length1, cursor1, dest);
+                };
+
+                *--dest = std::move(*--cursor1);
+                if (--length1 == 0)
+                    return;
+                if (length2 == 1)
+                    return finish_first();
+                while (true) {
+                    std::ptrdiff_t wins1 = 0, wins2 = 0;
+                    do {
+                        if (mComp(*(cursor2 - 1), *(cursor1 - 1))) {
+                            *--dest = std::move(*--cursor1);
+                            ++wins1;
+                            wins2 = 0;
+                            if (--length1 == 0)
+                                return;
+                        } else {
+                            *--dest = std::move(*--cursor2);
+                            ++wins2;
+                            wins1 = 0;
+                            if (--length2 == 1)
+                                return finish_first();
+                        }
+                    } while ((wins1 | wins2) < mMinGallop);
+
+                    ++mMinGallop;
+                    do {
+                        --mMinGallop;
+                        wins1 = length1 - gallop<true>(*(cursor2 - 1), cursor1 - length1, length1, true, mComp);
+                        if (wins1) {
+                            dest = std::move_backward(cursor1 - wins1, cursor1, dest);
+                            cursor1 -= wins1;
+                            length1 -= wins1;
+                            if (length1 == 0)
+                                return;
+                        }
+                        *--dest = std::move(*--cursor2);
+                        if (--length2 == 1)
+                            return finish_first();
+                        wins2 = length2 - gallop<false>(*(cursor1 - 1), buffer, length2, true, mComp);
+                        if (wins2) {
+                            dest = std::move_backward(cursor2 - wins2, cursor2, dest);
+                            cursor2 -= wins2;
+                            length2 -= wins2;
+                            if (length2 == 1)
+                                return finish_first();
+                            if (length2 == 0)
+                                return;
+                        }
+                        *--dest = std::move(*--cursor1);
+                        if (--length1 == 0)
+                            return;
+                    } while (wins1 >= tim_sort_min_gallop || wins2 >= tim_sort_min_gallop);
+                    mMinGallop = std::max<std::ptrdiff_t>(mMinGallop, 0) + 2;
+                }
+            }
+        };
+
+        template<typename Iter, typename T, typename Compare>
+        void tim_sort(Iter begin, Iter end, MergeBuffer<T>& buffer, Compare& comp) {
+            TimSort<Iter, T, Compare>(buffer, comp).sort(begin, end);
+        }
+    }
+
+    /**
+     * Sorts the elements in the range [first, last) with an adaptive, stable merge sort in the style of TimSort. The
+     * range is split into its natural runs, i.e. the stretches already in order, strictly descending stretches being
+     * reversed, and runs shorter than a minimum length of 32 to 64 are extended with binary insertion sort. The runs
+     * are merged in an order keeping merges balanced, and merges switch to galloping, i.e. exponential searches moving
+     * whole stretches of one run at once, when one run keeps providing the next elements. Sorted, reverse sorted and
+     * nearly sorted ranges, or ranges made of a few sorted stretches, are thus sorted in close to linear time. Equal
+     * elements keep their relative order.
+     *
+     * Merges move the shorter run into a scratch buffer of up to half the range. This overload allocates the buffer
+     * for the call; the overload taking a MergeBuffer reuses the buffer given across calls.
+     *
+     * \note
+     * If a comparison throws, every element is still in the range, in an unspecified order.
+     *
+     * **Time Complexity** = *O(n log n)*, *O(n)* for sorted or reverse sorted inputs, and *O(n + n log r)* for inputs
+     * made of r runs.
+     * @tparam RandomIt - the type of the random-access iterators over the elements.
+     * @tparam Compare - the type of the comparison object, returning `true` if its first argument should come first.
+     * @tparam Projection - the type of the projection applied to the elements before they are compared.
+     * @param first - an iterator to the first element to sort.
+     * @param last - an iterator past the last element to sort.
+     * @param comp - the comparison object, defaults to `std::less<>` which sorts in ascending order.
+     * @param proj - the projection, e.g. a pointer to a member to sort by, defaults to the element itself.
+     * @see <a href="https://github.com/python/cpython/blob/main/Objects/listsort.txt">TimSort</a>
+     */
+    template<typename RandomIt, typename Compare = std::less<>, typename Projection = std::identity>
+    requires std::random_access_iterator<RandomIt> && (!sort_detail::is_merge_buffer_v<Compare>)
+    void tim_sort(RandomIt first, RandomIt last, Compare comp = {}, Projection proj = {}) {
+        MergeBuffer<std::iter_value_t<RandomIt>> buffer;
+        auto&& compare = sort_detail::projected(comp, proj);
+        auto begin = sort_detail::unwrap(first);
+        sort_detail::tim_sort(begin, begin + (last - first), buffer, compare);
+    }
+
+    /**
+     * Sorts the elements in the range [first, last) with an adaptive, stable merge sort in the style of TimSort,
+     * using the scratch buffer given, which grows if the range needs a larger one.
+     * @param buffer - the scratch buffer, kept by the caller across calls.
+     * @see tim_sort(RandomIt, RandomIt, Compare, Projection)
+     */
+    template<typename RandomIt, typename Compare = std::less<>, typename Projection = std::identity>
+    requires std::random_access_iterator<RandomIt>
+    void tim_sort(RandomIt first, RandomIt last, MergeBuffer<std::iter_value_t<RandomIt>>& buffer, Compare comp = {},
+                  Projection proj = {}) {
+        auto&& compare = sort_detail::projected(comp, proj);
+        auto begin = sort_detail::unwrap(first);
+        sort_detail::tim_sort(begin, begin + (last - first), buffer, compare);
+    }
+
+    /**
+     * Sorts every element of a container with random-access iterators, such as Vector or Array, with an adaptive,
+     * stable merge sort in the style of TimSort.
+     * **Time Complexity** = *O(n log n)*, *O(n)* for sorted or reverse sorted inputs.
+     * @tparam Container - the type of the container.
+     * @param container - the container to sort.
+     * @see tim_sort(RandomIt, RandomIt, Compare, Projection)
+     */
+    template<typename Container, typename Compare = std::less<>, typename Projection = std::identity>
+    requires (!std::random_access_iterator<Container>) && (!sort_detail::is_merge_buffer_v<Compare>) &&
+             std::random_access_iterator<decltype(std::begin(std::declval<Container&>()))>
+    void tim_sort(Container& container, Compare comp = {}, Projection proj = {}) {
+        tim_sort(std::begin(container), std::end(container), std::move(comp), std::move(proj));
+    }
+
+    /**
+     * Sorts every element of a container with random-access iterators with an adaptive, stable merge sort in the
+     * style of TimSort, using the scratch buffer given.
+     * @tparam Container - the type of the container.
+     * @param container - the container to sort.
+     * @param buffer - the scratch buffer, kept by the caller across calls.
+     * @see tim_sort(RandomIt, RandomIt, MergeBuffer, Compare, Projection)
+     */
+    template<typename Container, typename Compare = std::less<>, typename Projection = std::identity>
+    requires (!std::random_access_iterator<Container>) &&
+             std::random_access_iterator<decltype(std::begin(std::declval<Container&>()))>
+    void tim_sort(Container& container,
+                  MergeBuffer<std::iter_value_t<decltype(std::begin(std::declval<Container&>()))>>& buffer,
+                  Compare comp = {}, Projection proj = {}) {
+        tim_sort(std::begin(container), std::end(container), buffer, std::move(comp), std::move(proj));
+    }
+
+    namespace sort_detail {
+        // A key computed by sort_by_cached_key, with the position of the element it was computed from
+        template<typename Key, typename Index>
+        struct CachedKey {
+            Key key;
+            Index index;
+        };
+
+        // Moves the element at order[i].index to position i for every i, following each cycle of the permutation so
+        // that every element is moved once, plus once more for the first element of each cycle. Positions are marked
+        // as done by pointing them at themselves
+        template<typename Iter, typename Cached>
+        void apply_permutation(Iter first, std::vector<Cached>& order) {
+            using Index = decltype(Cached::index);
+            auto at = [first](size_t position) { return first + static_cast<std::ptrdiff_t>(position); };
+            for (size_t start = 0; start < order.size(); ++start) {
+                if (order[start].index == start)
+                    continue;
+                auto value = std::move(*at(start));
+                size_t current = start;
+                while (true) {
+                    size_t source = order[current].index;
+                    order[current].index = static_cast<Index>(current);
+                    if (source == start)
+                        break;
+                    *at(current) = std::move(*at(source));
+                    current = source;
+                }
+                *at(current) = std::move(value);
+            }
+        }
+
+        template<typename Index, typename Iter, typename KeyFn, typename Compare>
+        void sort_by_cached_key(Iter first, size_t size, KeyFn& key_fn, Compare& comp) {
+            using Key = std::remove_cvref_t<std::invoke_result_t<KeyFn&,
+                    typename std::iterator_traits<Iter>::reference>>;
+            using Cached = CachedKey<Key, Index>;
+            std::vector<Cached> keys;
+            keys.reserve(size);
+            for (size_t i = 0; i < size; ++i)
+                keys.push_back(Cached{std::invoke(key_fn, first[static_cast<std::ptrdiff_t>(i)]),
+                                      static_cast<Index>(i)});
+
+            // The keys are in the order of their indices, so a stable sort of the keys keeps equal keys in the order
+            // of their elements
+            auto key = &Cached::key;
+            constexpr bool ascending = std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<Key>>;
+            if constexpr (ascending && radix_number<Key>)
+                lsd_radix_sort(keys.data(), static_cast<std::ptrdiff_t>(size), key);
+            else if constexpr (ascending && radix_string<Key>) {
+                // American flag sort is not stable, so each run of equal keys is put back in the order of its indices
+                american_flag_sort(keys.data(), static_cast<std::ptrdiff_t>(size), 0, key);
+                auto by_index = [](const Cached& a, const Cached& b) { return a.index < b.index; };
+                for (Cached* run = keys.data(), * end = keys.data() + size; run != end;) {
+                    std::string_view run_key = run->key;
+                    Cached* run_end = std::find_if(run + 1, end, [run_key](const Cached& cached) {
+                        return std::string_view(cached.key) != run_key;
+                    });
+                    if (run_end - run > 1)
+                        pdq_sort(run, run_end, by_index);
+                    run = run_end;
+                }
+            } else {
+                auto by_key = [&comp](const Cached& a, const Cached& b) {
+                    if (comp(a.key, b.key))
+                        return true;
+                    if (comp(b.key, a.key))
+                        return false;
+                    return a.index < b.index;
+                };
+                pdq_sort(keys.data(), keys.data() + size, by_key);
+            }
+            apply_permutation(first, keys);
+        }
+
+        template<typename Iter, typename KeyFn, typename Compare>
+        void sort_by_cached_key(Iter first, size_t size, KeyFn& key_fn, Compare& comp) {
+            // Ranges of up to 2^32 elements, i.e. all but the largest, have their indices stored in 32 bits
+            if (size <= std::numeric_limits<std::uint32_t>::max())
+                sort_by_cached_key<std::uint32_t>(first, size, key_fn, comp);
+            else
+                sort_by_cached_key<size_t>(first, size, key_fn, comp);
+        }
+    }
+
+    /**
+     * Sorts the elements in the range [first, last) by a key computed from each element, computing each key exactly
+     * once, for keys which are expensive to compute such as derived scores or normalised strings. The keys are stored
+     * with the positions of their elements in a compact array, which is sorted with the fastest sort applicable: the
+     * least significant digit radix sort for numeric keys in ascending order, American flag sort for string keys in
+     * ascending order, and pdq_sort otherwise. The elements are then moved to their sorted positions in place,
+     * following the cycles of the permutation so each element is moved about once. The sort is stable.
+     *
+     * \note
+     * The keys are stored by value, so a key function returning a reference has its key copied.
+     *
+     * **Time Complexity** = *O(n)* key computations, plus *O(n * w)* to sort numeric or string keys, where w is the
+     * number of bytes of the keys or of their distinguishing prefix, or *O(n log n)* key comparisons otherwise.
+     * @tparam RandomIt - the type of the random-access iterators over the elements.
+     * @tparam KeyFn - the type of the key function, invocable with an element.
+     * @tparam Compare - the type of the comparison of the keys, returning `true` if its first key should come first.
+     * @param first - an iterator to the first element to sort.
+     * @param last - an iterator past the last element to sort.
+     * @param key_fn - the key function, e.g. a pointer to a member or a lambda.
+     * @param comp - the comparison of the keys, defaults to `std::less<>` which sorts in ascending order of key.
+     * @see <a href="https://en.wikipedia.org/wiki/Schwartzian_transform">Decorate-sort-undecorate</a>
+     */
+    template<typename RandomIt, typename KeyFn, typename Compare = std::less<>>
+    requires std::random_access_iterator<RandomIt>
+    void sort_by_cached_key(RandomIt first, RandomIt last, KeyFn key_fn, Compare comp = {}) {
+        if (last - first < 2)
+            return;
+        sort_detail::sort_by_cached_key(sort_detail::unwrap(first), static_cast<size_t>(last - first), key_fn, comp);
+    }
 
+    /**
+     * Sorts every element of a container by a key computed once from each element. Containers without random-access
+     * iterators, such as LinkedList, are sorted through a buffer the elements are moved into and back out of.
+     * **Time Complexity** = *O(n)* key computations, plus the sort of the keys.
+     * @tparam Container - the type of the container.
+     * @param container - the container to sort.
+     * @see sort_by_cached_key(RandomIt, RandomIt, KeyFn, Compare)
+     */
+    template<typename Container, typename KeyFn, typename Compare = std::less<>>
+    requires (!std::random_access_iterator<Container>) && requires(Container& c) { std::begin(c); std::end(c); }
+    void sort_by_cached_key(Container& container, KeyFn key_fn, Compare comp = {}) {
+        if (sort_detail::length(container) < 2)
+            return;
+        sort_detail::through_buffer(container, [&key_fn, &comp](auto begin, auto end) {
+            sort_detail::sort_by_cached_key(begin, static_cast<size_t>(end - begin), key_fn, comp);
+        });
     }
 }
 
-#endif // SORTING_ALGORITHMS_H
\ No newline at end of file
+#endif // SORTING_ALGORITHMS_H
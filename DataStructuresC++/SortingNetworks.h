@@ -0,0 +1,751 @@
+#ifndef SORTING_NETWORKS_H
+#define SORTING_NETWORKS_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CUSTOM_SORTING_NETWORK_X86 1
+#include <immintrin.h>
+#else
+#define CUSTOM_SORTING_NETWORK_X86 0
+#endif
+
+namespace custom {
+	/**
+	 * The instruction sets the sorting network kernels can run on, from the slowest to the fastest.
+	 */
+	enum class SimdLevel : unsigned int {
+		Scalar = 0U,
+		Avx2,
+		Avx512
+	};
+
+	/**
+	 * The largest number of elements network_sort() accepts.
+	 */
+	inline constexpr size_t network_sort_max = 64;
+
+	/**
+	 * The element types network_sort() supports.
+	 */
+	template<typename T>
+	concept network_sortable = std::is_same_v<T, std::int32_t> || std::is_same_v<T, float> ||
+	                           std::is_same_v<T, std::int64_t> || std::is_same_v<T, double>;
+
+	/**
+	 * Returns the fastest instruction set the sorting network kernels can use on the current CPU, detected once.
+	 * @return - the SimdLevel used by network_sort() by default.
+	 */
+	inline SimdLevel simd_level() noexcept {
+#if CUSTOM_SORTING_NETWORK_X86
+		static const SimdLevel level = [] {
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx512f"))
+				return SimdLevel::Avx512;
+			if (__builtin_cpu_supports("avx2"))
+				return SimdLevel::Avx2;
+			return SimdLevel::Scalar;
+		}();
+		return level;
+#else
+		return SimdLevel::Scalar;
+#endif
+	}
+
+	namespace network_detail {
+		// The lanes whose index has the bit set take the larger element of their pair
+		template<size_t Lanes>
+		constexpr unsigned int upper_mask(size_t bit) noexcept {
+			unsigned int mask = 0;
+			for (size_t lane = 0; lane < Lanes; ++lane)
+				if (lane & bit)
+					mask |= 1U << lane;
+			return mask;
+		}
+
+		// The partner of each lane, i.e. the lane whose index differs by the bits given
+		template<size_t Lanes>
+		constexpr std::array<int, Lanes> xor_pattern(size_t bits) noexcept {
+			std::array<int, Lanes> pattern{};
+			for (size_t lane = 0; lane < Lanes; ++lane)
+				pattern[lane] = static_cast<int>(lane ^ bits);
+			return pattern;
+		}
+
+		// The value the vectors are padded with, which sorts after every other element
+		template<typename T>
+		constexpr T padding() noexcept {
+			if constexpr (std::numeric_limits<T>::has_infinity)
+				return std::numeric_limits<T>::infinity();
+			else
+				return std::numeric_limits<T>::max();
+		}
+
+		/**
+		 * A single element treated as a vector of one lane, so the generic network becomes a sequence of branchless
+		 * compare-exchanges. An element is only replaced if its partner is strictly smaller, so a comparison involving
+		 * a NaN leaves both elements in place.
+		 */
+		template<typename T>
+		struct ScalarVector {
+			using type = T;
+			static constexpr size_t lanes = 1;
+
+			static void load(type& value, const T* data) noexcept { value = *data; }
+
+			static void store(T* data, const type& value) noexcept { *data = value; }
+
+			static void load_partial(type& value, const T* data, size_t count) noexcept {
+				value = count ? *data : padding<T>();
+			}
+
+			static void store_partial(T* data, const type& value, size_t count) noexcept {
+				if (count)
+					*data = value;
+			}
+
+			static void compare_exchange(type& low, type& high) noexcept {
+				bool swap = high < low;
+				type smaller = swap ? high : low;
+				high = swap ? low : high;
+				low = smaller;
+			}
+
+			static void reverse(type&) noexcept {}
+
+			static void permute(type&, const std::array<int, 1>&) noexcept {}
+
+			static void blend(type&, const type&, unsigned int) noexcept {}
+		};
+
+#if CUSTOM_SORTING_NETWORK_X86
+#define CUSTOM_AVX2 gnu::target("avx2")
+#define CUSTOM_AVX512 gnu::target("avx512f")
+
+		template<typename T>
+		struct Avx2Vector;
+
+		template<>
+		struct Avx2Vector<std::int32_t> {
+			using type = __m256i;
+			static constexpr size_t lanes = 8;
+
+			[[CUSTOM_AVX2]] static void load(type& value, const std::int32_t* data) noexcept {
+				value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+			}
+
+			[[CUSTOM_AVX2]] static void store(std::int32_t* data, const type& value) noexcept {
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(data), value);
+			}
+
+			// The lanes below the count, masked loads and stores leave the memory of the other lanes untouched
+			[[CUSTOM_AVX2]] static type lane_mask(size_t count) noexcept {
+				return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(count)),
+				                          _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+			}
+
+			[[CUSTOM_AVX2]] static void load_partial(type& value, const std::int32_t* data, size_t count) noexcept {
+				type mask = lane_mask(count);
+				value = _mm256_blendv_epi8(_mm256_set1_epi32(padding<std::int32_t>()), _mm256_maskload_epi32(data, mask), mask);
+			}
+
+			[[CUSTOM_AVX2]] static void store_partial(std::int32_t* data, const type& value, size_t count) noexcept {
+				_mm256_maskstore_epi32(data, lane_mask(count), value);
+			}
+
+			[[CUSTOM_AVX2]] static void compare_exchange(type& low, type& high) noexcept {
+				type smaller = _mm256_min_epi32(low, high);
+				high = _mm256_max_epi32(low, high);
+				low = smaller;
+			}
+
+			[[CUSTOM_AVX2]] static void permute(type& value, const std::array<int, lanes>& p) noexcept {
+				value = _mm256_permutevar8x32_epi32(value, _mm256_setr_epi32(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]));
+			}
+
+			[[CUSTOM_AVX2]] static void reverse(type& value) noexcept {
+				value = _mm256_permutevar8x32_epi32(value, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+			}
+
+			[[CUSTOM_AVX2]] static void blend(type& low, const type& high, unsigned int mask) noexcept {
+				auto lane = [mask](int i) { return (mask >> i) & 1 ? -1 : 0; };
+				low = _mm256_blendv_epi8(low, high, _mm256_setr_epi32(lane(0), lane(1), lane(2), lane(3), lane(4),
+				                                                      lane(5), lane(6), lane(7)));
+			}
+		};
+
+		template<>
+		struct Avx2Vector<float> {
+			using type = __m256;
+			static constexpr size_t lanes = 8;
+
+			[[CUSTOM_AVX2]] static void load(type& value, const float* data) noexcept { value = _mm256_loadu_ps(data); }
+
+			[[CUSTOM_AVX2]] static void store(float* data, const type& value) noexcept {
+				_mm256_storeu_ps(data, value);
+			}
+
+			[[CUSTOM_AVX2]] static void load_partial(type& value, const float* data, size_t count) noexcept {
+				__m256i mask = Avx2Vector<std::int32_t>::lane_mask(count);
+				value = _mm256_blendv_ps(_mm256_set1_ps(padding<float>()), _mm256_maskload_ps(data, mask),
+				                         _mm256_castsi256_ps(mask));
+			}
+
+			[[CUSTOM_AVX2]] static void store_partial(float* data, const type& value, size_t count) noexcept {
+				_mm256_maskstore_ps(data, Avx2Vector<std::int32_t>::lane_mask(count), value);
+			}
+
+			[[CUSTOM_AVX2]] static void compare_exchange(type& low, type& high) noexcept {
+				// Blending on an ordered comparison keeps NaNs in place, where min and max would duplicate them
+				type swap = _mm256_cmp_ps(high, low, _CMP_LT_OQ);
+				type smaller = _mm256_blendv_ps(low, high, swap);
+				high = _mm256_blendv_ps(high, low, swap);
+				low = smaller;
+			}
+
+			[[CUSTOM_AVX2]] static void permute(type& value, const std::array<int, lanes>& p) noexcept {
+				value = _mm256_permutevar8x32_ps(value, _mm256_setr_epi32(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]));
+			}
+
+			[[CUSTOM_AVX2]] static void reverse(type& value) noexcept {
+				value = _mm256_permutevar8x32_ps(value, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+			}
+
+			[[CUSTOM_AVX2]] static void blend(type& low, const type& high, unsigned int mask) noexcept {
+				auto lane = [mask](int i) { return (mask >> i) & 1 ? -1 : 0; };
+				low = _mm256_blendv_ps(low, high, _mm256_castsi256_ps(_mm256_setr_epi32(
+						lane(0), lane(1), lane(2), lane(3), lane(4), lane(5), lane(6), lane(7))));
+			}
+		};
+
+		template<>
+		struct Avx2Vector<std::int64_t> {
+			using type = __m256i;
+			static constexpr size_t lanes = 4;
+
+			[[CUSTOM_AVX2]] static void load(type& value, const std::int64_t* data) noexcept {
+				value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+			}
+
+			[[CUSTOM_AVX2]] static void store(std::int64_t* data, const type& value) noexcept {
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(data), value);
+			}
+
+			[[CUSTOM_AVX2]] static type lane_mask(size_t count) noexcept {
+				return _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<long long>(count)), _mm256_setr_epi64x(0, 1, 2, 3));
+			}
+
+			[[CUSTOM_AVX2]] static void load_partial(type& value, const std::int64_t* data, size_t count) noexcept {
+				type mask = lane_mask(count);
+				value = _mm256_blendv_epi8(_mm256_set1_epi64x(padding<std::int64_t>()),
+				                           _mm256_maskload_epi64(reinterpret_cast<const long long*>(data), mask), mask);
+			}
+
+			[[CUSTOM_AVX2]] static void store_partial(std::int64_t* data, const type& value, size_t count) noexcept {
+				_mm256_maskstore_epi64(reinterpret_cast<long long*>(data), lane_mask(count), value);
+			}
+
+			[[CUSTOM_AVX2]] static void compare_exchange(type& low, type& high) noexcept {
+				// AVX2 has no 64-bit minimum, blend on a comparison instead
+				type swap = _mm256_cmpgt_epi64(low, high);
+				type smaller = _mm256_blendv_epi8(low, high, swap);
+				high = _mm256_blendv_epi8(high, low, swap);
+				low = smaller;
+			}
+
+			[[CUSTOM_AVX2]] static void permute(type& value, const std::array<int, lanes>& p) noexcept {
+				value = _mm256_permutevar8x32_epi32(value, _mm256_setr_epi32(2 * p[0], 2 * p[0] + 1, 2 * p[1], 2 * p[1] + 1,
+				                                                             2 * p[2], 2 * p[2] + 1, 2 * p[3], 2 * p[3] + 1));
+			}
+
+			[[CUSTOM_AVX2]] static void reverse(type& value) noexcept {
+				value = _mm256_permute4x64_epi64(value, _MM_SHUFFLE(0, 1, 2, 3));
+			}
+
+			[[CUSTOM_AVX2]] static void blend(type& low, const type& high, unsigned int mask) noexcept {
+				auto lane = [mask](int i) { return (mask >> i) & 1 ? -1LL : 0LL; };
+				low = _mm256_blendv_epi8(low, high, _mm256_setr_epi64x(lane(0), lane(1), lane(2), lane(3)));
+			}
+		};
+
+		template<>
+		struct Avx2Vector<double> {
+			using type = __m256d;
+			static constexpr size_t lanes = 4;
+
+			[[CUSTOM_AVX2]] static void load(type& value, const double* data) noexcept {
+				value = _mm256_loadu_pd(data);
+			}
+
+			[[CUSTOM_AVX2]] static void store(double* data, const type& value) noexcept {
+				_mm256_storeu_pd(data, value);
+			}
+
+			[[CUSTOM_AVX2]] static void load_partial(type& value, const double* data, size_t count) noexcept {
+				__m256i mask = Avx2Vector<std::int64_t>::lane_mask(count);
+				value = _mm256_blendv_pd(_mm256_set1_pd(padding<double>()), _mm256_maskload_pd(data, mask),
+				                         _mm256_castsi256_pd(mask));
+			}
+
+			[[CUSTOM_AVX2]] static void store_partial(double* data, const type& value, size_t count) noexcept {
+				_mm256_maskstore_pd(data, Avx2Vector<std::int64_t>::lane_mask(count), value);
+			}
+
+			[[CUSTOM_AVX2]] static void compare_exchange(type& low, type& high) noexcept {
+				type swap = _mm256_cmp_pd(high, low, _CMP_LT_OQ);
+				type smaller = _mm256_blendv_pd(low, high, swap);
+				high = _mm256_blendv_pd(high, low, swap);
+				low = smaller;
+			}
+
+			[[CUSTOM_AVX2]] static void permute(type& value, const std::array<int, lanes>& p) noexcept {
+				__m256i index = _mm256_setr_epi32(2 * p[0], 2 * p[0] + 1, 2 * p[1], 2 * p[1] + 1,
+				                                  2 * p[2], 2 * p[2] + 1, 2 * p[3], 2 * p[3] + 1);
+				value = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(value), index));
+			}
+
+			[[CUSTOM_AVX2]] static void reverse(type& value) noexcept {
+				value = _mm256_permute4x64_pd(value, _MM_SHUFFLE(0, 1, 2, 3));
+			}
+
+			[[CUSTOM_AVX2]] static void blend(type& low, const type& high, unsigned int mask) noexcept {
+				auto lane = [mask](int i) { return (mask >> i) & 1 ? -1LL : 0LL; };
+				low = _mm256_blendv_pd(low, high, _mm256_castsi256_pd(
+						_mm256_setr_epi64x(lane(0), lane(1), lane(2), lane(3))));
+			}
+		};
+
+		// GCC defines the unmasked AVX-512 permutes, minimums and maximums as masked ones whose pass-through operand
+		// is deliberately undefined, which -Wmaybe-uninitialized reports wherever they are inlined
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+		template<typename T>
+		struct Avx512Vector;
+
+		template<>
+		struct Avx512Vector<std::int32_t> {
+			using type = __m512i;
+			static constexpr size_t lanes = 16;
+
+			[[CUSTOM_AVX512]] static void load(type& value, const std::int32_t* data) noexcept {
+				value = _mm512_loadu_si512(data);
+			}
+
+			[[CUSTOM_AVX512]] static void store(std::int32_t* data, const type& value) noexcept {
+				_mm512_storeu_si512(data, value);
+			}
+
+			[[CUSTOM_AVX512]] static __mmask16 lane_mask(size_t count) noexcept {
+				return static_cast<__mmask16>((1U << count) - 1U);
+			}
+
+			[[CUSTOM_AVX512]] static void load_partial(type& value, const std::int32_t* data, size_t count) noexcept {
+				value = _mm512_mask_loadu_epi32(_mm512_set1_epi32(padding<std::int32_t>()), lane_mask(count), data);
+			}
+
+			[[CUSTOM_AVX512]] static void store_partial(std::int32_t* data, const type& value, size_t count) noexcept {
+				_mm512_mask_storeu_epi32(data, lane_mask(count), value);
+			}
+
+			[[CUSTOM_AVX512]] static void compare_exchange(type& low, type& high) noexcept {
+				type smaller = _mm512_min_epi32(low, high);
+				high = _mm512_max_epi32(low, high);
+				low = smaller;
+			}
+
+			[[CUSTOM_AVX512]] static void permute(type& value, const std::array<int, lanes>& p) noexcept {
+				value = _mm512_permutexvar_epi32(_mm512_setr_epi32(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], p[8],
+				                                                   p[9], p[10], p[11], p[12], p[13], p[14], p[15]), value);
+			}
+
+			[[CUSTOM_AVX512]] static void reverse(type& value) noexcept {
+				value = _mm512_permutexvar_epi32(_mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0),
+				                                 value);
+			}
+
+			[[CUSTOM_AVX512]] static void blend(type& low, const type& high, unsigned int mask) noexcept {
+				low = _mm512_mask_blend_epi32(static_cast<__mmask16>(mask), low, high);
+			}
+		};
+
+		template<>
+		struct Avx512Vector<float> {
+			using type = __m512;
+			static constexpr size_t lanes = 16;
+
+			[[CUSTOM_AVX512]] static void load(type& value, const float* data) noexcept {
+				value = _mm512_loadu_ps(data);
+			}
+
+			[[CUSTOM_AVX512]] static void store(float* data, const type& value) noexcept {
+				_mm512_storeu_ps(data, value);
+			}
+
+			[[CUSTOM_AVX512]] static __mmask16 lane_mask(size_t count) noexcept {
+				return static_cast<__mmask16>((1U << count) - 1U);
+			}
+
+			[[CUSTOM_AVX512]] static void load_partial(type& value, const float* data, size_t count) noexcept {
+				value = _mm512_mask_loadu_ps(_mm512_set1_ps(padding<float>()), lane_mask(count), data);
+			}
+
+			[[CUSTOM_AVX512]] static void store_partial(float* data, const type& value, size_t count) noexcept {
+				_mm512_mask_storeu_ps(data, lane_mask(count), value);
+			}
+
+			[[CUSTOM_AVX512]] static void compare_exchange(type& low, type& high) noexcept {
+				__mmask16 swap = _mm512_cmp_ps_mask(high, low, _CMP_LT_OQ);
+				type smaller = _mm512_mask_blend_ps(swap, low, high);
+				high = _mm512_mask_blend_ps(swap, high, low);
+				low = smaller;
+			}
+
+			[[CUSTOM_AVX512]] static void permute(type& value, const std::array<int, lanes>& p) noexcept {
+				value = _mm512_permutexvar_ps(_mm512_setr_epi32(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], p[8],
+				                                                p[9], p[10], p[11], p[12], p[13], p[14], p[15]), value);
+			}
+
+			[[CUSTOM_AVX512]] static void reverse(type& value) noexcept {
+				value = _mm512_permutexvar_ps(_mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0),
+				                              value);
+			}
+
+			[[CUSTOM_AVX512]] static void blend(type& low, const type& high, unsigned int mask) noexcept {
+				low = _mm512_mask_blend_ps(static_cast<__mmask16>(mask), low, high);
+			}
+		};
+
+		template<>
+		struct Avx512Vector<std::int64_t> {
+			using type = __m512i;
+			static constexpr size_t lanes = 8;
+
+			[[CUSTOM_AVX512]] static void load(type& value, const std::int64_t* data) noexcept {
+				value = _mm512_loadu_si512(data);
+			}
+
+			[[CUSTOM_AVX512]] static void store(std::int64_t* data, const type& value) noexcept {
+				_mm512_storeu_si512(data, value);
+			}
+
+			[[CUSTOM_AVX512]] static __mmask8 lane_mask(size_t count) noexcept {
+				return static_cast<__mmask8>((1U << count) - 1U);
+			}
+
+			[[CUSTOM_AVX512]] static void load_partial(type& value, const std::int64_t* data, size_t count) noexcept {
+				value = _mm512_mask_loadu_epi64(_mm512_set1_epi64(padding<std::int64_t>()), lane_mask(count), data);
+			}
+
+			[[CUSTOM_AVX512]] static void store_partial(std::int64_t* data, const type& value, size_t count) noexcept {
+				_mm512_mask_storeu_epi64(data, lane_mask(count), value);
+			}
+
+			[[CUSTOM_AVX512]] static void compare_exchange(type& low, type& high) noexcept {
+				type smaller = _mm512_min_epi64(low, high);
+				high = _mm512_max_epi64(low, high);
+				low = smaller;
+			}
+
+			[[CUSTOM_AVX512]] static void permute(type& value, const std::array<int, lanes>& p) noexcept {
+				value = _mm512_permutexvar_epi64(_mm512_setr_epi64(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]), value);
+			}
+
+			[[CUSTOM_AVX512]] static void reverse(type& value) noexcept {
+				value = _mm512_permutexvar_epi64(_mm512_setr_epi64(7, 6, 5, 4, 3, 2, 1, 0), value);
+			}
+
+			[[CUSTOM_AVX512]] static void blend(type& low, const type& high, unsigned int mask) noexcept {
+				low = _mm512_mask_blend_epi64(static_cast<__mmask8>(mask), low, high);
+			}
+		};
+
+		template<>
+		struct Avx512Vector<double> {
+			using type = __m512d;
+			static constexpr size_t lanes = 8;
+
+			[[CUSTOM_AVX512]] static void load(type& value, const double* data) noexcept {
+				value = _mm512_loadu_pd(data);
+			}
+
+			[[CUSTOM_AVX512]] static void store(double* data, const type& value) noexcept {
+				_mm512_storeu_pd(data, value);
+			}
+
+			[[CUSTOM_AVX512]] static __mmask8 lane_mask(size_t count) noexcept {
+				return static_cast<__mmask8>((1U << count) - 1U);
+			}
+
+			[[CUSTOM_AVX512]] static void load_partial(type& value, const double* data, size_t count) noexcept {
+				value = _mm512_mask_loadu_pd(_mm512_set1_pd(padding<double>()), lane_mask(count), data);
+			}
+
+			[[CUSTOM_AVX512]] static void store_partial(double* data, const type& value, size_t count) noexcept {
+				_mm512_mask_storeu_pd(data, lane_mask(count), value);
+			}
+
+			[[CUSTOM_AVX512]] static void compare_exchange(type& low, type& high) noexcept {
+				__mmask8 swap = _mm512_cmp_pd_mask(high, low, _CMP_LT_OQ);
+				type smaller = _mm512_mask_blend_pd(swap, low, high);
+				high = _mm512_mask_blend_pd(swap, high, low);
+				low = smaller;
+			}
+
+			[[CUSTOM_AVX512]] static void permute(type& value, const std::array<int, lanes>& p) noexcept {
+				value = _mm512_permutexvar_pd(_mm512_setr_epi64(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]), value);
+			}
+
+			[[CUSTOM_AVX512]] static void reverse(type& value) noexcept {
+				value = _mm512_permutexvar_pd(_mm512_setr_epi64(7, 6, 5, 4, 3, 2, 1, 0), value);
+			}
+
+			[[CUSTOM_AVX512]] static void blend(type& low, const type& high, unsigned int mask) noexcept {
+				low = _mm512_mask_blend_pd(static_cast<__mmask8>(mask), low, high);
+			}
+		};
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+		// The vector operations take and update their vectors by reference, and the generic network below is always
+		// inlined, at every optimisation level, into the kernel of each instruction set, so no vector is passed by value
+		// between functions compiled for different instruction sets
+
+		// Compare-exchanges every lane with the lane whose index differs by the bits given, within each vector
+		template<typename Vector, size_t Bits, size_t UpperBit>
+		[[gnu::always_inline]] inline void lane_step(typename Vector::type* v, size_t count) noexcept {
+			constexpr auto pattern = xor_pattern<Vector::lanes>(Bits);
+			constexpr unsigned int mask = upper_mask<Vector::lanes>(UpperBit);
+			for (size_t i = 0; i < count; ++i) {
+				// Each lane takes the result from its own side of the pair, so that the two lanes of a pair make the
+				// same decision when an element is a NaN
+				typename Vector::type partner = v[i];
+				Vector::permute(partner, pattern);
+				typename Vector::type low = v[i], unused_high = partner;
+				Vector::compare_exchange(low, unused_high);
+				typename Vector::type unused_low = partner, high = v[i];
+				Vector::compare_exchange(unused_low, high);
+				Vector::blend(low, high, mask);
+				v[i] = low;
+			}
+		}
+
+		// The first step of merging the sorted blocks of Size elements pairwise: element i of each block of 2 * Size is
+		// compared with element 2 * Size - 1 - i, so both halves can be sorted in the same direction
+		template<typename Vector, size_t Regs, size_t Size>
+		[[gnu::always_inline]] inline void flip_step(typename Vector::type* v) noexcept {
+			constexpr size_t lanes = Vector::lanes;
+			if constexpr (2 * Size <= lanes)
+				lane_step<Vector, 2 * Size - 1, Size>(v, Regs);
+			else {
+				constexpr size_t block = 2 * Size / lanes;
+				for (size_t base = 0; base < Regs; base += block) {
+					for (size_t i = 0; i < block / 2; ++i) {
+						typename Vector::type& low = v[base + i];
+						typename Vector::type& high = v[base + block - 1 - i];
+						Vector::reverse(high);
+						Vector::compare_exchange(low, high);
+						Vector::reverse(high);
+					}
+				}
+			}
+		}
+
+		// A half-cleaner step: every element is compare-exchanged with the element Distance positions away
+		template<typename Vector, size_t Regs, size_t Distance>
+		[[gnu::always_inline]] inline void half_clean_step(typename Vector::type* v) noexcept {
+			constexpr size_t lanes = Vector::lanes;
+			if constexpr (Distance < lanes)
+				lane_step<Vector, Distance, Distance>(v, Regs);
+			else {
+				constexpr size_t stride = Distance / lanes;
+				for (size_t i = 0; i < Regs; ++i)
+					if (!(i & stride))
+						Vector::compare_exchange(v[i], v[i + stride]);
+			}
+		}
+
+		// The half-cleaner steps merging the blocks of Size elements, at distances Size / 2, Size / 4, ..., 1
+		template<typename Vector, size_t Regs, size_t Size, size_t... Shift>
+		[[gnu::always_inline]] inline void half_clean_steps([[maybe_unused]] typename Vector::type* v,
+		                                                                     std::index_sequence<Shift...>) noexcept {
+			(half_clean_step<Vector, Regs, ((Size / 2) >> Shift)>(v), ...);
+		}
+
+		// Merges the sorted blocks of Size elements pairwise into sorted blocks of 2 * Size elements
+		template<typename Vector, size_t Regs, size_t Size>
+		[[gnu::always_inline]] inline void merge_step(typename Vector::type* v) noexcept {
+			flip_step<Vector, Regs, Size>(v);
+			half_clean_steps<Vector, Regs, Size>(v, std::make_index_sequence<std::bit_width(Size) - 1>());
+		}
+
+		// The merges of the blocks of 1, 2, 4, ... elements, up to half the elements of the Regs vectors
+		template<typename Vector, size_t Regs, size_t... Shift>
+		[[gnu::always_inline]] inline void merge_steps([[maybe_unused]] typename Vector::type* v,
+		                                                                std::index_sequence<Shift...>) noexcept {
+			(merge_step<Vector, Regs, size_t(1) << Shift>(v), ...);
+		}
+
+		// A bitonic sorting network over Regs vectors, the whole network being unrolled at compile time
+		template<typename Vector, size_t Regs>
+		[[gnu::always_inline]] inline void bitonic_sort(typename Vector::type* v) noexcept {
+			merge_steps<Vector, Regs>(v, std::make_index_sequence<std::bit_width(Regs * Vector::lanes) - 1>());
+		}
+
+		// Loads the elements into the smallest power of two number of vectors holding them, the last ones padded with
+		// the largest value through masked loads, sorts the vectors and stores the elements back
+		template<typename Vector, size_t Regs, typename T>
+		[[gnu::always_inline]] inline void sort_padded(T* data, size_t size) noexcept {
+			constexpr size_t lanes = Vector::lanes;
+			const size_t full = size / lanes;
+			typename Vector::type v[Regs];
+			for (size_t i = 0; i < Regs; ++i) {
+				if (i < full)
+					Vector::load(v[i], data + i * lanes);
+				else
+					Vector::load_partial(v[i], data + i * lanes, i == full ? size % lanes : 0);
+			}
+			bitonic_sort<Vector, Regs>(v);
+			for (size_t i = 0; i < full; ++i)
+				Vector::store(data + i * lanes, v[i]);
+			if (full < Regs)
+				Vector::store_partial(data + full * lanes, v[full], size % lanes);
+		}
+
+		template<typename Vector, typename T>
+		[[gnu::always_inline]] inline void sort_with(T* data, size_t size) noexcept {
+			constexpr size_t lanes = Vector::lanes;
+			size_t regs = std::bit_ceil((size + lanes - 1) / lanes);
+			switch (regs) {
+				case 1:
+					sort_padded<Vector, 1>(data, size);
+					break;
+				case 2:
+					sort_padded<Vector, 2>(data, size);
+					break;
+				case 4:
+					if constexpr (4 * lanes <= network_sort_max)
+						sort_padded<Vector, 4>(data, size);
+					break;
+				case 8:
+					if constexpr (8 * lanes <= network_sort_max)
+						sort_padded<Vector, 8>(data, size);
+					break;
+				case 16:
+					if constexpr (16 * lanes <= network_sort_max)
+						sort_padded<Vector, 16>(data, size);
+					break;
+				case 32:
+					if constexpr (32 * lanes <= network_sort_max)
+						sort_padded<Vector, 32>(data, size);
+					break;
+				default:
+					if constexpr (64 * lanes <= network_sort_max)
+						sort_padded<Vector, 64>(data, size);
+					break;
+			}
+		}
+
+		template<typename T>
+		void sort_scalar(T* data, size_t size) noexcept {
+			sort_with<ScalarVector<T>>(data, size);
+		}
+
+#if CUSTOM_SORTING_NETWORK_X86
+		// The kernels for each instruction set are flattened so the calls to the vector operations are inlined as well
+		template<typename T>
+		[[CUSTOM_AVX2, gnu::flatten]] void sort_avx2(T* data, size_t size) noexcept {
+			sort_with<Avx2Vector<T>>(data, size);
+		}
+
+		template<typename T>
+		[[CUSTOM_AVX512, gnu::flatten]] void sort_avx512(T* data, size_t size) noexcept {
+			sort_with<Avx512Vector<T>>(data, size);
+		}
+
+#undef CUSTOM_AVX2
+#undef CUSTOM_AVX512
+#endif
+
+		template<typename T>
+		inline void network_sort(T* data, size_t size, SimdLevel level) noexcept {
+			if (size < 2)
+				return;
+#if CUSTOM_SORTING_NETWORK_X86
+			// Masked AVX-512 accesses covering half a vector or less stall the accesses overlapping them, an AVX2 vector
+			// holds as many elements
+			if (level == SimdLevel::Avx512 && size > Avx2Vector<T>::lanes)
+				return sort_avx512(data, size);
+			if (level >= SimdLevel::Avx2)
+				return sort_avx2(data, size);
+#endif
+			sort_scalar(data, size);
+		}
+	}
+
+	/**
+	 * Sorts up to network_sort_max elements in ascending order with a bitonic sorting network. The elements are held in
+	 * vector registers and sorted by a fixed sequence of vectorised compare-exchanges, so the sort runs without any
+	 * data-dependent branch. The fastest instruction set supported by the CPU is picked at runtime: AVX-512, AVX2 or a
+	 * scalar network of branchless compare-exchanges. The sort is not stable. If the elements are floating point numbers
+	 * containing NaNs, the elements are permuted but not necessarily sorted.
+	 * **Time Complexity** = *O(n log^2 n)* compare-exchanges, performed *L* at a time where L is the number of lanes.
+	 * @tparam T - the type of the elements, one of `std::int32_t`, `float`, `std::int64_t` and `double`.
+	 * @param data - a pointer to the first element to sort.
+	 * @param size - the number of elements to sort, at most network_sort_max.
+	 */
+	template<network_sortable T>
+	void network_sort(T* data, size_t size) {
+		if (size > network_sort_max)
+			throw std::invalid_argument("Sorting network supports at most 64 elements");
+		network_detail::network_sort(data, size, simd_level());
+	}
+
+	/**
+	 * Sorts up to network_sort_max elements in ascending order with a bitonic sorting network, using the instruction set
+	 * specified. If the CPU does not support it, an `invalid_argument` exception is thrown.
+	 * @tparam T - the type of the elements, one of `std::int32_t`, `float`, `std::int64_t` and `double`.
+	 * @param data - a pointer to the first element to sort.
+	 * @param size - the number of elements to sort, at most network_sort_max.
+	 * @param level - the instruction set to use.
+	 * @see network_sort(T*, size_t)
+	 */
+	template<network_sortable T>
+	void network_sort(T* data, size_t size, SimdLevel level) {
+		if (size > network_sort_max)
+			throw std::invalid_argument("Sorting network supports at most 64 elements");
+		if (level > simd_level())
+			throw std::invalid_argument("The CPU does not support the requested instruction set");
+		network_detail::network_sort(data, size, level);
+	}
+
+	/**
+	 * Sorts the elements of a contiguous range of up to network_sort_max elements, such as a Vector, an Array or a raw
+	 * array, in ascending order with a bitonic sorting network.
+	 * @tparam ContiguousIt - the type of the contiguous iterators over the elements.
+	 * @param first - an iterator to the first element to sort.
+	 * @param last - an iterator past the last element to sort.
+	 * @see network_sort(T*, size_t)
+	 */
+	template<std::contiguous_iterator ContiguousIt>
+	requires network_sortable<std::iter_value_t<ContiguousIt>>
+	void network_sort(ContiguousIt first, ContiguousIt last) {
+		network_sort(std::to_address(first), static_cast<size_t>(last - first));
+	}
+}// namespace custom
+
+#endif// SORTING_NETWORKS_H
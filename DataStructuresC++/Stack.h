@@ -3,9 +3,17 @@
 
 #include <initializer_list>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <vector>
 
+#include "AllocationTracking.h"
+#include "Checking.h"
+#include "MemoryUsage.h"
+#include "Serialization.h"
+#include "Tracing.h"
+
 namespace custom {
 	/**
 	 * A template implementation of the stack data structure. Elements are stored in the order of insertion and the
@@ -19,23 +27,33 @@ namespace custom {
 	 * to continue running.
 	 *
 	 * @tparam T - the type of data to be stored in each node of the stack.
+	 * @tparam Allocator - the allocator the nodes are allocated with, `std::allocator` by default, see pmr::Stack.
 	 * @see <a href="https://en.wikipedia.org/wiki/Stack_(abstract_data_type)">Stack data structure</a>
 	 */
-	template<typename T>
+	template<typename T, typename Allocator = std::allocator<T>>
 	class Stack {
 	public:
+		using allocator_type = Allocator;  /**< An alias for the allocator the nodes are allocated with. */
+
 		/**
 		 * Default Stack constructor which initialises the head pointer member to nullptr and the length to 0.
 		 */
 		Stack() noexcept: head(nullptr), mLength(0) {}
 
+		/**
+		 * Overloaded Stack constructor which initialises an empty stack whose nodes will be allocated with the
+		 * allocator provided.
+		 * @param allocator - the allocator to allocate the nodes with.
+		 */
+		explicit Stack(const Allocator& allocator) noexcept: head(nullptr), mLength(0), mAllocator(allocator) {}
+
 		/**
 		 * Overloaded Stack constructor which allocates memory for one element node and copies the data provided.
 		 * This constructor is explicit, meaning implicit conversion is not supported.
 		 * @param data - data of type `T` to be copied into the head node of the Stack.
 		 */
 		explicit Stack(const T& data) noexcept: mLength(1) {
-			head = new Node(data);
+			head = create_node(data);
 		}
 
 		/**
@@ -44,7 +62,7 @@ namespace custom {
 		 * @param data - an *r-value reference* to data of type `T`, to be moved into the head node of the Stack.
 		 */
 		explicit Stack(T&& data) noexcept: mLength(1) {
-			head = new Node(std::move(data));
+			head = create_node(std::move(data));
 		}
 
 		/**
@@ -52,20 +70,23 @@ namespace custom {
 		 * its arguments, in order, to the top of the stack.
 		 * **Time Complexity** = *O(n)* where n is the number elements in the initialiser list.
 		 * @param init - an initialiser list of type `T` whose contents will be added to the stack.
+		 * @param allocator - the allocator to allocate the nodes with.
 		 * @see <a href="https://en.cppreference.com/w/cpp/utility/initializer_list">std::initializer_list</a>
 		 */
-		Stack(std::initializer_list<T> init) noexcept: mLength(0) {
+		Stack(std::initializer_list<T> init, const Allocator& allocator = Allocator()) noexcept:
+				head(nullptr), mLength(0), mAllocator(allocator) {
 			for (auto it = init.begin(); it != init.end(); ++it)
 				push(std::move(*it));
 		}
 
 		/**
 		 * Copy constructor for a Stack which will perform a deep copy, element-wise, of another Stack
-		 * object of the same type `T`.
+		 * object of the same type `T`, with the allocator the allocator of the other stack selects for a copy.
 		 * **Time Complexity** = *O(n)* where n is the twice the number of elements in the other stack.
 		 * @param other - another Stack object of the same type `T` to be copied.
 		 */
-		Stack(const Stack<T>& other) noexcept {
+		Stack(const Stack& other) noexcept:
+				mAllocator(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.mAllocator)) {
 			if (other.mLength) {
 				const auto other_contents = other.contents();
 				mLength = 0;
@@ -79,7 +100,7 @@ namespace custom {
 
 		/**
 		 * Copy assignment operator for the Stack which will copy another Stack object of the same type
-		 * `T` into the current object.
+		 * `T` into the current object, which keeps its allocator.
 		 * \note
 		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the other stack + the number of elements
@@ -87,7 +108,7 @@ namespace custom {
 		 * @param other - another Stack object of the same type `T` to be copied.
 		 * @return - a reference to the current object.
 		 */
-		Stack<T>& operator=(const Stack<T>& other) noexcept {
+		Stack& operator=(const Stack& other) noexcept {
 			if (this != &other) {
 				if (mLength)
 					clear();
@@ -106,28 +127,40 @@ namespace custom {
 
 		/**
 		 * Move constructor for a Stack which will take the data from another Stack object of the same type
-		 * `T` and set the other object to its default state of not have any data.
+		 * `T`, along with its allocator, and set the other object to its default state of not have any data.
 		 * **Time Complexity** = *O(1)*.
 		 * @param other - an *r-value reference* to a Stack object of type `T` to be moved.
 		 */
-		Stack(Stack<T>&& other) noexcept: head(other.head), mLength(other.mLength) {
+		Stack(Stack&& other) noexcept: head(other.head), mLength(other.mLength), mAllocator(other.mAllocator) {
 			other.head = nullptr;
 			other.mLength = 0;
 		}
 
 		/**
 		 * Move assignment operator for the Stack which will move another Stack object of type `T` into
-		 * the current object.
+		 * the current object, which keeps its allocator. If the allocators do not compare equal, e.g.
+		 * `std::pmr::polymorphic_allocator` objects of different memory resources, the elements are moved one by one.
 		 * \note
 		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
-		 * **Time Complexity** = *O(1)*.
+		 * **Time Complexity** = *O(1)*, or *O(n)* where n is the number of elements in the other stack if the
+		 * allocators differ.
 		 * @param other - an *r-value reference* to a Stack object of type `T` to be moved.
 		 * @return - a reference to the current object.
 		 */
-		Stack<T>& operator=(Stack<T>&& other) noexcept {
+		Stack& operator=(Stack&& other) noexcept {
 			if (this != &other) {
 				if (mLength)
 					clear();
+				if (!std::allocator_traits<Allocator>::is_always_equal::value && mAllocator != other.mAllocator) {
+					Node** link = &head;
+					for (Node* node = other.head; node; node = node->next) {
+						*link = create_node(std::move(node->data));
+						link = &(*link)->next;
+					}
+					mLength = other.mLength;
+					other.clear();
+					return *this;
+				}
 				head = other.head;
 				mLength = other.mLength;
 				other.head = nullptr;
@@ -143,7 +176,8 @@ namespace custom {
 		 * @param data - the data to be copied onto the top of the stack.
 		 */
 		void push(const T& data) noexcept {
-			Node* new_node = new Node(data);
+			tracing::Scope scope(tracing::Operation::Insert);
+			Node* new_node = create_node(data);
 			if (mLength) {
 				new_node->next = head;
 				head = new_node;
@@ -161,7 +195,8 @@ namespace custom {
 		 * @param data - an *r-value reference* to the data to be moved onto the top of the stack.
 		 */
 		void push(T&& data) noexcept {
-			Node* new_node = new Node(std::move(data));
+			tracing::Scope scope(tracing::Operation::Insert);
+			Node* new_node = create_node(std::move(data));
 			if (mLength) {
 				new_node->next = head;
 				head = new_node;
@@ -190,15 +225,14 @@ namespace custom {
 		 * @return - a copy of the data of the element at the top of the stack.
 		 */
 		T pop() {
-			if (mLength) {
-				T result = head->data;
-				Node* cur = head;
-				head = head->next;
-				delete cur;
-				--mLength;
-				return result;
-			}
-			throw std::runtime_error("Stack is empty, there is nothing to pop.");
+			tracing::Scope scope(tracing::Operation::Erase);
+			check<std::runtime_error>(mLength != 0, "Stack is empty, there is nothing to pop.");
+			T result = head->data;
+			Node* cur = head;
+			head = head->next;
+			destroy_node(cur);
+			--mLength;
+			return result;
 		}
 
 		/**
@@ -207,10 +241,9 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 * @return - a reference of the data of the element at the top of the stack.
 		 */
-		[[nodiscard]] T& peek() {
-			if (mLength)
-				return head->data;
-			throw std::runtime_error("Stack is empty, there is nothing to peek.");
+		[[nodiscard]] T& peek() noexcept(!checks_throw) {
+			check<std::runtime_error>(mLength != 0, "Stack is empty, there is nothing to peek.");
+			return head->data;
 		}
 
 		/**
@@ -219,10 +252,9 @@ namespace custom {
 		 * **Time Complexity** = *O(1)*.
 		 * @return - a const reference of the data of the element at the top of the stack.
 		 */
-		[[nodiscard]] const T& peek() const {
-			if (mLength)
-				return head->data;
-			throw std::runtime_error("Stack is empty, there is nothing to peek.");
+		[[nodiscard]] const T& peek() const noexcept(!checks_throw) {
+			check<std::runtime_error>(mLength != 0, "Stack is empty, there is nothing to peek.");
+			return head->data;
 		}
 
 		/**
@@ -243,6 +275,60 @@ namespace custom {
 			return mLength == 0;
 		}
 
+		/**
+		 * Returns a breakdown of the memory held by the stack: the data of the elements is the payload, while the pointer
+		 * to the next node, the padding of each node and the stack object itself are structural overhead.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - a MemoryUsage object with the bytes of payload, structure and estimated allocator overhead.
+		 */
+		[[nodiscard]] MemoryUsage memory_usage() const noexcept {
+			MemoryUsage usage;
+			usage.structure = sizeof(*this);
+			memory_detail::add_blocks(usage, mLength, sizeof(Node), sizeof(T));
+			return usage;
+		}
+
+		/**
+		 * Serializes the stack in the binary format of Serialization.h, from the top to the bottom.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the stack.
+		 * @param out - the serialization::Writer to append the stack to.
+		 */
+		void serialize(serialization::Writer& out) const {
+			out.header<T>(serialization::Kind::Stack, mLength);
+			for (Node* node = head; node; node = node->next)
+				out.value(node->data);
+		}
+
+		/**
+		 * Deserializes a stack written by serialize(), linking the nodes in the order they are read rather than pushing
+		 * them in reverse. If the data does not hold a serialized Stack of `T`, a `runtime_error` exception is thrown.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the stack.
+		 * @param in - the serialization::Reader to read the stack from.
+		 * @return - the stack.
+		 */
+		static Stack deserialize(serialization::Reader& in) {
+			size_t count = in.header<T>(serialization::Kind::Stack).count;
+			Stack result;
+			Node** link = &result.head;
+			for (size_t i = 0; i < count; ++i) {
+				*link = result.create_node(in.value<T>());
+				link = &(*link)->next;
+				++result.mLength;
+			}
+			return result;
+		}
+
+		/**
+		 * Returns a read-only view of the elements of a stack written by serialize(), in place in the data, from the top
+		 * to the bottom. Only available for trivially copyable elements.
+		 * **Time Complexity** = *O(1)*.
+		 * @param in - the serialization::Reader to read the stack from.
+		 * @return - a span of the elements, valid as long as the data.
+		 */
+		static std::span<const T> view(serialization::Reader& in) requires serialization::Codec<T>::raw {
+			return in.view<T>(in.header<T>(serialization::Kind::Stack).count);
+		}
+
 		/**
 		 * Conversion operator for boolean type. Evaluates to `true` if the size of the stack is not 0, otherwise
 		 * it evaluates to `false`.
@@ -261,7 +347,7 @@ namespace custom {
 		 * @param other - a Stack object of the same type `T`, whose data to compare against.
 		 * @return - a boolean value indicating whether the two stacks contain the same data.
 		 */
-		bool operator==(const Stack<T>& other) const noexcept {
+		bool operator==(const Stack& other) const noexcept {
 			if (mLength != other.mLength)
 				return false;
 			Node* cur = head;
@@ -283,7 +369,7 @@ namespace custom {
 		 * @param other - a Stack object of the same type `T`, whose data to compare against.
 		 * @return - a boolean value indicating whether the two stacks contain different data.
 		 */
-		[[nodiscard]] bool operator!=(const Stack<T>& other) const noexcept {
+		[[nodiscard]] bool operator!=(const Stack& other) const noexcept {
 			return !(*this == other);
 		}
 
@@ -295,16 +381,15 @@ namespace custom {
 		 * @return - a boolean value indicating whether an element with the data specified exists.
 		 */
 		bool contains(const T& data) const {
-			if (mLength) {
-				Node* cur_node = head;
-				while (cur_node) {
-					if (cur_node->data == data)
-						return true;
-					cur_node = cur_node->next;
-				}
-				return false;
+			tracing::Scope scope(tracing::Operation::Lookup);
+			check<std::runtime_error>(mLength != 0, "Error: stack is empty, cannot check for contents");
+			Node* cur_node = head;
+			while (cur_node) {
+				if (cur_node->data == data)
+					return true;
+				cur_node = cur_node->next;
 			}
-			throw std::runtime_error("Error: stack is empty, cannot check for contents");
+			return false;
 		}
 
 		/**
@@ -313,10 +398,10 @@ namespace custom {
 		 * @param right - a Stack object of type `T` to append to the current stack.
 		 * @return - a copy of the current stack object.
 		 */
-		[[nodiscard]] Stack<T> operator+(Stack<T>& right) noexcept {
+		[[nodiscard]] Stack operator+(Stack& right) noexcept {
 			if (right.mLength) {
 				std::vector<T> right_data = right.contents();
-				Stack<T> res(*this);
+				Stack res(*this);
 				for (size_t i = right_data.size(); i > 0; --i)
 					res.push(right_data[i-1]);
 				return res;
@@ -331,6 +416,7 @@ namespace custom {
 		 * @see <a href="https://en.cppreference.com/w/cpp/container/vector">std::vector</a>
 		 */
 		[[nodiscard]] std::vector<T> contents() const noexcept {
+			tracing::Scope scope(tracing::Operation::Traversal);
 			std::vector<T> elems(mLength);
 			Node* cur_node = head;
 			for (size_t i = 0; i < mLength; ++i) {
@@ -349,14 +435,12 @@ namespace custom {
 		 * @see <a href="https://en.cppreference.com/w/cpp/io/cout">std::cout</a>
 		 */
 		void display() const {
-			if (mLength) {
-				std::vector<T> data = contents();
-				for (const T& i: data) {
-					std::cout << i << "\t";
-				}
-				std::cout << "\n";
-			} else
-				throw std::runtime_error("Error: stack is empty, there is nothing to display");
+			check<std::runtime_error>(mLength != 0, "Error: stack is empty, there is nothing to display");
+			std::vector<T> data = contents();
+			for (const T& i: data) {
+				std::cout << i << "\t";
+			}
+			std::cout << "\n";
 		}
 
 		/**
@@ -368,13 +452,22 @@ namespace custom {
 			Node* cur_node = head;
 			while (cur_node) {
 				cur_node = cur_node->next;
-				delete head;
+				destroy_node(head);
 				head = cur_node;
 			}
 			head = nullptr;
 			mLength = 0;
 		}
 
+		/**
+		 * Returns a copy of the allocator the nodes are allocated with.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - the allocator of the stack.
+		 */
+		[[nodiscard]] Allocator get_allocator() const noexcept {
+			return mAllocator;
+		}
+
 		/**
 		 * Stack destructor which clears the stack and releases any memory allocated for each element.
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the stack.
@@ -388,7 +481,7 @@ namespace custom {
 		/**
 		 * A node structure to contain the data at each element and a pointer to the next node in the stack.
 		 */
-		struct Node {
+		struct Node : allocation_tracking::TrackedNode<ContainerType::Stack> {
 			T data;  /**< The data of type `T` of each element node. */
 			Node* next = nullptr;  /**< A pointer to the next node object in the stack. */
 
@@ -407,7 +500,35 @@ namespace custom {
 
 		Node* head;  /**< A pointer to the node element at the top of the stack, this will be the first element to be removed. */
 		size_t mLength;  /**< An unsigned integer specifying the number of elements in the stack. */
+		[[no_unique_address]] Allocator mAllocator;  /**< The allocator the nodes are allocated with. */
+
+		/**
+		 * Allocates and constructs a node with the allocator of the stack.
+		 * @param data - the data of the node, copied or moved into it.
+		 * @return - a pointer to the new node.
+		 */
+		template<typename Data>
+		Node* create_node(Data&& data) noexcept {
+			return allocation_tracking::create_node<ContainerType::Stack, Node>(mAllocator, std::forward<Data>(data));
+		}
+
+		/**
+		 * Destroys and deallocates a node from create_node().
+		 * @param node - a pointer to the node.
+		 */
+		void destroy_node(Node* node) noexcept {
+			allocation_tracking::destroy_node<ContainerType::Stack>(mAllocator, node);
+		}
 	};
+
+	namespace pmr {
+		/**
+		 * A Stack whose nodes are allocated from a `std::pmr::memory_resource`.
+		 * @tparam T - the type of data to be stored in each node of the stack.
+		 */
+		template<typename T>
+		using Stack = custom::Stack<T, std::pmr::polymorphic_allocator<T>>;
+	}// namespace pmr
 }// namespace custom
 
 #endif// STACK_H
\ No newline at end of file
@@ -0,0 +1,181 @@
+#ifndef DATA_STRUCTURES_CPP_STATICMAP_H
+#define DATA_STRUCTURES_CPP_STATICMAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "MemoryUsage.h"
+
+namespace custom {
+	/**
+	 * A templated map, from keys of type `U` to values of type `T`, whose key-value pairs are fixed when it is
+	 * constructed. The pairs are stored in the object itself, sorted by key, and found by binary search, so the map can
+	 * be built and queried in constant expressions: a `constexpr` StaticMap is placed in the read-only data of the
+	 * program, with no allocation or initialisation at startup, and lookups of keys known at compile time are folded
+	 * into constants. For a string key, `std::string_view` keeps the map usable in constant expressions.
+	 * @tparam U - the type of the keys, which must be move assignable so the pairs can be sorted.
+	 * @tparam T - the type of the values, which must be move assignable so the pairs can be sorted.
+	 * @tparam entries - the number of key-value pairs in the map.
+	 * @tparam Compare - the strict weak ordering of the keys, `std::less<U>` by default.
+	 */
+	template<typename U, typename T, size_t entries, typename Compare = std::less<U>>
+	class StaticMap {
+		static_assert(entries > 0, "A StaticMap must have at least one key-value pair");
+
+	public:
+		using Entry = std::pair<U, T>;  /**< An alias for the key-value pairs of the map. */
+		using Iterator = const Entry*;  /**< An alias for the iterator over the pairs, in the order of their keys. */
+
+	public:
+		/**
+		 * StaticMap constructor which copies the key-value pairs of an array and sorts them by key. If two pairs
+		 * have the same key, an `invalid_argument` exception is thrown, which fails the compilation in a constant
+		 * expression.
+		 * **Time Complexity** = *O(n log(n))* where n is the number of pairs.
+		 * @param init - an array of the key-value pairs of the map, e.g. a braced list of `{key, value}` pairs.
+		 * @param compare - the ordering of the keys.
+		 */
+		constexpr explicit StaticMap(const Entry (& init)[entries], Compare compare = Compare()) :
+				StaticMap(init, compare, std::make_index_sequence<entries>()) {}
+
+		/**
+		 * Obtains the value, of type `T`, at a specified key, of type `U`.
+		 * If the key is not found in the map, an `invalid_argument` exception is thrown, which fails the compilation
+		 * in a constant expression.
+		 * **Time Complexity** = *O(log(n))* where n is the number of pairs.
+		 * @param id - the key of type `U` whose value to return.
+		 * @return - a const reference to the value at the key.
+		 */
+		[[nodiscard]] constexpr const T& at(const U& id) const {
+			const Entry* entry = find_entry(id);
+			if (!entry)
+				throw std::invalid_argument("Id provided not found");
+			return entry->second;
+		}
+
+		/**
+		 * Returns a pointer to the value at a specified key, or `nullptr` if the key is not in the map.
+		 * **Time Complexity** = *O(log(n))* where n is the number of pairs.
+		 * @param id - the key of type `U` to search for.
+		 * @return - a pointer to the value at the key, or `nullptr`.
+		 */
+		[[nodiscard]] constexpr const T* find(const U& id) const noexcept {
+			const Entry* entry = find_entry(id);
+			return entry ? &entry->second : nullptr;
+		}
+
+		/**
+		 * Checks the map to see if an element with the given key exists.
+		 * **Time Complexity** = *O(log(n))* where n is the number of pairs.
+		 * @param id - the key of type `U` to search for.
+		 * @return - a boolean value indicating whether the key is in the map.
+		 */
+		[[nodiscard]] constexpr bool exists(const U& id) const noexcept {
+			return find_entry(id) != nullptr;
+		}
+
+		/**
+		 * Returns the number of key-value pairs in the map.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - an unsigned integer representing the number of pairs.
+		 */
+		[[nodiscard]] constexpr size_t size() const noexcept {
+			return entries;
+		}
+
+		/**
+		 * Returns the key-value pairs of the map, in the order of their keys.
+		 * **Time Complexity** = *O(n)* where n is the number of pairs.
+		 * @return - a `std::vector` of the key-value pairs.
+		 */
+		[[nodiscard]] std::vector<Entry> contents() const {
+			return std::vector<Entry>(begin(), end());
+		}
+
+		/**
+		 * Returns a breakdown of the memory held by the map: the keys and values are the payload, while the rest of
+		 * the object is structural overhead. The map never allocates.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - a MemoryUsage object with the bytes of payload and structure.
+		 */
+		[[nodiscard]] constexpr MemoryUsage memory_usage() const noexcept {
+			MemoryUsage usage;
+			usage.payload = entries * (sizeof(U) + sizeof(T));
+			usage.structure = sizeof(*this) - usage.payload;
+			return usage;
+		}
+
+		/**
+		 * Returns an iterator to the pair with the smallest key.
+		 * @return - a pointer to the first key-value pair.
+		 */
+		constexpr Iterator begin() const noexcept {
+			return pairs;
+		}
+
+		/**
+		 * Returns an iterator past the pair with the largest key.
+		 * @return - a pointer past the last key-value pair.
+		 */
+		constexpr Iterator end() const noexcept {
+			return pairs + entries;
+		}
+
+	private:
+		Entry pairs[entries];  /**< The key-value pairs of the map, sorted by key. */
+		[[no_unique_address]] Compare compare;  /**< The ordering of the keys. */
+
+		/**
+		 * Private constructor which copy-constructs each pair from the array, so the keys and values need not be
+		 * default constructible, then sorts the pairs and checks that their keys are unique.
+		 * **Time Complexity** = *O(n log(n))* where n is the number of pairs.
+		 * @tparam Indices - the indices of the pairs in the array.
+		 * @param init - the array of key-value pairs.
+		 * @param compare - the ordering of the keys.
+		 */
+		template<size_t... Indices>
+		constexpr StaticMap(const Entry (& init)[entries], Compare compare, std::index_sequence<Indices...>) :
+				pairs{init[Indices]...}, compare(compare) {
+			std::sort(pairs, pairs + entries, [this](const Entry& a, const Entry& b) {
+				return this->compare(a.first, b.first);
+			});
+			for (size_t i = 1; i < entries; ++i)
+				if (!this->compare(pairs[i - 1].first, pairs[i].first))
+					throw std::invalid_argument("Duplicate keys provided to the StaticMap");
+		}
+
+		/**
+		 * Private helper function which finds the pair with a given key by binary search.
+		 * **Time Complexity** = *O(log(n))* where n is the number of pairs.
+		 * @param id - the key to search for.
+		 * @return - a pointer to the pair with the key, or `nullptr` if the key is not in the map.
+		 */
+		constexpr const Entry* find_entry(const U& id) const noexcept {
+			const Entry* entry = std::lower_bound(pairs, pairs + entries, id, [this](const Entry& pair, const U& key) {
+				return compare(pair.first, key);
+			});
+			return entry != pairs + entries && !compare(id, entry->first) ? entry : nullptr;
+		}
+	};
+
+	/**
+	 * Creates a StaticMap from a braced list of key-value pairs, deducing the number of pairs, e.g.
+	 * `constexpr auto codes = custom::make_static_map<std::string_view, int>({{"a", 1}, {"b", 2}});`.
+	 * **Time Complexity** = *O(n log(n))* where n is the number of pairs.
+	 * @tparam U - the type of the keys.
+	 * @tparam T - the type of the values.
+	 * @tparam entries - the number of key-value pairs, deduced from the list.
+	 * @param init - the key-value pairs of the map.
+	 * @return - the StaticMap of the pairs.
+	 */
+	template<typename U, typename T, size_t entries>
+	constexpr StaticMap<U, T, entries> make_static_map(const std::pair<U, T> (& init)[entries]) {
+		return StaticMap<U, T, entries>(init);
+	}
+}
+
+#endif//DATA_STRUCTURES_CPP_STATICMAP_H
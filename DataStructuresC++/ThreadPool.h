@@ -0,0 +1,686 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace custom {
+	/**
+	 * A template implementation of the Chase-Lev work-stealing deque. The owning thread pushes and pops elements at
+	 * the bottom of the deque in LIFO order, while any number of other threads may concurrently steal elements from the
+	 * top in FIFO order. The deque is backed by a circular array which grows when full; retired arrays are kept alive
+	 * until the deque is destroyed, as a concurrent thief may still be reading from them.
+	 *
+	 * \note
+	 * The type `T` must be trivially copyable, in practice this is a pointer to a task.
+	 *
+	 * @tparam T - the type of the elements stored in the deque.
+	 * @see <a href="https://dl.acm.org/doi/10.1145/1073970.1073974">Dynamic Circular Work-Stealing Deque</a>
+	 * @see <a href="https://dl.acm.org/doi/10.1145/2442516.2442524">Correct and Efficient Work-Stealing for Weak Memory Models</a>
+	 */
+	template<typename T>
+	class WorkStealingDeque {
+		static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque elements must be trivially copyable");
+
+	public:
+		/**
+		 * Default WorkStealingDeque constructor which allocates a circular array with the capacity specified, rounded
+		 * up to the next power of two.
+		 * @param capacity - an unsigned integer specifying the initial capacity of the deque.
+		 */
+		explicit WorkStealingDeque(size_t capacity = 64) : mTop(0), mBottom(0) {
+			size_t cap = 1;
+			while (cap < capacity)
+				cap <<= 1;
+			mRetired.push_back(std::make_unique<CircularArray>(cap));
+			mArray.store(mRetired.back().get(), std::memory_order_relaxed);
+		}
+
+		WorkStealingDeque(const WorkStealingDeque&) = delete;
+		WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+		/**
+		 * Pushes an element onto the bottom of the deque, growing the underlying array if it is full. This must only
+		 * be called by the thread which owns the deque.
+		 * **Time Complexity** = *O(1)* amortised.
+		 * @param item - the element to push.
+		 */
+		void push(T item) {
+			std::int64_t bottom = mBottom.load(std::memory_order_relaxed);
+			std::int64_t top = mTop.load(std::memory_order_acquire);
+			CircularArray* array = mArray.load(std::memory_order_relaxed);
+			if (bottom - top > static_cast<std::int64_t>(array->capacity()) - 1)
+				array = grow(array, top, bottom);
+			array->put(bottom, item);
+			std::atomic_thread_fence(std::memory_order_release);
+			mBottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		/**
+		 * Pops the most recently pushed element from the bottom of the deque. This must only be called by the thread
+		 * which owns the deque.
+		 * **Time Complexity** = *O(1)*.
+		 * @param item - a reference which receives the popped element on success.
+		 * @return - a boolean value indicating whether an element was popped.
+		 */
+		bool pop(T& item) noexcept {
+			std::int64_t bottom = mBottom.load(std::memory_order_relaxed) - 1;
+			CircularArray* array = mArray.load(std::memory_order_relaxed);
+			mBottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			std::int64_t top = mTop.load(std::memory_order_relaxed);
+			if (top > bottom) {
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+				return false;
+			}
+			item = array->get(bottom);
+			if (top == bottom) {
+				// Last element, race against thieves for it.
+				bool won = mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+				                                        std::memory_order_relaxed);
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+				return won;
+			}
+			return true;
+		}
+
+		/**
+		 * Steals the oldest element from the top of the deque. This may be called by any thread.
+		 * **Time Complexity** = *O(1)*.
+		 * @param item - a reference which receives the stolen element on success.
+		 * @return - a boolean value indicating whether an element was stolen.
+		 */
+		bool steal(T& item) noexcept {
+			std::int64_t top = mTop.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			std::int64_t bottom = mBottom.load(std::memory_order_acquire);
+			if (top >= bottom)
+				return false;
+			CircularArray* array = mArray.load(std::memory_order_acquire);
+			item = array->get(top);
+			return mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		}
+
+		/**
+		 * Provides an approximate number of elements in the deque, which may be stale by the time it is read.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - an unsigned integer approximating the number of elements in the deque.
+		 */
+		[[nodiscard]] size_t size() const noexcept {
+			std::int64_t bottom = mBottom.load(std::memory_order_relaxed);
+			std::int64_t top = mTop.load(std::memory_order_relaxed);
+			return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+		}
+
+		/**
+		 * Provides a boolean value that indicates whether the deque appeared empty when read.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - a boolean value that indicates whether the deque is empty.
+		 */
+		[[nodiscard]] bool empty() const noexcept {
+			return size() == 0;
+		}
+
+		/**
+		 * Returns the capacity of the current underlying circular array.
+		 * **Time Complexity** = *O(1)*.
+		 * @return - an unsigned integer representing the capacity of the deque.
+		 */
+		[[nodiscard]] size_t capacity() const noexcept {
+			return mArray.load(std::memory_order_relaxed)->capacity();
+		}
+
+	private:
+		/**
+		 * A power of two sized circular buffer of atomic slots, indexed by the monotonically increasing top and
+		 * bottom counters of the deque.
+		 */
+		class CircularArray {
+		public:
+			explicit CircularArray(size_t capacity) : mMask(capacity - 1), mSlots(new std::atomic<T>[capacity]) {}
+
+			[[nodiscard]] size_t capacity() const noexcept { return mMask + 1; }
+
+			void put(std::int64_t index, T item) noexcept {
+				mSlots[static_cast<size_t>(index) & mMask].store(item, std::memory_order_relaxed);
+			}
+
+			T get(std::int64_t index) const noexcept {
+				return mSlots[static_cast<size_t>(index) & mMask].load(std::memory_order_relaxed);
+			}
+
+		private:
+			size_t mMask;  /**< The capacity of the array minus one, used to wrap indices. */
+			std::unique_ptr<std::atomic<T>[]> mSlots;  /**< The slots of the circular array. */
+		};
+
+		alignas(64) std::atomic<std::int64_t> mTop;  /**< The index of the oldest element, advanced by thieves. */
+		alignas(64) std::atomic<std::int64_t> mBottom;  /**< The index one past the newest element, owned by the owner thread. */
+		std::atomic<CircularArray*> mArray;  /**< The current circular array backing the deque. */
+		std::vector<std::unique_ptr<CircularArray>> mRetired;  /**< Every array allocated by the deque, freed on destruction. */
+
+		/**
+		 * Allocates a circular array of twice the capacity and copies the live elements across.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the deque.
+		 */
+		CircularArray* grow(CircularArray* array, std::int64_t top, std::int64_t bottom) {
+			mRetired.push_back(std::make_unique<CircularArray>(array->capacity() * 2));
+			CircularArray* bigger = mRetired.back().get();
+			for (std::int64_t i = top; i < bottom; ++i)
+				bigger->put(i, array->get(i));
+			mArray.store(bigger, std::memory_order_release);
+			return bigger;
+		}
+	};
+
+	/**
+	 * A counter of outstanding tasks which a ThreadPool can wait on, providing fork-join synchronisation. Each task
+	 * spawned against the group increments its counter and decrements it once complete. The first exception thrown by
+	 * any task in the group is captured and rethrown by ThreadPool::sync().
+	 */
+	class WaitGroup {
+	public:
+		WaitGroup() noexcept: mPending(0) {}
+
+		WaitGroup(const WaitGroup&) = delete;
+		WaitGroup& operator=(const WaitGroup&) = delete;
+
+		/**
+		 * Increments the number of outstanding tasks in the group.
+		 * @param count - the number of tasks to add.
+		 */
+		void add(size_t count = 1) noexcept {
+			mPending.fetch_add(count, std::memory_order_relaxed);
+		}
+
+		/**
+		 * Marks one outstanding task in the group as complete, waking any blocked waiters if it was the last. The
+		 * last decrement is made under the mutex, which every waiter takes before returning, so a group on the stack
+		 * of a waiter is not destroyed while it is being notified.
+		 */
+		void done() noexcept {
+			size_t pending = mPending.load(std::memory_order_relaxed);
+			while (pending > 1) {
+				if (mPending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel))
+					return;
+			}
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (mPending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				mCondition.notify_all();
+		}
+
+		/**
+		 * Provides the number of tasks in the group which have not yet completed.
+		 * @return - an unsigned integer representing the number of outstanding tasks.
+		 */
+		[[nodiscard]] size_t pending() const noexcept {
+			return mPending.load(std::memory_order_acquire);
+		}
+
+		/**
+		 * Blocks the calling thread, without executing any tasks, until every task in the group has completed.
+		 * \note
+		 * ThreadPool::sync() should be preferred from inside a worker thread, as it helps execute tasks while waiting.
+		 */
+		void wait() {
+			std::unique_lock<std::mutex> lock(mMutex);
+			mCondition.wait(lock, [this] { return pending() == 0; });
+		}
+
+	private:
+		friend class ThreadPool;
+
+		std::atomic<size_t> mPending;  /**< The number of outstanding tasks in the group. */
+		std::mutex mMutex;  /**< A mutex guarding the condition variable and the captured exception. */
+		std::condition_variable mCondition;  /**< Notified when the number of outstanding tasks reaches zero. */
+		std::exception_ptr mException;  /**< The first exception thrown by a task in the group. */
+
+		void capture(std::exception_ptr exception) noexcept {
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (!mException)
+				mException = std::move(exception);
+		}
+
+		void rethrow() {
+			std::exception_ptr exception;
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				std::swap(exception, mException);
+			}
+			if (exception)
+				std::rethrow_exception(exception);
+		}
+	};
+
+	/**
+	 * An enum of the CPU affinity strategies a ThreadPool can apply to its worker threads.
+	 * **None** leaves the scheduling of workers to the operating system.
+	 * **Compact** pins worker i to logical CPU i, wrapping around when there are more workers than CPUs.
+	 * **Custom** pins worker i to the i-th entry of ThreadPoolOptions::cpus, wrapping around the list.
+	 */
+	enum class Affinity : unsigned int {
+		None = 0U,
+		Compact,
+		Custom
+	};
+
+	/**
+	 * Configuration options used to construct a ThreadPool.
+	 */
+	struct ThreadPoolOptions {
+		size_t threads = 0;  /**< The number of worker threads, 0 uses `std::thread::hardware_concurrency()`. */
+		Affinity affinity = Affinity::None;  /**< The CPU affinity strategy applied to the workers. */
+		std::vector<unsigned int> cpus = {};  /**< The logical CPUs used by the `Custom` affinity strategy. */
+	};
+
+	/**
+	 * A work-stealing thread pool for fork-join parallelism. Every worker thread owns a WorkStealingDeque, tasks
+	 * spawned from a worker are pushed onto its own deque and idle workers steal from the deques of others. Tasks
+	 * spawned from outside the pool go through a shared injection queue. Waiting on a WaitGroup from a worker executes
+	 * other tasks in the meantime, so nested parallelism does not deadlock.
+	 *
+	 * \note
+	 * Exceptions thrown from tasks spawned against a WaitGroup are rethrown by sync(), while an exception escaping a
+	 * detached task will terminate the program.
+	 *
+	 * @see <a href="https://en.wikipedia.org/wiki/Work_stealing">Work stealing</a>
+	 */
+	class ThreadPool {
+	public:
+		/**
+		 * Default ThreadPool constructor which starts one worker per hardware thread with no CPU affinity.
+		 */
+		ThreadPool() : ThreadPool(ThreadPoolOptions{}) {}
+
+		/**
+		 * Overloaded ThreadPool constructor which starts the number of workers specified.
+		 * This constructor is explicit, meaning implicit conversion is not supported.
+		 * @param threads - the number of worker threads, 0 uses `std::thread::hardware_concurrency()`.
+		 * @param affinity - the CPU affinity strategy applied to the workers.
+		 */
+		explicit ThreadPool(size_t threads, Affinity affinity = Affinity::None) :
+				ThreadPool(ThreadPoolOptions{threads, affinity, {}}) {}
+
+		/**
+		 * Overloaded ThreadPool constructor which starts the workers as described by the options provided. If the
+		 * `Custom` affinity is requested without any CPUs, an `invalid_argument` exception is thrown.
+		 * @param options - the configuration of the pool.
+		 */
+		explicit ThreadPool(const ThreadPoolOptions& options) : mStop(false), mSleepers(0), mOutstanding(0) {
+			if (options.affinity == Affinity::Custom && options.cpus.empty())
+				throw std::invalid_argument("Custom thread affinity requires at least one CPU");
+			size_t threads = options.threads;
+			if (threads == 0)
+				threads = std::max(1U, std::thread::hardware_concurrency());
+			mWorkers.reserve(threads);
+			for (size_t i = 0; i < threads; ++i) {
+				mWorkers.push_back(std::make_unique<Worker>());
+				mWorkers[i]->seed *= i + 1;  // Distinct seeds, so the workers probe different victims
+			}
+			for (size_t i = 0; i < threads; ++i) {
+				mWorkers[i]->thread = std::thread([this, i] { worker_loop(i); });
+				apply_affinity(mWorkers[i]->thread, i, options);
+			}
+		}
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		/**
+		 * Schedules a detached task on the pool. The task is pushed onto the calling worker's own deque, or the
+		 * injection queue if called from outside the pool.
+		 * **Time Complexity** = *O(1)* amortised.
+		 * @tparam Function - the type of the callable, invocable with no arguments.
+		 * @param function - the callable to execute.
+		 */
+		template<typename Function>
+		void spawn(Function&& function) {
+			submit(new Task(std::forward<Function>(function), nullptr));
+		}
+
+		/**
+		 * Schedules a task on the pool which is tracked by the WaitGroup provided, allowing it to be joined with sync().
+		 * **Time Complexity** = *O(1)* amortised.
+		 * @tparam Function - the type of the callable, invocable with no arguments.
+		 * @param group - the WaitGroup tracking the task.
+		 * @param function - the callable to execute.
+		 */
+		template<typename Function>
+		void spawn(WaitGroup& group, Function&& function) {
+			group.add();
+			submit(new Task(std::forward<Function>(function), &group));
+		}
+
+		/**
+		 * Waits until every task tracked by the WaitGroup has completed. A worker thread executes other pending tasks
+		 * while it waits, whereas a thread outside the pool blocks. If any of the tasks threw an exception, the first
+		 * one captured is rethrown.
+		 * @param group - the WaitGroup to wait on.
+		 */
+		void sync(WaitGroup& group) {
+			Worker* self = current_worker();
+			if (self) {
+				while (group.pending()) {
+					if (!run_one(self))
+						std::this_thread::yield();
+				}
+			} else
+				group.wait();
+			group.rethrow();
+		}
+
+		/**
+		 * Invokes the body over the index range [first, last), recursively splitting it into halves executed in
+		 * parallel until each piece contains at most `grain` indices. The body is either invoked with a sub-range
+		 * as `body(begin, end)` or, if it only accepts a single index, once per index as `body(i)`.
+		 * **Time Complexity** = *O(n / p + log(n / grain))* where n is the size of the range and p the number of workers.
+		 * @tparam Body - the type of the callable, invocable with one or two `size_t` arguments.
+		 * @param first - the first index of the range.
+		 * @param last - the index past the end of the range.
+		 * @param grain - the maximum number of indices executed sequentially by one task, 0 picks a default.
+		 * @param body - the callable to execute.
+		 */
+		template<typename Body>
+		void parallel_for(size_t first, size_t last, size_t grain, Body&& body) {
+			if (first >= last)
+				return;
+			if (grain == 0)
+				grain = std::max<size_t>(1, (last - first) / (8 * size()));
+			WaitGroup group;
+			split_range(group, first, last, grain, body);
+			sync(group);
+		}
+
+		/**
+		 * Invokes the body over the index range [first, last) with a default grain size.
+		 * @see parallel_for(size_t, size_t, size_t, Body&&)
+		 */
+		template<typename Body>
+		void parallel_for(size_t first, size_t last, Body&& body) {
+			parallel_for(first, last, 0, std::forward<Body>(body));
+		}
+
+		/**
+		 * Blocks the calling thread until every task submitted to the pool, including detached ones, has completed.
+		 * When called from a worker, the task calling it is not waited on.
+		 */
+		void wait_idle() {
+			Worker* self = current_worker();
+			if (self) {
+				while (mOutstanding.load(std::memory_order_acquire) > (self->running ? 1U : 0U)) {
+					if (!run_one(self))
+						std::this_thread::yield();
+				}
+				return;
+			}
+			std::unique_lock<std::mutex> lock(mIdleMutex);
+			mIdleCondition.wait(lock, [this] { return mOutstanding.load(std::memory_order_acquire) == 0; });
+		}
+
+		/**
+		 * Returns the number of worker threads in the pool.
+		 * @return - an unsigned integer representing the number of workers.
+		 */
+		[[nodiscard]] size_t size() const noexcept {
+			return mWorkers.size();
+		}
+
+		/**
+		 * Returns the index of the calling worker thread within this pool, or `size()` if the calling thread is not
+		 * one of its workers.
+		 * @return - an unsigned integer representing the index of the current worker.
+		 */
+		[[nodiscard]] size_t worker_index() const noexcept {
+			const Context& context = this_context();
+			return context.pool == this ? context.index : size();
+		}
+
+		/**
+		 * ThreadPool destructor which waits for all submitted tasks to complete, then stops and joins the workers.
+		 */
+		~ThreadPool() {
+			wait_idle();
+			{
+				std::lock_guard<std::mutex> lock(mSleepMutex);
+				mStop.store(true, std::memory_order_release);
+			}
+			mSleepCondition.notify_all();
+			for (auto& worker: mWorkers)
+				worker->thread.join();
+		}
+
+	private:
+		/**
+		 * A heap allocated unit of work, holding the type erased callable and the WaitGroup it belongs to.
+		 */
+		struct Task {
+			std::function<void()> function;  /**< The callable executed by the task. */
+			WaitGroup* group;  /**< The WaitGroup tracking the task, or `nullptr` for detached tasks. */
+
+			template<typename Function>
+			Task(Function&& function, WaitGroup* group) : function(std::forward<Function>(function)), group(group) {}
+		};
+
+		/**
+		 * The state owned by each worker thread.
+		 */
+		struct Worker {
+			WorkStealingDeque<Task*> deque;  /**< The worker's deque of tasks, stolen from by other workers. */
+			std::thread thread;  /**< The worker's thread. */
+			std::uint64_t seed = 0x9E3779B97F4A7C15ULL;  /**< The state of the random number generator picking victims, scaled by the index of the worker. */
+			bool running = false;  /**< Whether the worker is currently executing a task. */
+		};
+
+		/**
+		 * Thread local record of the pool and worker index the current thread belongs to.
+		 */
+		struct Context {
+			const ThreadPool* pool = nullptr;
+			size_t index = 0;
+		};
+
+		std::vector<std::unique_ptr<Worker>> mWorkers;  /**< The workers of the pool. */
+		std::mutex mInjectionMutex;  /**< A mutex guarding the injection queue. */
+		std::deque<Task*> mInjection;  /**< Tasks submitted from threads outside the pool. */
+		std::atomic<size_t> mInjected{0};  /**< The number of tasks in the injection queue, read without locking. */
+		std::mutex mSleepMutex;  /**< A mutex guarding the sleep condition variable. */
+		std::condition_variable mSleepCondition;  /**< Notified when work is submitted while workers are asleep. */
+		std::atomic<bool> mStop;  /**< Set when the pool is being destroyed. */
+		std::atomic<size_t> mSleepers;  /**< The number of workers currently asleep. */
+		std::atomic<size_t> mOutstanding;  /**< The number of tasks submitted but not yet completed. */
+		std::mutex mIdleMutex;  /**< A mutex guarding the idle condition variable. */
+		std::condition_variable mIdleCondition;  /**< Notified when the number of outstanding tasks reaches zero. */
+
+		static Context& this_context() noexcept {
+			thread_local Context context;
+			return context;
+		}
+
+		Worker* current_worker() const noexcept {
+			const Context& context = this_context();
+			return context.pool == this ? mWorkers[context.index].get() : nullptr;
+		}
+
+		/**
+		 * Pushes a task onto the calling worker's deque, or the injection queue, and wakes a sleeping worker.
+		 */
+		void submit(Task* task) {
+			mOutstanding.fetch_add(1, std::memory_order_relaxed);
+			if (Worker* self = current_worker())
+				self->deque.push(task);
+			else {
+				std::lock_guard<std::mutex> lock(mInjectionMutex);
+				mInjection.push_back(task);
+				mInjected.fetch_add(1, std::memory_order_relaxed);
+			}
+			// Pairs with the fence in worker_loop() so either the sleeper sees the task or we see the sleeper.
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (mSleepers.load(std::memory_order_relaxed)) {
+				std::lock_guard<std::mutex> lock(mSleepMutex);
+				mSleepCondition.notify_one();
+			}
+		}
+
+		/**
+		 * Finds a task to run, first from the worker's own deque, then the injection queue and finally by stealing
+		 * from a random victim.
+		 */
+		Task* find_task(Worker* self) noexcept {
+			Task* task = nullptr;
+			if (self && self->deque.pop(task))
+				return task;
+			if (mInjected.load(std::memory_order_relaxed)) {
+				std::lock_guard<std::mutex> lock(mInjectionMutex);
+				if (!mInjection.empty()) {
+					task = mInjection.front();
+					mInjection.pop_front();
+					mInjected.fetch_sub(1, std::memory_order_relaxed);
+					return task;
+				}
+			}
+			size_t count = mWorkers.size();
+			std::uint64_t seed = self ? self->seed : reinterpret_cast<std::uintptr_t>(&task);
+			size_t start = static_cast<size_t>(next_random(seed) % count);
+			if (self)
+				self->seed = seed;
+			for (size_t i = 0; i < count; ++i) {
+				Worker* victim = mWorkers[(start + i) % count].get();
+				if (victim != self && victim->deque.steal(task))
+					return task;
+			}
+			return nullptr;
+		}
+
+		bool has_work() const noexcept {
+			if (mInjected.load(std::memory_order_relaxed))
+				return true;
+			for (const auto& worker: mWorkers) {
+				if (!worker->deque.empty())
+					return true;
+			}
+			return false;
+		}
+
+		/**
+		 * Attempts to find and execute a single task.
+		 * @return - a boolean value indicating whether a task was executed.
+		 */
+		bool run_one(Worker* self) {
+			Task* task = find_task(self);
+			if (!task)
+				return false;
+			execute(self, task);
+			return true;
+		}
+
+		void execute(Worker* self, Task* task) {
+			bool was_running = self ? self->running : false;
+			if (self)
+				self->running = true;
+			if (task->group) {
+				try {
+					task->function();
+				} catch (...) {
+					task->group->capture(std::current_exception());
+				}
+				task->group->done();
+			} else
+				task->function();
+			delete task;
+			if (self)
+				self->running = was_running;
+			if (mOutstanding.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				std::lock_guard<std::mutex> lock(mIdleMutex);
+				mIdleCondition.notify_all();
+			}
+		}
+
+		void worker_loop(size_t index) {
+			this_context() = Context{this, index};
+			Worker* self = mWorkers[index].get();
+			size_t failures = 0;
+			while (true) {
+				if (run_one(self)) {
+					failures = 0;
+					continue;
+				}
+				if (++failures < 128) {
+					std::this_thread::yield();
+					continue;
+				}
+				std::unique_lock<std::mutex> lock(mSleepMutex);
+				if (mStop.load(std::memory_order_acquire))
+					break;
+				mSleepers.fetch_add(1, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (!has_work())
+					mSleepCondition.wait(lock);
+				mSleepers.fetch_sub(1, std::memory_order_relaxed);
+				failures = 0;
+			}
+		}
+
+		template<typename Body>
+		void split_range(WaitGroup& group, size_t first, size_t last, size_t grain, Body& body) {
+			while (last - first > grain) {
+				size_t middle = first + (last - first) / 2;
+				spawn(group, [this, &group, middle, last, grain, &body] {
+					split_range(group, middle, last, grain, body);
+				});
+				last = middle;
+			}
+			if constexpr (std::is_invocable_v<Body&, size_t, size_t>)
+				body(first, last);
+			else {
+				for (size_t i = first; i < last; ++i)
+					body(i);
+			}
+		}
+
+		static std::uint64_t next_random(std::uint64_t& state) noexcept {
+			// xorshift64*
+			state ^= state >> 12;
+			state ^= state << 25;
+			state ^= state >> 27;
+			return state * 0x2545F4914F6CDD1DULL;
+		}
+
+		static void apply_affinity(std::thread& thread, size_t index, const ThreadPoolOptions& options) noexcept {
+#if defined(__linux__)
+			if (options.affinity == Affinity::None)
+				return;
+			unsigned int cpus = std::max(1U, std::thread::hardware_concurrency());
+			unsigned int cpu = options.affinity == Affinity::Compact ? static_cast<unsigned int>(index % cpus)
+			                                                          : options.cpus[index % options.cpus.size()];
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			CPU_SET(cpu, &set);
+			pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &set);
+#else
+			(void)thread;
+			(void)index;
+			(void)options;
+#endif
+		}
+	};
+}// namespace custom
+
+#endif// THREAD_POOL_H
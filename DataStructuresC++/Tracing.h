@@ -0,0 +1,533 @@
+#ifndef TRACING_H
+#define TRACING_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#if defined(CUSTOM_TRACE_TSC) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define CUSTOM_TRACE_CLOCK_TSC
+#elif defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+#define CUSTOM_TRACE_CLOCK_MONOTONIC
+#endif
+
+namespace custom {
+	/**
+	 * Opt-in latency tracing of the operations of the containers, enabled by defining `CUSTOM_TRACE_OPERATIONS` on the
+	 * command line of every translation unit of the program. The containers time their operations with a Scope, and
+	 * each sampled operation is recorded in a log-bucketed histogram of its operation type, kept per thread and merged
+	 * when read with snapshot(). An exporter callback can be installed to pass the snapshots to a metrics system.
+	 *
+	 * Operations are timed with `clock_gettime(CLOCK_MONOTONIC)`, or with the time-stamp counter on x86 if
+	 * `CUSTOM_TRACE_TSC` is also defined, which is cheaper to read and converted to nanoseconds when a snapshot is
+	 * taken. When `CUSTOM_TRACE_OPERATIONS` is not defined, Scope is an empty class and the containers compile to
+	 * exactly the same code as without it.
+	 */
+	namespace tracing {
+#ifdef CUSTOM_TRACE_OPERATIONS
+		inline constexpr bool enabled = true;  /**< Whether operations are being traced. */
+#else
+		inline constexpr bool enabled = false;  /**< Whether operations are being traced. */
+#endif
+
+		/**
+		 * The types of operation which are traced, each of which has a histogram of its own.
+		 */
+		enum class Operation {
+			Insert,  /**< Adding an element. */
+			Lookup,  /**< Finding or accessing an element by key, value or position. */
+			Erase,  /**< Removing an element. */
+			Grow,  /**< Moving the elements of an array into a block of a different size. */
+			Rehash,  /**< Redistributing the elements of a hash table over a different number of buckets. */
+			Traversal  /**< Visiting every element, e.g. to copy them out or print them. */
+		};
+
+		inline constexpr size_t operations = static_cast<size_t>(Operation::Traversal) + 1;  /**< The number of operation types traced. */
+
+		/**
+		 * Returns the name of an operation type, as shown in the report.
+		 * @param operation - the operation type.
+		 * @return - a string literal with the name of the operation type.
+		 */
+		constexpr const char* name(Operation operation) noexcept {
+			constexpr const char* names[operations] = {"Insert", "Lookup", "Erase", "Grow", "Rehash", "Traversal"};
+			return names[static_cast<size_t>(operation)];
+		}
+
+		namespace detail {
+			class ThreadHistogram;
+		}
+
+		/**
+		 * A histogram of latencies with log-bucketed precision, in the style of HdrHistogram: every power of two is
+		 * split into 16 linear sub-buckets, so a recorded value is known to within 1/16 of itself across the whole
+		 * range of 64-bit values, in under 8 KiB of counters.
+		 */
+		class Histogram {
+		public:
+			static constexpr unsigned sub_bucket_bits = 4;  /**< The base 2 logarithm of the number of sub-buckets per power of two. */
+			static constexpr size_t sub_buckets = size_t{1} << sub_bucket_bits;  /**< The number of sub-buckets per power of two. */
+			static constexpr size_t buckets = sub_buckets * (64 - sub_bucket_bits) + sub_buckets;  /**< The number of buckets covering every 64-bit value. */
+
+			/**
+			 * Returns the index of the bucket a value is counted in. Values below 32 have a bucket each.
+			 * **Time Complexity** = *O(1)*.
+			 * @param value - the value to find the bucket of.
+			 * @return - the index of the bucket.
+			 */
+			static constexpr size_t bucket_index(std::uint64_t value) noexcept {
+				if (value < 2 * sub_buckets)
+					return static_cast<size_t>(value);
+				unsigned shift = std::bit_width(value) - 1 - sub_bucket_bits;
+				return sub_buckets * shift + static_cast<size_t>(value >> shift);
+			}
+
+			/**
+			 * Returns the smallest value counted in a bucket.
+			 * **Time Complexity** = *O(1)*.
+			 * @param index - the index of the bucket.
+			 * @return - the lowest value of the bucket.
+			 */
+			static constexpr std::uint64_t bucket_value(size_t index) noexcept {
+				if (index < 2 * sub_buckets)
+					return index;
+				size_t shift = index / sub_buckets - 1;
+				return static_cast<std::uint64_t>(index - sub_buckets * shift) << shift;
+			}
+
+			/**
+			 * Records a value.
+			 * **Time Complexity** = *O(1)*.
+			 * @param value - the value to record.
+			 * @param count - the number of times to record it.
+			 */
+			void record(std::uint64_t value, std::uint64_t count = 1) noexcept {
+				counts[bucket_index(value)] += count;
+				mCount += count;
+				mSum += value * count;
+				mMin = std::min(mMin, value);
+				mMax = std::max(mMax, value);
+			}
+
+			/**
+			 * Adds the values recorded in another histogram to this one.
+			 * **Time Complexity** = *O(b)* where b is the number of buckets.
+			 * @param other - the histogram to add.
+			 */
+			void merge(const Histogram& other) noexcept {
+				for (size_t i = 0; i < buckets; ++i)
+					counts[i] += other.counts[i];
+				mCount += other.mCount;
+				mSum += other.mSum;
+				mMin = std::min(mMin, other.mMin);
+				mMax = std::max(mMax, other.mMax);
+			}
+
+			/**
+			 * Returns the number of values recorded.
+			 * @return - an unsigned integer representing the number of values recorded.
+			 */
+			[[nodiscard]] std::uint64_t count() const noexcept {
+				return mCount;
+			}
+
+			/**
+			 * Returns the smallest value recorded, exactly.
+			 * @return - the smallest value, or 0 if nothing was recorded.
+			 */
+			[[nodiscard]] std::uint64_t min() const noexcept {
+				return mCount ? mMin : 0;
+			}
+
+			/**
+			 * Returns the largest value recorded, exactly.
+			 * @return - the largest value, or 0 if nothing was recorded.
+			 */
+			[[nodiscard]] std::uint64_t max() const noexcept {
+				return mMax;
+			}
+
+			/**
+			 * Returns the mean of the values recorded, exactly.
+			 * @return - the mean, or 0 if nothing was recorded.
+			 */
+			[[nodiscard]] double mean() const noexcept {
+				return mCount ? static_cast<double>(mSum) / static_cast<double>(mCount) : 0.0;
+			}
+
+			/**
+			 * Returns the value below which a given percentage of the values recorded lie, to within the precision of
+			 * the buckets. The middle of the bucket is returned, clamped to the smallest and largest values recorded.
+			 * **Time Complexity** = *O(b)* where b is the number of buckets.
+			 * @param percentile - the percentage, between 0 and 100, e.g. 99 for the p99 latency.
+			 * @return - the value at the percentile, or 0 if nothing was recorded.
+			 */
+			[[nodiscard]] std::uint64_t value_at_percentile(double percentile) const noexcept {
+				if (!mCount)
+					return 0;
+				percentile = std::clamp(percentile, 0.0, 100.0);
+				auto rank = static_cast<std::uint64_t>(percentile / 100.0 * static_cast<double>(mCount) + 0.5);
+				rank = std::clamp<std::uint64_t>(rank, 1, mCount);
+				std::uint64_t seen = 0;
+				for (size_t i = 0; i < buckets; ++i) {
+					seen += counts[i];
+					if (seen >= rank) {
+						std::uint64_t low = bucket_value(i);
+						std::uint64_t high = i + 1 < buckets ? bucket_value(i + 1) - 1
+						                                     : std::numeric_limits<std::uint64_t>::max();
+						return std::clamp(low + (high - low) / 2, min(), mMax);
+					}
+				}
+				return mMax;
+			}
+
+			/**
+			 * Returns the number of values counted in a bucket.
+			 * @param index - the index of the bucket.
+			 * @return - the count of the bucket.
+			 */
+			[[nodiscard]] std::uint64_t bucket_count(size_t index) const noexcept {
+				return counts[index];
+			}
+
+		private:
+			friend class detail::ThreadHistogram;
+
+			std::array<std::uint64_t, buckets> counts{};  /**< The number of values counted in each bucket. */
+			std::uint64_t mCount = 0;  /**< The number of values recorded. */
+			std::uint64_t mSum = 0;  /**< The sum of the values recorded. */
+			std::uint64_t mMin = std::numeric_limits<std::uint64_t>::max();  /**< The smallest value recorded. */
+			std::uint64_t mMax = 0;  /**< The largest value recorded. */
+		};
+
+		/**
+		 * The histograms of every operation type, merged over every thread, as taken by snapshot().
+		 */
+		struct Snapshot {
+			std::array<Histogram, operations> histograms;  /**< The histogram of each operation type, in ticks of the clock. */
+			double nanoseconds_per_tick = 1.0;  /**< The length of a tick of the clock in nanoseconds, 1 unless the time-stamp counter is used. */
+			std::uint32_t sample_rate = 1;  /**< One operation in this many was timed. */
+
+			/**
+			 * Provides the histogram of an operation type.
+			 * @param operation - the operation type.
+			 * @return - a const reference to the histogram, in ticks of the clock.
+			 */
+			const Histogram& operator[](Operation operation) const noexcept {
+				return histograms[static_cast<size_t>(operation)];
+			}
+
+			/**
+			 * Returns the latency of an operation type at a percentile, in nanoseconds.
+			 * @param operation - the operation type.
+			 * @param percentile - the percentage, between 0 and 100, e.g. 50 for the median latency.
+			 * @return - the latency at the percentile in nanoseconds, or 0 if no operation of the type was timed.
+			 */
+			[[nodiscard]] double percentile_ns(Operation operation, double percentile) const noexcept {
+				return static_cast<double>((*this)[operation].value_at_percentile(percentile)) * nanoseconds_per_tick;
+			}
+		};
+
+		using Exporter = std::function<void(const Snapshot&)>;  /**< A callback passed the snapshots to export. */
+
+		namespace detail {
+			// Reads the clock, in ticks
+			inline std::uint64_t now() noexcept {
+#if defined(CUSTOM_TRACE_CLOCK_TSC)
+				return __rdtsc();
+#elif defined(CUSTOM_TRACE_CLOCK_MONOTONIC)
+				timespec time{};
+				clock_gettime(CLOCK_MONOTONIC, &time);
+				return static_cast<std::uint64_t>(time.tv_sec) * 1000000000U + static_cast<std::uint64_t>(time.tv_nsec);
+#else
+				return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+						std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+			}
+
+			// A histogram written by its own thread only and read by any, so its counters are relaxed atomics which
+			// compile to plain loads and stores
+			class ThreadHistogram {
+			public:
+				void record(std::uint64_t value) noexcept {
+					increment(counts[Histogram::bucket_index(value)], 1);
+					increment(count, 1);
+					increment(sum, value);
+					if (value < min.load(std::memory_order_relaxed))
+						min.store(value, std::memory_order_relaxed);
+					if (value > max.load(std::memory_order_relaxed))
+						max.store(value, std::memory_order_relaxed);
+				}
+
+				void add_to(Histogram& histogram) const noexcept;
+
+				void reset() noexcept {
+					for (std::atomic<std::uint64_t>& bucket: counts)
+						bucket.store(0, std::memory_order_relaxed);
+					count.store(0, std::memory_order_relaxed);
+					sum.store(0, std::memory_order_relaxed);
+					min.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+					max.store(0, std::memory_order_relaxed);
+				}
+
+			private:
+				static void increment(std::atomic<std::uint64_t>& counter, std::uint64_t amount) noexcept {
+					counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+				}
+
+				std::array<std::atomic<std::uint64_t>, Histogram::buckets> counts{};
+				std::atomic<std::uint64_t> count{0};
+				std::atomic<std::uint64_t> sum{0};
+				std::atomic<std::uint64_t> min{std::numeric_limits<std::uint64_t>::max()};
+				std::atomic<std::uint64_t> max{0};
+			};
+
+			struct ThreadBuffer;
+
+			// The number of operations until the next one sampled on this thread, kept apart from the thread buffer
+			// as it is constant-initialised, so operations which are not sampled need no initialisation check
+			inline thread_local std::uint32_t countdown = 1;
+
+			// Every live thread buffer, and the histograms of the threads which have exited
+			struct Registry {
+				std::mutex mutex;
+				std::vector<ThreadBuffer*> buffers;
+				std::array<Histogram, operations> retired;
+				Exporter exporter;
+				std::atomic<std::uint32_t> sample_rate{1};
+				// The reference points the time-stamp counter is calibrated against
+				std::uint64_t start_ticks = now();
+				std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+				static Registry& instance() {
+					static Registry registry;
+					return registry;
+				}
+			};
+
+			// The histograms of one thread, which registers itself on first use and hands its histograms over when
+			// the thread exits
+			struct ThreadBuffer {
+				std::array<ThreadHistogram, operations> histograms;
+
+				ThreadBuffer() {
+					Registry& registry = Registry::instance();
+					std::lock_guard<std::mutex> lock(registry.mutex);
+					registry.buffers.push_back(this);
+				}
+
+				~ThreadBuffer() {
+					Registry& registry = Registry::instance();
+					std::lock_guard<std::mutex> lock(registry.mutex);
+					for (size_t i = 0; i < operations; ++i)
+						histograms[i].add_to(registry.retired[i]);
+					registry.buffers.erase(std::find(registry.buffers.begin(), registry.buffers.end(), this));
+				}
+
+				static ThreadBuffer& local() {
+					thread_local ThreadBuffer buffer;
+					return buffer;
+				}
+			};
+
+			inline void ThreadHistogram::add_to(Histogram& histogram) const noexcept {
+				std::uint64_t recorded = count.load(std::memory_order_relaxed);
+				if (!recorded)
+					return;
+				for (size_t i = 0; i < Histogram::buckets; ++i)
+					histogram.counts[i] += counts[i].load(std::memory_order_relaxed);
+				histogram.mCount += recorded;
+				histogram.mSum += sum.load(std::memory_order_relaxed);
+				histogram.mMin = std::min(histogram.mMin, min.load(std::memory_order_relaxed));
+				histogram.mMax = std::max(histogram.mMax, max.load(std::memory_order_relaxed));
+			}
+
+			// Measures the length of a tick of the clock against the steady clock, over the life of the program
+			inline double nanoseconds_per_tick(const Registry& registry) noexcept {
+#if defined(CUSTOM_TRACE_CLOCK_TSC)
+				std::uint64_t ticks = now() - registry.start_ticks;
+				auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() -
+				                                                        registry.start_time).count();
+				return ticks ? elapsed / static_cast<double>(ticks) : 1.0;
+#else
+				static_cast<void>(registry);
+				return 1.0;
+#endif
+			}
+		}
+
+		/**
+		 * Sets the rate at which operations are sampled: one operation in every `rate` is timed, on each thread. A
+		 * rate of 1, the default, times every operation.
+		 * **Time Complexity** = *O(1)*.
+		 * @param rate - the sampling rate, a rate of 0 is treated as 1.
+		 */
+		inline void set_sample_rate(std::uint32_t rate) noexcept {
+			if constexpr (enabled)
+				detail::Registry::instance().sample_rate.store(std::max<std::uint32_t>(rate, 1),
+				                                               std::memory_order_relaxed);
+		}
+
+		/**
+		 * Returns the rate at which operations are sampled.
+		 * @return - one operation in this many is timed.
+		 */
+		inline std::uint32_t sample_rate() noexcept {
+			if constexpr (enabled)
+				return detail::Registry::instance().sample_rate.load(std::memory_order_relaxed);
+			return 1;
+		}
+
+		/**
+		 * Merges the histograms of every thread, including the threads which have exited, into a snapshot. Threads
+		 * keep recording while the snapshot is taken, so the snapshot may miss their latest operations. Without
+		 * `CUSTOM_TRACE_OPERATIONS` every histogram is empty.
+		 * **Time Complexity** = *O(t * b)* where t is the number of threads and b the number of buckets.
+		 * @return - the snapshot of the histograms.
+		 */
+		inline Snapshot snapshot() {
+			Snapshot result;
+			if constexpr (enabled) {
+				detail::Registry& registry = detail::Registry::instance();
+				std::lock_guard<std::mutex> lock(registry.mutex);
+				result.histograms = registry.retired;
+				for (const detail::ThreadBuffer* buffer: registry.buffers) {
+					for (size_t i = 0; i < operations; ++i)
+						buffer->histograms[i].add_to(result.histograms[i]);
+				}
+				result.nanoseconds_per_tick = detail::nanoseconds_per_tick(registry);
+				result.sample_rate = registry.sample_rate.load(std::memory_order_relaxed);
+			}
+			return result;
+		}
+
+		/**
+		 * Clears the histograms of every thread, e.g. after exporting them. Operations recorded by other threads while
+		 * the histograms are cleared may be lost.
+		 * **Time Complexity** = *O(t * b)* where t is the number of threads and b the number of buckets.
+		 */
+		inline void reset() {
+			if constexpr (enabled) {
+				detail::Registry& registry = detail::Registry::instance();
+				std::lock_guard<std::mutex> lock(registry.mutex);
+				registry.retired = {};
+				for (detail::ThreadBuffer* buffer: registry.buffers) {
+					for (detail::ThreadHistogram& histogram: buffer->histograms)
+						histogram.reset();
+				}
+			}
+		}
+
+		/**
+		 * Installs the callback which export_snapshot() passes the snapshots to, replacing any previous one.
+		 * @param exporter - the callback, or an empty function to remove it.
+		 */
+		inline void set_exporter(Exporter exporter) {
+			if constexpr (enabled) {
+				detail::Registry& registry = detail::Registry::instance();
+				std::lock_guard<std::mutex> lock(registry.mutex);
+				registry.exporter = std::move(exporter);
+			}
+		}
+
+		/**
+		 * Takes a snapshot and passes it to the exporter, if one is installed, e.g. from a timer of the application.
+		 * The histograms are cleared afterwards if `reset_after` is `true`, so each export covers one interval.
+		 * @param reset_after - whether to clear the histograms after exporting them.
+		 */
+		inline void export_snapshot(bool reset_after = false) {
+			if constexpr (enabled) {
+				Exporter exporter;
+				{
+					detail::Registry& registry = detail::Registry::instance();
+					std::lock_guard<std::mutex> lock(registry.mutex);
+					exporter = registry.exporter;
+				}
+				if (exporter)
+					exporter(snapshot());
+				if (reset_after)
+					reset();
+			}
+		}
+
+		/**
+		 * Writes a table of the latencies of every operation type which has been timed, one row per type.
+		 * @param out - the stream to write the table to, `std::cout` by default.
+		 */
+		inline void report(std::ostream& out = std::cout) {
+			if constexpr (!enabled) {
+				out << "Tracing is disabled, define CUSTOM_TRACE_OPERATIONS to enable it\n";
+			} else {
+				Snapshot data = snapshot();
+				out << std::left << std::setw(12) << "Operation" << std::right << std::setw(12) << "Samples"
+				    << std::setw(12) << "Mean (ns)" << std::setw(12) << "p50 (ns)" << std::setw(12) << "p90 (ns)"
+				    << std::setw(12) << "p99 (ns)" << std::setw(12) << "Max (ns)" << '\n';
+				for (size_t i = 0; i < operations; ++i) {
+					auto operation = static_cast<Operation>(i);
+					const Histogram& histogram = data[operation];
+					if (!histogram.count())
+						continue;
+					out << std::left << std::setw(12) << name(operation) << std::right << std::setw(12)
+					    << histogram.count() << std::fixed << std::setprecision(0) << std::setw(12)
+					    << histogram.mean() * data.nanoseconds_per_tick << std::setw(12)
+					    << data.percentile_ns(operation, 50) << std::setw(12) << data.percentile_ns(operation, 90)
+					    << std::setw(12) << data.percentile_ns(operation, 99) << std::setw(12)
+					    << static_cast<double>(histogram.max()) * data.nanoseconds_per_tick << '\n';
+				}
+			}
+		}
+
+		/**
+		 * Times the operation of a container from its construction to its destruction, if the operation is sampled.
+		 * Without `CUSTOM_TRACE_OPERATIONS` it is an empty class and does nothing.
+		 */
+		class Scope {
+		public:
+#ifdef CUSTOM_TRACE_OPERATIONS
+			/**
+			 * Starts timing an operation, if it is sampled.
+			 * @param operation - the type of the operation.
+			 */
+			explicit Scope(Operation operation) noexcept: operation(operation) {
+				if (--detail::countdown == 0) [[unlikely]] {
+					detail::countdown = sample_rate();
+					start = detail::now();
+				}
+			}
+
+			/**
+			 * Records the time taken by the operation, if it is sampled.
+			 */
+			~Scope() {
+				if (start) [[unlikely]] {
+					std::uint64_t end = detail::now();
+					detail::ThreadBuffer::local().histograms[static_cast<size_t>(operation)].record(end - start);
+				}
+			}
+
+			Scope(const Scope&) = delete;
+
+			Scope& operator=(const Scope&) = delete;
+
+		private:
+			Operation operation;  /**< The type of the operation timed. */
+			std::uint64_t start = 0;  /**< The time the operation started, or 0 if it is not sampled. */
+#else
+			constexpr explicit Scope(Operation) noexcept {}
+#endif
+		};
+	}
+}// namespace custom
+
+#endif// TRACING_H
@@ -2,11 +2,20 @@
 #define TREE_H
 
 #include <algorithm>
+#include <cstdint>
 #include <initializer_list>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <type_traits>
 #include <vector>
 
+#include "AllocationTracking.h"
+#include "Checking.h"
+#include "MemoryUsage.h"
+#include "Serialization.h"
+#include "Tracing.h"
+
 namespace custom {
 	/**
 	 * A template implementation of a tree data structure. Each node in the tree has a member data of type `T` and a
@@ -15,11 +24,15 @@ namespace custom {
 	 * There is an option of having the children nodes of each parent node ordered, only if the data type `T` is arithmetic.
 	 *
 	 * @tparam T - the type of the data of each node in the tree.
+	 * @tparam Allocator - the allocator the nodes, and their lists of children, are allocated with, `std::allocator`
+	 * by default, see pmr::Tree.
 	 * @see <a href="https://en.wikipedia.org/wiki/Tree_(data_structure)">Tree (Data Structure)</a>
 	 */
-	template<typename T>
+	template<typename T, typename Allocator = std::allocator<T>>
 	class Tree {
 	public:
+		using allocator_type = Allocator;  /**< An alias for the allocator the nodes are allocated with. */
+
 		/**
 		 * Default Tree constructor which sets the root and current head node to `nullptr` and sets the `ordered` status
 		 * to `false`.
@@ -36,9 +49,11 @@ namespace custom {
 		 *
 		 * @param data - data of type `T` to be copied into the root node.
 		 * @param ordered - boolean value to set the `ordered` status of the children nodes, set by default to `false`.
+		 * @param allocator - the allocator to allocate the nodes with.
 		 */
-		explicit Tree(const T& data, bool ordered = false) noexcept: ordered(ordered) {
-			root = new Node(data);
+		explicit Tree(const T& data, bool ordered = false, const Allocator& allocator = Allocator()) noexcept:
+				ordered(ordered), mAllocator(allocator) {
+			root = create_node(data);
 			current_head = root;
 			if (ordered)
 				static_assert(std::is_arithmetic<T>::value,
@@ -55,9 +70,11 @@ namespace custom {
 		 *
 		 * @param data - a *r-value reference* to data of type `T` to be moved into the root node.
 		 * @param ordered - boolean value to set the `ordered` status of the children nodes, set by default to `false`.
+		 * @param allocator - the allocator to allocate the nodes with.
 		 */
-		explicit Tree(T&& data, bool ordered = false) noexcept: ordered(ordered) {
-			root = new Node(std::move(data));
+		explicit Tree(T&& data, bool ordered = false, const Allocator& allocator = Allocator()) noexcept:
+				ordered(ordered), mAllocator(allocator) {
+			root = create_node(std::move(data));
 			current_head = root;
 			if (ordered)
 				static_assert(std::is_arithmetic<T>::value, "Ordered trees require arithmetic data types");
@@ -74,20 +91,18 @@ namespace custom {
 		 * @param data - data of type `T` to be copied into the new child node.
 		 */
 		void add_child(const T& data) {
-			if (current_head) {
-				Node* new_node = new Node(data);
-				if (!current_head->children.empty() && ordered) {
-					for (size_t i = 0; i < current_head->children.size(); ++i) {
-						if (new_node->data < current_head->children[i]->data) {
-							current_head->children.insert(current_head->children.begin() + i, new_node);
-							return;
-						}
+			tracing::Scope scope(tracing::Operation::Insert);
+			check<std::runtime_error>(current_head != nullptr, "Current node is uninitialised, cannot add child");
+			Node* new_node = create_node(data);
+			if (!current_head->children.empty() && ordered) {
+				for (size_t i = 0; i < current_head->children.size(); ++i) {
+					if (new_node->data < current_head->children[i]->data) {
+						current_head->children.insert(current_head->children.begin() + i, new_node);
+						return;
 					}
 				}
-				current_head->children.push_back(new_node);
-				return;
 			}
-			throw std::runtime_error("Current node is uninitialised, cannot add child");
+			current_head->children.push_back(new_node);
 		}
 
 		/**
@@ -101,20 +116,18 @@ namespace custom {
 		 * @param data - data of type `T` to be moved into the new child node.
 		 */
 		void add_child(T&& data) {
-			if (current_head) {
-				Node* new_node = new Node(std::move(data));
-				if (!current_head->children.empty() && ordered) {
-					for (size_t i = 0; i < current_head->children.size(); ++i) {
-						if (new_node->data < current_head->children[i]->data) {
-							current_head->children.insert(current_head->children.begin() + i, new_node);
-							return;
-						}
+			tracing::Scope scope(tracing::Operation::Insert);
+			check<std::runtime_error>(current_head != nullptr, "Current node is uninitialised, cannot add child");
+			Node* new_node = create_node(std::move(data));
+			if (!current_head->children.empty() && ordered) {
+				for (size_t i = 0; i < current_head->children.size(); ++i) {
+					if (new_node->data < current_head->children[i]->data) {
+						current_head->children.insert(current_head->children.begin() + i, new_node);
+						return;
 					}
 				}
-				current_head->children.push_back(new_node);
-				return;
 			}
-			throw std::runtime_error("Current node is uninitialised, cannot add child");
+			current_head->children.push_back(new_node);
 		}
 
 		/**
@@ -129,11 +142,9 @@ namespace custom {
 		 * @see <a href="https://en.cppreference.com/w/cpp/utility/initializer_list">std::initializer_list</a>
 		 */
 		void add_child(std::initializer_list<T> list) {
-			if (current_head) {
-				for (auto it = list.begin(); it != list.end(); ++it)
-					add_child(std::move(*it));
-			} else
-				throw std::runtime_error("Current node is uninitialised, cannot add child");
+			check<std::runtime_error>(current_head != nullptr, "Current node is uninitialised, cannot add child");
+			for (auto it = list.begin(); it != list.end(); ++it)
+				add_child(std::move(*it));
 		}
 
 		/**
@@ -146,14 +157,12 @@ namespace custom {
 		 * @return - a `std::vector` of type `T` containing the data values of the children nodes.
 		 */
 		[[nodiscard]] std::vector<T> children_data() const {
-			if (!current_head->children.empty()) {
-				std::vector<T> ret;
-				for (const Node*& node: current_head->children) {
-					ret.push_back(node->data);
-				}
-				return ret;
+			check<std::runtime_error>(!current_head->children.empty(), "Current node has no children");
+			std::vector<T> ret;
+			for (const Node* node: current_head->children) {
+				ret.push_back(node->data);
 			}
-			throw std::runtime_error("Current node has no children");
+			return ret;
 		}
 
 		/**
@@ -170,16 +179,15 @@ namespace custom {
 		 * specified is found.
 		 */
 		[[nodiscard]] int find_child(const T& data) const {
-			if (!current_head->children.empty()) {
-				int index = 0;
-				for (Node* node: current_head->children) {
-					if (node->data == data)
-						return index;
-					++index;
-				}
-				return -1;
+			tracing::Scope scope(tracing::Operation::Lookup);
+			check<std::runtime_error>(!current_head->children.empty(), "Current node has no children");
+			int index = 0;
+			for (Node* node: current_head->children) {
+				if (node->data == data)
+					return index;
+				++index;
 			}
-			throw std::runtime_error("Current node has no children");
+			return -1;
 		}
 
 		/**
@@ -191,11 +199,9 @@ namespace custom {
 		 *
 		 * @param index - an integer value specifying the index of a child node to change the current head node to.
 		 */
-		void goto_child(const int& index) {
-			if (index < current_head->children.size() && index > -1)
-				current_head = current_head->children[index];
-			else
-				throw std::invalid_argument("Index out of range.");
+		void goto_child(const int& index) noexcept(!checks_throw) {
+			check<std::invalid_argument>(index < current_head->children.size() && index > -1, "Index out of range.");
+			current_head = current_head->children[index];
 		}
 
 		/**
@@ -241,6 +247,57 @@ namespace custom {
 			return root == nullptr;
 		}
 
+		/**
+		 * Returns a breakdown of the memory held by the tree: the data of the nodes is the payload, while the vector of
+		 * children of each node, the padding of each node and the tree object itself are structural overhead.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the tree.
+		 *
+		 * @return - a MemoryUsage object with the bytes of payload, structure and estimated allocator overhead.
+		 */
+		[[nodiscard]] MemoryUsage memory_usage() const noexcept {
+			MemoryUsage usage;
+			usage.structure = sizeof(*this);
+			add_memory_usage(root, usage);
+			return usage;
+		}
+
+		/**
+		 * Serializes the tree in the binary format of Serialization.h, as its `ordered` status followed by the data of
+		 * its nodes in pre-order, each followed by its number of children.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the tree.
+		 *
+		 * @param out - the serialization::Writer to append the tree to.
+		 */
+		void serialize(serialization::Writer& out) const {
+			out.header<T>(serialization::Kind::Tree, count_nodes(root), ordered);
+			if (root)
+				write_subtree(out, root);
+		}
+
+		/**
+		 * Deserializes a tree written by serialize(), with the same shape, the same order of children and the root as
+		 * the current head. If the data does not hold a serialized Tree of `T`, a `runtime_error` exception is thrown.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the tree.
+		 *
+		 * @param in - the serialization::Reader to read the tree from.
+		 * @return - the tree.
+		 */
+		static Tree deserialize(serialization::Reader& in) {
+			serialization::Header header = in.header<T>(serialization::Kind::Tree);
+			size_t count = header.count;
+			Tree result;
+			result.ordered = header.extra != 0;
+			if (count)
+				result.read_subtree(in, result.root, count);
+			if (count)
+				throw std::runtime_error("Error: the serialized Tree has fewer nodes than its header");
+			result.current_head = result.root;
+			return result;
+		}
+
 		/**
 		 * Conversion operator for boolean type. Evaluates to true if the current head node of the tree is **not**
 		 * `nullptr`.
@@ -263,11 +320,10 @@ namespace custom {
 		 * @return - a `std::vector` of type `T` containing the contents of the whole tree, in order.
 		 */
 		[[nodiscard]] std::vector<T> contents_InOrder() const {
-			if (root) {
-				std::vector<T> temp;
-				return InOrder(root, temp);
-			}
-			throw std::runtime_error("Error: Tree is empty, there is no content to return");
+			tracing::Scope scope(tracing::Operation::Traversal);
+			check<std::runtime_error>(root != nullptr, "Error: Tree is empty, there is no content to return");
+			std::vector<T> temp;
+			return InOrder(root, temp);
 		}
 
 		/**
@@ -279,11 +335,11 @@ namespace custom {
 		 *
 		 * @param index - an integer specifying the index of the child node to remove.
 		 */
-		void remove_child(const int& index) {
-			if (index < current_head->children.size() && index > -1)
-				current_head->children.erase(current_head->children.begin() + index);
-			else
-				throw std::invalid_argument("Index for remove_child is out of range");
+		void remove_child(const int& index) noexcept(!checks_throw) {
+			tracing::Scope scope(tracing::Operation::Erase);
+			check<std::invalid_argument>(index < current_head->children.size() && index > -1,
+			                             "Index for remove_child is out of range");
+			current_head->children.erase(current_head->children.begin() + index);
 		}
 
 		/**
@@ -307,6 +363,17 @@ namespace custom {
 			current_head = root;
 		}
 
+		/**
+		 * Returns a copy of the allocator the nodes are allocated with.
+		 *
+		 * **Time Complexity** = *O(1)*.
+		 *
+		 * @return - the allocator of the tree.
+		 */
+		[[nodiscard]] Allocator get_allocator() const noexcept {
+			return mAllocator;
+		}
+
 		/**
 		 * Tree destructor which calls clear() if the tree is initialised, clearing its contents and freeing memory.
 		 *
@@ -322,26 +389,127 @@ namespace custom {
 		 * A node structure to contain the data, of type `T` for each node in the tree and a `std::vector` of Node
 		 * pointers containing the children nodes of this specific node.
 		 */
-		struct Node {
+		struct Node : allocation_tracking::TrackedNode<ContainerType::Tree> {
+			using ChildAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node*>;  /**< The allocator of the children list. */
+
 			T data;  /**< The data of type `T` of each node. */
-			std::vector<Node*> children;  /**< A `std::vector` of type `Node*` specifying the children nodes of this node. */
+			std::vector<Node*, ChildAllocator> children;  /**< A `std::vector` of type `Node*` specifying the children nodes of this node. */
 
 			/**
 			 * Constructor which copies the data provided into the node object and initialises an empty children list.
 			 * @param data - data of type `T` to copy into the node object.
+			 * @param allocator - the allocator of the tree, to allocate the children list with.
 			 */
-			explicit Node(const T& data) noexcept: data(data), children({}) {}
+			Node(const T& data, const Allocator& allocator) noexcept: data(data), children(ChildAllocator(allocator)) {}
 
 			/**
 			 * Constructor which moves the data provided into the node object and initialises an empty children list.
 			 * @param data - a *r-value reference* to data of type `T` to move into the node object.
+			 * @param allocator - the allocator of the tree, to allocate the children list with.
 			 */
-			explicit Node(T&& data) noexcept: data(std::move(data)), children({}) {}
+			Node(T&& data, const Allocator& allocator) noexcept: data(std::move(data)),
+			                                                     children(ChildAllocator(allocator)) {}
 		};
 
 		Node* root;  /**< A pointer to the root node of the tree. */
 		Node* current_head;  /**< A pointer to a node in the tree currently in context. */
 		bool ordered;  /**< A boolean value which indicates whether the children nodes are ordered in ascending order. */
+		[[no_unique_address]] Allocator mAllocator;  /**< The allocator the nodes are allocated with. */
+
+		/**
+		 * Private helper function which allocates and constructs a node, and its children list, with the allocator of
+		 * the tree.
+		 *
+		 * @param data - the data of the node, copied or moved into it.
+		 * @return - a pointer to the new node.
+		 */
+		template<typename Data>
+		Node* create_node(Data&& data) noexcept {
+			return allocation_tracking::create_node<ContainerType::Tree, Node>(mAllocator, std::forward<Data>(data),
+			                                                                   mAllocator);
+		}
+
+		/**
+		 * Private helper function which destroys and deallocates a node from create_node().
+		 *
+		 * @param node - a pointer to the node.
+		 */
+		void destroy_node(Node* node) noexcept {
+			allocation_tracking::destroy_node<ContainerType::Tree>(mAllocator, node);
+		}
+
+		/**
+		 * Private helper function which adds the memory held by the sub-tree originating from the node provided to a
+		 * breakdown of memory usage.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number nodes in the sub-tree originating from the node provided.
+		 *
+		 * @param node - a pointer to the root node of the sub-tree.
+		 * @param usage - a reference to the MemoryUsage object to add to.
+		 */
+		void add_memory_usage(const Node* node, MemoryUsage& usage) const noexcept {
+			if (!node) return;
+			memory_detail::add_blocks(usage, 1, sizeof(Node), sizeof(T));
+			memory_detail::add_vector(usage, node->children);
+			for (const Node* child: node->children)
+				add_memory_usage(child, usage);
+		}
+
+		/**
+		 * Private helper function which counts the nodes of the sub-tree with the root node provided.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the sub-tree.
+		 *
+		 * @param node - a pointer to the root node of the sub-tree.
+		 * @return - an unsigned integer representing the number of nodes in the sub-tree.
+		 */
+		static size_t count_nodes(const Node* node) noexcept {
+			if (!node) return 0;
+			size_t count = 1;
+			for (const Node* child: node->children)
+				count += count_nodes(child);
+			return count;
+		}
+
+		/**
+		 * Private helper function which serializes the sub-tree with the root node provided in pre-order.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the sub-tree.
+		 *
+		 * @param out - the serialization::Writer to append the sub-tree to.
+		 * @param node - a pointer to the root node of the sub-tree, which must not be `nullptr`.
+		 */
+		static void write_subtree(serialization::Writer& out, const Node* node) {
+			out.value(node->data);
+			out.value(static_cast<std::uint64_t>(node->children.size()));
+			for (const Node* child: node->children)
+				write_subtree(out, child);
+		}
+
+		/**
+		 * Private helper function which deserializes a sub-tree written by write_subtree(), linking each node as soon as
+		 * it is created so the tree owns it if an exception is thrown.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of nodes in the sub-tree.
+		 *
+		 * @param in - the serialization::Reader to read the sub-tree from.
+		 * @param node - a reference to the pointer to set to the root node of the sub-tree.
+		 * @param count - the number of nodes left to read, which is decremented for each node read.
+		 */
+		void read_subtree(serialization::Reader& in, Node*& node, size_t& count) {
+			if (count == 0)
+				throw std::runtime_error("Error: the serialized Tree has more nodes than its header");
+			--count;
+			node = create_node(in.value<T>());
+			auto children = in.value<std::uint64_t>();
+			if (children > count)
+				throw std::runtime_error("Error: the serialized Tree has more nodes than its header");
+			node->children.reserve(children);
+			for (std::uint64_t i = 0; i < children; ++i) {
+				node->children.push_back(nullptr);
+				read_subtree(in, node->children.back(), count);
+			}
+		}
 
 		/**
 		 * Private helper function which traverses the tree recursively, in order and appends the data at each node
@@ -390,15 +558,21 @@ namespace custom {
 		 */
 		void delete_tree(Node*& node) noexcept {
 			if (!node) return;
-			if (node->children.empty()) {
-				delete node;
-				return;
-			}
 			for (Node*& child: node->children) {
 				delete_tree(child);
 			}
+			destroy_node(node);
 		}
 	};
+
+	namespace pmr {
+		/**
+		 * A Tree whose nodes, and their lists of children, are allocated from a `std::pmr::memory_resource`.
+		 * @tparam T - the type of the data of each node in the tree.
+		 */
+		template<typename T>
+		using Tree = custom::Tree<T, std::pmr::polymorphic_allocator<T>>;
+	}// namespace pmr
 }// namespace custom
 
 #endif// TREE_H
\ No newline at end of file
@@ -1,11 +1,22 @@
 #ifndef VECTOR_H
 #define VECTOR_H
 
+#include <compare>
+#include <cstddef>
 #include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "AllocationTracking.h"
+#include "Checking.h"
+#include "MemoryUsage.h"
+#include "Serialization.h"
+#include "Tracing.h"
+
 namespace custom {
 
 	/**
@@ -13,18 +24,28 @@ namespace custom {
 	 * functionality for incrementing or decrementing the iterator and allows for C++ operations such as range
 	 * based for loops and other iterator methods. The current position of the iterator along with the Vector's
 	 * beginning and, past the ending positions are tracked using pointers.
+	 *
+	 * The iterator models a C++20 contiguous iterator, so standard and custom algorithms requiring random access,
+	 * such as pdq_sort(), can be used on a Vector or Array. Algorithms may obtain a raw pointer to the elements with
+	 * `std::to_address` to avoid the bounds checks of the iterator.
 	 * @tparam Vector - the Vector type to iterate over.
 	 */
 	template<typename Vector>
 	class VectorIterator {
 	public:
 		using DataType = typename Vector::Type;  /**< An alias for the type of the data in the Vector. */
+		using iterator_concept = std::contiguous_iterator_tag;  /**< The C++20 iterator concept modelled. */
+		using iterator_category = std::random_access_iterator_tag;  /**< The iterator category for pre-C++20 algorithms. */
+		using value_type = std::remove_cv_t<DataType>;  /**< The type of the elements. */
+		using difference_type = std::ptrdiff_t;  /**< The type of the distance between two iterators. */
+		using pointer = DataType*;  /**< The type of a pointer to an element. */
+		using reference = DataType&;  /**< The type of a reference to an element. */
 
 	public:
 		/**
 		 * Default Vector iterator constructor which sets the member pointers of the iterator to `nullptr`.
 		 */
-		VectorIterator() noexcept : mPtr(nullptr), mBegin(nullptr), mEnd(nullptr) {}
+		constexpr VectorIterator() noexcept : mPtr(nullptr), mBegin(nullptr), mEnd(nullptr) {}
 
 		/**
 		 * Overloaded iterator constructor which provides a pointer to an element in the Vector.
@@ -32,13 +53,15 @@ namespace custom {
 		 * @param begin - a pointer to the first element in the Vector.
 		 * @param end - a pointer past the last element in the Vector.
 		 */
-		VectorIterator(DataType* ptr, DataType* begin, DataType* end) noexcept : mPtr(ptr), mBegin(begin), mEnd(end) {}
+		constexpr VectorIterator(DataType* ptr, DataType* begin, DataType* end) noexcept : mPtr(ptr), mBegin(begin),
+		                                                                                   mEnd(end) {}
 
 		/**
 		 * Copy constructor for the iterator which copies the other iterator's member pointers.
 		 * @param other - an iterator to copy.
 		 */
-		VectorIterator(const VectorIterator& other) noexcept : mPtr(other.mPtr), mBegin(other.mBegin), mEnd(other.mEnd) {}
+		constexpr VectorIterator(const VectorIterator& other) noexcept : mPtr(other.mPtr), mBegin(other.mBegin),
+		                                                                 mEnd(other.mEnd) {}
 
 		/**
 		 * Copy assignment operator which copies anther Vector iterator into the current object.
@@ -46,7 +69,7 @@ namespace custom {
 		 * @param other - an iterator to copy.
 		 * @return - a reference to the resultant current object.
 		 */
-		VectorIterator& operator=(const VectorIterator& other) noexcept {
+		constexpr VectorIterator& operator=(const VectorIterator& other) noexcept {
 			if (this != &other) {
 				mPtr = other.mPtr;
 				mBegin = other.mBegin;
@@ -59,7 +82,8 @@ namespace custom {
 		 * Move constructor for the iterator.
 		 * @param other - an iterator to move into the current object.
 		 */
-		VectorIterator(VectorIterator&& other) noexcept : mPtr(other.mPtr), mBegin(other.mBegin), mEnd(other.mEnd) {
+		constexpr VectorIterator(VectorIterator&& other) noexcept : mPtr(other.mPtr), mBegin(other.mBegin),
+		                                                            mEnd(other.mEnd) {
 			other.mPtr = nullptr;
 			other.mEnd = nullptr;
 		}
@@ -69,7 +93,7 @@ namespace custom {
 		 * @param other - an iterator object to move into the current object.
 		 * @return - a reference to the resultant current object.
 		 */
-		VectorIterator& operator=(VectorIterator&& other) noexcept {
+		constexpr VectorIterator& operator=(VectorIterator&& other) noexcept {
 			if (this != &other) {
 				mPtr = other.mPtr;
 				mBegin = other.mBegin;
@@ -87,12 +111,10 @@ namespace custom {
 		 * or past the end of the vector, is incremented.
 		 * @return - a reference to the current object after incrementing.
 		 */
-		VectorIterator& operator++() {
-			if (mPtr != mEnd) {
-				++mPtr;
-				return *this;
-			}
-			throw std::out_of_range("Cannot increment vector iterator past end of vector");
+		constexpr VectorIterator& operator++() noexcept(!checks_throw) {
+			check<std::out_of_range>(mPtr != mEnd, "Cannot increment vector iterator past end of vector");
+			++mPtr;
+			return *this;
 		}
 
 		/**
@@ -101,13 +123,10 @@ namespace custom {
 		 * points to an element before the beginning or past the end of the vector, is incremented.
 		 * @return - a copy VectorIterator object at the position before incrementing.
 		 */
-		const VectorIterator operator++(int) {
-			if (mPtr != mEnd) {
-				const VectorIterator temp(*this);
-				++*this;
-				return temp;
-			}
-			throw std::out_of_range("Cannot increment vector iterator past end of vector");
+		constexpr VectorIterator operator++(int) noexcept(!checks_throw) {
+			VectorIterator temp(*this);
+			++*this;
+			return temp;
 		}
 
 		/**
@@ -116,12 +135,10 @@ namespace custom {
 		 * or past the end of the vector, is decremented.
 		 * @return - a reference to the current object after decrementing.
 		 */
-		VectorIterator& operator--() {
-			if (mPtr != mBegin) {
-				--mPtr;
-				return *this;
-			}
-			throw std::out_of_range("Cannot decrement vector iterator before beginning of vector");
+		constexpr VectorIterator& operator--() noexcept(!checks_throw) {
+			check<std::out_of_range>(mPtr != mBegin, "Cannot decrement vector iterator before beginning of vector");
+			--mPtr;
+			return *this;
 		}
 
 		/**
@@ -130,13 +147,10 @@ namespace custom {
 		 * or past the end of the vector, is decremented.
 		 * @return - a copy VectorIterator object at the position before decrementing.
 		 */
-		const VectorIterator operator--(int) {
-			if (mPtr != mBegin) {
-				const VectorIterator temp(*this);
-				--*this;
-				return temp;
-			}
-			throw std::out_of_range("Cannot decrement vector iterator before beginning of vector");
+		constexpr VectorIterator operator--(int) noexcept(!checks_throw) {
+			VectorIterator temp(*this);
+			--*this;
+			return temp;
 		}
 
 		/**
@@ -146,95 +160,109 @@ namespace custom {
 		 * @param distance - an unsigned integer to represent the number of positions to advance.
 		 * @return - a reference to the current object.
 		 */
-		VectorIterator& advance(const int& distance) {
-			if (mPtr != mEnd && mPtr != (mBegin-1)) {
-				int moved = 0;
-				if (distance > 0) {
-					while (mPtr != mEnd && moved < distance) {
-						++*this;
-						++moved;
-					}
-				} else {
-					while (mPtr != mBegin && moved > distance) {
-						--*this;
-						--moved;
-					}
-				}
-				if (moved != distance)
-					throw std::invalid_argument("Distance out of range of iterator");
-				return *this;
-			}
-			throw std::runtime_error("Iterator is at an invalid position, cannot advance");
+		constexpr VectorIterator& advance(const int& distance) noexcept(!checks_throw) {
+			check<std::runtime_error>(mPtr != mEnd, "Iterator is at an invalid position, cannot advance");
+			check<std::invalid_argument>(distance <= mEnd - mPtr && distance >= mBegin - mPtr,
+			                             "Distance out of range of iterator");
+			mPtr += distance;
+			return *this;
 		}
 
 		/**
-		 * Plus operator which advances the iterator by the distance specified. If the distance goes out of the
-		 * range of the iterator, an `out_of_range` exception is thrown.
-		 * @param amount - an unsigned integer to represent the distance to advance the iterator by.
+		 * Plus operator which advances the iterator by the distance specified, which could be negative to advance
+		 * backwards. If the distance goes out of the range of the iterator, an `out_of_range` exception is thrown.
+		 * **Time Complexity** = *O(1)*.
+		 * @param amount - an integer to represent the distance to advance the iterator by.
 		 * @return - a copy of an advanced iterator.
 		 */
-		VectorIterator operator+(const size_t& amount) {
+		constexpr VectorIterator operator+(difference_type amount) const noexcept(!checks_throw) {
 			VectorIterator result(*this);
-			size_t moved = 0;
-			while (result.mPtr != result.mEnd && moved < amount) {
-				++result.mPtr;
-				++moved;
-			}
-			if (moved == amount)
-				return result;
-			throw std::out_of_range("Cannot move vector iterator past end of vector");
+			result += amount;
+			return result;
+		}
+
+		/**
+		 * Plus operator which advances an iterator by the distance specified, allowing the distance to be on the
+		 * left-hand side. If the distance goes out of the range of the iterator, an `out_of_range` exception is thrown.
+		 * **Time Complexity** = *O(1)*.
+		 * @param amount - an integer to represent the distance to advance the iterator by.
+		 * @param it - the iterator to advance.
+		 * @return - a copy of an advanced iterator.
+		 */
+		friend constexpr VectorIterator operator+(difference_type amount, const VectorIterator& it) noexcept(!checks_throw) {
+			return it + amount;
 		}
 
 		/**
-		 * Plus-equals operator which advances the current object by the distance specified. If the distance goes
-		 * out of the range of the iterator, an `out_of_range` exception is thrown.
-		 * @param amount - an unsigned integer to represent the distance to advance the iterator by.
+		 * Plus-equals operator which advances the current object by the distance specified, which could be negative to
+		 * advance backwards. If the distance goes out of the range of the iterator, an `out_of_range` exception is
+		 * thrown.
+		 * **Time Complexity** = *O(1)*.
+		 * @param amount - an integer to represent the distance to advance the iterator by.
 		 * @return - a reference to the current advanced iterator.
 		 */
-		VectorIterator& operator+=(const size_t& amount) {
-			size_t moved = 0;
-			while (mPtr != mEnd && moved < amount) {
-				++mPtr;
-				++moved;
-			}
-			if (moved == amount)
-				return *this;
-			throw std::out_of_range("Cannot move vector iterator past end of vector");
+		constexpr VectorIterator& operator+=(difference_type amount) noexcept(!checks_throw) {
+			check<std::out_of_range>(amount <= mEnd - mPtr, "Cannot move vector iterator past end of vector");
+			check<std::out_of_range>(amount >= mBegin - mPtr, "Cannot move vector iterator before beginning of vector");
+			mPtr += amount;
+			return *this;
 		}
 
 		/**
 		 * Minus operator which advances the iterator backwards by the distance specified. If the distance goes out
 		 * of the range of the iterator, an `out_of_range` exception is thrown.
-		 * @param amount - an unsigned integer to represent the distance to advance the iterator by.
+		 * **Time Complexity** = *O(1)*.
+		 * @param amount - an integer to represent the distance to advance the iterator by.
 		 * @return - a copy of an advanced iterator.
 		 */
-		VectorIterator operator-(const size_t& amount) {
+		constexpr VectorIterator operator-(difference_type amount) const noexcept(!checks_throw) {
 			VectorIterator result(*this);
-			size_t moved = 0;
-			while (result.mPtr != result.mBegin && moved < amount) {
-				--result.mPtr;
-				++moved;
-			}
-			if (moved == amount)
-				return result;
-			throw std::out_of_range("Cannot move vector iterator before beginning of vector");
+			result -= amount;
+			return result;
 		}
 
 		/**
 		 * Minus-equals operator which advances the current object backwards by the distance specified. If the
 		 * distance goes out of the range of the iterator, an `out_of_range` exception is thrown.
-		 * @param amount - an unsigned integer to represent the distance to advance the iterator by.
+		 * **Time Complexity** = *O(1)*.
+		 * @param amount - an integer to represent the distance to advance the iterator by.
 		 * @return - a reference to the current advanced iterator.
 		 */
-		VectorIterator& operator-=(const size_t& amount) {
-			size_t moved = 0;
-			while (mPtr != mBegin && moved < amount) {
-				--mPtr;
-				++moved;
-			}
-			if (moved == amount)
-				return *this;
-			throw std::out_of_range("Cannot move vector iterator before beginning of vector");
+		constexpr VectorIterator& operator-=(difference_type amount) noexcept(!checks_throw) {
+			check<std::out_of_range>(amount <= mPtr - mBegin, "Cannot move vector iterator before beginning of vector");
+			check<std::out_of_range>(amount >= mPtr - mEnd, "Cannot move vector iterator past end of vector");
+			mPtr -= amount;
+			return *this;
+		}
+
+		/**
+		 * Minus operator which provides the distance between two iterators over the same Vector.
+		 * **Time Complexity** = *O(1)*.
+		 * @param other - another iterator over the same Vector.
+		 * @return - the number of positions from `other` to the current iterator, negative if `other` is after it.
+		 */
+		constexpr difference_type operator-(const VectorIterator& other) const noexcept {
+			return mPtr - other.mPtr;
+		}
+
+		/**
+		 * Subscript operator which returns the data at the distance specified from the current iterator position. If
+		 * the position is out of the range of the iterator, an exception is thrown.
+		 * @param amount - an integer to represent the distance from the current position.
+		 * @return - a reference to the data at the position.
+		 */
+		constexpr DataType& operator[](difference_type amount) const noexcept(!checks_throw) {
+			return *(*this + amount);
+		}
+
+		/**
+		 * Three-way comparison operator which compares the positions of two iterators over the same Vector, providing
+		 * the `<`, `<=`, `>` and `>=` operators.
+		 * @param other - another iterator over the same Vector.
+		 * @return - the ordering of the positions of the two iterators.
+		 */
+		constexpr std::strong_ordering operator<=>(const VectorIterator& other) const noexcept {
+			return mPtr <=> other.mPtr;
 		}
 
 		/**
@@ -242,7 +270,7 @@ namespace custom {
 		 * @param other - another Vector iterator to compare.
 		 * @return - a boolean indicating if the two iterators are at the same position.
 		 */
-		bool operator==(const VectorIterator& other) const noexcept {
+		constexpr bool operator==(const VectorIterator& other) const noexcept {
 			return mPtr == other.mPtr;
 		}
 
@@ -251,7 +279,7 @@ namespace custom {
 		 * @param other - another Vector iterator to compare.
 		 * @return - a boolean indicating if the two iterators are not at the same position.
 		 */
-		bool operator!=(const VectorIterator& other) const noexcept {
+		constexpr bool operator!=(const VectorIterator& other) const noexcept {
 			return mPtr != other.mPtr;
 		}
 
@@ -260,17 +288,16 @@ namespace custom {
 		 * to an invalid position, a `runtime_error` exception is thrown.
 		 * @return - A reference to the data at the current iterator position.
 		 */
-		DataType& operator*() const {
-			if (mPtr != mEnd && mPtr != (mBegin-1))
-				return *mPtr;
-			throw std::runtime_error("Iterator does not point to a valid position, cannot dereference");
+		constexpr DataType& operator*() const noexcept(!checks_throw) {
+			check<std::runtime_error>(mPtr != mEnd, "Iterator does not point to a valid position, cannot dereference");
+			return *mPtr;
 		}
 
 		/**
 		 * Member access operator allows access to the member function of the object being iterated over, directly from the iterator.
 		 * @return - a pointer to the current position of the iterator.
 		 */
-		DataType* operator->() const noexcept {
+		constexpr DataType* operator->() const noexcept {
 			return mPtr;
 		}
 
@@ -278,11 +305,11 @@ namespace custom {
 		 * Returns the length of the Vector object being iterated over.
 		 * @return - an unsigned integer representing the length of the Vector object.
 		 */
-		size_t _size() const noexcept {
+		constexpr size_t _size() const noexcept {
 			return Vector::mSize;
 		}
 
-		virtual ~VectorIterator() = default;
+		constexpr ~VectorIterator() = default;
 
 	private:
 		DataType* mPtr;  /**< A pointer of type Vector::DataType which points to the current position in the Vector. */
@@ -300,11 +327,13 @@ namespace custom {
 	 * Where possible, methods which should not throw exceptions are explicitly marked noexcept.
 	 *
 	 * @tparam T - the type of the data to be stored in the array.
+	 * @tparam Allocator - the allocator the array is allocated with, `std::allocator` by default, see pmr::Vector.
 	 */
-	template<typename T>
+	template<typename T, typename Allocator = std::allocator<T>>
 	class Vector {
 	public:
 		using Type = T;  /**< An alias for the type of data `T` to be used by external utility classes. */
+		using allocator_type = Allocator;  /**< An alias for the allocator the array is allocated with. */
 		using Iterator = VectorIterator<Vector>;  /**< An alias for the Vector iterator class. */
 
 		friend class VectorIterator<Vector>;  /**< Friend Vector iterator class, allowing it to access private members. */
@@ -314,7 +343,16 @@ namespace custom {
 		 * Default constructor of Vector class which initialises an empty vector array with no
 		 * allocated memory. Sets member variables to their default values.
 		 */
-		Vector() noexcept: capacity{0}, mSize{0}, data{nullptr} {}
+		Vector() noexcept: mSize{0}, capacity{0}, data{nullptr} {}
+
+		/**
+		 * Constructor of the Vector class which initialises an empty vector array with no allocated memory, which will
+		 * allocate its array with the allocator provided.
+		 *
+		 * @param allocator - the allocator to allocate the array with.
+		 */
+		explicit Vector(const Allocator& allocator) noexcept: mSize{0}, capacity{0}, data{nullptr},
+		                                                      mAllocator(allocator) {}
 
 		/**
 		 * Overloaded constructor of the Vector class. Allocates memory on the heap for the capacity provided.
@@ -324,10 +362,12 @@ namespace custom {
 		 * This constructor is explicit, meaning implicit conversion is not supported.
 		 *
 		 * @param capacity - an unsigned integer to specify the total capacity of the array at initialization.
+		 * @param allocator - the allocator to allocate the array with.
 		 */
-		explicit Vector(size_t capacity) noexcept: capacity(capacity), mSize(0) {
-			data = (T*)::operator new(capacity *
-			                          sizeof(T));  // ::operator new is analogous to malloc i.e. it does not call the constructor of the object within
+		explicit Vector(size_t capacity, const Allocator& allocator = Allocator()) noexcept: mSize(0),
+		                                                                                  capacity(capacity),
+		                                                                                  mAllocator(allocator) {
+			data = allocate(capacity);  // Only allocates memory, analogous to malloc, the elements are constructed later
 		}
 
 		/**
@@ -340,36 +380,42 @@ namespace custom {
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the initialiser list.
 		 *
 		 * @param init - the initialiser list whose contents will be added to the array
+		 * @param allocator - the allocator to allocate the array with.
 		 *
 		 * @see <a href="https://en.cppreference.com/w/cpp/utility/initializer_list">std::initializer_list</a>
 		 */
-		Vector(std::initializer_list<T> init) noexcept: mSize(init.size()) {
+		Vector(std::initializer_list<T> init, const Allocator& allocator = Allocator()) noexcept: mSize(init.size()),
+		                                                                                       mAllocator(allocator) {
 			if (mSize < 10)
 				capacity = 10;
 			else
 				capacity = mSize + mSize / 2;
-			data = (T*)::operator new(capacity * sizeof(T));
+			data = allocate(capacity);
 			for (size_t i = 0; i < mSize; ++i)
-				data[i] = *(init.begin() + i);
+				new(&data[i]) T(*(init.begin() + i));
 		}
 
 		/**
 		 * Copy constructor for the Vector class. This will create a new Vector object and perform an element wise,
-		 * deep copy of another vector of the same type `T`.
+		 * deep copy of another vector of the same type `T`. The allocator is the one the allocator of the other vector
+		 * selects for a copy, which for a `std::pmr::polymorphic_allocator` is the default memory resource.
 		 *
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the other vector.
 		 *
 		 * @param other
 		 */
-		Vector(const Vector<T>& other) noexcept: mSize(other.mSize), capacity(other.capacity) {
-			data = (T*)::operator new(capacity * sizeof(T));
-			for (int i = 0; i < mSize; ++i)
-				data[i] = other[i];
+		Vector(const Vector& other) noexcept: mSize(other.mSize), capacity(other.capacity),
+		                                      mAllocator(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+				                                      other.mAllocator)) {
+			data = allocate(capacity);
+			for (size_t i = 0; i < mSize; ++i)
+				new(&data[i]) T(other.data[i]);
 		}
 
 		/**
 		 * Copy assignment operator will perform an element wise, deep copy of another vector of the same type `T` into
-		 * this Vector object. This function will check for and ignore self assignment.
+		 * this Vector object. This function will check for and ignore self assignment. The current object keeps its
+		 * allocator.
 		 *
 		 * \note
 		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
@@ -380,25 +426,25 @@ namespace custom {
 		 * @param other - the Vector to be copied.
 		 * @return - a reference to the current Vector object.
 		 */
-		Vector<T>& operator=(const Vector<T>& other) noexcept {
+		Vector& operator=(const Vector& other) noexcept {
 			if (this != &other) {
-				if (mSize) {
+				if (data) {
 					// Call destructor of elements and deallocate memory
 					clear();
-					::operator delete(data, capacity * sizeof(T));
+					deallocate(data, capacity);
 				}
 				capacity = other.capacity;
 				mSize = other.mSize;
-				data = (T*)::operator new(capacity * sizeof(T));
-				for (int i = 0; i < mSize; ++i)
-					data[i] = other[i];
+				data = allocate(capacity);
+				for (size_t i = 0; i < mSize; ++i)
+					new(&data[i]) T(other.data[i]);
 			}
 			return *this;
 		}
 
 		/**
 		 * Move constructor for the Vector class. This will create a new Vector object and move an existing Vector
-		 * object's data to this object. Both Vector objects must be of the same type `T`.
+		 * object's data, and its allocator, to this object. Both Vector objects must be of the same type `T`.
 		 *
 		 * \note
 		 * As expected of move operations, the other Vector object will be uninitialized.
@@ -407,7 +453,8 @@ namespace custom {
 		 *
 		 * @param other - an *r-value reference* to the Vector object to be moved.
 		 */
-		Vector(Vector<T>&& other) noexcept: data(other.data), capacity(other.capacity), mSize(other.mSize) {
+		Vector(Vector&& other) noexcept: mSize(other.mSize), capacity(other.capacity), data(other.data),
+		                                 mAllocator(other.mAllocator) {
 			other.data = nullptr;
 			other.capacity = 0;
 			other.mSize = 0;
@@ -415,21 +462,34 @@ namespace custom {
 
 		/**
 		 * Move assignment operator will move an existing Vector object's data into this object. Both Vector objects
-		 * must be of the same type `T`. This function will check for and ignore self assignment.
+		 * must be of the same type `T`. This function will check for and ignore self assignment. The current object
+		 * keeps its allocator, so if it does not compare equal to the allocator of the other object, e.g. a
+		 * `std::pmr::polymorphic_allocator` of another memory resource, the elements are moved one by one instead.
 		 *
 		 * \note
 		 * If the current object, that is being copied into, is not empty, **it will be cleared**.
 		 *
-		 * **Time Complexity** = *O(n)* where n is the number of elements in the existing Vector object.
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the existing Vector object, + the number of
+		 * elements in the other Vector object if the allocators differ.
 		 *
 		 * @param other - an *r-value reference* to the Vector object to be moved.
 		 * @return - a reference to the current Vector object.
 		 */
-		Vector<T>& operator=(Vector<T>&& other) noexcept {
+		Vector& operator=(Vector&& other) noexcept {
 			if (this != &other) {
-				if (mSize) {
+				if (data) {
 					clear();
-					::operator delete(data, capacity * sizeof(T));
+					deallocate(data, capacity);
+					data = nullptr;
+					capacity = 0;
+				}
+				if (!std::allocator_traits<Allocator>::is_always_equal::value && mAllocator != other.mAllocator) {
+					init_grow(other.mSize);
+					for (size_t i = 0; i < other.mSize; ++i)
+						new(&data[i]) T(std::move(other.data[i]));
+					mSize = other.mSize;
+					other.clear();
+					return *this;
 				}
 				data = other.data;
 				capacity = other.capacity;
@@ -452,9 +512,10 @@ namespace custom {
 		 * @see grow()
 		 */
 		void push_back(const T& value) noexcept {
+			tracing::Scope scope(tracing::Operation::Insert);
 			if (mSize >= capacity)
 				grow();
-			data[mSize++] = value;
+			new(&data[mSize++]) T(value);
 		}
 
 		/**
@@ -469,9 +530,10 @@ namespace custom {
 		 * @see grow()
 		 */
 		void push_back(T&& value) noexcept {
+			tracing::Scope scope(tracing::Operation::Insert);
 			if (mSize >= capacity)
 				grow();
-			data[mSize++] = std::move(value);
+			new(&data[mSize++]) T(std::move(value));
 		}
 
 		/**
@@ -493,7 +555,7 @@ namespace custom {
 			if (new_size >= capacity)
 				init_grow(new_size + new_size / 2);
 			for (auto it = list.begin(); it != list.end(); ++it)
-				data[mSize++] = std::move(*it);
+				new(&data[mSize++]) T(std::move(*it));
 		}
 
 		/**
@@ -512,6 +574,7 @@ namespace custom {
 		 */
 		template<typename... Ts>
 		T& emplace_back(Ts&& ... args) noexcept {
+			tracing::Scope scope(tracing::Operation::Insert);
 			if (mSize >= capacity)
 				grow();
 			new(&data[mSize]) T(std::forward<Ts>(
@@ -530,12 +593,11 @@ namespace custom {
 		 * @see shrink()
 		 */
 		void pop_back() {
-			if (mSize) {
-				data[--mSize].~T();
-				if (mSize < (capacity / 2))
-					shrink();
-			} else
-				throw std::runtime_error("Vector is empty, there is nothing to pop.");
+			tracing::Scope scope(tracing::Operation::Erase);
+			check<std::runtime_error>(mSize != 0, "Vector is empty, there is nothing to pop.");
+			data[--mSize].~T();
+			if (mSize < (capacity / 2))
+				shrink();
 		}
 
 		/**
@@ -546,10 +608,9 @@ namespace custom {
 		 *
 		 * @return - a reference to the object of type `T` at the beginning of the array.
 		 */
-		T& front() {
-			if (mSize)
-				return data[0];
-			throw std::runtime_error("Vector is empty, there is nothing at the front.");
+		T& front() noexcept(!checks_throw) {
+			check<std::runtime_error>(mSize != 0, "Vector is empty, there is nothing at the front.");
+			return data[0];
 		}
 
 		/**
@@ -560,10 +621,9 @@ namespace custom {
 		 *
 		 * @return - a const reference to the object of type `T` at the beginning of the array.
 		 */
-		const T& front() const {
-			if (mSize)
-				return data[0];
-			throw std::runtime_error("Vector is empty, there is nothing at the front.");
+		const T& front() const noexcept(!checks_throw) {
+			check<std::runtime_error>(mSize != 0, "Vector is empty, there is nothing at the front.");
+			return data[0];
 		}
 
 		/**
@@ -574,10 +634,9 @@ namespace custom {
 		 *
 		 * @return - a reference to the object of type `T` at the end of the array.
 		 */
-		T& back() {
-			if (mSize)
-				return data[mSize - 1];
-			throw std::runtime_error("Vector is empty, there is nothing at the back");
+		T& back() noexcept(!checks_throw) {
+			check<std::runtime_error>(mSize != 0, "Vector is empty, there is nothing at the back");
+			return data[mSize - 1];
 		}
 
 		/**
@@ -588,10 +647,9 @@ namespace custom {
 		 *
 		 * @return - a const reference to the object of type `T` at the end of the array.
 		 */
-		const T& back() const {
-			if (mSize)
-				return data[mSize - 1];
-			throw std::runtime_error("Vector is empty, there is nothing at the back");
+		const T& back() const noexcept(!checks_throw) {
+			check<std::runtime_error>(mSize != 0, "Vector is empty, there is nothing at the back");
+			return data[mSize - 1];
 		}
 
 		/**
@@ -616,6 +674,72 @@ namespace custom {
 			return mSize == 0;
 		}
 
+		/**
+		 * Returns a breakdown of the memory held by the Vector object: the elements are the payload, while the unused
+		 * capacity of the array and the object itself are structural overhead.
+		 *
+		 * **Time Complexity** = *O(1)*.
+		 *
+		 * @return - a MemoryUsage object with the bytes of payload, structure and estimated allocator overhead.
+		 */
+		[[nodiscard]] MemoryUsage memory_usage() const noexcept {
+			MemoryUsage usage;
+			usage.structure = sizeof(*this);
+			if (data)
+				memory_detail::add_blocks(usage, 1, capacity * sizeof(T), mSize * sizeof(T));
+			return usage;
+		}
+
+		/**
+		 * Serializes the Vector object in the binary format of Serialization.h, copying the array in one block if its
+		 * elements are trivially copyable.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the array.
+		 *
+		 * @param out - the serialization::Writer to append the Vector object to.
+		 */
+		void serialize(serialization::Writer& out) const {
+			out.header<T>(serialization::Kind::Vector, mSize);
+			out.values(data, mSize);
+		}
+
+		/**
+		 * Deserializes a Vector object written by serialize(), allocating exactly the capacity needed. If the data
+		 * does not hold a serialized Vector of `T`, a `runtime_error` exception is thrown.
+		 *
+		 * **Time Complexity** = *O(n)* where n is the number of elements in the array.
+		 *
+		 * @param in - the serialization::Reader to read the Vector object from.
+		 * @return - the Vector object.
+		 */
+		static Vector deserialize(serialization::Reader& in) {
+			size_t count = in.header<T>(serialization::Kind::Vector).count;
+			if (count == 0)
+				return Vector();
+			Vector result(count);
+			if constexpr (serialization::Codec<T>::raw) {
+				in.values(result.data, count);
+				result.mSize = count;
+			} else {
+				for (size_t i = 0; i < count; ++i)
+					result.emplace_back(in.value<T>());
+			}
+			return result;
+		}
+
+		/**
+		 * Returns a read-only view of the elements of a Vector object written by serialize(), in place in the data.
+		 * Only available for trivially copyable elements.
+		 *
+		 * **Time Complexity** = *O(1)*.
+		 *
+		 * @param in - the serialization::Reader to read the Vector object from.
+		 * @return - a span of the elements, valid as long as the data.
+		 */
+		static std::span<const T> view(serialization::Reader& in) requires serialization::Codec<T>::raw {
+			return in.view<T>(in.header<T>(serialization::Kind::Vector).count);
+		}
+
 		/**
 		 * Conversion operator for boolean type. Evaluates to `true` if the size of the array is not 0, otherwise
 		 * it evaluates to `false`.
@@ -638,7 +762,7 @@ namespace custom {
 		 * @param other - a Vector object of the same type `T`, whose data to compare against.
 		 * @return - a boolean value indicating whether the two arrays contain the same data.
 		 */
-		bool operator==(const Vector<T>& other) const noexcept {
+		bool operator==(const Vector& other) const noexcept {
 			if (mSize != other.mSize)
 				return false;
 			for (size_t i = 0; i < mSize; ++i) {
@@ -658,7 +782,7 @@ namespace custom {
 		 * @param other - a Vector object of the same type `T`, whose data to compare against.
 		 * @return - a boolean value indicating whether the two arrays contain different data.
 		 */
-		bool operator!=(const Vector<T>& other) const noexcept {
+		bool operator!=(const Vector& other) const noexcept {
 			return !(*this == other);
 		}
 
@@ -672,10 +796,9 @@ namespace custom {
 		 *
 		 * @return - a reference, of type `T`, to the data at the element specified by index.
 		 */
-		[[nodiscard]] T& operator[](const size_t& index) {
-			if (index >= 0 && index < capacity)
-				return data[index];
-			throw std::invalid_argument("Invalid index, out of range");
+		[[nodiscard]] T& operator[](const size_t& index) noexcept(!checks_throw) {
+			check<std::invalid_argument>(index < capacity, "Invalid index, out of range");
+			return data[index];
 		}
 
 		/**
@@ -688,10 +811,9 @@ namespace custom {
 		 *
 		 * @return - a const reference, of type `T`, to the data at the element specified by index.
 		 */
-		[[nodiscard]] const T& operator[](const size_t& index) const {
-			if (index >= 0 && index < capacity)
-				return data[index];
-			throw std::invalid_argument("Invalid index, out of range");
+		[[nodiscard]] const T& operator[](const size_t& index) const noexcept(!checks_throw) {
+			check<std::invalid_argument>(index < capacity, "Invalid index, out of range");
+			return data[index];
 		}
 
 		/**
@@ -703,9 +825,9 @@ namespace custom {
 		 *
 		 * @return - a new Vector object containing the data of the current and `right` objects.
 		 */
-		[[nodiscard]] Vector<T> operator+(const Vector<T>& right) const noexcept {
+		[[nodiscard]] Vector operator+(const Vector& right) const noexcept {
 			if (right.mSize) {
-				Vector<T> res(*this);
+				Vector res(*this);
 				for (size_t i = 0; i < right.mSize; ++i)
 					res.push_back(right[i]);
 				return res;
@@ -713,6 +835,17 @@ namespace custom {
 			return *this;
 		}
 
+		/**
+		 * Returns a copy of the allocator the array is allocated with.
+		 *
+		 * **Time Complexity** = *O(1)*.
+		 *
+		 * @return - the allocator of the Vector object.
+		 */
+		[[nodiscard]] Allocator get_allocator() const noexcept {
+			return mAllocator;
+		}
+
 		/**
 		 * Creates and returns an iterator with the position of the beginning of the vector.
 		 * **Time Complexity** = *O(1)*.
@@ -749,13 +882,41 @@ namespace custom {
 		 */
 		virtual ~Vector() {
 			clear();
-			::operator delete(data, capacity * sizeof(T));
+			deallocate(data, capacity);
 		}
 
 	private:
 		size_t mSize;  /**< An unsigned integer representing the number of elements in the array. */
 		size_t capacity; /**< An unsigned integer representing the number of elements for which memory is allocated. */
 		T* data;  /**< A pointer of type `T` which points to the beginning of the array. */
+		[[no_unique_address]] Allocator mAllocator;  /**< The allocator the array is allocated with. */
+
+		/**
+		 * Allocates uninitialised memory for the number of elements specified, without constructing them.
+		 * @param count - the number of elements to allocate memory for.
+		 * @return - a pointer of type `T` to the beginning of the memory.
+		 */
+		T* allocate(size_t count) noexcept {
+			allocation_tracking::record_allocation(ContainerType::Vector, count * sizeof(T));
+			if constexpr (allocation_tracking::default_allocator<Allocator>)
+				return static_cast<T*>(::operator new(count * sizeof(T)));
+			else
+				return std::allocator_traits<Allocator>::allocate(mAllocator, count);
+		}
+
+		/**
+		 * Deallocates memory from allocate(), whose elements must already have been destroyed.
+		 * @param memory - a pointer to the memory, which may be `nullptr`.
+		 * @param count - the number of elements the memory was allocated for.
+		 */
+		void deallocate(T* memory, size_t count) noexcept {
+			if (memory)
+				allocation_tracking::record_deallocation(ContainerType::Vector, count * sizeof(T));
+			if constexpr (allocation_tracking::default_allocator<Allocator>)
+				::operator delete(memory, count * sizeof(T));
+			else if (memory)
+				std::allocator_traits<Allocator>::deallocate(mAllocator, memory, count);
+		}
 
 		/**
 		 * Grows the array and copies, or moves if possible, the elements from the old array to the new array.
@@ -766,21 +927,22 @@ namespace custom {
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the array.
 		 */
 		void grow() noexcept {
+			tracing::Scope scope(tracing::Operation::Grow);
 			if (!data) {
 				capacity = 1;
-				data = (T*)::operator new(
-						capacity * sizeof(T));// Allocates memory without calling constructor, analogous to malloc
+				data = allocate(capacity);// Allocates memory without calling constructor, analogous to malloc
 				return;
 			}
-			size_t new_capacity = capacity + capacity / 2;
-			T* new_data = (T*)::operator new(new_capacity * sizeof(T));
+			size_t new_capacity = capacity + (capacity + 1) / 2;  // Rounded up so a capacity of 1 still grows
+			T* new_data = allocate(new_capacity);
+			allocation_tracking::record_reallocation(ContainerType::Vector);
 
 			for (size_t i = 0; i < mSize; ++i) {
-				new_data[i] = std::move(data[i]);
+				new(&new_data[i]) T(std::move(data[i]));
 				data[i].~T();
 			}
 
-			::operator delete(data, capacity * sizeof(T));// deallocated memory without calling destructor
+			deallocate(data, capacity);// deallocated memory without calling destructor
 			data = new_data;
 			capacity = new_capacity;
 		}
@@ -794,20 +956,21 @@ namespace custom {
 		 * @param cap - the new capacity of the array.
 		 */
 		void init_grow(size_t cap) noexcept {
+			tracing::Scope scope(tracing::Operation::Grow);
 			if (!data) {
 				capacity = cap;
-				data = (T*)::operator new(
-						capacity * sizeof(T));
+				data = allocate(capacity);
 				return;
 			}
-			T* new_data = (T*)::operator new(cap * sizeof(T));
+			T* new_data = allocate(cap);
+			allocation_tracking::record_reallocation(ContainerType::Vector);
 
 			for (size_t i = 0; i < mSize; ++i) {
-				new_data[i] = std::move(data[i]);
+				new(&new_data[i]) T(std::move(data[i]));
 				data[i].~T();
 			}
 
-			::operator delete(data, capacity * sizeof(T));
+			deallocate(data, capacity);
 			data = new_data;
 			capacity = cap;
 		}
@@ -819,18 +982,30 @@ namespace custom {
 		 * **Time Complexity** = *O(n)* where n is the number of elements in the array.
 		 */
 		void shrink() noexcept {
+			tracing::Scope scope(tracing::Operation::Grow);
 			size_t new_capacity = capacity - capacity / 2;
-			T* new_data = (T*)::operator new(new_capacity * sizeof(T));
+			T* new_data = allocate(new_capacity);
+			allocation_tracking::record_reallocation(ContainerType::Vector);
 			for (size_t i = 0; i < mSize; ++i) {
-				new_data[i] = std::move(data[i]);
+				new(&new_data[i]) T(std::move(data[i]));
 				data[i].~T();
 			}
 
-			::operator delete(data, capacity * sizeof(T));
+			deallocate(data, capacity);
 			data = new_data;
 			capacity = new_capacity;
 		}
 	};
+
+	namespace pmr {
+		/**
+		 * A Vector whose array is allocated from a `std::pmr::memory_resource`, e.g. a
+		 * `std::pmr::monotonic_buffer_resource` whose memory is released all at once.
+		 * @tparam T - the type of the data to be stored in the array.
+		 */
+		template<typename T>
+		using Vector = custom::Vector<T, std::pmr::polymorphic_allocator<T>>;
+	}// namespace pmr
 }// namespace custom
 
 #endif// VECTOR_H
\ No newline at end of file
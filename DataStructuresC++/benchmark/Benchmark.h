@@ -0,0 +1,443 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "PerfCounters.h"
+
+namespace custom::benchmark {
+	/**
+	 * Prevents the compiler from optimising away the computation of a value which is otherwise unused.
+	 * @tparam T - the type of the value.
+	 * @param value - the value which must be computed.
+	 */
+	template<typename T>
+	inline void do_not_optimize(const T& value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static volatile const T* sink;
+		sink = &value;
+#endif
+	}
+
+	/**
+	 * The state handed to each benchmark function. The function must perform its workload `iterations()` times and
+	 * may report the number of items it processed so that a throughput can be calculated. Timing can be paused
+	 * around setup work which should not be measured.
+	 */
+	class State {
+	public:
+		State(size_t iterations, std::int64_t arg) noexcept: mIterations(iterations), mArg(arg), mItems(0), mBytes(0),
+		                                                      mPaused(std::chrono::nanoseconds::zero()) {}
+
+		/**
+		 * Returns the number of times the benchmark function must repeat its workload.
+		 * @return - an unsigned integer representing the number of iterations.
+		 */
+		[[nodiscard]] size_t iterations() const noexcept {
+			return mIterations;
+		}
+
+		/**
+		 * Returns the argument the benchmark was registered with, typically the size of the workload.
+		 * @return - an integer representing the argument of the current run.
+		 */
+		[[nodiscard]] std::int64_t arg() const noexcept {
+			return mArg;
+		}
+
+		/**
+		 * Sets the total number of items processed across every iteration, used to report a throughput.
+		 * @param items - an unsigned integer representing the number of items processed.
+		 */
+		void set_items_processed(size_t items) noexcept {
+			mItems = items;
+		}
+
+		/**
+		 * Sets the total number of bytes processed across every iteration, used to report a throughput in GB/s.
+		 * @param bytes - an unsigned integer representing the number of bytes processed.
+		 */
+		void set_bytes_processed(size_t bytes) noexcept {
+			mBytes = bytes;
+		}
+
+		/**
+		 * Records a named, user-defined value to be reported alongside the timing of the benchmark.
+		 * @param name - the name of the counter.
+		 * @param value - the value of the counter.
+		 */
+		void set_counter(const std::string& name, double value) {
+			for (auto& counter: mCounters) {
+				if (counter.first == name) {
+					counter.second = value;
+					return;
+				}
+			}
+			mCounters.emplace_back(name, value);
+		}
+
+		/**
+		 * Stops the timer and the hardware counters, e.g. before setup work which should not be measured.
+		 */
+		void pause_timing() noexcept {
+			mPauseStart = std::chrono::steady_clock::now();
+			if (mPerf)
+				mPerf->stop();
+		}
+
+		/**
+		 * Restarts the timer and the hardware counters after pause_timing().
+		 */
+		void resume_timing() noexcept {
+			if (mPerf)
+				mPerf->resume();
+			mPaused += std::chrono::steady_clock::now() - mPauseStart;
+		}
+
+	private:
+		friend class Runner;
+
+		size_t mIterations;  /**< The number of iterations the benchmark must perform. */
+		std::int64_t mArg;  /**< The argument of the current run. */
+		size_t mItems;  /**< The number of items processed across all iterations. */
+		size_t mBytes;  /**< The number of bytes processed across all iterations. */
+		std::chrono::steady_clock::duration mPaused;  /**< The total time spent with the timer paused. */
+		std::chrono::steady_clock::time_point mPauseStart;  /**< The time at which the timer was last paused. */
+		std::vector<std::pair<std::string, double>> mCounters;  /**< The user-defined counters of the run. */
+		PerfCounters* mPerf = nullptr;  /**< The hardware counters of the run, `nullptr` if none are counted. */
+	};
+
+	/**
+	 * A registered benchmark, run once per argument.
+	 */
+	struct Case {
+		std::string suite;  /**< The name of the group the benchmark belongs to. */
+		std::string name;  /**< The name of the benchmark. */
+		std::function<void(State&)> function;  /**< The benchmark function. */
+		std::vector<std::int64_t> args;  /**< The arguments the benchmark is run with. */
+	};
+
+	/**
+	 * The measurements of a single run of a benchmark.
+	 */
+	struct Result {
+		std::string name;  /**< The full name of the run, "suite/name/arg". */
+		std::string suite;  /**< The name of the group the benchmark belongs to. */
+		std::string benchmark;  /**< The name of the benchmark within its group. */
+		std::int64_t arg = 0;  /**< The argument of the run. */
+		size_t iterations = 0;  /**< The number of iterations performed. */
+		double ns_per_iteration = 0.0;  /**< The average time of one iteration in nanoseconds. */
+		double items_per_second = 0.0;  /**< The throughput of the run, 0 if no items were reported. */
+		double bytes_per_second = 0.0;  /**< The throughput of the run in bytes, 0 if no bytes were reported. */
+		std::vector<std::pair<std::string, double>> counters;  /**< The user-defined counters of the run. */
+		std::vector<std::pair<std::string, double>> perf_counters;  /**< The hardware events per iteration and the instructions per cycle, empty if not counted. */
+	};
+
+	/**
+	 * Returns the global list of benchmarks registered with BENCHMARK_CASE.
+	 * @return - a reference to the list of registered benchmarks.
+	 */
+	inline std::vector<Case>& registry() {
+		static std::vector<Case> cases;
+		return cases;
+	}
+
+	/**
+	 * Registers a benchmark, e.g. one of a family generated in a loop, which BENCHMARK_CASE cannot express.
+	 * @param suite - the name of the group the benchmark belongs to.
+	 * @param name - the name of the benchmark.
+	 * @param function - the benchmark function.
+	 * @param args - the arguments the benchmark is run with, a single run with argument 0 if empty.
+	 */
+	inline void register_benchmark(std::string suite, std::string name, std::function<void(State&)> function,
+	                               std::vector<std::int64_t> args) {
+		if (args.empty())
+			args.push_back(0);
+		registry().push_back(Case{std::move(suite), std::move(name), std::move(function), std::move(args)});
+	}
+
+	/**
+	 * A helper whose construction registers a benchmark, used by the BENCHMARK_CASE macro.
+	 */
+	struct Registration {
+		Registration(const char* suite, const char* name, void (*function)(State&), std::vector<std::int64_t> args) {
+			register_benchmark(suite, name, function, std::move(args));
+		}
+	};
+
+	/**
+	 * Runs the registered benchmarks, repeating each one with an increasing number of iterations until it runs for
+	 * at least the minimum time, and prints the results.
+	 */
+	class Runner {
+	public:
+		/**
+		 * Parses the command line options of the benchmark executable.
+		 * Supported options are `--filter=<substring>`, `--min_time=<seconds>`, `--max_arg=<n>`, which skips the runs
+		 * with a larger argument, `--json=<path>`, which writes the results to a JSON file once every benchmark
+		 * has run, and `--perf_counters[=<event>,...]`, which reports hardware events per iteration, every event of
+		 * PerfCounters if none are listed. Events which cannot be counted, e.g. in a virtual machine, are left out
+		 * with a warning.
+		 * @param argc - the number of command line arguments.
+		 * @param argv - the command line arguments.
+		 * @param max_arg - the largest argument run unless `--max_arg` is given, e.g. to keep the largest sizes of a
+		 * suite opt-in.
+		 */
+		Runner(int argc, char** argv, std::int64_t max_arg = std::numeric_limits<std::int64_t>::max()) :
+				mMinTime(0.25), mMaxArg(max_arg), mExecutable(argc > 0 ? argv[0] : "") {
+			for (int i = 1; i < argc; ++i) {
+				std::string option = argv[i];
+				if (option.rfind("--filter=", 0) == 0)
+					mFilter = option.substr(9);
+				else if (option.rfind("--min_time=", 0) == 0)
+					mMinTime = std::strtod(option.c_str() + 11, nullptr);
+				else if (option.rfind("--max_arg=", 0) == 0)
+					mMaxArg = static_cast<std::int64_t>(std::strtod(option.c_str() + 10, nullptr));
+				else if (option.rfind("--json=", 0) == 0)
+					mJsonPath = option.substr(7);
+				else if (option == "--perf_counters")
+					mPerfSelected.fill(true);
+				else if (option.rfind("--perf_counters=", 0) == 0)
+					select_perf_counters(option.substr(16));
+				else {
+					std::cerr << "Unknown option: " << option << "\n";
+					std::exit(1);
+				}
+			}
+		}
+
+		/**
+		 * Runs every registered benchmark whose full name contains the filter.
+		 * @return - the exit code of the benchmark executable.
+		 */
+		int run() {
+			open_perf_counters();
+			std::printf("%-56s %14s %14s %16s\n", "Benchmark", "Time (ns)", "Iterations", "Items/s");
+			for (const Case& bench: registry()) {
+				for (std::int64_t arg: bench.args) {
+					std::string name = bench.suite + "/" + bench.name + "/" + std::to_string(arg);
+					if (name.find(mFilter) == std::string::npos || arg > mMaxArg)
+						continue;
+					Result result = measure(bench, arg);
+					result.name = name;
+					result.suite = bench.suite;
+					result.benchmark = bench.name;
+					result.arg = arg;
+					print(result);
+					mResults.push_back(std::move(result));
+				}
+			}
+			if (!mJsonPath.empty() && !write_json()) {
+				std::cerr << "Error: could not write the results to " << mJsonPath << "\n";
+				return 1;
+			}
+			return 0;
+		}
+
+		/**
+		 * Returns the results of the benchmarks run so far.
+		 * @return - a const reference to the results, in the order the benchmarks ran.
+		 */
+		[[nodiscard]] const std::vector<Result>& results() const noexcept {
+			return mResults;
+		}
+
+	private:
+		std::string mFilter;  /**< Only benchmarks whose name contains this string are run. */
+		double mMinTime;  /**< The minimum time, in seconds, each benchmark must run for. */
+		std::int64_t mMaxArg;  /**< Runs with a larger argument are skipped. */
+		std::string mExecutable;  /**< The path of the benchmark executable, recorded in the JSON output. */
+		std::string mJsonPath;  /**< The file the results are written to as JSON, none if empty. */
+		std::vector<Result> mResults;  /**< The results of every benchmark run. */
+		std::array<bool, PerfCounters::EventCount> mPerfSelected{};  /**< Whether each hardware event was requested. */
+		std::unique_ptr<PerfCounters> mPerf;  /**< The hardware counters, `nullptr` if none are counted. */
+
+		void select_perf_counters(const std::string& list) {
+			size_t start = 0;
+			while (start <= list.size()) {
+				size_t end = std::min(list.find(',', start), list.size());
+				std::string event = list.substr(start, end - start);
+				bool known = false;
+				for (int i = 0; i < PerfCounters::EventCount; ++i) {
+					if (event == PerfCounters::name(static_cast<PerfCounters::Event>(i)))
+						mPerfSelected[i] = known = true;
+				}
+				if (!known) {
+					std::cerr << "Unknown hardware event: " << event << "\n";
+					std::exit(1);
+				}
+				start = end + 1;
+			}
+		}
+
+		// Falls back to timings alone, with a warning, when the selected events cannot be counted
+		void open_perf_counters() {
+			if (std::find(mPerfSelected.begin(), mPerfSelected.end(), true) == mPerfSelected.end())
+				return;
+			mPerf = std::make_unique<PerfCounters>(mPerfSelected);
+			if (!mPerf->any_available()) {
+				std::cerr << "Warning: hardware counters are unavailable (" << mPerf->error()
+				          << "), reporting timings only\n";
+				mPerf.reset();
+			} else if (!mPerf->error().empty())
+				std::cerr << "Warning: some hardware counters are unavailable (" << mPerf->error() << ")\n";
+		}
+
+		void add_perf_counters(Result& result) const {
+			std::array<double, PerfCounters::EventCount> values = mPerf->read();
+			auto iterations = static_cast<double>(result.iterations);
+			for (int i = 0; i < PerfCounters::EventCount; ++i) {
+				if (mPerf->available(static_cast<PerfCounters::Event>(i)))
+					result.perf_counters.emplace_back(PerfCounters::name(static_cast<PerfCounters::Event>(i)),
+					                                  values[i] / iterations);
+			}
+			if (mPerf->available(PerfCounters::Cycles) && mPerf->available(PerfCounters::Instructions) &&
+			    values[PerfCounters::Cycles] > 0)
+				result.perf_counters.emplace_back("ipc", values[PerfCounters::Instructions] / values[PerfCounters::Cycles]);
+		}
+
+		Result measure(const Case& bench, std::int64_t arg) const {
+			size_t iterations = 1;
+			while (true) {
+				State state(iterations, arg);
+				state.mPerf = mPerf.get();
+				if (mPerf)
+					mPerf->start();
+				auto start = std::chrono::steady_clock::now();
+				bench.function(state);
+				auto elapsed = std::chrono::steady_clock::now() - start - state.mPaused;
+				if (mPerf)
+					mPerf->stop();
+				double seconds = std::chrono::duration<double>(elapsed).count();
+				if (seconds >= mMinTime || iterations >= (size_t(1) << 40)) {
+					Result result;
+					result.iterations = iterations;
+					result.ns_per_iteration = seconds * 1e9 / static_cast<double>(iterations);
+					result.items_per_second = state.mItems && seconds > 0 ? static_cast<double>(state.mItems) / seconds : 0.0;
+					result.bytes_per_second = state.mBytes && seconds > 0 ? static_cast<double>(state.mBytes) / seconds : 0.0;
+					result.counters = state.mCounters;
+					if (mPerf)
+						add_perf_counters(result);
+					return result;
+				}
+				double scale = seconds > 0 ? 1.4 * mMinTime / seconds : 10.0;
+				iterations = std::max(iterations + 1, static_cast<size_t>(static_cast<double>(iterations) * std::min(scale, 10.0)));
+			}
+		}
+
+		static std::string json_string(const std::string& text) {
+			std::string quoted = "\"";
+			for (char c: text) {
+				if (c == '"' || c == '\\') {
+					quoted += '\\';
+					quoted += c;
+				} else if (static_cast<unsigned char>(c) < 0x20) {
+					char escaped[8];
+					std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+					quoted += escaped;
+				} else
+					quoted += c;
+			}
+			return quoted + "\"";
+		}
+
+		static std::string json_number(double value) {
+			// JSON has no representation for infinities and NaNs
+			if (!std::isfinite(value))
+				return "null";
+			char number[32];
+			std::snprintf(number, sizeof(number), "%.9g", value);
+			return number;
+		}
+
+		// Writes the results with the context needed to compare them across machines and releases
+		bool write_json() const {
+			std::ofstream file(mJsonPath);
+			if (!file)
+				return false;
+			char date[32];
+			std::time_t now = std::time(nullptr);
+			std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+			file << "{\n  \"context\": {\n";
+			file << "    \"date\": " << json_string(date) << ",\n";
+			file << "    \"executable\": " << json_string(mExecutable) << ",\n";
+#if defined(__VERSION__)
+			file << "    \"compiler\": " << json_string(__VERSION__) << ",\n";
+#endif
+			file << "    \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+			file << "    \"min_time\": " << json_number(mMinTime) << ",\n";
+			file << "    \"perf_counters\": [";
+			for (int i = 0, listed = 0; mPerf && i < PerfCounters::EventCount; ++i) {
+				if (mPerf->available(static_cast<PerfCounters::Event>(i)))
+					file << (listed++ ? ", " : "") << json_string(PerfCounters::name(static_cast<PerfCounters::Event>(i)));
+			}
+			file << "]\n  },\n";
+			file << "  \"benchmarks\": [";
+			for (size_t i = 0; i < mResults.size(); ++i) {
+				const Result& result = mResults[i];
+				file << (i ? ",\n" : "\n") << "    {\"name\": " << json_string(result.name)
+				     << ", \"suite\": " << json_string(result.suite)
+				     << ", \"benchmark\": " << json_string(result.benchmark)
+				     << ", \"arg\": " << result.arg
+				     << ", \"iterations\": " << result.iterations
+				     << ", \"ns_per_iteration\": " << json_number(result.ns_per_iteration)
+				     << ", \"items_per_second\": " << json_number(result.items_per_second)
+				     << ", \"bytes_per_second\": " << json_number(result.bytes_per_second)
+				     << ", \"counters\": {";
+				for (size_t j = 0; j < result.counters.size(); ++j)
+					file << (j ? ", " : "") << json_string(result.counters[j].first) << ": "
+					     << json_number(result.counters[j].second);
+				file << "}, \"perf_counters\": {";
+				for (size_t j = 0; j < result.perf_counters.size(); ++j)
+					file << (j ? ", " : "") << json_string(result.perf_counters[j].first) << ": "
+					     << json_number(result.perf_counters[j].second);
+				file << "}}";
+			}
+			file << "\n  ]\n}\n";
+			return static_cast<bool>(file.flush());
+		}
+
+		static void print(const Result& result) {
+			std::printf("%-56s %14.1f %14zu %16.4g", result.name.c_str(), result.ns_per_iteration, result.iterations,
+			            result.items_per_second);
+			if (result.bytes_per_second > 0)
+				std::printf("  GB/s=%.3f", result.bytes_per_second / 1e9);
+			for (const auto& [name, value]: result.counters)
+				std::printf("  %s=%g", name.c_str(), value);
+			for (const auto& [name, value]: result.perf_counters)
+				std::printf("  %s=%.4g", name.c_str(), value);
+			std::printf("\n");
+		}
+	};
+}// namespace custom::benchmark
+
+/**
+ * Defines and registers a benchmark function taking a `custom::benchmark::State&`. Any further arguments are the
+ * values the benchmark is run with, available through State::arg().
+ */
+#define BENCHMARK_CASE(suite, name, ...)                                                                           \
+	static void suite##_##name##_Benchmark(custom::benchmark::State&);                                          \
+	static const custom::benchmark::Registration suite##_##name##_Registration(#suite, #name,                   \
+	                                                                           &suite##_##name##_Benchmark,     \
+	                                                                           {__VA_ARGS__});                  \
+	static void suite##_##name##_Benchmark
+
+#endif// BENCHMARK_H
@@ -0,0 +1,132 @@
+/**
+ * The cost of the checking policy on the hot paths of the containers: indexing, iterating and popping. The same
+ * source is built once per policy, as CheckingChecked_run, CheckingAssertOnly_run and CheckingUnchecked_run, since the
+ * policy must be the same in every translation unit of a program. Running the three with the same arguments, e.g.
+ * `--json=<path>` for each, compares the policies run by run.
+ */
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "../Array.h"
+#include "../DoublyLinkedList.h"
+#include "../LinkedList.h"
+#include "../Queue.h"
+#include "../Stack.h"
+#include "../Vector.h"
+#include "Benchmark.h"
+
+namespace {
+	custom::Vector<int> make_vector(size_t n) {
+		custom::Vector<int> vector;
+		for (size_t i = 0; i < n; ++i)
+			vector.push_back(static_cast<int>(i));
+		return vector;
+	}
+
+	void report(custom::benchmark::State& state, size_t n) {
+		state.set_items_processed(state.iterations() * n);
+		state.set_counter("policy", static_cast<double>(custom::checking));
+	}
+}
+
+BENCHMARK_CASE(Checking, VectorIndex, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	const auto n = static_cast<size_t>(state.arg());
+	state.pause_timing();
+	custom::Vector<int> vector = make_vector(n);
+	state.resume_timing();
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		std::int64_t sum = 0;
+		for (size_t j = 0; j < n; ++j)
+			sum += vector[j];
+		custom::benchmark::do_not_optimize(sum);
+	}
+	state.pause_timing();
+	report(state, n);
+}
+
+BENCHMARK_CASE(Checking, VectorIterate, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	const auto n = static_cast<size_t>(state.arg());
+	state.pause_timing();
+	custom::Vector<int> vector = make_vector(n);
+	state.resume_timing();
+	for (size_t i = 0; i < state.iterations(); ++i)
+		custom::benchmark::do_not_optimize(std::accumulate(vector.begin(), vector.end(), std::int64_t{0}));
+	state.pause_timing();
+	report(state, n);
+}
+
+BENCHMARK_CASE(Checking, ArrayIndex, 4096)(custom::benchmark::State& state) {
+	state.pause_timing();
+	custom::Array<int, 4096> array;
+	for (size_t j = 0; j < 4096; ++j)
+		array[j] = static_cast<int>(j);
+	state.resume_timing();
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		std::int64_t sum = 0;
+		for (size_t j = 0; j < 4096; ++j)
+			sum += array[j];
+		custom::benchmark::do_not_optimize(sum);
+	}
+	state.pause_timing();
+	report(state, 4096);
+}
+
+BENCHMARK_CASE(Checking, LinkedListIterate, 1000, 100000)(custom::benchmark::State& state) {
+	const auto n = static_cast<size_t>(state.arg());
+	state.pause_timing();
+	custom::LinkedList<int> list;
+	for (size_t j = 0; j < n; ++j)
+		list.push_front(static_cast<int>(j));
+	state.resume_timing();
+	for (size_t i = 0; i < state.iterations(); ++i)
+		custom::benchmark::do_not_optimize(std::accumulate(list.begin(), list.end(), std::int64_t{0}));
+	state.pause_timing();
+	report(state, n);
+}
+
+BENCHMARK_CASE(Checking, DoublyLinkedListIterate, 1000, 100000)(custom::benchmark::State& state) {
+	const auto n = static_cast<size_t>(state.arg());
+	state.pause_timing();
+	custom::DoublyLinkedList<int> list;
+	for (size_t j = 0; j < n; ++j)
+		list.push_back(static_cast<int>(j));
+	state.resume_timing();
+	for (size_t i = 0; i < state.iterations(); ++i)
+		custom::benchmark::do_not_optimize(std::accumulate(list.begin(), list.end(), std::int64_t{0}));
+	state.pause_timing();
+	report(state, n);
+}
+
+BENCHMARK_CASE(Checking, StackPushPop, 1000, 100000)(custom::benchmark::State& state) {
+	const auto n = static_cast<size_t>(state.arg());
+	custom::Stack<int> stack;
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		for (size_t j = 0; j < n; ++j)
+			stack.push(static_cast<int>(j));
+		std::int64_t sum = 0;
+		for (size_t j = 0; j < n; ++j)
+			sum += stack.pop();
+		custom::benchmark::do_not_optimize(sum);
+	}
+	report(state, n);
+}
+
+BENCHMARK_CASE(Checking, QueueEnqueueDequeue, 1000, 100000)(custom::benchmark::State& state) {
+	const auto n = static_cast<size_t>(state.arg());
+	custom::Queue<int> queue;
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		for (size_t j = 0; j < n; ++j)
+			queue.enqueue(static_cast<int>(j));
+		std::int64_t sum = 0;
+		for (size_t j = 0; j < n; ++j)
+			sum += queue.peek() + queue.dequeue();
+		custom::benchmark::do_not_optimize(sum);
+	}
+	report(state, n);
+}
+
+int main(int argc, char** argv) {
+	custom::benchmark::Runner runner(argc, argv);
+	return runner.run();
+}
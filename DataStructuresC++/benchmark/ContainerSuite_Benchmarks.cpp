@@ -0,0 +1,829 @@
+/**
+ * The container benchmark suite: every container of the library against its closest std counterpart, on the same
+ * keys, at sizes from 10 to 10^7. Each container is measured on five workloads:
+ *  - Insert builds the container from the keys 0 to n - 1 in a random order,
+ *  - Lookup finds 256 random keys which are present,
+ *  - Iterate visits every element, through contents() where a container has no iterators,
+ *  - Erase removes every element, with the cheapest removal the container offers,
+ *  - Copy copy constructs the container.
+ * Building, copying and destroying the containers which are not measured is done with the timer paused, and small
+ * containers are built and copied in batches so starting and stopping the timer does not dominate their runs.
+ *
+ * A workload is skipped where a container cannot support it: Array has a fixed size so it cannot be erased from,
+ * BinarySearchTree has no public lookup and a shallow copy, Graph has no working copy constructor, and the quadratic
+ * workloads (ordered PriorityQueue insertion, the linear lookups of the lists and adapters, and Graph lookup and
+ * removal) stop at the size where a single run still takes well under a second. The std side of a skipped workload is
+ * skipped with it, so every result has a counterpart.
+ *
+ * Runs above 10^6 elements are skipped unless `--max_arg` is given, e.g. `--max_arg=1e7` for the whole suite, and
+ * `--json=<path>` writes the results for tracking across releases.
+ */
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <forward_list>
+#include <functional>
+#include <limits>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <set>
+#include <stack>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../Array.h"
+#include "../BinarySearchTree.h"
+#include "../DoublyLinkedList.h"
+#include "../Graph.h"
+#include "../LinkedList.h"
+#include "../Map.h"
+#include "../Queue.h"
+#include "../Stack.h"
+#include "../Vector.h"
+#include "Benchmark.h"
+
+namespace {
+	using custom::benchmark::State;
+
+	constexpr std::int64_t unlimited = std::numeric_limits<std::int64_t>::max();
+	constexpr std::int64_t quadratic_limit = 10000;  // The largest size of the workloads which are O(n^2) per run
+	constexpr std::int64_t linear_lookup_limit = 100000;  // The largest size of the workloads which are O(n) per lookup
+
+	// The largest size each workload of a container is run at, 0 where the container does not support it
+	struct Limits {
+		std::int64_t insert = unlimited;
+		std::int64_t lookup = unlimited;
+		std::int64_t iterate = unlimited;
+		std::int64_t erase = unlimited;
+		std::int64_t copy = unlimited;
+	};
+
+	// The keys 0 to size - 1 in a random order, so ordered containers see no pattern and trees are balanced on average
+	std::vector<int> make_keys(size_t size) {
+		std::vector<int> keys(size);
+		std::iota(keys.begin(), keys.end(), 0);
+		std::shuffle(keys.begin(), keys.end(), std::mt19937(91));
+		return keys;
+	}
+
+	// The keys looked up by one iteration of the lookup workload, all of them present in the container
+	std::vector<int> make_probes(size_t size) {
+		std::vector<int> probes(256);
+		std::mt19937 generator(size);
+		for (int& probe: probes)
+			probe = static_cast<int>(generator() % size);
+		return probes;
+	}
+
+	// The number of containers built or copied in one timed region, about 4096 elements in all
+	size_t batch_size(size_t size) {
+		return std::max<size_t>(1, 4096 / size);
+	}
+
+	// Exposes the underlying container of a std container adapter, which the adapters have no lookup or iteration for
+	template<typename Adapter>
+	struct Exposed : Adapter {
+		using Adapter::c;
+	};
+
+	template<typename Range>
+	long long sum(const Range& range) {
+		long long total = 0;
+		for (const auto& value: range)
+			total += value;
+		return total;
+	}
+
+	template<typename Range>
+	long long sum_values(const Range& range) {
+		long long total = 0;
+		for (const auto& value: range)
+			total += value.second;
+		return total;
+	}
+
+	// Every container is described by its operations on int keys: build returns a container holding the keys, lookup
+	// returns the sum of what it found for the probes, iterate returns the sum of the elements and erase empties it.
+
+	struct CustomVector {
+		using Container = custom::Vector<int>;
+		static constexpr const char* name = "custom";
+		static constexpr Limits limits{};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (int key: keys)
+				container->push_back(key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += container[probe];
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container);
+		}
+
+		static void erase(Container& container, const std::vector<int>&) {
+			while (!container.empty())
+				container.pop_back();
+		}
+	};
+
+	struct StdVector {
+		using Container = std::vector<int>;
+		static constexpr const char* name = "std";
+		static constexpr Limits limits{};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (int key: keys)
+				container->push_back(key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += container[probe];
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container);
+		}
+
+		static void erase(Container& container, const std::vector<int>&) {
+			while (!container.empty())
+				container.pop_back();
+		}
+	};
+
+	// The size of an Array is a template argument, so the array workloads are registered once per size
+	template<size_t Size>
+	struct CustomArray {
+		using Container = custom::Array<int, Size>;
+		static constexpr const char* name = "custom";
+		static constexpr Limits limits{.erase = 0};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (size_t i = 0; i < Size; ++i)
+				(*container)[i] = keys[i];
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += container[probe];
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container);
+		}
+	};
+
+	template<size_t Size>
+	struct StdArray {
+		using Container = std::array<int, Size>;
+		static constexpr const char* name = "std";
+		static constexpr Limits limits{.erase = 0};
+
+		// Left uninitialised before it is filled, as the elements of a custom::Array are
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique_for_overwrite<Container>();
+			for (size_t i = 0; i < Size; ++i)
+				(*container)[i] = keys[i];
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += container[probe];
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container);
+		}
+	};
+
+	struct CustomLinkedList {
+		using Container = custom::LinkedList<int>;
+		static constexpr const char* name = "custom";
+		static constexpr Limits limits{.lookup = linear_lookup_limit};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (int key: keys)
+				container->append(key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += container.find(probe);
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container);
+		}
+
+		static void erase(Container& container, const std::vector<int>&) {
+			while (!container.empty())
+				container.pop_front();
+		}
+	};
+
+	struct StdForwardList {
+		using Container = std::forward_list<int>;
+		static constexpr const char* name = "std";
+		static constexpr Limits limits{.lookup = linear_lookup_limit};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			auto tail = container->before_begin();
+			for (int key: keys)
+				tail = container->insert_after(tail, key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += std::distance(container.begin(), std::find(container.begin(), container.end(), probe));
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container);
+		}
+
+		static void erase(Container& container, const std::vector<int>&) {
+			while (!container.empty())
+				container.pop_front();
+		}
+	};
+
+	struct CustomDoublyLinkedList {
+		using Container = custom::DoublyLinkedList<int>;
+		static constexpr const char* name = "custom";
+		static constexpr Limits limits{.lookup = linear_lookup_limit};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (int key: keys)
+				container->append(key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += container.find(probe);
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container);
+		}
+
+		static void erase(Container& container, const std::vector<int>&) {
+			while (!container.empty())
+				container.pop_back();
+		}
+	};
+
+	struct StdList {
+		using Container = std::list<int>;
+		static constexpr const char* name = "std";
+		static constexpr Limits limits{.lookup = linear_lookup_limit};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (int key: keys)
+				container->push_back(key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += std::distance(container.begin(), std::find(container.begin(), container.end(), probe));
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container);
+		}
+
+		static void erase(Container& container, const std::vector<int>&) {
+			while (!container.empty())
+				container.pop_back();
+		}
+	};
+
+	struct CustomStack {
+		using Container = custom::Stack<int>;
+		static constexpr const char* name = "custom";
+		static constexpr Limits limits{.lookup = linear_lookup_limit};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (int key: keys)
+				container->push(key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += container.contains(probe);
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container.contents());
+		}
+
+		static void erase(Container& container, const std::vector<int>&) {
+			while (!container.empty())
+				custom::benchmark::do_not_optimize(container.pop());
+		}
+	};
+
+	struct StdStack {
+		using Container = Exposed<std::stack<int>>;
+		static constexpr const char* name = "std";
+		static constexpr Limits limits{.lookup = linear_lookup_limit};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (int key: keys)
+				container->push(key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += std::find(container.c.begin(), container.c.end(), probe) != container.c.end();
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container.c);
+		}
+
+		static void erase(Container& container, const std::vector<int>&) {
+			while (!container.empty()) {
+				custom::benchmark::do_not_optimize(container.top());
+				container.pop();
+			}
+		}
+	};
+
+	struct CustomQueue {
+		using Container = custom::Queue<int>;
+		static constexpr const char* name = "custom";
+		static constexpr Limits limits{.lookup = linear_lookup_limit};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (int key: keys)
+				container->enqueue(key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += container.contains(probe);
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container.contents());
+		}
+
+		static void erase(Container& container, const std::vector<int>&) {
+			while (!container.empty())
+				custom::benchmark::do_not_optimize(container.dequeue());
+		}
+	};
+
+	struct StdQueue {
+		using Container = Exposed<std::queue<int>>;
+		static constexpr const char* name = "std";
+		static constexpr Limits limits{.lookup = linear_lookup_limit};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (int key: keys)
+				container->push(key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += std::find(container.c.begin(), container.c.end(), probe) != container.c.end();
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container.c);
+		}
+
+		static void erase(Container& container, const std::vector<int>&) {
+			while (!container.empty()) {
+				custom::benchmark::do_not_optimize(container.front());
+				container.pop();
+			}
+		}
+	};
+
+	// An ordered enqueue walks the queue to find its position, so building the queue is quadratic
+	struct CustomPriorityQueue {
+		using Container = custom::PriorityQueue<int, custom::queue_policy::Ascending>;
+		static constexpr const char* name = "custom";
+		static constexpr Limits limits{quadratic_limit, quadratic_limit, quadratic_limit, quadratic_limit,
+		                               quadratic_limit};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (int key: keys)
+				container->enqueue(key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += container.contains(probe);
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container.contents());
+		}
+
+		static void erase(Container& container, const std::vector<int>&) {
+			while (!container.empty())
+				custom::benchmark::do_not_optimize(container.dequeue());
+		}
+	};
+
+	struct StdPriorityQueue {
+		using Container = Exposed<std::priority_queue<int, std::vector<int>, std::greater<>>>;
+		static constexpr const char* name = "std";
+		static constexpr Limits limits{.lookup = linear_lookup_limit};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (int key: keys)
+				container->push(key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += std::find(container.c.begin(), container.c.end(), probe) != container.c.end();
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container.c);
+		}
+
+		static void erase(Container& container, const std::vector<int>&) {
+			while (!container.empty()) {
+				custom::benchmark::do_not_optimize(container.top());
+				container.pop();
+			}
+		}
+	};
+
+	// Map never rehashes, so both maps are given a bucket per key up front
+	struct CustomMap {
+		using Container = custom::Map<int, int>;
+		static constexpr const char* name = "custom";
+		static constexpr Limits limits{};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>(std::max<size_t>(keys.size(), 1));
+			for (int key: keys)
+				container->add(key, key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += container.at(probe);
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum_values(container.contents());
+		}
+
+		static void erase(Container& container, const std::vector<int>& keys) {
+			for (int key: keys)
+				container.remove(key);
+		}
+	};
+
+	struct StdUnorderedMap {
+		using Container = std::unordered_map<int, int>;
+		static constexpr const char* name = "std";
+		static constexpr Limits limits{};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			container->reserve(keys.size());
+			for (int key: keys)
+				container->emplace(key, key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += container.find(probe)->second;
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum_values(container);
+		}
+
+		static void erase(Container& container, const std::vector<int>& keys) {
+			for (int key: keys)
+				container.erase(key);
+		}
+	};
+
+	// The tree is rooted at the first key, and only removes leaves reliably, so the keys are removed in the reverse of
+	// the order they were added in, down to the root which is cleared
+	struct CustomBinarySearchTree {
+		using Container = custom::BinarySearchTree<int>;
+		static constexpr const char* name = "custom";
+		static constexpr Limits limits{.lookup = 0, .copy = 0};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>(keys.front());
+			for (size_t i = 1; i < keys.size(); ++i)
+				container->add(keys[i]);
+			return container;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container.contents_InOrder());
+		}
+
+		static void erase(Container& container, const std::vector<int>& keys) {
+			for (size_t i = keys.size() - 1; i > 0; --i)
+				container.remove(keys[i]);
+			container.clear();
+		}
+	};
+
+	struct StdSet {
+		using Container = std::set<int>;
+		static constexpr const char* name = "std";
+		static constexpr Limits limits{.lookup = 0, .copy = 0};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (int key: keys)
+				container->insert(key);
+			return container;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum(container);
+		}
+
+		static void erase(Container& container, const std::vector<int>& keys) {
+			for (size_t i = keys.size(); i > 0; --i)
+				container.erase(keys[i - 1]);
+		}
+	};
+
+	// The nodes of a graph are found by a linear search, so lookup and removal are linear per key
+	struct CustomGraph {
+		using Container = custom::Graph<int, int>;
+		static constexpr const char* name = "custom";
+		static constexpr Limits limits{.lookup = quadratic_limit, .erase = quadratic_limit, .copy = 0};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (int key: keys)
+				container->add_node(key, key);
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += container.contains(probe);
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			return sum_values(container.contents());
+		}
+
+		static void erase(Container& container, const std::vector<int>& keys) {
+			for (int key: keys)
+				container.remove(key);
+		}
+	};
+
+	// An adjacency list keyed by node, holding each node's neighbours as the graph does
+	struct StdAdjacencyList {
+		using Container = std::unordered_map<int, std::vector<int>>;
+		static constexpr const char* name = "std";
+		static constexpr Limits limits{.lookup = quadratic_limit, .erase = quadratic_limit, .copy = 0};
+
+		static std::unique_ptr<Container> build(const std::vector<int>& keys) {
+			auto container = std::make_unique<Container>();
+			for (int key: keys)
+				container->try_emplace(key, std::vector<int>{key});
+			return container;
+		}
+
+		static long long lookup(const Container& container, const std::vector<int>& probes) {
+			long long total = 0;
+			for (int probe: probes)
+				total += container.contains(probe);
+			return total;
+		}
+
+		static long long iterate(const Container& container) {
+			long long total = 0;
+			for (const auto& node: container)
+				total += node.second.front();
+			return total;
+		}
+
+		static void erase(Container& container, const std::vector<int>& keys) {
+			for (int key: keys)
+				container.erase(key);
+		}
+	};
+
+	template<typename Ops>
+	void insert(State& state) {
+		auto size = static_cast<size_t>(state.arg());
+		state.pause_timing();
+		const std::vector<int> keys = make_keys(size);
+		std::vector<std::unique_ptr<typename Ops::Container>> containers(batch_size(size));
+		state.resume_timing();
+		for (size_t i = 0; i < state.iterations(); ++i) {
+			for (auto& container: containers)
+				container = Ops::build(keys);
+			state.pause_timing();
+			for (auto& container: containers)
+				container.reset();
+			state.resume_timing();
+		}
+		state.set_items_processed(size * containers.size() * state.iterations());
+	}
+
+	template<typename Ops>
+	void lookup(State& state) {
+		auto size = static_cast<size_t>(state.arg());
+		state.pause_timing();
+		auto container = Ops::build(make_keys(size));
+		const std::vector<int> probes = make_probes(size);
+		state.resume_timing();
+		for (size_t i = 0; i < state.iterations(); ++i)
+			custom::benchmark::do_not_optimize(Ops::lookup(*container, probes));
+		state.pause_timing();
+		container.reset();
+		state.resume_timing();
+		state.set_items_processed(probes.size() * state.iterations());
+	}
+
+	template<typename Ops>
+	void iterate(State& state) {
+		auto size = static_cast<size_t>(state.arg());
+		state.pause_timing();
+		auto container = Ops::build(make_keys(size));
+		state.resume_timing();
+		for (size_t i = 0; i < state.iterations(); ++i)
+			custom::benchmark::do_not_optimize(Ops::iterate(*container));
+		state.pause_timing();
+		container.reset();
+		state.resume_timing();
+		state.set_items_processed(size * state.iterations());
+	}
+
+	template<typename Ops>
+	void erase(State& state) {
+		auto size = static_cast<size_t>(state.arg());
+		state.pause_timing();
+		const std::vector<int> keys = make_keys(size);
+		std::vector<std::unique_ptr<typename Ops::Container>> containers(batch_size(size));
+		state.resume_timing();
+		for (size_t i = 0; i < state.iterations(); ++i) {
+			state.pause_timing();
+			for (auto& container: containers)
+				container = Ops::build(keys);
+			state.resume_timing();
+			for (auto& container: containers)
+				Ops::erase(*container, keys);
+		}
+		state.pause_timing();
+		containers.clear();
+		state.resume_timing();
+		state.set_items_processed(size * batch_size(size) * state.iterations());
+	}
+
+	template<typename Ops>
+	void copy(State& state) {
+		auto size = static_cast<size_t>(state.arg());
+		state.pause_timing();
+		const auto container = Ops::build(make_keys(size));
+		std::vector<std::unique_ptr<typename Ops::Container>> copies(batch_size(size));
+		state.resume_timing();
+		for (size_t i = 0; i < state.iterations(); ++i) {
+			for (auto& copy: copies)
+				copy = std::make_unique<typename Ops::Container>(*container);
+			state.pause_timing();
+			for (auto& copy: copies)
+				copy.reset();
+			state.resume_timing();
+		}
+		state.set_items_processed(size * copies.size() * state.iterations());
+	}
+
+	void register_workload(const std::string& name, std::function<void(State&)> function,
+	                       const std::vector<std::int64_t>& sizes, std::int64_t limit) {
+		std::vector<std::int64_t> args;
+		for (std::int64_t size: sizes)
+			if (size <= limit)
+				args.push_back(size);
+		if (!args.empty())
+			custom::benchmark::register_benchmark("Containers", name, std::move(function), std::move(args));
+	}
+
+	// Registers the workloads of a container which it supports, named "<container>/<workload>/<custom or std>"
+	template<typename Ops>
+	void register_container(const std::string& container, const std::vector<std::int64_t>& sizes) {
+		const std::string suffix = std::string("/") + Ops::name;
+		if constexpr (Ops::limits.insert > 0)
+			register_workload(container + "/Insert" + suffix, insert<Ops>, sizes, Ops::limits.insert);
+		if constexpr (Ops::limits.lookup > 0)
+			register_workload(container + "/Lookup" + suffix, lookup<Ops>, sizes, Ops::limits.lookup);
+		if constexpr (Ops::limits.iterate > 0)
+			register_workload(container + "/Iterate" + suffix, iterate<Ops>, sizes, Ops::limits.iterate);
+		if constexpr (Ops::limits.erase > 0)
+			register_workload(container + "/Erase" + suffix, erase<Ops>, sizes, Ops::limits.erase);
+		if constexpr (Ops::limits.copy > 0)
+			register_workload(container + "/Copy" + suffix, copy<Ops>, sizes, Ops::limits.copy);
+	}
+
+	template<typename... Ops>
+	void register_containers(const std::string& container, const std::vector<std::int64_t>& sizes) {
+		(register_container<Ops>(container, sizes), ...);
+	}
+
+	template<size_t... Sizes>
+	void register_arrays() {
+		(register_containers<CustomArray<Sizes>, StdArray<Sizes>>("Array", {Sizes}), ...);
+	}
+}
+
+int main(int argc, char** argv) {
+	const std::vector<std::int64_t> sizes = {10, 100, 1000, 10000, 100000, 1000000, 10000000};
+	register_containers<CustomVector, StdVector>("Vector", sizes);
+	register_arrays<10, 100, 1000, 10000, 100000, 1000000, 10000000>();
+	register_containers<CustomLinkedList, StdForwardList>("LinkedList", sizes);
+	register_containers<CustomDoublyLinkedList, StdList>("DoublyLinkedList", sizes);
+	register_containers<CustomStack, StdStack>("Stack", sizes);
+	register_containers<CustomQueue, StdQueue>("Queue", sizes);
+	register_containers<CustomPriorityQueue, StdPriorityQueue>("PriorityQueue", sizes);
+	register_containers<CustomMap, StdUnorderedMap>("Map", sizes);
+	register_containers<CustomBinarySearchTree, StdSet>("BinarySearchTree", sizes);
+	register_containers<CustomGraph, StdAdjacencyList>("Graph", sizes);
+	custom::benchmark::Runner runner(argc, argv, 1000000);
+	return runner.run();
+}
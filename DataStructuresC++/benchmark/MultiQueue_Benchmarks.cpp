@@ -0,0 +1,133 @@
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../MultiQueue.h"
+#include "Benchmark.h"
+
+namespace {
+	/**
+	 * A strict concurrent priority queue, a binary heap behind a single mutex, used as the baseline for MultiQueue.
+	 */
+	template<typename T>
+	class LockedHeap {
+	public:
+		explicit LockedHeap(size_t) {}
+
+		void push(const T& data) {
+			std::lock_guard<std::mutex> lock(mMutex);
+			mHeap.push(data);
+		}
+
+		template<typename Function>
+		bool try_pop(Function&& function) {
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (mHeap.empty())
+				return false;
+			T data = mHeap.top();
+			mHeap.pop();
+			function(std::move(data));
+			return true;
+		}
+
+	private:
+		std::mutex mMutex;
+		std::priority_queue<T, std::vector<T>, std::greater<T>> mHeap;
+	};
+
+	constexpr size_t prefill = 1 << 16;  // Elements in the queue while the throughput is measured
+	constexpr size_t operations = 1 << 14;  // Pop and push pairs performed by each thread
+
+	std::vector<std::uint32_t> random_keys(size_t count) {
+		std::vector<std::uint32_t> keys(count);
+		std::mt19937 generator(7);
+		for (std::uint32_t& key: keys)
+			key = generator();
+		return keys;
+	}
+
+	// The hold model of a best-first search: each thread repeatedly pops an element and pushes a successor with a
+	// larger key, keeping the size of the queue steady.
+	template<typename QueueType>
+	void hold_throughput(custom::benchmark::State& state) {
+		auto threads = static_cast<size_t>(state.arg());
+		std::vector<std::uint32_t> keys = random_keys(prefill);
+		for (size_t i = 0; i < state.iterations(); ++i) {
+			state.pause_timing();
+			QueueType queue(threads);
+			for (std::uint32_t key: keys)
+				queue.push(key);
+			state.resume_timing();
+			std::vector<std::thread> workers;
+			for (size_t t = 0; t < threads; ++t) {
+				workers.emplace_back([&queue, t] {
+					std::minstd_rand generator(static_cast<std::uint32_t>(t + 1));
+					for (size_t j = 0; j < operations; ++j) {
+						std::uint32_t key = 0;
+						queue.try_pop([&key](std::uint32_t&& value) { key = value; });
+						queue.push(key + generator() % 1024);
+					}
+				});
+			}
+			for (std::thread& worker: workers)
+				worker.join();
+		}
+		state.set_items_processed(state.iterations() * threads * operations * 2);
+	}
+
+	// Every thread pops from a prefilled queue until it is empty, numbering its pops with a shared counter while the
+	// element is still locked, so the rank error of the resulting linearisation can be measured.
+	template<typename QueueType>
+	void pop_rank_error(custom::benchmark::State& state) {
+		auto threads = static_cast<size_t>(state.arg());
+		std::vector<std::uint32_t> keys = random_keys(prefill);
+		std::vector<std::uint32_t> order(prefill);
+		custom::RankError error;
+		for (size_t i = 0; i < state.iterations(); ++i) {
+			state.pause_timing();
+			QueueType queue(threads);
+			for (std::uint32_t key: keys)
+				queue.push(key);
+			std::atomic<size_t> ticket{0};
+			state.resume_timing();
+			std::vector<std::thread> workers;
+			for (size_t t = 0; t < threads; ++t) {
+				workers.emplace_back([&queue, &ticket, &order] {
+					auto record = [&ticket, &order](std::uint32_t&& value) {
+						order[ticket.fetch_add(1, std::memory_order_relaxed)] = value;
+					};
+					while (queue.try_pop(record)) {}
+				});
+			}
+			for (std::thread& worker: workers)
+				worker.join();
+			state.pause_timing();
+			error = custom::rank_error(order.begin(), order.end());
+			state.resume_timing();
+		}
+		state.set_items_processed(state.iterations() * prefill);
+		state.set_counter("mean_rank_error", error.mean);
+		state.set_counter("max_rank_error", static_cast<double>(error.max));
+	}
+}// namespace
+
+BENCHMARK_CASE(MultiQueue, HoldThroughput, 1, 2, 4, 8, 16)(custom::benchmark::State& state) {
+	hold_throughput<custom::MultiQueue<std::uint32_t>>(state);
+}
+
+BENCHMARK_CASE(LockedHeap, HoldThroughput, 1, 2, 4, 8, 16)(custom::benchmark::State& state) {
+	hold_throughput<LockedHeap<std::uint32_t>>(state);
+}
+
+BENCHMARK_CASE(MultiQueue, PopRankError, 1, 2, 4, 8, 16)(custom::benchmark::State& state) {
+	pop_rank_error<custom::MultiQueue<std::uint32_t>>(state);
+}
+
+BENCHMARK_CASE(LockedHeap, PopRankError, 1, 2, 4, 8, 16)(custom::benchmark::State& state) {
+	pop_rank_error<LockedHeap<std::uint32_t>>(state);
+}
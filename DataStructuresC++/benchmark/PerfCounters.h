@@ -0,0 +1,207 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace custom::benchmark {
+	/**
+	 * Hardware performance counters of the calling thread, and of the threads it creates while they are open, read
+	 * through `perf_event_open` on Linux. Each counter is opened on its own, so a counter the CPU, the kernel or the
+	 * `perf_event_paranoid` setting does not allow is reported as unavailable without affecting the others. Elsewhere
+	 * every counter is unavailable.
+	 *
+	 * Only user-space events are counted, which `perf_event_paranoid` levels up to 2 allow. When the CPU has fewer
+	 * counters than events, the kernel multiplexes them and the values are scaled by the share of time each one ran.
+	 */
+	class PerfCounters {
+	public:
+		/**
+		 * The events counted.
+		 */
+		enum Event {
+			Cycles,  /**< CPU cycles. */
+			Instructions,  /**< Instructions retired. */
+			L1DMisses,  /**< Loads which missed the level 1 data cache. */
+			LLCMisses,  /**< References which missed the last level cache. */
+			BranchMisses,  /**< Mispredicted branches. */
+			DTLBMisses,  /**< Loads which missed the data TLB. */
+			EventCount  /**< The number of events. */
+		};
+
+		/**
+		 * Returns the name of an event, as used in the output of the benchmarks and the `--perf_counters` option.
+		 * @param event - the event.
+		 * @return - the name of the event in snake case.
+		 */
+		static const char* name(Event event) noexcept {
+			static constexpr std::array<const char*, EventCount> names = {"cycles", "instructions", "l1d_misses",
+			                                                              "llc_misses", "branch_misses", "dtlb_misses"};
+			return names[event];
+		}
+
+		/**
+		 * Opens the counters of the events selected. The counters start disabled.
+		 * @param selected - whether each event is counted.
+		 */
+		explicit PerfCounters(const std::array<bool, EventCount>& selected) {
+			mFds.fill(-1);
+			for (int event = 0; event < EventCount; ++event) {
+				if (selected[event])
+					open(static_cast<Event>(event));
+			}
+		}
+
+		PerfCounters(const PerfCounters&) = delete;
+		PerfCounters& operator=(const PerfCounters&) = delete;
+
+		/**
+		 * Closes the counters.
+		 */
+		~PerfCounters() {
+#if defined(__linux__)
+			for (int fd: mFds) {
+				if (fd != -1)
+					close(fd);
+			}
+#endif
+		}
+
+		/**
+		 * Returns whether an event is being counted.
+		 * @param event - the event.
+		 * @return - a boolean value indicating whether the counter of the event was opened.
+		 */
+		[[nodiscard]] bool available(Event event) const noexcept {
+			return mFds[event] != -1;
+		}
+
+		/**
+		 * Returns whether any event is being counted.
+		 * @return - a boolean value indicating whether at least one counter was opened.
+		 */
+		[[nodiscard]] bool any_available() const noexcept {
+			for (int fd: mFds) {
+				if (fd != -1)
+					return true;
+			}
+			return false;
+		}
+
+		/**
+		 * Returns why the first counter which could not be opened was unavailable.
+		 * @return - a description of the error, empty if every selected counter was opened.
+		 */
+		[[nodiscard]] const std::string& error() const noexcept {
+			return mError;
+		}
+
+		/**
+		 * Zeroes and starts the counters.
+		 */
+		void start() noexcept {
+#if defined(__linux__)
+			control(PERF_EVENT_IOC_RESET);
+			control(PERF_EVENT_IOC_ENABLE);
+#endif
+		}
+
+		/**
+		 * Stops the counters, keeping their values, e.g. around setup work which should not be measured.
+		 */
+		void stop() noexcept {
+#if defined(__linux__)
+			control(PERF_EVENT_IOC_DISABLE);
+#endif
+		}
+
+		/**
+		 * Restarts the counters after stop(), adding to their values.
+		 */
+		void resume() noexcept {
+#if defined(__linux__)
+			control(PERF_EVENT_IOC_ENABLE);
+#endif
+		}
+
+		/**
+		 * Reads the value of each counter, scaled for the time it was multiplexed out.
+		 * @return - the value of each event, 0 for the unavailable ones.
+		 */
+		[[nodiscard]] std::array<double, EventCount> read() const noexcept {
+			std::array<double, EventCount> values{};
+#if defined(__linux__)
+			for (int event = 0; event < EventCount; ++event) {
+				// The value, then the time the counter was enabled and the time it was running
+				std::uint64_t data[3] = {};
+				if (mFds[event] == -1 || ::read(mFds[event], data, sizeof(data)) != sizeof(data))
+					continue;
+				values[event] = data[2] ? static_cast<double>(data[0]) * static_cast<double>(data[1]) /
+				                          static_cast<double>(data[2]) : 0.0;
+			}
+#endif
+			return values;
+		}
+
+	private:
+		std::array<int, EventCount> mFds;  /**< The file descriptor of the counter of each event, -1 if unavailable. */
+		std::string mError;  /**< Why the first unavailable counter could not be opened. */
+
+#if defined(__linux__)
+		static constexpr std::uint64_t cache_miss(std::uint64_t cache) noexcept {
+			return cache | PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+		}
+
+		void open(Event event) {
+			static constexpr std::array<std::pair<std::uint32_t, std::uint64_t>, EventCount> configs = {{
+					{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+					{PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+					{PERF_TYPE_HW_CACHE, cache_miss(PERF_COUNT_HW_CACHE_L1D)},
+					{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+					{PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+					{PERF_TYPE_HW_CACHE, cache_miss(PERF_COUNT_HW_CACHE_DTLB)}
+			}};
+			perf_event_attr attr;
+			std::memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.type = configs[event].first;
+			attr.config = configs[event].second;
+			attr.disabled = 1;
+			attr.inherit = 1;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+			long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+			if (fd != -1)
+				mFds[event] = static_cast<int>(fd);
+			else if (mError.empty())
+				mError = std::string(name(event)) + ": " + std::strerror(errno);
+		}
+
+		void control(unsigned long request) noexcept {
+			for (int fd: mFds) {
+				if (fd != -1)
+					ioctl(fd, request, 0);
+			}
+		}
+#else
+		void open(Event event) {
+			if (mError.empty())
+				mError = std::string(name(event)) + ": perf_event_open is only available on Linux";
+		}
+#endif
+	};
+}// namespace custom::benchmark
+
+#endif// PERF_COUNTERS_H
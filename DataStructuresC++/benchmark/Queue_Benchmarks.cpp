@@ -0,0 +1,171 @@
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../Queue.h"
+#include "Benchmark.h"
+
+namespace {
+	/**
+	 * The layout of Queue before it was devirtualised: enqueue is virtual and every node is allocated with `new`. It is
+	 * used as the baseline the policy-based queues are measured against.
+	 */
+	template<typename T>
+	class VirtualQueue {
+	public:
+		virtual ~VirtualQueue() {
+			while (head) {
+				Node* next = head->next;
+				delete head;
+				head = next;
+			}
+		}
+
+		virtual void enqueue(const T& data) {
+			Node* node = new Node{data, nullptr};
+			if (length)
+				tail->next = node;
+			else
+				head = node;
+			tail = node;
+			++length;
+		}
+
+		T dequeue() {
+			if (!length)
+				throw std::runtime_error("Error: queue is empty, there is nothing to dequeue");
+			Node* first = head;
+			head = head->next;
+			T data = first->data;
+			delete first;
+			if (--length == 0)
+				tail = nullptr;
+			return data;
+		}
+
+		[[nodiscard]] bool empty() const noexcept {
+			return length == 0;
+		}
+
+	private:
+		struct Node {
+			T data;
+			Node* next;
+		};
+
+		Node* head = nullptr;
+		Node* tail = nullptr;
+		size_t length = 0;
+	};
+
+	/**
+	 * Hides the value of a pointer from the optimiser, so calls through it cannot be devirtualised, as is the case when
+	 * a queue is passed around by reference.
+	 */
+	template<typename T>
+	T* opaque(T* pointer) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : "+r"(pointer));
+#endif
+		return pointer;
+	}
+
+	template<typename QueueType>
+	void enqueue_dequeue(custom::benchmark::State& state) {
+		auto n = static_cast<size_t>(state.arg());
+		for (size_t i = 0; i < state.iterations(); ++i) {
+			QueueType storage;
+			QueueType* queue = opaque(&storage);
+			for (size_t j = 0; j < n; ++j)
+				queue->enqueue(static_cast<std::int64_t>(j));
+			std::int64_t sum = 0;
+			while (!queue->empty())
+				sum += queue->dequeue();
+			custom::benchmark::do_not_optimize(sum);
+		}
+		state.set_items_processed(state.iterations() * n * 2);
+	}
+
+	template<typename QueueType, typename... Args>
+	void priority_enqueue(custom::benchmark::State& state, const Args& ... args) {
+		auto n = static_cast<size_t>(state.arg());
+		std::vector<int> input(n);
+		std::mt19937 generator(42);
+		for (int& value: input)
+			value = static_cast<int>(generator() % 1000);
+		for (size_t i = 0; i < state.iterations(); ++i) {
+			QueueType storage(input[0], args...);
+			QueueType* queue = opaque(&storage);
+			for (int value: input)
+				queue->enqueue(value);
+			custom::benchmark::do_not_optimize(queue->peek());
+		}
+		state.set_items_processed(state.iterations() * n);
+	}
+}// namespace
+
+BENCHMARK_CASE(Queue, VirtualBaseline, 16, 1000, 100000)(custom::benchmark::State& state) {
+	enqueue_dequeue<VirtualQueue<std::int64_t>>(state);
+}
+
+BENCHMARK_CASE(Queue, HeapNodes, 16, 1000, 100000)(custom::benchmark::State& state) {
+	enqueue_dequeue<custom::Queue<std::int64_t, custom::queue_policy::HeapNodes>>(state);
+}
+
+BENCHMARK_CASE(Queue, PooledNodes, 16, 1000, 100000)(custom::benchmark::State& state) {
+	enqueue_dequeue<custom::Queue<std::int64_t>>(state);
+}
+
+BENCHMARK_CASE(PriorityQueue, RuntimeAscending, 64, 1000)(custom::benchmark::State& state) {
+	priority_enqueue<custom::PriorityQueue<int>>(state, custom::queue_policy::RuntimePriority::Ascending);
+}
+
+BENCHMARK_CASE(PriorityQueue, CompileTimeAscending, 64, 1000)(custom::benchmark::State& state) {
+	priority_enqueue<custom::PriorityQueue<int, custom::queue_policy::Ascending>>(state);
+}
+
+BENCHMARK_CASE(Queue, EnqueueDequeueSingle, 1000, 100000)(custom::benchmark::State& state) {
+	auto n = static_cast<size_t>(state.arg());
+	std::vector<std::int64_t> input(n);
+	std::iota(input.begin(), input.end(), 0);
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		custom::Queue<std::int64_t> queue;
+		for (std::int64_t value: input)
+			queue.enqueue(value);
+		std::int64_t sum = 0;
+		while (!queue.empty())
+			sum += queue.dequeue();
+		custom::benchmark::do_not_optimize(sum);
+	}
+	state.set_items_processed(state.iterations() * n);
+}
+
+BENCHMARK_CASE(Queue, EnqueueRangeDequeueN, 1000, 100000)(custom::benchmark::State& state) {
+	auto n = static_cast<size_t>(state.arg());
+	std::vector<std::int64_t> input(n);
+	std::iota(input.begin(), input.end(), 0);
+	std::vector<std::int64_t> output(n);
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		custom::Queue<std::int64_t> queue;
+		queue.enqueue_range(input.begin(), input.end());
+		queue.dequeue_n(output.begin(), n);
+		custom::benchmark::do_not_optimize(output.back());
+	}
+	state.set_items_processed(state.iterations() * n);
+}
+
+BENCHMARK_CASE(Queue, EnqueueRangeDrain, 1000, 100000)(custom::benchmark::State& state) {
+	auto n = static_cast<size_t>(state.arg());
+	std::vector<std::int64_t> input(n);
+	std::iota(input.begin(), input.end(), 0);
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		custom::Queue<std::int64_t> queue;
+		queue.enqueue_range(input.begin(), input.end());
+		std::int64_t sum = 0;
+		queue.drain([&sum](std::int64_t&& value) { sum += value; });
+		custom::benchmark::do_not_optimize(sum);
+	}
+	state.set_items_processed(state.iterations() * n);
+}
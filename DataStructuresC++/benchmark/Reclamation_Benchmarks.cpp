@@ -0,0 +1,69 @@
+#include <atomic>
+#include <cstdint>
+
+#include "../Reclamation.h"
+#include "Benchmark.h"
+
+namespace {
+	struct Payload {
+		std::uint64_t value;
+	};
+}// namespace
+
+BENCHMARK_CASE(EpochDomain, PinUnpin)(custom::benchmark::State& state) {
+	custom::EpochDomain domain;
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		auto guard = domain.pin();
+		custom::benchmark::do_not_optimize(guard);
+	}
+	state.set_items_processed(state.iterations());
+}
+
+BENCHMARK_CASE(EpochDomain, NestedPin)(custom::benchmark::State& state) {
+	custom::EpochDomain domain;
+	auto outer = domain.pin();
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		auto guard = domain.pin();
+		custom::benchmark::do_not_optimize(guard);
+	}
+	state.set_items_processed(state.iterations());
+}
+
+BENCHMARK_CASE(HazardDomain, GuardProtect)(custom::benchmark::State& state) {
+	custom::HazardDomain domain;
+	Payload payload{1};
+	std::atomic<Payload*> shared{&payload};
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		auto guard = domain.guard();
+		custom::benchmark::do_not_optimize(guard.protect(shared)->value);
+	}
+	state.set_items_processed(state.iterations());
+}
+
+BENCHMARK_CASE(HazardDomain, Protect)(custom::benchmark::State& state) {
+	custom::HazardDomain domain;
+	Payload payload{1};
+	std::atomic<Payload*> shared{&payload};
+	auto guard = domain.guard();
+	for (size_t i = 0; i < state.iterations(); ++i)
+		custom::benchmark::do_not_optimize(guard.protect(shared)->value);
+	state.set_items_processed(state.iterations());
+}
+
+BENCHMARK_CASE(EpochDomain, RetireReclaim, 16, 128, 1024)(custom::benchmark::State& state) {
+	custom::EpochDomain domain(static_cast<size_t>(state.arg()));
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		auto guard = domain.pin();
+		domain.retire(new Payload{i});
+	}
+	state.set_items_processed(state.iterations());
+	state.set_counter("pending", static_cast<double>(domain.stats().pending));
+}
+
+BENCHMARK_CASE(HazardDomain, RetireReclaim, 16, 128, 1024)(custom::benchmark::State& state) {
+	custom::HazardDomain domain(4, static_cast<size_t>(state.arg()));
+	for (size_t i = 0; i < state.iterations(); ++i)
+		domain.retire(new Payload{i});
+	state.set_items_processed(state.iterations());
+	state.set_counter("pending", static_cast<double>(domain.stats().pending));
+}
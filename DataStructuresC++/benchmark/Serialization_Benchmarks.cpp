@@ -0,0 +1,128 @@
+/**
+ * The throughput of serialization in GB/s of serialized data, for the bulk copies of trivially copyable elements
+ * (Vector), the element by element paths (LinkedList, Map, strings) and reading elements in place through a view.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "../LinkedList.h"
+#include "../Map.h"
+#include "../Serialization.h"
+#include "../Vector.h"
+#include "Benchmark.h"
+
+namespace {
+	using custom::benchmark::State;
+
+	// The containers are built with the timer paused, so only serialization is measured
+	custom::Vector<std::uint64_t> make_vector(State& state) {
+		state.pause_timing();
+		custom::Vector<std::uint64_t> vector;
+		for (std::int64_t i = 0; i < state.arg(); ++i)
+			vector.push_back(i * 0x9e3779b97f4a7c15ULL);
+		state.resume_timing();
+		return vector;
+	}
+
+	custom::LinkedList<std::uint64_t> make_list(State& state) {
+		state.pause_timing();
+		custom::LinkedList<std::uint64_t> list;
+		for (std::int64_t i = 0; i < state.arg(); ++i)
+			list.append(i);
+		state.resume_timing();
+		return list;
+	}
+
+	custom::Map<std::uint64_t, std::uint64_t> make_map(State& state) {
+		state.pause_timing();
+		custom::Map<std::uint64_t, std::uint64_t> map(state.arg());
+		for (std::int64_t i = 0; i < state.arg(); ++i)
+			map.add(i, i * 3);
+		state.resume_timing();
+		return map;
+	}
+
+	custom::Vector<std::string> make_strings(State& state) {
+		state.pause_timing();
+		custom::Vector<std::string> strings;
+		for (std::int64_t i = 0; i < state.arg(); ++i)
+			strings.push_back("element " + std::to_string(i));
+		state.resume_timing();
+		return strings;
+	}
+
+	// Serializes a container once per iteration, reporting the bytes written
+	template<typename Container>
+	void serialize_workload(State& state, const Container& container) {
+		size_t bytes = 0;
+		for (size_t i = 0; i < state.iterations(); ++i) {
+			std::vector<std::byte> data = custom::serialize(container);
+			bytes += data.size();
+			custom::benchmark::do_not_optimize(data.data());
+		}
+		state.set_bytes_processed(bytes);
+	}
+
+	// Deserializes a container once per iteration, reporting the bytes read
+	template<typename Container>
+	void deserialize_workload(State& state, const Container& container) {
+		state.pause_timing();
+		std::vector<std::byte> data = custom::serialize(container);
+		state.resume_timing();
+		for (size_t i = 0; i < state.iterations(); ++i) {
+			Container copy = custom::deserialize<Container>(data);
+			custom::benchmark::do_not_optimize(copy);
+		}
+		state.set_bytes_processed(data.size() * state.iterations());
+	}
+}
+
+BENCHMARK_CASE(VectorSerialization, Serialize, 1 << 10, 1 << 16, 1 << 22)(State& state) {
+	serialize_workload(state, make_vector(state));
+}
+
+BENCHMARK_CASE(VectorSerialization, Deserialize, 1 << 10, 1 << 16, 1 << 22)(State& state) {
+	deserialize_workload(state, make_vector(state));
+}
+
+// Summing the elements in place, so the view is read rather than only validated
+BENCHMARK_CASE(VectorSerialization, ViewSum, 1 << 10, 1 << 16, 1 << 22)(State& state) {
+	custom::Vector<std::uint64_t> vector = make_vector(state);
+	state.pause_timing();
+	std::vector<std::byte> data = custom::serialize(vector);
+	state.resume_timing();
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		std::uint64_t sum = 0;
+		for (std::uint64_t value: custom::view<custom::Vector<std::uint64_t>>(data))
+			sum += value;
+		custom::benchmark::do_not_optimize(sum);
+	}
+	state.set_bytes_processed(data.size() * state.iterations());
+}
+
+BENCHMARK_CASE(ListSerialization, Serialize, 1 << 10, 1 << 16, 1 << 20)(State& state) {
+	serialize_workload(state, make_list(state));
+}
+
+BENCHMARK_CASE(ListSerialization, Deserialize, 1 << 10, 1 << 16, 1 << 20)(State& state) {
+	deserialize_workload(state, make_list(state));
+}
+
+BENCHMARK_CASE(MapSerialization, Serialize, 1 << 10, 1 << 16)(State& state) {
+	serialize_workload(state, make_map(state));
+}
+
+BENCHMARK_CASE(MapSerialization, Deserialize, 1 << 10, 1 << 16)(State& state) {
+	deserialize_workload(state, make_map(state));
+}
+
+BENCHMARK_CASE(StringSerialization, Serialize, 1 << 10, 1 << 16)(State& state) {
+	serialize_workload(state, make_strings(state));
+}
+
+BENCHMARK_CASE(StringSerialization, Deserialize, 1 << 10, 1 << 16)(State& state) {
+	deserialize_workload(state, make_strings(state));
+}
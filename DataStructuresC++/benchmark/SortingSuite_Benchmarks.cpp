@@ -0,0 +1,362 @@
+/**
+ * The sorting benchmark suite: every sort of SortingAlgorithms.h and ParallelSort.h, with std::sort and
+ * std::stable_sort as baselines, on every input distribution and element type, at sizes from 10^3 to 10^8. Besides
+ * the time and throughput of each run, one extra run per size sorts elements which count their moves and copies with
+ * a comparison which counts its calls, outside the timed region, and reports both per element.
+ *
+ * Runs above 10^6 elements are skipped unless `--max_arg` is given, e.g. `--max_arg=1e8` for the whole suite, and
+ * `--json=<path>` writes the results for tracking across releases.
+ */
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../ParallelSort.h"
+#include "../SortingAlgorithms.h"
+#include "../ThreadPool.h"
+#include "Benchmark.h"
+
+namespace {
+	enum class Distribution { Random, Sorted, Reverse, OrganPipe, FewUnique, Zipf, NearlySorted };
+
+	const std::pair<Distribution, const char*> distributions[] = {
+			{Distribution::Random, "Random"}, {Distribution::Sorted, "Sorted"}, {Distribution::Reverse, "Reverse"},
+			{Distribution::OrganPipe, "OrganPipe"}, {Distribution::FewUnique, "FewUnique"}, {Distribution::Zipf, "Zipf"},
+			{Distribution::NearlySorted, "NearlySorted"}};
+
+	// The ranks of the elements of an input, which the element types turn into values in the same order
+	std::vector<std::uint64_t> make_ranks(size_t size, Distribution distribution) {
+		std::vector<std::uint64_t> ranks(size);
+		std::mt19937_64 generator(89);
+		std::uniform_real_distribution<double> uniform(0.0, 1.0);
+		const double log_size = std::log(static_cast<double>(size) + 1.0);
+		for (size_t i = 0; i < size; ++i) {
+			switch (distribution) {
+				case Distribution::Random:
+					ranks[i] = generator();
+					break;
+				case Distribution::Sorted:
+				case Distribution::NearlySorted:
+					ranks[i] = i;
+					break;
+				case Distribution::Reverse:
+					ranks[i] = size - i;
+					break;
+				case Distribution::OrganPipe:
+					ranks[i] = i < size / 2 ? i : size - i;
+					break;
+				case Distribution::FewUnique:
+					ranks[i] = generator() % 16;
+					break;
+				case Distribution::Zipf:
+					// Inverting the continuous approximation of the CDF of a Zipf distribution with exponent 1 over
+					// the ranks 1 to n, so rank k is drawn about 1/k times as often as rank 1
+					ranks[i] = static_cast<std::uint64_t>(std::exp(uniform(generator) * log_size));
+					break;
+			}
+		}
+		// One element in a hundred swapped with a random other one
+		if (distribution == Distribution::NearlySorted)
+			for (size_t i = 0; i < size / 100; ++i)
+				std::swap(ranks[generator() % size], ranks[generator() % size]);
+		return ranks;
+	}
+
+	// A 64 byte record sorted by its key, standing for the rows of a table
+	struct Record {
+		std::uint64_t key;
+		std::uint64_t payload[7];
+	};
+
+	// The element types, their names, how they are made from ranks and the key the radix sort uses
+	template<typename T>
+	struct Element;
+
+	template<>
+	struct Element<std::uint32_t> {
+		static constexpr const char* name = "uint32";
+		static constexpr std::int64_t max_size = 100000000;
+
+		static std::uint32_t make(std::uint64_t rank) { return static_cast<std::uint32_t>(rank); }
+
+		static std::uint32_t key(std::uint32_t value) { return value; }
+	};
+
+	template<>
+	struct Element<std::uint64_t> {
+		static constexpr const char* name = "uint64";
+		static constexpr std::int64_t max_size = 100000000;
+
+		static std::uint64_t make(std::uint64_t rank) { return rank; }
+
+		static std::uint64_t key(std::uint64_t value) { return value; }
+	};
+
+	template<>
+	struct Element<double> {
+		static constexpr const char* name = "double";
+		static constexpr std::int64_t max_size = 100000000;
+
+		static double make(std::uint64_t rank) { return static_cast<double>(rank >> 11) * 0x1p-20; }
+
+		static double key(double value) { return value; }
+	};
+
+	template<>
+	struct Element<std::string> {
+		static constexpr const char* name = "string";
+		static constexpr std::int64_t max_size = 10000000;
+
+		// Too long for the small string buffer, with a common prefix making the comparisons scan several characters
+		static std::string make(std::uint64_t rank) {
+			char text[32];
+			std::snprintf(text, sizeof(text), "key-%020llu", static_cast<unsigned long long>(rank));
+			return text;
+		}
+
+		static const std::string& key(const std::string& value) { return value; }
+	};
+
+	template<>
+	struct Element<Record> {
+		static constexpr const char* name = "record64";
+		static constexpr std::int64_t max_size = 10000000;
+
+		static Record make(std::uint64_t rank) { return Record{rank, {rank, rank, rank, rank, rank, rank, rank}}; }
+
+		static std::uint64_t key(const Record& value) { return value.key; }
+	};
+
+	// The counts of the instrumented runs, atomic as the parallel sorts count from every worker
+	std::atomic<std::uint64_t> comparisons = 0, moves = 0;
+
+	// An element counting its copies and moves, including those into and out of scratch buffers
+	template<typename T>
+	struct Counted {
+		T value;
+
+		Counted() = default;
+
+		explicit Counted(T v) : value(std::move(v)) {}
+
+		Counted(const Counted& other) : value(other.value) { moves.fetch_add(1, std::memory_order_relaxed); }
+
+		Counted(Counted&& other) noexcept : value(std::move(other.value)) {
+			moves.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		Counted& operator=(const Counted& other) {
+			value = other.value;
+			moves.fetch_add(1, std::memory_order_relaxed);
+			return *this;
+		}
+
+		Counted& operator=(Counted&& other) noexcept {
+			value = std::move(other.value);
+			moves.fetch_add(1, std::memory_order_relaxed);
+			return *this;
+		}
+	};
+
+	// The order of the elements, by key, and its instrumented version counting its calls
+	struct Less {
+		template<typename T>
+		bool operator()(const T& a, const T& b) const { return Element<T>::key(a) < Element<T>::key(b); }
+
+		template<typename T>
+		bool operator()(const Counted<T>& a, const Counted<T>& b) const {
+			comparisons.fetch_add(1, std::memory_order_relaxed);
+			return (*this)(a.value, b.value);
+		}
+	};
+
+	// The key of an element for the radix sort, which makes no comparisons
+	struct Key {
+		template<typename T>
+		decltype(auto) operator()(const T& value) const { return Element<T>::key(value); }
+
+		template<typename T>
+		decltype(auto) operator()(const Counted<T>& element) const { return Element<T>::key(element.value); }
+	};
+
+	custom::ThreadPool& pool() {
+		static custom::ThreadPool workers(std::max(1U, std::thread::hardware_concurrency()));
+		return workers;
+	}
+
+	// Every sort as a generic function of the container, so each one runs on both the plain and the counted elements
+	struct StdSort {
+		static constexpr const char* name = "StdSort";
+		static constexpr std::int64_t max_size = 100000000;
+
+		template<typename Data>
+		static void sort(Data& data) { std::sort(data.begin(), data.end(), Less()); }
+	};
+
+	struct StdStableSort {
+		static constexpr const char* name = "StdStableSort";
+		static constexpr std::int64_t max_size = 100000000;
+
+		template<typename Data>
+		static void sort(Data& data) { std::stable_sort(data.begin(), data.end(), Less()); }
+	};
+
+	struct PdqSort {
+		static constexpr const char* name = "PdqSort";
+		static constexpr std::int64_t max_size = 100000000;
+
+		template<typename Data>
+		static void sort(Data& data) { custom::pdq_sort(data.begin(), data.end(), Less()); }
+	};
+
+	struct TimSort {
+		static constexpr const char* name = "TimSort";
+		static constexpr std::int64_t max_size = 100000000;
+
+		template<typename Data>
+		static void sort(Data& data) { custom::tim_sort(data.begin(), data.end(), Less()); }
+	};
+
+	struct RadixSort {
+		static constexpr const char* name = "RadixSort";
+		static constexpr std::int64_t max_size = 100000000;
+
+		template<typename Data>
+		static void sort(Data& data) { custom::radix_sort(data.begin(), data.end(), Key()); }
+	};
+
+	struct ParallelSort {
+		static constexpr const char* name = "ParallelSort";
+		static constexpr std::int64_t max_size = 100000000;
+
+		template<typename Data>
+		static void sort(Data& data) { custom::parallel_sort(pool(), data.begin(), data.end(), Less()); }
+	};
+
+	struct ParallelStableSort {
+		static constexpr const char* name = "ParallelStableSort";
+		static constexpr std::int64_t max_size = 100000000;
+
+		template<typename Data>
+		static void sort(Data& data) { custom::parallel_stable_sort(pool(), data.begin(), data.end(), Less()); }
+	};
+
+	// The simple sorts take a comparison returning true when two elements are out of order
+	struct Greater {
+		template<typename T>
+		bool operator()(const T& a, const T& b) const { return Less()(b, a); }
+	};
+
+	struct MergeSort {
+		static constexpr const char* name = "MergeSort";
+		static constexpr std::int64_t max_size = 10000000;
+
+		template<typename Data>
+		static void sort(Data& data) { custom::merge_sort(data, Greater()); }
+	};
+
+	struct InsertionSort {
+		static constexpr const char* name = "InsertionSort";
+		static constexpr std::int64_t max_size = 10000;
+
+		template<typename Data>
+		static void sort(Data& data) { custom::insertion_sort(data, Greater()); }
+	};
+
+	struct SelectionSort {
+		static constexpr const char* name = "SelectionSort";
+		static constexpr std::int64_t max_size = 10000;
+
+		template<typename Data>
+		static void sort(Data& data) { custom::selection_sort(data, Greater()); }
+	};
+
+	struct BubbleSort {
+		static constexpr const char* name = "BubbleSort";
+		static constexpr std::int64_t max_size = 10000;
+
+		template<typename Data>
+		static void sort(Data& data) { custom::bubble_sort(data, Greater()); }
+	};
+
+	// The comparisons and moves per element of a sort, measured once per size as the instrumented run is slow
+	struct Counts {
+		double comparisons;
+		double moves;
+	};
+
+	template<typename SortType, typename T>
+	Counts count_operations(const std::vector<T>& input) {
+		std::vector<Counted<T>> data;
+		data.reserve(input.size());
+		for (const T& value: input)
+			data.emplace_back(value);
+		comparisons = 0;
+		moves = 0;
+		SortType::sort(data);
+		auto size = static_cast<double>(input.size());
+		return Counts{static_cast<double>(comparisons.load()) / size, static_cast<double>(moves.load()) / size};
+	}
+
+	template<typename SortType, typename T>
+	void register_case(Distribution distribution, const char* distribution_name, const std::vector<std::int64_t>& sizes) {
+		std::vector<std::int64_t> args;
+		for (std::int64_t size: sizes)
+			if (size <= SortType::max_size && size <= Element<T>::max_size)
+				args.push_back(size);
+		auto counts = std::make_shared<std::map<std::int64_t, Counts>>();
+		std::string name = std::string(SortType::name) + "/" + distribution_name + "/" + Element<T>::name;
+		custom::benchmark::register_benchmark("SortSuite", name, [distribution, counts](custom::benchmark::State& state) {
+			auto size = static_cast<size_t>(state.arg());
+			state.pause_timing();
+			std::vector<std::uint64_t> ranks = make_ranks(size, distribution);
+			std::vector<T> input(size);
+			std::transform(ranks.begin(), ranks.end(), input.begin(), Element<T>::make);
+			ranks = {};
+			auto [count, inserted] = counts->try_emplace(state.arg());
+			if (inserted)
+				count->second = count_operations<SortType>(input);
+			state.resume_timing();
+
+			std::vector<T> data;
+			for (size_t i = 0; i < state.iterations(); ++i) {
+				state.pause_timing();
+				data = input;
+				state.resume_timing();
+				SortType::sort(data);
+				custom::benchmark::do_not_optimize(data.front());
+			}
+			state.set_items_processed(size * state.iterations());
+			state.set_counter("comparisons_per_element", count->second.comparisons);
+			state.set_counter("moves_per_element", count->second.moves);
+		}, std::move(args));
+	}
+
+	template<typename SortType, typename... Types>
+	void register_sort(const std::vector<std::int64_t>& sizes) {
+		for (const auto& [distribution, distribution_name]: distributions)
+			(register_case<SortType, Types>(distribution, distribution_name, sizes), ...);
+	}
+
+	template<typename... Sorts>
+	void register_suite(const std::vector<std::int64_t>& sizes) {
+		(register_sort<Sorts, std::uint32_t, std::uint64_t, double, std::string, Record>(sizes), ...);
+	}
+}
+
+int main(int argc, char** argv) {
+	register_suite<StdSort, StdStableSort, PdqSort, TimSort, RadixSort, ParallelSort, ParallelStableSort, MergeSort,
+	               InsertionSort, SelectionSort, BubbleSort>({1000, 10000, 100000, 1000000, 10000000, 100000000});
+	custom::benchmark::Runner runner(argc, argv, 1000000);
+	return runner.run();
+}
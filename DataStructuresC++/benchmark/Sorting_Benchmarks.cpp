@@ -0,0 +1,550 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../ExternalSort.h"
+#include "../ParallelSort.h"
+#include "../SortingAlgorithms.h"
+#include "../SortingNetworks.h"
+#include "../Vector.h"
+#include "Benchmark.h"
+
+namespace {
+	enum class Pattern { Random, Sorted, Reversed, FewUnique, NearlySorted };
+
+	std::vector<int> make_input(size_t size, Pattern pattern) {
+		std::vector<int> input(size);
+		std::mt19937 generator(11);
+		for (size_t i = 0; i < size; ++i) {
+			switch (pattern) {
+				case Pattern::Random:
+					input[i] = static_cast<int>(generator());
+					break;
+				case Pattern::Sorted:
+					input[i] = static_cast<int>(i);
+					break;
+				case Pattern::Reversed:
+					input[i] = static_cast<int>(size - i);
+					break;
+				case Pattern::FewUnique:
+					input[i] = static_cast<int>(generator() % 16);
+					break;
+				case Pattern::NearlySorted:
+					input[i] = static_cast<int>(i);
+					break;
+			}
+		}
+		// One element in a hundred swapped with a random other one
+		if (pattern == Pattern::NearlySorted && size > 0)
+			for (size_t i = 0; i < size / 100; ++i)
+				std::swap(input[generator() % size], input[generator() % size]);
+		return input;
+	}
+
+	template<typename Sort>
+	void sort_benchmark(custom::benchmark::State& state, Pattern pattern, Sort sort) {
+		auto size = static_cast<size_t>(state.arg());
+		const std::vector<int> input = make_input(size, pattern);
+		std::vector<int> data;
+		for (size_t i = 0; i < state.iterations(); ++i) {
+			state.pause_timing();
+			data = input;
+			state.resume_timing();
+			sort(data);
+			custom::benchmark::do_not_optimize(data.front());
+		}
+		state.set_items_processed(size * state.iterations());
+	}
+
+	void std_sort(std::vector<int>& data) {
+		std::sort(data.begin(), data.end());
+	}
+
+	void pdq_sort(std::vector<int>& data) {
+		custom::pdq_sort(data.begin(), data.end());
+	}
+
+	void std_stable_sort(std::vector<int>& data) {
+		std::stable_sort(data.begin(), data.end());
+	}
+
+	void tim_sort(std::vector<int>& data) {
+		// The buffer is kept across iterations, as by a caller sorting many ranges
+		static custom::MergeBuffer<int> buffer;
+		custom::tim_sort(data.begin(), data.end(), buffer);
+	}
+
+	/**
+	 * The insertion sort as it was before the sorts took generic comparisons: the comparison is called through a
+	 * function pointer, with the elements passed by value. It is used as the baseline the templated sorts are measured
+	 * against.
+	 */
+	template<typename T>
+	bool by_value_ascending(T a, T b) { return a > b; }
+
+	template<typename ListType, typename T>
+	void function_pointer_insertion_sort(ListType& list, bool (* comparison)(T, T) = &by_value_ascending) {
+		int list_size = static_cast<int>(list.size());
+		for (int i = 1; i < list_size; ++i) {
+			auto temp = list[i];
+			int j = i - 1;
+			while (j >= 0 && comparison(list[j], temp)) {
+				list[j + 1] = list[j];
+				--j;
+			}
+			list[j + 1] = temp;
+		}
+	}
+
+	template<typename T>
+	custom::Vector<T> make_vector(size_t size) {
+		std::vector<int> input = make_input(size, Pattern::Random);
+		custom::Vector<T> vec;
+		for (int value: input) {
+			if constexpr (std::is_same_v<T, std::string>)
+				vec.push_back("key-" + std::to_string(value));
+			else
+				vec.push_back(value);
+		}
+		return vec;
+	}
+
+	template<typename T, typename Sort>
+	void vector_sort_benchmark(custom::benchmark::State& state, Sort sort) {
+		auto size = static_cast<size_t>(state.arg());
+		const custom::Vector<T> input = make_vector<T>(size);
+		for (size_t i = 0; i < state.iterations(); ++i) {
+			state.pause_timing();
+			custom::Vector<T> data(input);
+			state.resume_timing();
+			sort(data);
+			custom::benchmark::do_not_optimize(data[0]);
+		}
+		state.set_items_processed(size * state.iterations());
+	}
+}
+
+BENCHMARK_CASE(Sort, StdSortRandom, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::Random, std_sort);
+}
+
+BENCHMARK_CASE(Sort, PdqSortRandom, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::Random, pdq_sort);
+}
+
+BENCHMARK_CASE(Sort, StdSortSorted, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::Sorted, std_sort);
+}
+
+BENCHMARK_CASE(Sort, PdqSortSorted, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::Sorted, pdq_sort);
+}
+
+BENCHMARK_CASE(Sort, StdSortReversed, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::Reversed, std_sort);
+}
+
+BENCHMARK_CASE(Sort, PdqSortReversed, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::Reversed, pdq_sort);
+}
+
+BENCHMARK_CASE(Sort, StdSortFewUnique, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::FewUnique, std_sort);
+}
+
+BENCHMARK_CASE(Sort, PdqSortFewUnique, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::FewUnique, pdq_sort);
+}
+
+BENCHMARK_CASE(StableSort, StdStableSortSorted, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::Sorted, std_stable_sort);
+}
+
+BENCHMARK_CASE(StableSort, TimSortSorted, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::Sorted, tim_sort);
+}
+
+BENCHMARK_CASE(StableSort, StdStableSortNearlySorted, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::NearlySorted, std_stable_sort);
+}
+
+BENCHMARK_CASE(StableSort, TimSortNearlySorted, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::NearlySorted, tim_sort);
+}
+
+BENCHMARK_CASE(StableSort, StdStableSortReversed, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::Reversed, std_stable_sort);
+}
+
+BENCHMARK_CASE(StableSort, TimSortReversed, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::Reversed, tim_sort);
+}
+
+BENCHMARK_CASE(StableSort, StdStableSortRandom, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::Random, std_stable_sort);
+}
+
+BENCHMARK_CASE(StableSort, TimSortRandom, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	sort_benchmark(state, Pattern::Random, tim_sort);
+}
+
+// The same sort through the checked iterators of Vector, which pdq_sort unwraps to raw pointers
+BENCHMARK_CASE(Sort, PdqSortVectorRandom, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	auto size = static_cast<size_t>(state.arg());
+	const std::vector<int> input = make_input(size, Pattern::Random);
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		state.pause_timing();
+		custom::Vector<int> data;
+		for (int value: input)
+			data.push_back(value);
+		state.resume_timing();
+		custom::pdq_sort(data);
+		custom::benchmark::do_not_optimize(data[0]);
+	}
+	state.set_items_processed(size * state.iterations());
+}
+
+BENCHMARK_CASE(Sort, FunctionPointerInsertionInt, 256, 2048)(custom::benchmark::State& state) {
+	vector_sort_benchmark<int>(state, [](custom::Vector<int>& data) {
+		function_pointer_insertion_sort(data, &by_value_ascending<int>);
+	});
+}
+
+BENCHMARK_CASE(Sort, TemplatedInsertionInt, 256, 2048)(custom::benchmark::State& state) {
+	vector_sort_benchmark<int>(state, [](custom::Vector<int>& data) { custom::insertion_sort(data); });
+}
+
+BENCHMARK_CASE(Sort, FunctionPointerInsertionString, 256, 2048)(custom::benchmark::State& state) {
+	vector_sort_benchmark<std::string>(state, [](custom::Vector<std::string>& data) {
+		function_pointer_insertion_sort(data, &by_value_ascending<std::string>);
+	});
+}
+
+BENCHMARK_CASE(Sort, TemplatedInsertionString, 256, 2048)(custom::benchmark::State& state) {
+	vector_sort_benchmark<std::string>(state, [](custom::Vector<std::string>& data) { custom::insertion_sort(data); });
+}
+
+BENCHMARK_CASE(Sort, TemplatedMergeString, 256, 2048)(custom::benchmark::State& state) {
+	vector_sort_benchmark<std::string>(state, [](custom::Vector<std::string>& data) { custom::merge_sort(data); });
+}
+
+// Strong scaling: the same 2^23 keys sorted on pools with an increasing number of workers
+static void parallel_sort_benchmark(custom::benchmark::State& state, bool stable) {
+	auto threads = static_cast<size_t>(state.arg());
+	const std::vector<int> input = make_input(size_t(1) << 23, Pattern::Random);
+	custom::ThreadPool pool(threads);
+	std::vector<int> data;
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		state.pause_timing();
+		data = input;
+		state.resume_timing();
+		if (stable)
+			custom::parallel_stable_sort(pool, data);
+		else
+			custom::parallel_sort(pool, data);
+		custom::benchmark::do_not_optimize(data.front());
+	}
+	state.set_items_processed(input.size() * state.iterations());
+}
+
+BENCHMARK_CASE(ParallelSort, SampleSort, 1, 2, 4, 8, 16, 32, 64)(custom::benchmark::State& state) {
+	parallel_sort_benchmark(state, false);
+}
+
+BENCHMARK_CASE(ParallelSort, StableMergeSort, 1, 2, 4, 8, 16, 32, 64)(custom::benchmark::State& state) {
+	parallel_sort_benchmark(state, true);
+}
+
+namespace {
+	template<typename T>
+	std::vector<T> random_numbers(size_t size) {
+		std::vector<T> numbers(size);
+		std::mt19937_64 generator(13);
+		for (T& number: numbers) {
+			if constexpr (std::is_floating_point_v<T>)
+				number = static_cast<T>(static_cast<std::int64_t>(generator())) * T(1e-9);
+			else
+				number = static_cast<T>(generator());
+		}
+		return numbers;
+	}
+
+	std::vector<std::string> random_words(size_t size) {
+		std::vector<std::string> words(size);
+		std::mt19937 generator(13);
+		for (std::string& word: words) {
+			word.resize(4 + generator() % 12);
+			for (char& c: word)
+				c = static_cast<char>('a' + generator() % 26);
+		}
+		return words;
+	}
+
+	template<typename T, typename Sort>
+	void key_sort_benchmark(custom::benchmark::State& state, const std::vector<T>& input, Sort sort) {
+		std::vector<T> data;
+		for (size_t i = 0; i < state.iterations(); ++i) {
+			state.pause_timing();
+			data = input;
+			state.resume_timing();
+			sort(data);
+			custom::benchmark::do_not_optimize(data.front());
+		}
+		state.set_items_processed(input.size() * state.iterations());
+	}
+}
+
+BENCHMARK_CASE(RadixSort, StdSortUint32, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_numbers<std::uint32_t>(state.arg()), [](auto& data) {
+		std::sort(data.begin(), data.end());
+	});
+}
+
+BENCHMARK_CASE(RadixSort, PdqSortUint32, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_numbers<std::uint32_t>(state.arg()), [](auto& data) { custom::pdq_sort(data); });
+}
+
+BENCHMARK_CASE(RadixSort, RadixSortUint32, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_numbers<std::uint32_t>(state.arg()), [](auto& data) { custom::radix_sort(data); });
+}
+
+BENCHMARK_CASE(RadixSort, StdSortUint64, 1000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_numbers<std::uint64_t>(state.arg()), [](auto& data) {
+		std::sort(data.begin(), data.end());
+	});
+}
+
+BENCHMARK_CASE(RadixSort, RadixSortUint64, 1000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_numbers<std::uint64_t>(state.arg()), [](auto& data) { custom::radix_sort(data); });
+}
+
+BENCHMARK_CASE(RadixSort, StdSortDouble, 1000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_numbers<double>(state.arg()), [](auto& data) {
+		std::sort(data.begin(), data.end());
+	});
+}
+
+BENCHMARK_CASE(RadixSort, RadixSortDouble, 1000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_numbers<double>(state.arg()), [](auto& data) { custom::radix_sort(data); });
+}
+
+BENCHMARK_CASE(RadixSort, StdSortString, 100000, 1000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_words(state.arg()), [](auto& data) { std::sort(data.begin(), data.end()); });
+}
+
+BENCHMARK_CASE(RadixSort, RadixSortString, 100000, 1000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_words(state.arg()), [](auto& data) { custom::radix_sort(data); });
+}
+
+BENCHMARK_CASE(RadixSort, ParallelRadixSortUint32, 1, 2, 4, 8)(custom::benchmark::State& state) {
+	custom::ThreadPool pool(static_cast<size_t>(state.arg()));
+	key_sort_benchmark(state, random_numbers<std::uint32_t>(size_t(1) << 23), [&pool](auto& data) {
+		custom::parallel_radix_sort(pool, data);
+	});
+}
+
+namespace {
+	// Sorts every consecutive chunk of the size given in a buffer of random numbers, as the base case of a larger sort
+	template<typename T, typename Sort>
+	void small_sort_benchmark(custom::benchmark::State& state, Sort sort) {
+		const size_t chunk = static_cast<size_t>(state.arg());
+		const std::vector<T> input = random_numbers<T>(size_t(1) << 16);
+		std::vector<T> data;
+		for (size_t i = 0; i < state.iterations(); ++i) {
+			state.pause_timing();
+			data = input;
+			state.resume_timing();
+			for (size_t first = 0; first < data.size(); first += chunk)
+				sort(data.data() + first, chunk);
+			custom::benchmark::do_not_optimize(data.front());
+		}
+		state.set_items_processed(input.size() * state.iterations());
+	}
+
+	template<typename T>
+	void network_benchmark(custom::benchmark::State& state, custom::SimdLevel level) {
+		if (level > custom::simd_level()) {
+			state.set_counter("unsupported", 1.0);
+			level = custom::simd_level();
+		}
+		small_sort_benchmark<T>(state, [level](T* data, size_t size) { custom::network_sort(data, size, level); });
+	}
+
+	template<typename T>
+	void insertion_benchmark(custom::benchmark::State& state) {
+		small_sort_benchmark<T>(state, [](T* data, size_t size) {
+			std::less<> comp;
+			custom::sort_detail::insertion_sort(data, data + size, comp);
+		});
+	}
+
+	template<typename T>
+	void std_small_sort_benchmark(custom::benchmark::State& state) {
+		small_sort_benchmark<T>(state, [](T* data, size_t size) { std::sort(data, data + size); });
+	}
+}
+
+BENCHMARK_CASE(SortingNetwork, Int32Avx512, 8, 16, 32, 64)(custom::benchmark::State& state) {
+	network_benchmark<std::int32_t>(state, custom::SimdLevel::Avx512);
+}
+
+BENCHMARK_CASE(SortingNetwork, Int32Avx2, 8, 16, 32, 64)(custom::benchmark::State& state) {
+	network_benchmark<std::int32_t>(state, custom::SimdLevel::Avx2);
+}
+
+BENCHMARK_CASE(SortingNetwork, Int32Scalar, 8, 16, 32, 64)(custom::benchmark::State& state) {
+	network_benchmark<std::int32_t>(state, custom::SimdLevel::Scalar);
+}
+
+BENCHMARK_CASE(SortingNetwork, Int32Insertion, 8, 16, 32, 64)(custom::benchmark::State& state) {
+	insertion_benchmark<std::int32_t>(state);
+}
+
+BENCHMARK_CASE(SortingNetwork, Int32StdSort, 8, 16, 32, 64)(custom::benchmark::State& state) {
+	std_small_sort_benchmark<std::int32_t>(state);
+}
+
+BENCHMARK_CASE(SortingNetwork, FloatAvx512, 16, 64)(custom::benchmark::State& state) {
+	network_benchmark<float>(state, custom::SimdLevel::Avx512);
+}
+
+BENCHMARK_CASE(SortingNetwork, FloatAvx2, 16, 64)(custom::benchmark::State& state) {
+	network_benchmark<float>(state, custom::SimdLevel::Avx2);
+}
+
+BENCHMARK_CASE(SortingNetwork, FloatInsertion, 16, 64)(custom::benchmark::State& state) {
+	insertion_benchmark<float>(state);
+}
+
+BENCHMARK_CASE(SortingNetwork, Int64Avx512, 16, 64)(custom::benchmark::State& state) {
+	network_benchmark<std::int64_t>(state, custom::SimdLevel::Avx512);
+}
+
+BENCHMARK_CASE(SortingNetwork, Int64Avx2, 16, 64)(custom::benchmark::State& state) {
+	network_benchmark<std::int64_t>(state, custom::SimdLevel::Avx2);
+}
+
+BENCHMARK_CASE(SortingNetwork, Int64Insertion, 16, 64)(custom::benchmark::State& state) {
+	insertion_benchmark<std::int64_t>(state);
+}
+
+BENCHMARK_CASE(SortingNetwork, DoubleAvx512, 16, 64)(custom::benchmark::State& state) {
+	network_benchmark<double>(state, custom::SimdLevel::Avx512);
+}
+
+BENCHMARK_CASE(SortingNetwork, DoubleAvx2, 16, 64)(custom::benchmark::State& state) {
+	network_benchmark<double>(state, custom::SimdLevel::Avx2);
+}
+
+BENCHMARK_CASE(SortingNetwork, DoubleInsertion, 16, 64)(custom::benchmark::State& state) {
+	insertion_benchmark<double>(state);
+}
+
+// Sorts a file of 2^22 random 64-bit records, 32 MiB, with a memory budget of the number of MiB given, 64 MiB sorting
+// it in memory
+BENCHMARK_CASE(ExternalSort, Uint64File, 2, 8, 64)(custom::benchmark::State& state) {
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "custom-external-sort-benchmark";
+	std::filesystem::create_directories(directory);
+	const std::vector<std::uint64_t> records = random_numbers<std::uint64_t>(size_t(1) << 22);
+	{
+		std::ofstream file(directory / "input", std::ios::binary);
+		file.write(reinterpret_cast<const char*>(records.data()),
+		           static_cast<std::streamsize>(records.size() * sizeof(std::uint64_t)));
+	}
+	custom::ExternalSortOptions options;
+	options.memory_budget = static_cast<size_t>(state.arg()) << 20;
+	options.temp_directory = directory;
+	custom::ExternalSortStats stats;
+	for (size_t i = 0; i < state.iterations(); ++i)
+		stats = custom::external_sort<std::uint64_t>(directory / "input", directory / "output", options);
+	state.set_items_processed(records.size() * state.iterations());
+	state.set_counter("runs", static_cast<double>(stats.runs));
+	state.set_counter("io_MB/s", stats.throughput() / 1e6);
+	std::filesystem::remove_all(directory);
+}
+
+// Selecting the 100 smallest of n random integers, against sorting all of them
+BENCHMARK_CASE(Selection, FullPdqSort, 1000000, 10000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_numbers<std::int32_t>(state.arg()), [](auto& data) { custom::pdq_sort(data); });
+}
+
+BENCHMARK_CASE(Selection, StdPartialSort, 1000000, 10000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_numbers<std::int32_t>(state.arg()), [](auto& data) {
+		std::partial_sort(data.begin(), data.begin() + 100, data.end());
+	});
+}
+
+BENCHMARK_CASE(Selection, PartialSort, 1000000, 10000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_numbers<std::int32_t>(state.arg()), [](auto& data) {
+		custom::partial_sort(data.begin(), data.begin() + 100, data.end());
+	});
+}
+
+BENCHMARK_CASE(Selection, TopK, 1000000, 10000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_numbers<std::int32_t>(state.arg()), [](auto& data) {
+		custom::TopK<std::int32_t> top(100);
+		top.push(data.begin(), data.end());
+		custom::benchmark::do_not_optimize(top.threshold());
+	});
+}
+
+BENCHMARK_CASE(Selection, StdNthElementMedian, 1000000, 10000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_numbers<std::int32_t>(state.arg()), [](auto& data) {
+		std::nth_element(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(data.size() / 2), data.end());
+	});
+}
+
+BENCHMARK_CASE(Selection, NthElementMedian, 1000000, 10000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_numbers<std::int32_t>(state.arg()), [](auto& data) {
+		custom::nth_element(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(data.size() / 2), data.end());
+	});
+}
+
+namespace {
+	// A derived score, expensive enough that computing it dominates a comparison
+	double word_score(const std::string& word) {
+		double score = 0.0;
+		for (size_t i = 0; i < word.size(); ++i)
+			score += std::sqrt(static_cast<double>((word[i] - 'a' + 1) * (i + 1)));
+		return score;
+	}
+
+	// A normalised form of a word, allocating a new string for every call
+	std::string normalized_word(const std::string& word) {
+		std::string normalized;
+		for (char c: word)
+			if (c != 'e')
+				normalized += static_cast<char>(c - 'a' + 'A');
+		return normalized;
+	}
+}
+
+BENCHMARK_CASE(CachedKey, PdqSortProjectedScore, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_words(state.arg()), [](auto& data) {
+		custom::pdq_sort(data, std::less<>(), word_score);
+	});
+}
+
+BENCHMARK_CASE(CachedKey, CachedScore, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_words(state.arg()), [](auto& data) {
+		custom::sort_by_cached_key(data, word_score);
+	});
+}
+
+BENCHMARK_CASE(CachedKey, PdqSortProjectedNormalized, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_words(state.arg()), [](auto& data) {
+		custom::pdq_sort(data, std::less<>(), normalized_word);
+	});
+}
+
+BENCHMARK_CASE(CachedKey, CachedNormalized, 1000, 100000, 1000000)(custom::benchmark::State& state) {
+	key_sort_benchmark(state, random_words(state.arg()), [](auto& data) {
+		custom::sort_by_cached_key(data, normalized_word);
+	});
+}
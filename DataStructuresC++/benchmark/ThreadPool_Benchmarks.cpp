@@ -0,0 +1,87 @@
+#include <atomic>
+#include <cstdint>
+
+#include "../ThreadPool.h"
+#include "Benchmark.h"
+
+static custom::ThreadPool& shared_pool() {
+	static custom::ThreadPool pool;
+	return pool;
+}
+
+static std::uint64_t fork_join_fib(custom::ThreadPool& pool, unsigned int n) {
+	if (n < 2)
+		return n;
+	std::uint64_t left = 0;
+	custom::WaitGroup group;
+	pool.spawn(group, [&pool, &left, n] { left = fork_join_fib(pool, n - 1); });
+	std::uint64_t right = fork_join_fib(pool, n - 2);
+	pool.sync(group);
+	return left + right;
+}
+
+// Every call of fork_join_fib(n) with n >= 2 spawns exactly one task, so fib(n+1) - 1 tasks are forked and joined.
+static std::uint64_t fib_tasks(unsigned int n) {
+	std::uint64_t a = 0, b = 1;
+	for (unsigned int i = 0; i <= n; ++i) {
+		std::uint64_t next = a + b;
+		a = b;
+		b = next;
+	}
+	return a - 1;
+}
+
+BENCHMARK_CASE(ThreadPool, ForkJoinFib, 15, 20, 25)(custom::benchmark::State& state) {
+	custom::ThreadPool& pool = shared_pool();
+	auto n = static_cast<unsigned int>(state.arg());
+	custom::WaitGroup root;
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		std::uint64_t result = 0;
+		pool.spawn(root, [&pool, &result, n] { result = fork_join_fib(pool, n); });
+		pool.sync(root);
+		custom::benchmark::do_not_optimize(result);
+	}
+	state.set_items_processed(state.iterations() * fib_tasks(n));
+	state.set_counter("workers", static_cast<double>(pool.size()));
+}
+
+BENCHMARK_CASE(ThreadPool, SpawnDetachedEmpty, 1000, 100000)(custom::benchmark::State& state) {
+	custom::ThreadPool& pool = shared_pool();
+	std::atomic<size_t> counter{0};
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		for (std::int64_t j = 0; j < state.arg(); ++j)
+			pool.spawn([&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+		pool.wait_idle();
+	}
+	state.set_items_processed(state.iterations() * static_cast<size_t>(state.arg()));
+}
+
+BENCHMARK_CASE(ThreadPool, ParallelForSum, 1 << 16, 1 << 20)(custom::benchmark::State& state) {
+	custom::ThreadPool& pool = shared_pool();
+	auto n = static_cast<size_t>(state.arg());
+	std::vector<std::uint32_t> data(n, 1);
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		std::atomic<std::uint64_t> total{0};
+		pool.parallel_for(0, n, 4096, [&](size_t first, size_t last) {
+			std::uint64_t sum = 0;
+			for (size_t j = first; j < last; ++j)
+				sum += data[j];
+			total.fetch_add(sum, std::memory_order_relaxed);
+		});
+		custom::benchmark::do_not_optimize(total.load());
+	}
+	state.set_items_processed(state.iterations() * n);
+}
+
+BENCHMARK_CASE(WorkStealingDeque, PushPop, 1024)(custom::benchmark::State& state) {
+	custom::WorkStealingDeque<std::intptr_t> deque;
+	auto n = static_cast<std::intptr_t>(state.arg());
+	for (size_t i = 0; i < state.iterations(); ++i) {
+		for (std::intptr_t j = 0; j < n; ++j)
+			deque.push(j);
+		std::intptr_t item = 0;
+		while (deque.pop(item))
+			custom::benchmark::do_not_optimize(item);
+	}
+	state.set_items_processed(state.iterations() * static_cast<size_t>(n));
+}
@@ -0,0 +1,6 @@
+#include "Benchmark.h"
+
+int main(int argc, char** argv) {
+	custom::benchmark::Runner runner(argc, argv);
+	return runner.run();
+}
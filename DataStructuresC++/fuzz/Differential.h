@@ -0,0 +1,794 @@
+#ifndef DIFFERENTIAL_H
+#define DIFFERENTIAL_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../Array.h"
+#include "../BinarySearchTree.h"
+#include "../DoublyLinkedList.h"
+#include "../Graph.h"
+#include "../LinkedList.h"
+#include "../Map.h"
+#include "../Queue.h"
+#include "../Stack.h"
+#include "../Vector.h"
+
+/**
+ * Differential testing of the containers against the standard library. Each target decodes a sequence of operations
+ * from a buffer of bytes and applies it both to a container and to a model built from std containers, checking after
+ * every operation that the two agree. The same decoding can replay a sequence on the container alone, so the
+ * throughput of a container is measured on exactly the operations it was checked on.
+ *
+ * The targets are driven by libFuzzer through Differential_Fuzz.cpp, and by the standalone driver in
+ * Differential_Driver.cpp, which generates random sequences, measures throughput and enforces performance budgets.
+ */
+namespace custom::fuzz {
+	/**
+	 * Thrown when a container disagrees with its model.
+	 */
+	struct Mismatch : std::logic_error {
+		using std::logic_error::logic_error;
+	};
+
+	/**
+	 * Decodes the operations and their arguments from a buffer of bytes. Reading past the end yields zeros, so any
+	 * buffer is a valid input.
+	 */
+	class Input {
+	public:
+		Input(const std::uint8_t* data, size_t size) noexcept: data(data), size(size), position(0) {}
+
+		/**
+		 * Returns whether every byte has been read.
+		 * @return - a boolean value indicating whether the input is exhausted.
+		 */
+		[[nodiscard]] bool empty() const noexcept {
+			return position >= size;
+		}
+
+		/**
+		 * Reads the next byte.
+		 * @return - the byte, or 0 past the end of the input.
+		 */
+		std::uint8_t byte() noexcept {
+			return position < size ? data[position++] : 0;
+		}
+
+		/**
+		 * Reads an element value. Values are drawn from a small range so that searches and duplicate keys are hit.
+		 * @return - an integer between -16 and 47.
+		 */
+		int value() noexcept {
+			return static_cast<int>(byte() % 64) - 16;
+		}
+
+		/**
+		 * Reads an index below a bound.
+		 * @param bound - the number of valid indices, which must be positive.
+		 * @return - an index between 0 and bound - 1.
+		 */
+		size_t index(size_t bound) noexcept {
+			size_t raw = static_cast<size_t>(byte()) << 8 | byte();
+			return raw % bound;
+		}
+
+	private:
+		const std::uint8_t* data;  /**< The bytes of the input. */
+		size_t size;  /**< The number of bytes in the input. */
+		size_t position;  /**< The index of the next byte to read. */
+	};
+
+	namespace detail {
+		// Fails the current operation of a target if a condition does not hold
+		inline void expect(bool condition, const char* target, const char* operation) {
+			if (!condition)
+				throw Mismatch(std::string(target) + ": " + operation + " disagrees with the std model");
+		}
+
+		// Checks that an operation whose precondition is broken throws the exception it documents. Under the
+		// unchecked and assert-only policies breaking it is undefined, so the operation is skipped
+		template<typename Exception, typename Operation>
+		void expect_throw(Operation&& operation, const char* target, const char* name) {
+			if constexpr (checks_throw) {
+				try {
+					operation();
+				} catch (const Exception&) {
+					return;
+				}
+				throw Mismatch(std::string(target) + ": " + name + " did not throw on a broken precondition");
+			}
+		}
+
+		template<typename Container, typename Model>
+		bool same_elements(const Container& container, const Model& model) {
+			return std::equal(container.begin(), container.end(), model.begin(), model.end());
+		}
+	}
+
+	/**
+	 * Vector against `std::vector`: push_back, emplace_back, pop_back, element access, copying and clearing.
+	 * @tparam Differential - whether to apply the operations to the model and compare, or to the Vector alone.
+	 * @param input - the bytes the operations are decoded from.
+	 * @return - the number of operations performed.
+	 */
+	template<bool Differential>
+	size_t vector_ops(Input input) {
+		constexpr const char* target = "Vector";
+		using detail::expect;
+		custom::Vector<int> vector;
+		std::vector<int> model;
+		size_t ops = 0;
+		while (!input.empty()) {
+			++ops;
+			switch (input.byte() % 8) {
+				case 0:
+				case 1: {
+					int value = input.value();
+					vector.push_back(value);
+					if constexpr (Differential) model.push_back(value);
+					break;
+				}
+				case 2: {
+					int value = input.value();
+					int& result = vector.emplace_back(value);
+					if constexpr (Differential) {
+						model.emplace_back(value);
+						expect(result == value, target, "emplace_back");
+					}
+					break;
+				}
+				case 3:
+					if (vector.empty()) {
+						if constexpr (Differential)
+							detail::expect_throw<std::runtime_error>([&] { vector.pop_back(); }, target, "pop_back");
+						break;
+					}
+					vector.pop_back();
+					if constexpr (Differential) model.pop_back();
+					break;
+				case 4:
+					if (!vector.empty()) {
+						size_t index = input.index(vector.size());
+						int value = input.value();
+						vector[index] = value;
+						if constexpr (Differential) {
+							model[index] = value;
+							expect(vector.front() == model.front() && vector.back() == model.back(), target,
+							       "front/back");
+						}
+					}
+					break;
+				case 5: {
+					custom::Vector<int> copy(vector);
+					if constexpr (Differential) expect(copy == vector && detail::same_elements(copy, model), target, "copy");
+					break;
+				}
+				case 6: {
+					std::int64_t sum = 0;
+					for (int value: vector)
+						sum += value;
+					if constexpr (Differential) {
+						std::int64_t expected = 0;
+						for (int value: model)
+							expected += value;
+						expect(sum == expected, target, "iteration");
+					}
+					break;
+				}
+				default:
+					if (input.byte() % 8 == 0) {
+						vector.clear();
+						if constexpr (Differential) model.clear();
+					}
+					break;
+			}
+			if constexpr (Differential)
+				expect(vector.size() == model.size() && detail::same_elements(vector, model), target, "contents");
+		}
+		return ops;
+	}
+
+	/**
+	 * Array against `std::array`: writes and reads by index and iteration.
+	 * @tparam Differential - whether to apply the operations to the model and compare, or to the Array alone.
+	 * @param input - the bytes the operations are decoded from.
+	 * @return - the number of operations performed.
+	 */
+	template<bool Differential>
+	size_t array_ops(Input input) {
+		constexpr const char* target = "Array";
+		using detail::expect;
+		constexpr size_t length = 64;
+		custom::Array<int, length> array;
+		std::array<int, length> model{};
+		for (size_t i = 0; i < length; ++i)
+			array[i] = 0;
+		size_t ops = 0;
+		while (!input.empty()) {
+			++ops;
+			switch (input.byte() % 3) {
+				case 0: {
+					size_t index = input.index(length);
+					int value = input.value();
+					array[index] = value;
+					if constexpr (Differential) model[index] = value;
+					break;
+				}
+				case 1: {
+					size_t index = input.index(length);
+					if constexpr (Differential) expect(array[index] == model[index], target, "operator[]");
+					break;
+				}
+				default:
+					if constexpr (Differential) {
+						expect(detail::same_elements(array, model), target, "iteration");
+						detail::expect_throw<std::out_of_range>([&] { static_cast<void>(array[length]); }, target,
+						                                        "operator[] out of range");
+					}
+					break;
+			}
+		}
+		return ops;
+	}
+
+	/**
+	 * LinkedList or DoublyLinkedList against `std::list`: appending and prepending, inserting and erasing at an
+	 * index, popping from either end, access by index, searching, reversing and copying.
+	 * @tparam List - the type of the list, LinkedList or DoublyLinkedList of `int`.
+	 * @tparam Differential - whether to apply the operations to the model and compare, or to the list alone.
+	 * @param input - the bytes the operations are decoded from.
+	 * @param target - the name of the target, used in the messages of mismatches.
+	 * @return - the number of operations performed.
+	 */
+	template<typename List, bool Differential>
+	size_t list_ops(Input input, const char* target) {
+		using detail::expect;
+		List list;
+		std::list<int> model;
+		size_t ops = 0;
+		while (!input.empty()) {
+			++ops;
+			switch (input.byte() % 12) {
+				case 0:
+				case 1: {
+					int value = input.value();
+					list.push_back(value);
+					if constexpr (Differential) model.push_back(value);
+					break;
+				}
+				case 2: {
+					int value = input.value();
+					list.push_front(value);
+					if constexpr (Differential) model.push_front(value);
+					break;
+				}
+				case 3: {
+					int value = input.value();
+					if (list.empty()) {
+						if constexpr (Differential)
+							detail::expect_throw<std::runtime_error>([&] { list.insert(value, 0); }, target, "insert");
+						break;
+					}
+					size_t index = input.index(list.length() + 1);
+					list.insert(value, index);
+					if constexpr (Differential) model.insert(std::next(model.begin(), static_cast<long>(index)), value);
+					break;
+				}
+				case 4:
+					if (list.empty()) {
+						if constexpr (Differential)
+							detail::expect_throw<std::runtime_error>([&] { list.erase(0); }, target, "erase");
+						break;
+					} else {
+						size_t index = input.index(list.length());
+						list.erase(index);
+						if constexpr (Differential) model.erase(std::next(model.begin(), static_cast<long>(index)));
+					}
+					break;
+				case 5:
+					if (list.empty()) {
+						if constexpr (Differential)
+							detail::expect_throw<std::runtime_error>([&] { list.pop_front(); }, target, "pop_front");
+						break;
+					}
+					list.pop_front();
+					if constexpr (Differential) model.pop_front();
+					break;
+				case 6:
+					if (list.empty()) {
+						if constexpr (Differential)
+							detail::expect_throw<std::runtime_error>([&] { list.pop_back(); }, target, "pop_back");
+						break;
+					}
+					list.pop_back();
+					if constexpr (Differential) model.pop_back();
+					break;
+				case 7:
+					if (!list.empty()) {
+						size_t index = input.index(list.length());
+						int value = list.get(index);
+						if constexpr (Differential) {
+							expect(value == *std::next(model.begin(), static_cast<long>(index)), target, "get");
+							expect(list.front() == model.front() && list.back() == model.back(), target, "front/back");
+						}
+					}
+					break;
+				case 8:
+					if (!list.empty()) {
+						int value = input.value();
+						int index = list.find(value);
+						if constexpr (Differential) {
+							auto it = std::find(model.begin(), model.end(), value);
+							expect(index == (it == model.end() ? -1 : static_cast<int>(std::distance(model.begin(), it))),
+							       target, "find");
+						}
+					}
+					break;
+				case 9:
+					if (!list.empty()) {
+						list.reverse_order();
+						if constexpr (Differential) model.reverse();
+					}
+					break;
+				case 10: {
+					List copy(list);
+					if constexpr (Differential) expect(copy.contents() == list.contents(), target, "copy");
+					break;
+				}
+				default: {
+					std::int64_t sum = 0;
+					for (int value: list)
+						sum += value;
+					if constexpr (Differential) {
+						std::int64_t expected = 0;
+						for (int value: model)
+							expected += value;
+						expect(sum == expected, target, "iteration");
+					}
+					break;
+				}
+			}
+			if constexpr (Differential) {
+				expect(list.length() == model.size(), target, "length");
+				expect(detail::same_elements(list.contents(), model), target, "contents");
+			}
+		}
+		return ops;
+	}
+
+	/**
+	 * Stack against a `std::vector` used as a stack: pushing, popping, peeking and searching.
+	 * @tparam Differential - whether to apply the operations to the model and compare, or to the Stack alone.
+	 * @param input - the bytes the operations are decoded from.
+	 * @return - the number of operations performed.
+	 */
+	template<bool Differential>
+	size_t stack_ops(Input input) {
+		constexpr const char* target = "Stack";
+		using detail::expect;
+		custom::Stack<int> stack;
+		std::vector<int> model;
+		size_t ops = 0;
+		while (!input.empty()) {
+			++ops;
+			switch (input.byte() % 5) {
+				case 0:
+				case 1: {
+					int value = input.value();
+					stack.push(value);
+					if constexpr (Differential) model.push_back(value);
+					break;
+				}
+				case 2:
+					if (stack.empty()) {
+						if constexpr (Differential)
+							detail::expect_throw<std::runtime_error>([&] { stack.pop(); }, target, "pop");
+						break;
+					} else {
+						int value = stack.pop();
+						if constexpr (Differential) {
+							expect(value == model.back(), target, "pop");
+							model.pop_back();
+						}
+					}
+					break;
+				case 3:
+					if (!stack.empty()) {
+						int value = input.value();
+						bool found = stack.contains(value);
+						if constexpr (Differential)
+							expect(found == (std::find(model.begin(), model.end(), value) != model.end()), target,
+							       "contains");
+					}
+					break;
+				default:
+					if (!stack.empty()) {
+						int value = stack.peek();
+						if constexpr (Differential) expect(value == model.back(), target, "peek");
+					}
+					break;
+			}
+			if constexpr (Differential) {
+				expect(stack.length() == model.size(), target, "length");
+				// The contents of a stack are listed from the top down
+				expect(detail::same_elements(stack.contents(), std::vector<int>(model.rbegin(), model.rend())), target,
+				       "contents");
+			}
+		}
+		return ops;
+	}
+
+	/**
+	 * Queue against `std::deque`: enqueuing single elements and ranges, dequeuing single elements and batches,
+	 * peeking and searching.
+	 * @tparam Differential - whether to apply the operations to the model and compare, or to the Queue alone.
+	 * @param input - the bytes the operations are decoded from.
+	 * @return - the number of operations performed.
+	 */
+	template<bool Differential>
+	size_t queue_ops(Input input) {
+		constexpr const char* target = "Queue";
+		using detail::expect;
+		custom::Queue<int> queue;
+		std::deque<int> model;
+		size_t ops = 0;
+		while (!input.empty()) {
+			++ops;
+			switch (input.byte() % 6) {
+				case 0:
+				case 1: {
+					int value = input.value();
+					queue.enqueue(value);
+					if constexpr (Differential) model.push_back(value);
+					break;
+				}
+				case 2: {
+					std::vector<int> values(input.byte() % 8);
+					for (int& value: values)
+						value = input.value();
+					queue.enqueue_range(values.begin(), values.end());
+					if constexpr (Differential) model.insert(model.end(), values.begin(), values.end());
+					break;
+				}
+				case 3:
+					if (queue.empty()) {
+						if constexpr (Differential)
+							detail::expect_throw<std::runtime_error>([&] { queue.dequeue(); }, target, "dequeue");
+						break;
+					} else {
+						int value = queue.dequeue();
+						if constexpr (Differential) {
+							expect(value == model.front(), target, "dequeue");
+							model.pop_front();
+						}
+					}
+					break;
+				case 4: {
+					std::vector<int> values;
+					size_t removed = queue.dequeue_n(std::back_inserter(values), input.byte() % 8);
+					if constexpr (Differential) {
+						expect(removed == values.size() && std::equal(values.begin(), values.end(), model.begin()),
+						       target, "dequeue_n");
+						model.erase(model.begin(), model.begin() + static_cast<long>(removed));
+					}
+					break;
+				}
+				default:
+					if (!queue.empty()) {
+						int value = queue.peek();
+						bool found = queue.contains(input.value());
+						if constexpr (Differential) {
+							expect(value == model.front(), target, "peek");
+							static_cast<void>(found);
+						}
+					}
+					break;
+			}
+			if constexpr (Differential) {
+				expect(static_cast<size_t>(queue.length()) == model.size(), target, "length");
+				expect(detail::same_elements(queue.contents(), model), target, "contents");
+			}
+		}
+		return ops;
+	}
+
+	/**
+	 * PriorityQueue in ascending order against `std::multiset`: enqueuing, dequeuing the smallest element and
+	 * peeking.
+	 * @tparam Differential - whether to apply the operations to the model and compare, or to the PriorityQueue alone.
+	 * @param input - the bytes the operations are decoded from.
+	 * @return - the number of operations performed.
+	 */
+	template<bool Differential>
+	size_t priority_queue_ops(Input input) {
+		constexpr const char* target = "PriorityQueue";
+		using detail::expect;
+		custom::PriorityQueue<int, custom::queue_policy::Ascending> queue;
+		std::multiset<int> model;
+		size_t ops = 0;
+		while (!input.empty()) {
+			++ops;
+			switch (input.byte() % 4) {
+				case 0:
+				case 1: {
+					int value = input.value();
+					queue.enqueue(value);
+					if constexpr (Differential) model.insert(value);
+					break;
+				}
+				case 2:
+					if (!queue.empty()) {
+						int value = queue.dequeue();
+						if constexpr (Differential) {
+							expect(value == *model.begin(), target, "dequeue");
+							model.erase(model.begin());
+						}
+					}
+					break;
+				default:
+					if (!queue.empty()) {
+						int value = queue.peek();
+						if constexpr (Differential) expect(value == *model.begin(), target, "peek");
+					}
+					break;
+			}
+			if constexpr (Differential) {
+				expect(static_cast<size_t>(queue.length()) == model.size(), target, "length");
+				expect(detail::same_elements(queue.contents(), model), target, "contents");
+			}
+		}
+		return ops;
+	}
+
+	/**
+	 * Map against `std::unordered_map`: adding, reading, changing and removing elements by key, including the
+	 * exceptions for keys which already exist or are missing.
+	 * @tparam Differential - whether to apply the operations to the model and compare, or to the Map alone.
+	 * @param input - the bytes the operations are decoded from.
+	 * @return - the number of operations performed.
+	 */
+	template<bool Differential>
+	size_t map_ops(Input input) {
+		constexpr const char* target = "Map";
+		using detail::expect;
+		custom::Map<int, int> map(16);
+		std::unordered_map<int, int> model;
+		size_t ops = 0;
+		while (!input.empty()) {
+			++ops;
+			int key = input.value();
+			switch (input.byte() % 6) {
+				case 0: {
+					int value = input.value();
+					if (map.exists(key)) {
+						if constexpr (Differential)
+							detail::expect_throw<std::invalid_argument>([&] { map.add(key, value); }, target, "add");
+						break;
+					}
+					map.add(key, value);
+					if constexpr (Differential) model.emplace(key, value);
+					break;
+				}
+				case 1: {
+					bool exists = map.exists(key);
+					if constexpr (Differential) {
+						expect(exists == model.contains(key), target, "exists");
+						if (exists)
+							expect(map.at(key) == model.at(key), target, "at");
+						else
+							detail::expect_throw<std::invalid_argument>([&] { static_cast<void>(map.at(key)); },
+							                                            target, "at");
+					}
+					break;
+				}
+				case 2: {
+					int value = input.value();
+					if (!map.exists(key)) {
+						if constexpr (Differential)
+							detail::expect_throw<std::invalid_argument>([&] { map.change(key, value); }, target,
+							                                            "change");
+						break;
+					}
+					map.change(key, value);
+					if constexpr (Differential) model[key] = value;
+					break;
+				}
+				case 3: {
+					int value = map[key];
+					if constexpr (Differential) expect(value == model[key], target, "operator[]");
+					break;
+				}
+				case 4:
+					if (!map.exists(key)) {
+						if constexpr (Differential)
+							detail::expect_throw<std::exception>([&] { map.remove(key); }, target, "remove");
+						break;
+					}
+					map.remove(key);
+					if constexpr (Differential) model.erase(key);
+					break;
+				default: {
+					std::vector<std::pair<int, int>> contents = map.contents();
+					if constexpr (Differential) {
+						std::sort(contents.begin(), contents.end());
+						std::vector<std::pair<int, int>> expected(model.begin(), model.end());
+						std::sort(expected.begin(), expected.end());
+						expect(contents == expected, target, "contents");
+					}
+					break;
+				}
+			}
+			if constexpr (Differential) expect(map.size() == model.size(), target, "size");
+		}
+		return ops;
+	}
+
+	/**
+	 * BinarySearchTree against `std::set`: adding and removing values, with the in-order contents compared to the
+	 * sorted set after every operation.
+	 * @tparam Differential - whether to apply the operations to the model and compare, or to the tree alone.
+	 * @param input - the bytes the operations are decoded from.
+	 * @return - the number of operations performed.
+	 */
+	template<bool Differential>
+	size_t binary_search_tree_ops(Input input) {
+		constexpr const char* target = "BinarySearchTree";
+		using detail::expect;
+		custom::BinarySearchTree<int> tree;
+		std::set<int> model;
+		size_t ops = 0;
+		while (!input.empty()) {
+			++ops;
+			int value = input.value();
+			std::vector<int> contents = tree.contents_InOrder();
+			bool present = std::binary_search(contents.begin(), contents.end(), value);
+			if (input.byte() % 3 != 2) {
+				if (present) {
+					if constexpr (Differential)
+						detail::expect_throw<std::invalid_argument>([&] { tree.add(value); }, target, "add");
+				} else {
+					tree.add(value);
+					if constexpr (Differential) model.insert(value);
+				}
+			} else {
+				if (!present) {
+					if constexpr (Differential)
+						detail::expect_throw<std::runtime_error>([&] { tree.remove(value); }, target, "remove");
+				} else {
+					tree.remove(value);
+					if constexpr (Differential) model.erase(value);
+				}
+			}
+			if constexpr (Differential) {
+				expect(detail::same_elements(tree.contents_InOrder(), model), target, "contents_InOrder");
+				expect(tree.empty() == model.empty(), target, "empty");
+			}
+		}
+		return ops;
+	}
+
+	/**
+	 * Graph against a `std::map` from each ID to the multiset of IDs it has edges to: adding and removing nodes,
+	 * adding edges and looking nodes and edges up.
+	 * @tparam Differential - whether to apply the operations to the model and compare, or to the Graph alone.
+	 * @param input - the bytes the operations are decoded from.
+	 * @return - the number of operations performed.
+	 */
+	template<bool Differential>
+	size_t graph_ops(Input input) {
+		constexpr const char* target = "Graph";
+		using detail::expect;
+		custom::Graph<int, int> graph;
+		std::map<int, std::multiset<int>> model;
+		size_t ops = 0;
+		while (!input.empty()) {
+			++ops;
+			int id = input.value() & 31;
+			switch (input.byte() % 5) {
+				case 0:
+					if (!graph.contains(id)) {
+						graph.add_node(id * 10, id);
+						if constexpr (Differential) model[id];
+					}
+					break;
+				case 1: {
+					int other = input.value() & 31;
+					if (id != other && graph.contains(id) && graph.contains(other)) {
+						graph.add_edge(id, other);
+						if constexpr (Differential) {
+							model[id].insert(other);
+							model[other].insert(id);
+						}
+					} else if constexpr (Differential) {
+						detail::expect_throw<std::runtime_error>([&] { graph.add_edge(id, other); }, target,
+						                                         "add_edge");
+					}
+					break;
+				}
+				case 2: {
+					int other = input.value() & 31;
+					bool found = graph.find_edge(id, other);
+					if constexpr (Differential) {
+						// Every node of the graph is listed as adjacent to itself
+						auto it = model.find(id);
+						expect(found == (it != model.end() && (id == other || it->second.contains(other))), target,
+						       "find_edge");
+					}
+					break;
+				}
+				case 3:
+					if (graph.contains(id)) {
+						graph.remove(id);
+						if constexpr (Differential) {
+							for (int other: model[id])
+								model[other].erase(id);
+							model.erase(id);
+						}
+					} else if constexpr (Differential) {
+						detail::expect_throw<std::exception>([&] { graph.remove(id); }, target, "remove");
+					}
+					break;
+				default: {
+					bool found = graph.contains(id);
+					if constexpr (Differential) expect(found == model.contains(id), target, "contains");
+					break;
+				}
+			}
+			if constexpr (Differential) expect(graph.size() == model.size(), target, "size");
+		}
+		return ops;
+	}
+
+	/**
+	 * A container checked by the harness, with its differential run and its replay on the container alone.
+	 */
+	struct Target {
+		const char* name;  /**< The name of the container. */
+		size_t (*differential)(Input);  /**< Applies the operations to the container and its model, throwing a Mismatch if they disagree. */
+		size_t (*replay)(Input);  /**< Applies the operations to the container alone, for measuring throughput. */
+	};
+
+	inline constexpr std::array<Target, 10> targets = {{
+			{"Vector", &vector_ops<true>, &vector_ops<false>},
+			{"Array", &array_ops<true>, &array_ops<false>},
+			{"LinkedList", [](Input input) { return list_ops<custom::LinkedList<int>, true>(input, "LinkedList"); },
+			 [](Input input) { return list_ops<custom::LinkedList<int>, false>(input, "LinkedList"); }},
+			{"DoublyLinkedList",
+			 [](Input input) { return list_ops<custom::DoublyLinkedList<int>, true>(input, "DoublyLinkedList"); },
+			 [](Input input) { return list_ops<custom::DoublyLinkedList<int>, false>(input, "DoublyLinkedList"); }},
+			{"Stack", &stack_ops<true>, &stack_ops<false>},
+			{"Queue", &queue_ops<true>, &queue_ops<false>},
+			{"PriorityQueue", &priority_queue_ops<true>, &priority_queue_ops<false>},
+			{"Map", &map_ops<true>, &map_ops<false>},
+			{"BinarySearchTree", &binary_search_tree_ops<true>, &binary_search_tree_ops<false>},
+			{"Graph", &graph_ops<true>, &graph_ops<false>}
+	}};  /**< Every target of the harness. */
+
+	/**
+	 * Runs one input the way the fuzzer does: the first byte selects the target and the rest are its operations.
+	 * @param data - the bytes of the input.
+	 * @param size - the number of bytes in the input.
+	 * @return - the number of operations performed.
+	 */
+	inline size_t run_input(const std::uint8_t* data, size_t size) {
+		if (size == 0)
+			return 0;
+		const Target& target = targets[data[0] % targets.size()];
+		return target.differential(Input(data + 1, size - 1));
+	}
+}// namespace custom::fuzz
+
+#endif// DIFFERENTIAL_H
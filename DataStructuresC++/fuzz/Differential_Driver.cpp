@@ -0,0 +1,176 @@
+/**
+ * The standalone driver of the differential harness, for running it without libFuzzer, e.g. in CI. For each target
+ * in Differential.h it generates random inputs, checks the container against its std model on every one of them and
+ * then replays them on the container alone to measure its throughput in operations per second.
+ *
+ * Options:
+ *  - `--seed=<n>` seeds the generation of the inputs, so a run can be repeated, 1 by default,
+ *  - `--runs=<n>` is the number of inputs per target, 200 by default,
+ *  - `--size=<n>` is the number of bytes of each input, 2048 by default,
+ *  - `--filter=<substring>` only runs the targets whose name contains the substring,
+ *  - `--min_time=<seconds>` is the minimum time the throughput of each target is measured for, 0.2 by default,
+ *  - `--budgets=<path>` reads the minimum throughput of each target from a file of `<target> <operations per second>`
+ *    lines, where `#` starts a comment.
+ * Any other argument is the path of an input to replay, such as one written by this driver or saved by libFuzzer.
+ *
+ * The inputs on which a container disagrees with its model are written to `mismatch-<target>-<seed>-<run>`, in the
+ * format of the fuzzer. The driver exits with 1 if there is a mismatch or a target is slower than its budget.
+ */
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Differential.h"
+
+namespace {
+	struct Options {
+		std::uint64_t seed = 1;
+		size_t runs = 200;
+		size_t size = 2048;
+		double min_time = 0.2;
+		std::string filter;
+		std::string budgets;
+		std::vector<std::string> replays;
+	};
+
+	bool parse(int argc, char** argv, Options& options) {
+		for (int i = 1; i < argc; ++i) {
+			std::string option = argv[i];
+			if (option.rfind("--seed=", 0) == 0)
+				options.seed = std::stoull(option.substr(7));
+			else if (option.rfind("--runs=", 0) == 0)
+				options.runs = std::stoul(option.substr(7));
+			else if (option.rfind("--size=", 0) == 0)
+				options.size = std::stoul(option.substr(7));
+			else if (option.rfind("--filter=", 0) == 0)
+				options.filter = option.substr(9);
+			else if (option.rfind("--min_time=", 0) == 0)
+				options.min_time = std::stod(option.substr(11));
+			else if (option.rfind("--budgets=", 0) == 0)
+				options.budgets = option.substr(10);
+			else if (option.rfind("--", 0) == 0) {
+				std::cerr << "Unknown option: " << option << "\n";
+				return false;
+			} else
+				options.replays.push_back(option);
+		}
+		return true;
+	}
+
+	// Reads the minimum operations per second of each target, returning false if the file cannot be read
+	bool read_budgets(const std::string& path, std::map<std::string, double>& budgets) {
+		std::ifstream file(path);
+		if (!file)
+			return false;
+		std::string line;
+		while (std::getline(file, line)) {
+			line = line.substr(0, line.find('#'));
+			std::istringstream fields(line);
+			std::string name;
+			double budget;
+			if (fields >> name >> budget)
+				budgets[name] = budget;
+		}
+		return true;
+	}
+
+	// Replays the inputs of the fuzzer saved in files, returning the number which mismatched
+	size_t replay_files(const std::vector<std::string>& paths) {
+		size_t mismatches = 0;
+		for (const std::string& path: paths) {
+			std::ifstream file(path, std::ios::binary);
+			std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+			try {
+				size_t ops = custom::fuzz::run_input(data.data(), data.size());
+				std::cout << path << ": " << ops << " operations agree\n";
+			} catch (const custom::fuzz::Mismatch& mismatch) {
+				std::cout << path << ": " << mismatch.what() << "\n";
+				++mismatches;
+			}
+		}
+		return mismatches;
+	}
+
+	// Saves an input which mismatched, prefixed with the index of its target so the fuzzer entry point replays it
+	void save(const std::string& path, size_t target, const std::vector<std::uint8_t>& input) {
+		std::ofstream file(path, std::ios::binary);
+		file.put(static_cast<char>(target));
+		file.write(reinterpret_cast<const char*>(input.data()), static_cast<std::streamsize>(input.size()));
+	}
+}
+
+int main(int argc, char** argv) {
+	Options options;
+	if (!parse(argc, argv, options))
+		return 1;
+	if (!options.replays.empty())
+		return replay_files(options.replays) ? 1 : 0;
+
+	std::map<std::string, double> budgets;
+	if (!options.budgets.empty() && !read_budgets(options.budgets, budgets)) {
+		std::cerr << "Error: could not read the budgets from " << options.budgets << "\n";
+		return 1;
+	}
+
+	bool failed = false;
+	std::cout << std::left << std::setw(20) << "Target" << std::right << std::setw(12) << "Operations"
+	          << std::setw(16) << "Ops/s" << std::setw(16) << "Budget" << "  Result\n";
+	for (size_t t = 0; t < custom::fuzz::targets.size(); ++t) {
+		const custom::fuzz::Target& target = custom::fuzz::targets[t];
+		if (std::string(target.name).find(options.filter) == std::string::npos)
+			continue;
+
+		std::mt19937_64 engine(options.seed * custom::fuzz::targets.size() + t);
+		std::vector<std::vector<std::uint8_t>> inputs(options.runs, std::vector<std::uint8_t>(options.size));
+		size_t operations = 0;
+		std::string result = "ok";
+		for (size_t run = 0; run < options.runs; ++run) {
+			for (std::uint8_t& byte: inputs[run])
+				byte = static_cast<std::uint8_t>(engine());
+			try {
+				operations += target.differential(custom::fuzz::Input(inputs[run].data(), inputs[run].size()));
+			} catch (const custom::fuzz::Mismatch& mismatch) {
+				std::string path = "mismatch-" + std::string(target.name) + "-" + std::to_string(options.seed) + "-" +
+				                   std::to_string(run);
+				save(path, t, inputs[run]);
+				std::cerr << mismatch.what() << ", input saved to " << path << "\n";
+				result = "MISMATCH";
+				break;
+			}
+		}
+
+		double ops_per_second = 0;
+		if (result == "ok") {
+			// The throughput is measured on the container alone, without the model and the comparisons
+			using clock = std::chrono::steady_clock;
+			size_t replayed = 0;
+			auto start = clock::now();
+			std::chrono::duration<double> elapsed{};
+			do {
+				for (const std::vector<std::uint8_t>& input: inputs)
+					replayed += target.replay(custom::fuzz::Input(input.data(), input.size()));
+				elapsed = clock::now() - start;
+			} while (elapsed.count() < options.min_time);
+			ops_per_second = static_cast<double>(replayed) / elapsed.count();
+		}
+
+		auto budget = budgets.find(target.name);
+		if (result == "ok" && budget != budgets.end() && ops_per_second < budget->second)
+			result = "OVER BUDGET";
+		failed |= result != "ok";
+
+		std::cout << std::left << std::setw(20) << target.name << std::right << std::setw(12) << operations
+		          << std::setw(16) << std::fixed << std::setprecision(0) << ops_per_second << std::setw(16)
+		          << (budget != budgets.end() ? std::to_string(static_cast<std::uint64_t>(budget->second)) : "-")
+		          << "  " << result << "\n";
+	}
+	return failed ? 1 : 0;
+}
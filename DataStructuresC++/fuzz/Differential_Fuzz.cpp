@@ -0,0 +1,20 @@
+/**
+ * The libFuzzer entry point of the differential harness. The first byte of each input selects the container and the
+ * rest are decoded into its operations, see Differential.h. A mismatch with the std model aborts, so libFuzzer saves
+ * the input, which Differential_Driver_run replays when given the path of the file.
+ */
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#include "Differential.h"
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, size_t size) {
+	try {
+		custom::fuzz::run_input(data, size);
+	} catch (const custom::fuzz::Mismatch& mismatch) {
+		std::cerr << mismatch.what() << std::endl;
+		std::abort();
+	}
+	return 0;
+}
@@ -0,0 +1,122 @@
+// Built as its own executable, with CUSTOM_TRACK_ALLOCATIONS defined for every translation unit of it
+#include <sstream>
+#include <string>
+
+#include "../BinarySearchTree.h"
+#include "../DoublyLinkedList.h"
+#include "../Graph.h"
+#include "../LinkedList.h"
+#include "../Map.h"
+#include "../Queue.h"
+#include "../Stack.h"
+#include "../Tree.h"
+#include "../Vector.h"
+#include "gtest/gtest.h"
+
+namespace tracking = custom::allocation_tracking;
+
+TEST (AllocationTrackingTests /*test suite name*/, Vector /*test name*/) {
+	static_assert(tracking::enabled);
+	tracking::reset();
+	{
+		custom::Vector<int> vector;
+		for (int i = 0; i < 100; ++i)
+			vector.push_back(i);
+		custom::AllocationStats stats = tracking::stats(custom::ContainerType::Vector);
+		// Every growth after the first allocation moves the elements into a new array
+		EXPECT_EQ (stats.reallocations, stats.allocations - 1);
+		EXPECT_EQ (stats.deallocations, stats.reallocations);
+		EXPECT_GE (stats.live_bytes(), 100 * sizeof(int));
+		EXPECT_GE (stats.peak_bytes, stats.live_bytes());
+
+		custom::Vector<int> copy(vector);
+		EXPECT_EQ (tracking::stats(custom::ContainerType::Vector).allocations, stats.allocations + 1);
+	}
+	custom::AllocationStats stats = tracking::stats(custom::ContainerType::Vector);
+	EXPECT_EQ (stats.live_bytes(), 0U);
+	EXPECT_EQ (stats.allocations, stats.deallocations);
+	EXPECT_EQ (stats.bytes_allocated, stats.bytes_freed);
+}
+
+TEST (AllocationTrackingTests /*test suite name*/, Nodes /*test name*/) {
+	tracking::reset();
+	{
+		custom::LinkedList<int> list = {1, 2, 3, 4};
+		custom::DoublyLinkedList<int> doubly_list = {1, 2, 3};
+		custom::Stack<int> stack = {1, 2};
+		custom::BinarySearchTree<int> tree(50);
+		tree.add(25);
+		tree.add(75);
+		custom::Tree<int> general_tree(1);
+		general_tree.add_child(2);
+		custom::Graph<int, int> graph(1, 1);
+		graph.add_node(2, 2);
+		EXPECT_EQ (tracking::stats(custom::ContainerType::LinkedList).allocations, 4U);
+		EXPECT_EQ (tracking::stats(custom::ContainerType::DoublyLinkedList).allocations, 3U);
+		EXPECT_EQ (tracking::stats(custom::ContainerType::Stack).allocations, 2U);
+		EXPECT_EQ (tracking::stats(custom::ContainerType::BinarySearchTree).allocations, 3U);
+		EXPECT_EQ (tracking::stats(custom::ContainerType::Tree).allocations, 2U);
+		EXPECT_EQ (tracking::stats(custom::ContainerType::Graph).allocations, 2U);
+
+		list.pop_front();
+		stack.pop();
+		EXPECT_EQ (tracking::stats(custom::ContainerType::LinkedList).deallocations, 1U);
+		EXPECT_EQ (tracking::stats(custom::ContainerType::Stack).live_bytes(),
+		           tracking::stats(custom::ContainerType::Stack).bytes_allocated / 2);
+	}
+	for (custom::ContainerType type: {custom::ContainerType::LinkedList, custom::ContainerType::DoublyLinkedList,
+	                                  custom::ContainerType::Stack, custom::ContainerType::BinarySearchTree,
+	                                  custom::ContainerType::Tree, custom::ContainerType::Graph}) {
+		custom::AllocationStats stats = tracking::stats(type);
+		EXPECT_EQ (stats.live_bytes(), 0U) << tracking::name(type);
+		EXPECT_EQ (stats.allocations, stats.deallocations) << tracking::name(type);
+		EXPECT_GT (stats.peak_bytes, 0U) << tracking::name(type);
+	}
+}
+
+TEST (AllocationTrackingTests /*test suite name*/, QueueAndMap /*test name*/) {
+	tracking::reset();
+	{
+		// Pooled queues allocate their nodes in chunks, heap queues one node at a time
+		custom::Queue<int> pooled;
+		for (int i = 0; i < 10; ++i)
+			pooled.enqueue(i);
+		EXPECT_EQ (tracking::stats(custom::ContainerType::Queue).allocations, 1U);
+		custom::PriorityQueue<int, custom::queue_policy::Ascending, custom::queue_policy::HeapNodes> heap;
+		for (int i = 0; i < 10; ++i)
+			heap.enqueue(i);
+		EXPECT_EQ (tracking::stats(custom::ContainerType::Queue).allocations, 11U);
+		heap.dequeue();
+		EXPECT_EQ (tracking::stats(custom::ContainerType::Queue).deallocations, 1U);
+
+		custom::Map<int, int> map(8);
+		EXPECT_EQ (tracking::stats(custom::ContainerType::Map).allocations, 1U);
+		for (int i = 0; i < 20; ++i)
+			map.add(i, i);
+		EXPECT_EQ (tracking::stats(custom::ContainerType::Map).allocations, 21U);
+		map.remove(0);
+		EXPECT_EQ (tracking::stats(custom::ContainerType::Map).deallocations, 1U);
+	}
+	for (custom::ContainerType type: {custom::ContainerType::Queue, custom::ContainerType::Map}) {
+		EXPECT_EQ (tracking::stats(type).live_bytes(), 0U) << tracking::name(type);
+		EXPECT_EQ (tracking::stats(type).allocations, tracking::stats(type).deallocations) << tracking::name(type);
+	}
+}
+
+TEST (AllocationTrackingTests /*test suite name*/, Report /*test name*/) {
+	tracking::reset();
+	custom::Vector<int> vector = {1, 2, 3};
+	std::ostringstream out;
+	tracking::report(out);
+	const std::string report = out.str();
+	EXPECT_NE (report.find("Peak bytes"), std::string::npos);
+	EXPECT_NE (report.find("Vector"), std::string::npos);
+	EXPECT_EQ (report.find("LinkedList"), std::string::npos);
+
+	// Memory still in use is kept as live bytes across a reset
+	tracking::reset();
+	custom::AllocationStats stats = tracking::stats(custom::ContainerType::Vector);
+	EXPECT_EQ (stats.allocations, 0U);
+	EXPECT_EQ (stats.live_bytes(), 10 * sizeof(int));
+	EXPECT_EQ (stats.peak_bytes, stats.live_bytes());
+}
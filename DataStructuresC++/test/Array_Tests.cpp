@@ -42,6 +42,11 @@ TEST (ArrayTests /*test suite name*/, Methods /*test name*/) {
 	EXPECT_EQ (arr[9], 9);
 	EXPECT_TRUE (arr);
 	EXPECT_EQ (arr.size(), 10);
+
+	// The tests are built with the default, checked, policy
+	static_assert(custom::checking == custom::CheckingPolicy::Checked);
+	static_assert(!noexcept(arr[0]));
+	EXPECT_THROW (static_cast<void>(arr[10]), std::out_of_range);
 }
 
 TEST (ArrayTests /*test suite name*/, IteratorTest /*test name*/) {
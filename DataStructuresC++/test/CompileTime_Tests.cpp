@@ -0,0 +1,112 @@
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../Array.h"
+#include "../FixedVector.h"
+#include "../Serialization.h"
+#include "../StaticMap.h"
+#include "../Vector.h"
+#include "gtest/gtest.h"
+
+namespace {
+	// A table computed entirely at compile time
+	constexpr custom::Array<int, 8> squares = [] {
+		custom::Array<int, 8> result;
+		for (size_t i = 0; i < result.size(); ++i)
+			result[i] = static_cast<int>(i * i);
+		return result;
+	}();
+
+	constexpr custom::FixedVector<int, 16> primes = [] {
+		custom::FixedVector<int, 16> result;
+		for (int n = 2; !result.full(); ++n) {
+			bool prime = true;
+			for (int p: result)
+				prime = prime && n % p != 0;
+			if (prime)
+				result.push_back(n);
+		}
+		return result;
+	}();
+
+	constexpr auto status_codes = custom::make_static_map<std::string_view, int>({
+			{"not-found", 404}, {"ok", 200}, {"teapot", 418}, {"created", 201}, {"moved", 301}});
+
+	// A use which does not compile if the map does not reject duplicate keys in constant expressions
+	template<auto Make>
+	constexpr bool rejected = !requires { typename std::integral_constant<int, (Make(), 0)>; };
+}
+
+TEST (CompileTimeTests /*test suite name*/, Array /*test name*/) {
+	static_assert(squares[7] == 49);
+	static_assert(std::accumulate(squares.begin(), squares.end(), 0) == 140);
+	static_assert(std::is_trivially_destructible_v<custom::Array<int, 8>>);
+	static_assert(sizeof(custom::Array<int, 8>) == 8 * sizeof(int) + sizeof(size_t));
+	static_assert([] {
+		custom::Array<int, 3> array = {3, 1, 2};
+		custom::Array<int, 3> moved(std::move(array));
+		return moved[0] == 3 && array.size() == 0;
+	}());
+	EXPECT_EQ (squares[3], 9);
+	EXPECT_EQ (squares.memory_usage().allocations, 0);
+	EXPECT_EQ (squares.memory_usage().payload, 8 * sizeof(int));
+}
+
+TEST (CompileTimeTests /*test suite name*/, FixedVector /*test name*/) {
+	static_assert(primes.size() == 16 && primes.back() == 53);
+	static_assert(custom::FixedVector<int, 4>({1, 2}) != custom::FixedVector<int, 4>({1, 2, 3}));
+	static_assert([] {
+		custom::FixedVector<std::string, 4> strings;  // Strings of a constant expression do not outlive it
+		strings.emplace_back(3, 'x');
+		strings.push_back("long enough to be allocated on the heap");
+		strings.pop_back();
+		return strings.size() == 1 && strings.front() == "xxx";
+	}());
+
+	custom::FixedVector<std::string, 3> strings = {"a", "b"};
+	strings.push_back("c");
+	EXPECT_TRUE (strings.full());
+	EXPECT_THROW (strings.push_back("d"), std::length_error);
+	EXPECT_THROW (static_cast<void>(strings[3]), std::out_of_range);
+	custom::FixedVector<std::string, 3> moved(std::move(strings));
+	EXPECT_TRUE (strings.empty());
+	EXPECT_EQ (moved.back(), "c");
+	moved.clear();
+	EXPECT_THROW (moved.pop_back(), std::runtime_error);
+
+	// The data of a FixedVector is that of a Vector
+	custom::Vector<int> vector = custom::deserialize<custom::Vector<int>>(custom::serialize(primes));
+	EXPECT_EQ (vector.size(), 16);
+	EXPECT_EQ (vector[15], 53);
+	EXPECT_EQ ((custom::deserialize<custom::FixedVector<int, 16>>(custom::serialize(vector))), primes);
+	EXPECT_THROW ((custom::deserialize<custom::FixedVector<int, 8>>(custom::serialize(vector))), std::runtime_error);
+}
+
+TEST (CompileTimeTests /*test suite name*/, StaticMap /*test name*/) {
+	static_assert(status_codes.at("teapot") == 418);
+	static_assert(status_codes.exists("ok") && !status_codes.exists("gone"));
+	static_assert(status_codes.find("gone") == nullptr);
+	static_assert(status_codes.begin()->first == "created");  // The pairs are sorted by key
+	static_assert(rejected<[] { return custom::make_static_map<int, int>({{1, 1}, {2, 2}, {1, 3}}); }>);
+	static_assert(!rejected<[] { return custom::make_static_map<int, int>({{1, 1}, {2, 2}, {3, 3}}); }>);
+
+	constexpr custom::StaticMap<int, char, 3, std::greater<>> descending({{1, 'a'}, {3, 'c'}, {2, 'b'}});
+	static_assert(descending.begin()->first == 3 && descending.at(2) == 'b');
+
+	std::string key = "moved";  // Known only at run time
+	EXPECT_EQ (status_codes.at(key), 301);
+	EXPECT_EQ (*status_codes.find("created"), 201);
+	EXPECT_THROW (static_cast<void>(status_codes.at("gone")), std::invalid_argument);
+	EXPECT_EQ (status_codes.contents().size(), 5);
+	EXPECT_EQ (status_codes.memory_usage().allocations, 0);
+
+	// Keys and values which are not literal types can still be held, built at run time
+	custom::StaticMap<std::string, std::vector<int>, 2> runtime({{"odd", {1, 3}}, {"even", {2, 4}}});
+	EXPECT_EQ (runtime.at("odd"), std::vector<int>({1, 3}));
+	EXPECT_THROW ((custom::StaticMap<std::string, int, 2>({{"a", 1}, {"a", 2}})), std::invalid_argument);
+}
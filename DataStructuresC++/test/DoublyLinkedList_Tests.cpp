@@ -174,4 +174,31 @@ TEST (DoublyLinkedListTest /*test suite name*/, IteratorTest /*test name*/) {
 	EXPECT_TRUE (it != it2);
 	--it;
 	EXPECT_TRUE (it == it2);
-}
\ No newline at end of file
+}
+
+TEST (DoublyLinkedListTest /*test suite name*/, Relinking /*test name*/) {
+	// Regressions found by the differential harness in fuzz/
+	custom::DoublyLinkedList<int> list;
+	list.push_front(1);
+	list.insert(3, 1);
+	list.insert(2, 1);
+	EXPECT_EQ (list.contents(), std::vector<int>({1, 2, 3}));
+	EXPECT_EQ (list.back(), 3);
+	list.append({4, 5, 6});
+	EXPECT_EQ (list.get(4), 5);
+	list.erase(4);
+	list.erase(1);
+	EXPECT_EQ (list.contents(), std::vector<int>({1, 3, 4, 6}));
+	EXPECT_EQ (list.get(2), 4);
+	list.reverse_order();
+	EXPECT_EQ (list.contents(), std::vector<int>({6, 4, 3, 1}));
+	list.reverse_order();
+	list.erase(3);
+	EXPECT_EQ (list.back(), 4);
+	list.pop_back();
+	list.pop_back();
+	list.pop_back();
+	EXPECT_TRUE (list.empty());
+	list.push_back(7);
+	EXPECT_EQ (list.front(), 7);
+}
@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../ExternalSort.h"
+#include "gtest/gtest.h"
+
+namespace {
+	// A directory of its own for every test, removed at the end of the test
+	class ScratchDirectory {
+	public:
+		explicit ScratchDirectory(const std::string& name) :
+				mPath(std::filesystem::temp_directory_path() / ("custom-external-sort-test-" + name)) {
+			std::filesystem::remove_all(mPath);
+			std::filesystem::create_directories(mPath);
+		}
+
+		~ScratchDirectory() {
+			std::filesystem::remove_all(mPath);
+		}
+
+		[[nodiscard]] std::filesystem::path operator/(const std::string& name) const {
+			return mPath / name;
+		}
+
+		[[nodiscard]] size_t entries() const {
+			return static_cast<size_t>(std::distance(std::filesystem::directory_iterator(mPath),
+			                                         std::filesystem::directory_iterator()));
+		}
+
+	private:
+		std::filesystem::path mPath;
+	};
+
+	template<typename T>
+	void write_records(const std::filesystem::path& path, const std::vector<T>& records) {
+		std::ofstream file(path, std::ios::binary);
+		file.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(T)));
+	}
+
+	template<typename T>
+	std::vector<T> read_records(const std::filesystem::path& path) {
+		std::vector<T> records(std::filesystem::file_size(path) / sizeof(T));
+		std::ifstream file(path, std::ios::binary);
+		file.read(reinterpret_cast<char*>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(T)));
+		return records;
+	}
+}
+
+TEST (ExternalSortTests /*test suite name*/, InMemory /*test name*/) {
+	ScratchDirectory scratch("in-memory");
+	for (size_t size: {size_t(0), size_t(1), size_t(1000)}) {
+		std::mt19937_64 generator(size);
+		std::vector<std::uint64_t> records(size);
+		for (std::uint64_t& record: records)
+			record = generator();
+		write_records(scratch / "input", records);
+		custom::ExternalSortStats stats = custom::external_sort<std::uint64_t>(scratch / "input", scratch / "output");
+		std::sort(records.begin(), records.end());
+		EXPECT_EQ (read_records<std::uint64_t>(scratch / "output"), records);
+		EXPECT_EQ (stats.phase, custom::ExternalSortPhase::Done);
+		EXPECT_EQ (stats.records, size);
+		EXPECT_EQ (stats.runs, 0U);
+		EXPECT_EQ (stats.bytes_written, size * sizeof(std::uint64_t));
+	}
+}
+
+TEST (ExternalSortTests /*test suite name*/, MultiPassMerge /*test name*/) {
+	ScratchDirectory scratch("multi-pass");
+	std::mt19937 generator(86);
+	std::vector<std::int32_t> records(100003);
+	for (std::int32_t& record: records)
+		record = static_cast<std::int32_t>(generator() % 50000) - 25000;
+	write_records(scratch / "input", records);
+
+	// 64 KiB of memory holds 8192 records per run, so 13 runs are merged 4 at a time in 2 passes
+	custom::ExternalSortOptions options;
+	options.memory_budget = 64 << 10;
+	options.max_fan_in = 4;
+	options.temp_directory = scratch / "";
+	size_t reports = 0;
+	custom::ExternalSortPhase last_phase = custom::ExternalSortPhase::RunGeneration;
+	options.progress = [&](const custom::ExternalSortStats& stats) {
+		EXPECT_GE (stats.phase, last_phase);
+		EXPECT_LE (stats.records_done, stats.records);
+		last_phase = stats.phase;
+		++reports;
+	};
+	custom::ExternalSortStats stats = custom::external_sort<std::int32_t>(scratch / "input", scratch / "output", options);
+	std::sort(records.begin(), records.end());
+	EXPECT_EQ (read_records<std::int32_t>(scratch / "output"), records);
+	EXPECT_EQ (stats.runs, 13U);
+	EXPECT_EQ (stats.merge_passes, 2U);
+	EXPECT_EQ (stats.records_done, records.size());
+	EXPECT_EQ (last_phase, custom::ExternalSortPhase::Done);
+	EXPECT_GT (reports, 13U);
+	EXPECT_GT (stats.throughput(), 0.0);
+	// Only the input and the output are left behind
+	EXPECT_EQ (scratch.entries(), 2U);
+}
+
+TEST (ExternalSortTests /*test suite name*/, RecordsInPlace /*test name*/) {
+	struct Record {
+		std::uint32_t key;
+		std::uint32_t id;
+		double payload;
+	};
+	ScratchDirectory scratch("records");
+	std::mt19937 generator(7);
+	std::vector<Record> records(20000);
+	for (std::uint32_t i = 0; i < records.size(); ++i)
+		records[i] = Record{static_cast<std::uint32_t>(generator() % 1000), i, i * 0.5};
+	write_records(scratch / "data", records);
+
+	custom::ExternalSortOptions options;
+	options.memory_budget = 32 << 10;
+	options.temp_directory = scratch / "";
+	// The input is replaced by the sorted records, in descending order of key
+	custom::external_sort<Record>(scratch / "data", scratch / "data", options, std::greater<>(), &Record::key);
+	std::vector<Record> sorted = read_records<Record>(scratch / "data");
+	ASSERT_EQ (sorted.size(), records.size());
+	std::vector<bool> seen(records.size());
+	for (size_t i = 0; i < sorted.size(); ++i) {
+		if (i > 0) {
+			EXPECT_GE (sorted[i - 1].key, sorted[i].key);
+		}
+		EXPECT_EQ (sorted[i].payload, sorted[i].id * 0.5);
+		seen[sorted[i].id] = true;
+	}
+	EXPECT_TRUE (std::all_of(seen.begin(), seen.end(), [](bool x) { return x; }));
+}
+
+TEST (ExternalSortTests /*test suite name*/, Errors /*test name*/) {
+	ScratchDirectory scratch("errors");
+	write_records(scratch / "odd", std::vector<char>(10));
+	EXPECT_THROW (custom::external_sort<std::uint64_t>(scratch / "odd", scratch / "output"), std::invalid_argument);
+	EXPECT_THROW (custom::external_sort<std::uint64_t>(scratch / "missing", scratch / "output"),
+	              std::filesystem::filesystem_error);
+
+	custom::ExternalSortOptions options;
+	options.max_fan_in = 1;
+	EXPECT_THROW (custom::external_sort<char>(scratch / "odd", scratch / "output", options), std::invalid_argument);
+
+	options.max_fan_in = 2;
+	options.memory_budget = 4;
+	EXPECT_THROW (custom::external_sort<char>(scratch / "odd", scratch / "missing" / "output", options),
+	              std::runtime_error);
+}
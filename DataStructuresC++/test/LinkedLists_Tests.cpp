@@ -151,4 +151,33 @@ TEST (LinkedListTest /*test suite name*/, IteratorTest /*test name*/) {
 	++it;
 	EXPECT_FALSE (it == it2);
 	EXPECT_TRUE (it != it2);
-}
\ No newline at end of file
+}
+
+TEST (LinkedListTest /*test suite name*/, MemoryUsage /*test name*/) {
+	custom::LinkedList<int> list = {1, 2, 3, 4};
+	custom::MemoryUsage usage = list.memory_usage();
+	EXPECT_EQ (usage.payload, 4 * sizeof(int));
+	EXPECT_EQ (usage.allocations, 4);
+	// Each node holds a pointer to the next node besides its data
+	EXPECT_GE (usage.structure, sizeof(list) + 4 * sizeof(void*));
+	list.pop_front();
+	EXPECT_EQ (list.memory_usage().allocations, 3);
+}
+
+TEST (LinkedListTest /*test suite name*/, TailTracking /*test name*/) {
+	// Regressions found by the differential harness in fuzz/
+	custom::LinkedList<int> list;
+	list.push_front(1);
+	EXPECT_EQ (list.back(), 1);
+	list.insert(2, 1);
+	EXPECT_EQ (list.back(), 2);
+	list.push_back(3);
+	EXPECT_EQ (list.contents(), std::vector<int>({1, 2, 3}));
+	list.pop_front();
+	list.pop_front();
+	list.pop_front();
+	list.push_front(4);
+	list.push_back(5);
+	EXPECT_EQ (list.contents(), std::vector<int>({4, 5}));
+	EXPECT_EQ (list.back(), 5);
+}
@@ -0,0 +1,188 @@
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <utility>
+
+#include "../BinarySearchTree.h"
+#include "../BinaryTree.h"
+#include "../DoublyLinkedList.h"
+#include "../Graph.h"
+#include "../LinkedList.h"
+#include "../Map.h"
+#include "../Queue.h"
+#include "../Stack.h"
+#include "../Tree.h"
+#include "../Vector.h"
+#include "gtest/gtest.h"
+
+namespace {
+	// A memory resource which counts the allocations made through it and the bytes still allocated
+	class CountingResource : public std::pmr::memory_resource {
+	public:
+		size_t allocations = 0;
+		size_t live_bytes = 0;
+
+	private:
+		void* do_allocate(size_t bytes, size_t alignment) override {
+			++allocations;
+			live_bytes += bytes;
+			return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+		}
+
+		void do_deallocate(void* memory, size_t bytes, size_t alignment) override {
+			live_bytes -= bytes;
+			std::pmr::new_delete_resource()->deallocate(memory, bytes, alignment);
+		}
+
+		[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+			return this == &other;
+		}
+	};
+
+	// Replaces the default memory resource for the duration of a test, so allocations which escape the resource
+	// given to a container are counted
+	class DefaultResourceGuard {
+	public:
+		DefaultResourceGuard() : previous(std::pmr::set_default_resource(&fallback)) {}
+
+		~DefaultResourceGuard() {
+			std::pmr::set_default_resource(previous);
+		}
+
+		[[nodiscard]] size_t allocations() const noexcept {
+			return fallback.allocations;
+		}
+
+	private:
+		CountingResource fallback;
+		std::pmr::memory_resource* previous;
+	};
+
+	std::pmr::string long_key(int i, std::pmr::memory_resource* resource) {
+		std::pmr::string key("a key long enough not to fit in a small string ", resource);
+		key += std::to_string(i);
+		return key;
+	}
+}
+
+TEST (MemoryResourceTests /*test suite name*/, Sequences /*test name*/) {
+	DefaultResourceGuard guard;
+	CountingResource resource;
+	{
+		custom::pmr::Vector<int> vector(&resource);
+		for (int i = 0; i < 100; ++i)
+			vector.push_back(i);
+		custom::pmr::LinkedList<int> list({1, 2, 3}, &resource);
+		custom::pmr::DoublyLinkedList<int> doubly_list({1, 2, 3}, &resource);
+		custom::pmr::Stack<int> stack({1, 2, 3}, &resource);
+		custom::pmr::Queue<int> queue({1, 2, 3}, &resource);
+		custom::pmr::PriorityQueue<int, custom::queue_policy::Ascending> priority(&resource);
+		priority.enqueue({3, 1, 2});
+		EXPECT_EQ (vector.get_allocator().resource(), &resource);
+		EXPECT_EQ (queue.get_allocator().resource(), &resource);
+		EXPECT_EQ (priority.contents(), std::vector<int>({1, 2, 3}));
+		EXPECT_GT (resource.allocations, 0);
+		EXPECT_GT (resource.live_bytes, 100 * sizeof(int));
+	}
+	EXPECT_EQ (resource.live_bytes, 0);
+	EXPECT_EQ (guard.allocations(), 0);
+}
+
+TEST (MemoryResourceTests /*test suite name*/, NestedContainers /*test name*/) {
+	DefaultResourceGuard guard;
+	CountingResource resource;
+	{
+		// The buckets of the map and the keys in them are allocated from the resource of the map
+		custom::pmr::Map<std::pmr::string, int> map(8, &resource);
+		for (int i = 0; i < 50; ++i)
+			map.add(long_key(i, &resource), i);
+		EXPECT_EQ (map.at(long_key(17, &resource)), 17);
+
+		custom::pmr::Graph<int, int> graph(&resource);
+		for (int i = 0; i < 10; ++i)
+			graph.add_node(i * 10, i);
+		graph.add_edge(1, 2);
+		custom::pmr::DirectedGraph<int, int> directed(&resource);
+		directed.add_node(10, 1);
+		directed.add_node(20, 2);
+		directed.add_edge(1, 2);
+
+		custom::pmr::BinarySearchTree<int> search_tree({50, 30, 70}, &resource);
+		custom::pmr::BinaryTree<int> binary_tree(0, &resource);
+		binary_tree.new_left(1);
+		binary_tree.new_right(2);
+		custom::pmr::Tree<int> tree(1, true, &resource);
+		tree.add_child({4, 2, 3});
+		EXPECT_EQ (tree.children_data(), std::vector<int>({2, 3, 4}));
+		EXPECT_TRUE (graph.find_edge(2, 1));
+		EXPECT_EQ (search_tree.contents_InOrder(), std::vector<int>({30, 50, 70}));
+		EXPECT_EQ (binary_tree.contents_InOrder(), std::vector<int>({1, 0, 2}));
+		EXPECT_GT (resource.live_bytes, 0);
+	}
+	EXPECT_EQ (resource.live_bytes, 0);
+	EXPECT_EQ (guard.allocations(), 0);
+}
+
+TEST (MemoryResourceTests /*test suite name*/, MonotonicBuffer /*test name*/) {
+	// Every allocation of the containers is served from the buffer, without ever reaching the upstream resource
+	alignas(std::max_align_t) std::array<std::byte, 1 << 16> buffer{};
+	CountingResource upstream;
+	std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), &upstream);
+	{
+		custom::pmr::Vector<int> vector(&arena);
+		custom::pmr::Map<int, int> map(&arena);
+		custom::pmr::Queue<int> queue(&arena);
+		for (int i = 0; i < 200; ++i) {
+			vector.push_back(i);
+			map.add(i, -i);
+			queue.enqueue(i);
+		}
+		EXPECT_EQ (map.at(150), -150);
+		EXPECT_EQ (queue.dequeue(), 0);
+	}
+	EXPECT_EQ (upstream.allocations, 0);
+	arena.release();
+}
+
+TEST (MemoryResourceTests /*test suite name*/, MovesBetweenResources /*test name*/) {
+	CountingResource first;
+	CountingResource second;
+	{
+		custom::pmr::LinkedList<int> list({1, 2, 3}, &first);
+		custom::pmr::LinkedList<int> moved(std::move(list));  // Takes the nodes and the resource
+		EXPECT_EQ (moved.get_allocator().resource(), &first);
+		EXPECT_EQ (moved.contents(), std::vector<int>({1, 2, 3}));
+
+		custom::pmr::LinkedList<int> other(&second);
+		other = std::move(moved);  // Keeps its resource, so the elements are moved into new nodes
+		EXPECT_EQ (other.get_allocator().resource(), &second);
+		EXPECT_EQ (other.contents(), std::vector<int>({1, 2, 3}));
+		EXPECT_EQ (first.live_bytes, 0);
+
+		custom::pmr::Vector<int> vector({1, 2, 3}, &first);
+		custom::pmr::Vector<int> other_vector(&second);
+		other_vector = std::move(vector);
+		EXPECT_EQ (other_vector, custom::pmr::Vector<int>({1, 2, 3}, &second));
+		EXPECT_EQ (vector.size(), 0);  // The storage of the other vector is kept for reuse, as with std::vector
+
+		custom::pmr::Queue<int> queue({1, 2, 3}, &first);
+		custom::pmr::Queue<int> other_queue(&second);
+		other_queue = std::move(queue);
+		EXPECT_EQ (other_queue.contents(), std::vector<int>({1, 2, 3}));
+		EXPECT_TRUE (queue.empty());
+
+		custom::pmr::Graph<int, int> graph(&first);
+		graph.add_node(10, 1);
+		graph.add_node(20, 2);
+		graph.add_edge(1, 2);
+		custom::pmr::Graph<int, int> other_graph(&second);
+		other_graph = std::move(graph);
+		EXPECT_TRUE (other_graph.find_edge(2, 1));
+		EXPECT_EQ (other_graph.contents(), (std::vector<std::pair<int, int>>({{1, 10}, {2, 20}})));
+		EXPECT_TRUE (graph.contents().empty());
+		EXPECT_GT (second.live_bytes, 0);
+	}
+	EXPECT_EQ (first.live_bytes, 0);
+	EXPECT_EQ (second.live_bytes, 0);
+}
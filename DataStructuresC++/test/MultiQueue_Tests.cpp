@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../MultiQueue.h"
+#include "gtest/gtest.h"
+
+TEST (MultiQueueTests /*test suite name*/, SingleThread /*test name*/) {
+	custom::MultiQueue<int> queue(2, 2);
+	EXPECT_EQ (queue.heap_count(), 4);
+	EXPECT_TRUE (queue.empty());
+	EXPECT_FALSE (queue.try_pop().has_value());
+	for (int i = 0; i < 1000; ++i)
+		queue.push(999 - i);
+	EXPECT_EQ (queue.length(), 1000);
+
+	// Every element comes out exactly once, close to priority order
+	std::vector<int> popped;
+	while (auto value = queue.try_pop())
+		popped.push_back(*value);
+	EXPECT_TRUE (queue.empty());
+	custom::RankError error = custom::rank_error(popped.begin(), popped.end());
+	EXPECT_LT (error.mean, 50.0);
+	std::sort(popped.begin(), popped.end());
+	for (int i = 0; i < 1000; ++i)
+		EXPECT_EQ (popped[i], i);
+}
+
+TEST (MultiQueueTests /*test suite name*/, RankError /*test name*/) {
+	std::vector<int> exact = {1, 2, 3, 4, 5};
+	EXPECT_EQ (custom::rank_error(exact.begin(), exact.end()).max, 0);
+	std::vector<int> relaxed = {3, 1, 2, 5, 4};
+	custom::RankError error = custom::rank_error(relaxed.begin(), relaxed.end());
+	EXPECT_EQ (error.max, 2);
+	EXPECT_DOUBLE_EQ (error.mean, 3.0 / 5.0);
+	// A max-priority queue is measured with its own comparison object
+	std::vector<int> descending = {5, 4, 3, 2, 1};
+	EXPECT_EQ (custom::rank_error(descending.begin(), descending.end(), std::greater<>()).max, 0);
+}
+
+TEST (MultiQueueTests /*test suite name*/, Concurrent /*test name*/) {
+	constexpr int threads = 4;
+	constexpr int per_thread = 20000;
+	custom::MultiQueue<int> queue(threads);
+	std::atomic<long long> sum{0};
+	std::atomic<int> popped{0};
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threads; ++t) {
+		workers.emplace_back([&, t] {
+			for (int i = 0; i < per_thread; ++i) {
+				queue.push(t * per_thread + i);
+				if (i % 2) {
+					if (auto value = queue.try_pop()) {
+						sum += *value;
+						++popped;
+					}
+				}
+			}
+		});
+	}
+	for (std::thread& worker: workers)
+		worker.join();
+	while (auto value = queue.try_pop()) {
+		sum += *value;
+		++popped;
+	}
+	long long total = static_cast<long long>(threads) * per_thread;
+	EXPECT_EQ (popped.load(), total);
+	EXPECT_EQ (sum.load(), total * (total - 1) / 2);
+}
+
+TEST (MultiQueueTests /*test suite name*/, ThrowingConstructor /*test name*/) {
+	struct Element {
+		int value;
+
+		Element(int value, bool fail) : value(value) {
+			if (fail)
+				throw std::runtime_error("Element construction failed");
+		}
+
+		bool operator<(const Element& other) const noexcept {
+			return value < other.value;
+		}
+	};
+
+	// Every heap holds elements, so a heap left locked by the failed construction would block popping them
+	custom::MultiQueue<Element> queue(1, 1);
+	for (int i = 0; i < 100; ++i)
+		queue.emplace(i, false);
+	for (int i = 0; i < 10; ++i)
+		EXPECT_THROW (queue.emplace(-1, true), std::runtime_error);
+	size_t popped = 0;
+	while (queue.try_pop().has_value())
+		++popped;
+	EXPECT_EQ (popped, 100);
+}
@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../ParallelSort.h"
+#include "../Vector.h"
+#include "gtest/gtest.h"
+
+static std::vector<std::uint32_t> random_keys(size_t count, std::uint32_t modulo) {
+	std::vector<std::uint32_t> keys(count);
+	std::mt19937 generator(17);
+	for (std::uint32_t& key: keys)
+		key = generator() % modulo;
+	return keys;
+}
+
+TEST (ParallelSortTests /*test suite name*/, SampleSort /*test name*/) {
+	custom::ThreadPool pool(4);
+	for (std::uint32_t modulo: {1U, 7U, 1000U, 0xFFFFFFFFU}) {
+		for (size_t size: {size_t(0), size_t(100), size_t(1) << 18}) {
+			std::vector<std::uint32_t> keys = random_keys(size, modulo);
+			std::vector<std::uint32_t> expected = keys;
+			std::sort(expected.begin(), expected.end());
+			custom::parallel_sort(pool, keys);
+			EXPECT_EQ (keys, expected);
+		}
+	}
+
+	// Sorted and reverse sorted inputs, in descending order
+	std::vector<int> values(200000);
+	for (size_t i = 0; i < values.size(); ++i)
+		values[i] = static_cast<int>(i);
+	custom::parallel_sort(pool, values.begin(), values.end(), std::greater<>());
+	EXPECT_TRUE (std::is_sorted(values.begin(), values.end(), std::greater<>()));
+	custom::parallel_sort(pool, values.begin(), values.end());
+	EXPECT_TRUE (std::is_sorted(values.begin(), values.end()));
+}
+
+TEST (ParallelSortTests /*test suite name*/, Containers /*test name*/) {
+	custom::ThreadPool pool(3);
+	std::vector<std::uint32_t> keys = random_keys(100000, 1U << 20);
+	custom::Vector<std::string> words;
+	for (std::uint32_t key: keys)
+		words.push_back(std::to_string(key));
+	custom::parallel_sort(pool, words);
+	EXPECT_TRUE (std::is_sorted(words.begin(), words.end()));
+
+	// Sorting by the length of the words only
+	custom::parallel_stable_sort(pool, words, std::less<>(), &std::string::size);
+	EXPECT_TRUE (std::is_sorted(words.begin(), words.end(), [](const std::string& x, const std::string& y) {
+		return x.size() < y.size() || (x.size() == y.size() && x < y);
+	}));
+}
+
+TEST (ParallelSortTests /*test suite name*/, StableSort /*test name*/) {
+	custom::ThreadPool pool(4);
+	for (size_t size: {size_t(1000), size_t(1) << 17, (size_t(1) << 17) + 12345}) {
+		std::vector<std::uint32_t> keys = random_keys(size, 64);
+		std::vector<std::pair<std::uint32_t, size_t>> items(size);
+		for (size_t i = 0; i < size; ++i)
+			items[i] = {keys[i], i};
+		custom::parallel_stable_sort(pool, items.begin(), items.end(), std::less<>(),
+		                             &std::pair<std::uint32_t, size_t>::first);
+		// Equal keys keep their original order, so the pairs end up fully sorted
+		EXPECT_TRUE (std::is_sorted(items.begin(), items.end()));
+	}
+}
+
+TEST (ParallelSortTests /*test suite name*/, NestedInPool /*test name*/) {
+	// Sorting from within a task of the same pool must not deadlock
+	custom::ThreadPool pool(2);
+	std::vector<std::uint32_t> first = random_keys(1 << 17, 1000), second = first;
+	custom::WaitGroup group;
+	pool.spawn(group, [&] { custom::parallel_sort(pool, first); });
+	pool.spawn(group, [&] { custom::parallel_stable_sort(pool, second); });
+	pool.sync(group);
+	EXPECT_TRUE (std::is_sorted(first.begin(), first.end()));
+	EXPECT_EQ (first, second);
+}
+
+TEST (ParallelSortTests /*test suite name*/, RadixSort /*test name*/) {
+	custom::ThreadPool pool(4);
+	std::vector<std::uint32_t> keys = random_keys(size_t(1) << 18, 0xFFFFFFFFU);
+	std::vector<std::uint32_t> expected = keys;
+	std::sort(expected.begin(), expected.end());
+	custom::parallel_radix_sort(pool, keys);
+	EXPECT_EQ (keys, expected);
+
+	// Stable on records, with the pre-pass histograms reused by the first pass and recounted afterwards
+	std::vector<std::pair<std::int16_t, size_t>> records(size_t(1) << 17);
+	std::vector<std::uint32_t> record_keys = random_keys(records.size(), 3000);
+	for (size_t i = 0; i < records.size(); ++i)
+		records[i] = {static_cast<std::int16_t>(record_keys[i]) - 1500, i};
+	custom::parallel_radix_sort(pool, records, &std::pair<std::int16_t, size_t>::first);
+	EXPECT_TRUE (std::is_sorted(records.begin(), records.end()));
+
+	std::vector<std::string> words(100000);
+	for (size_t i = 0; i < words.size(); ++i)
+		words[i] = std::to_string(keys[i] % 100000);
+	std::vector<std::string> expected_words = words;
+	std::sort(expected_words.begin(), expected_words.end());
+	custom::parallel_radix_sort(pool, words.begin(), words.end());
+	EXPECT_EQ (words, expected_words);
+}
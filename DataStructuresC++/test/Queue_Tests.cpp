@@ -1,3 +1,8 @@
+#include <cstdlib>
+#include <list>
+#include <string>
+#include <vector>
+
 #include "../Queue.h"
 #include "gtest/gtest.h"
 
@@ -75,6 +80,59 @@ TEST (QueueTests /*test suite name*/, EmptyListExceptions /*test name*/) {
 	EXPECT_THROW (queue2.display(), std::runtime_error);
 }
 
+TEST (QueueTests /*test suite name*/, BulkOperations /*test name*/) {
+	custom::Queue<std::string> queue;
+	std::vector<std::string> words = {"a", "b", "c", "d", "e"};
+	queue.enqueue_range(words.begin(), words.end());
+	EXPECT_EQ (queue.length(), 5);
+	EXPECT_EQ (queue.peek(), "a");
+
+	// Input from a non-random-access range, moved into the queue
+	std::list<std::string> more = {"f", "g"};
+	queue.enqueue_range(std::make_move_iterator(more.begin()), std::make_move_iterator(more.end()));
+	EXPECT_EQ (queue.length(), 7);
+
+	std::vector<std::string> out;
+	EXPECT_EQ (queue.dequeue_n(std::back_inserter(out), 3), 3);
+	EXPECT_EQ (out, std::vector<std::string>({"a", "b", "c"}));
+	EXPECT_EQ (queue.peek(), "d");
+
+	// Recycled nodes are reused by later enqueues
+	queue.enqueue("h");
+	EXPECT_EQ (queue.length(), 5);
+
+	std::string drained;
+	EXPECT_EQ (queue.drain([&drained](std::string&& value) { drained += value; }), 5);
+	EXPECT_EQ (drained, "defgh");
+	EXPECT_TRUE (queue.empty());
+	EXPECT_EQ (queue.dequeue_n(std::back_inserter(out), 10), 0);
+
+	// The queue remains usable after being drained
+	queue.enqueue({"x", "y"});
+	EXPECT_EQ (queue.dequeue(), "x");
+	EXPECT_EQ (queue.dequeue(), "y");
+	EXPECT_TRUE (queue.empty());
+
+	// Copying an empty queue
+	custom::Queue<std::string> empty_copy(queue);
+	EXPECT_TRUE (empty_copy.empty());
+}
+
+TEST (QueueTests /*test suite name*/, MemoryUsage /*test name*/) {
+	// Pooled queues hold their nodes in chunks, including the unused slots
+	custom::Queue<int> pooled = {1, 2, 3};
+	custom::MemoryUsage usage = pooled.memory_usage();
+	EXPECT_EQ (usage.payload, 3 * sizeof(int));
+	EXPECT_EQ (usage.allocations, 2);
+	EXPECT_GE (usage.structure, 16 * sizeof(void*));
+
+	custom::Queue<int, custom::queue_policy::HeapNodes> heap = {1, 2, 3};
+	EXPECT_EQ (heap.memory_usage().payload, 3 * sizeof(int));
+	EXPECT_EQ (heap.memory_usage().allocations, 3);
+	heap.dequeue();
+	EXPECT_EQ (heap.memory_usage().allocations, 2);
+}
+
 TEST (PriorityQueueTests /*test suite name*/, Initialisation /*test name*/) {
 	// Default initialization
 	custom::PriorityQueue<int> queue;
@@ -150,6 +208,13 @@ TEST (PriorityQueueTests /*test suite name*/, Methods /*test name*/) {
 	EXPECT_EQ (queue3.length(), 9);
 	queue3.clear();
 	EXPECT_FALSE (queue3);
+
+	// The priority types are still members, and a priority queue is passed as a Queue by conversion
+	custom::PriorityQueue<int> descending(1, custom::PriorityQueue<int>::Descending);
+	descending.enqueue({3, 2});
+	auto front_of = [](const custom::Queue<int>& converted) { return converted.peek(); };
+	EXPECT_EQ (front_of(descending), 3);
+	EXPECT_EQ (descending.length(), 3);
 }
 
 TEST (PriorityQueueTests /*test suite name*/, EmptyListExceptions /*test name*/) {
@@ -161,4 +226,43 @@ TEST (PriorityQueueTests /*test suite name*/, EmptyListExceptions /*test name*/)
 	EXPECT_THROW (static_cast<void>(queue2.peek()), std::runtime_error);
 	EXPECT_THROW (queue2.contains(3), std::runtime_error);
 	EXPECT_THROW (queue2.display(), std::runtime_error);
-}
\ No newline at end of file
+}
+
+TEST (PriorityQueueTests /*test suite name*/, BulkOperations /*test name*/) {
+	custom::PriorityQueue<int> queue(5, 1);
+	std::vector<int> values = {9, 1, 7, 3};
+	queue.enqueue_range(values.begin(), values.end());
+	std::vector<int> out;
+	EXPECT_EQ (queue.dequeue_n(std::back_inserter(out), 2), 2);
+	EXPECT_EQ (out, std::vector<int>({1, 3}));
+	queue.enqueue(10);
+	queue.enqueue(0);
+	std::vector<int> rest;
+	queue.drain([&rest](int&& value) { rest.push_back(value); });
+	EXPECT_EQ (rest, std::vector<int>({0, 5, 7, 9, 10}));
+}
+
+TEST (PriorityQueueTests /*test suite name*/, CompileTimePolicies /*test name*/) {
+	custom::PriorityQueue<int, custom::queue_policy::Descending> queue;
+	queue.enqueue({3, 9, 1, 7});
+	EXPECT_EQ (queue.contents(), std::vector<int>({9, 7, 3, 1}));
+
+	// Moving an unordered queue into an ordered one places every element
+	custom::Queue<int> unordered = {4, 8, 2};
+	custom::PriorityQueue<int, custom::queue_policy::Ascending> ascending(std::move(unordered));
+	EXPECT_EQ (ascending.contents(), std::vector<int>({2, 4, 8}));
+	EXPECT_TRUE (unordered.empty());
+
+	// Queues with different storage policies compare element-wise
+	custom::Queue<int, custom::queue_policy::HeapNodes> heap_queue = {2, 4, 8};
+	EXPECT_EQ (heap_queue, ascending);
+	custom::Queue<int, custom::queue_policy::HeapNodes> sum = heap_queue + queue;
+	EXPECT_EQ (sum.length(), 7);
+	EXPECT_EQ (sum.dequeue(), 2);
+
+	// Stateful comparison objects are stored by the ordering policy
+	auto by_distance = [](int a, int b) { return std::abs(a - 5) < std::abs(b - 5); };
+	custom::PriorityQueue<int, custom::queue_policy::Ordered<decltype(by_distance)>> closest(0, {by_distance});
+	closest.enqueue({9, 5, 4});
+	EXPECT_EQ (closest.contents(), std::vector<int>({5, 4, 9, 0}));
+}
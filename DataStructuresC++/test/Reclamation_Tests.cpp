@@ -0,0 +1,183 @@
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "../Reclamation.h"
+#include "gtest/gtest.h"
+
+namespace {
+	struct Counted {
+		static inline std::atomic<int> alive{0};
+		int value;
+
+		explicit Counted(int value) : value(value) { ++alive; }
+
+		~Counted() { --alive; }
+	};
+
+	/**
+	 * A lock-free Treiber stack whose popped nodes are freed through a reclamation domain. Reading a node after it has
+	 * been freed is caught when the tests are built with AddressSanitizer.
+	 */
+	template<typename Domain>
+	class TreiberStack {
+	public:
+		explicit TreiberStack(Domain& domain) : domain(domain) {}
+
+		~TreiberStack() {
+			Node* node = head.load();
+			while (node) {
+				Node* next = node->next;
+				delete node;
+				node = next;
+			}
+		}
+
+		void push(int value) {
+			Node* node = new Node{value, head.load(std::memory_order_relaxed)};
+			while (!head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {}
+		}
+
+		bool pop(int& value) {
+			if constexpr (std::is_same_v<Domain, custom::EpochDomain>) {
+				auto guard = domain.pin();
+				Node* node = head.load(std::memory_order_acquire);
+				while (node) {
+					interleave();
+					if (head.compare_exchange_weak(node, node->next, std::memory_order_acquire))
+						break;
+				}
+				if (!node)
+					return false;
+				value = node->value;
+				domain.retire(node);
+				return true;
+			} else {
+				auto guard = domain.guard();
+				while (true) {
+					Node* node = guard.protect(head);
+					if (!node)
+						return false;
+					interleave();
+					if (head.compare_exchange_strong(node, node->next, std::memory_order_acquire)) {
+						value = node->value;
+						guard.reset();
+						domain.retire(node);
+						return true;
+					}
+				}
+			}
+		}
+
+	private:
+		struct Node {
+			int value;
+			Node* next;
+		};
+
+		// Gives up the processor now and then between loading a node and reading it, so that other threads pop and
+		// retire it in between even when the threads share a single core
+		static void interleave() {
+			thread_local unsigned int counter = 0;
+			if (++counter % 16 == 0)
+				std::this_thread::yield();
+		}
+
+		Domain& domain;
+		std::atomic<Node*> head{nullptr};
+	};
+
+	template<typename Domain>
+	void stress(Domain& domain) {
+		constexpr int threads = 4;
+		constexpr int operations = 20000;
+		TreiberStack<Domain> stack(domain);
+		std::atomic<long long> pushed{0};
+		std::atomic<long long> popped{0};
+		std::vector<std::thread> workers;
+		for (int t = 0; t < threads; ++t) {
+			workers.emplace_back([&, t] {
+				int value = 0;
+				for (int i = 0; i < operations; ++i) {
+					int item = t * operations + i;
+					stack.push(item);
+					pushed += item;
+					if (stack.pop(value))
+						popped += value;
+				}
+			});
+		}
+		for (std::thread& worker: workers)
+			worker.join();
+		int value = 0;
+		while (stack.pop(value))
+			popped += value;
+		EXPECT_EQ (popped.load(), pushed.load());
+		custom::ReclamationStats stats = domain.stats();
+		EXPECT_EQ (stats.retired, static_cast<size_t>(threads) * operations);
+		EXPECT_EQ (stats.retired, stats.reclaimed + stats.pending);
+	}
+}// namespace
+
+TEST (EpochDomainTests /*test suite name*/, PinnedObjectsAreKept /*test name*/) {
+	custom::EpochDomain domain(1000);
+	{
+		auto guard = domain.pin();
+		auto nested = domain.pin();
+		domain.retire(new Counted(1));
+		domain.retire(new Counted(2));
+		EXPECT_EQ (domain.stats().pending, 2);
+		// The epoch can advance once, but not twice, while this thread is pinned
+		domain.collect();
+		domain.collect();
+		EXPECT_EQ (Counted::alive.load(), 2);
+	}
+	domain.collect();
+	domain.collect();
+	EXPECT_EQ (Counted::alive.load(), 0);
+	custom::ReclamationStats stats = domain.stats();
+	EXPECT_EQ (stats.retired, 2);
+	EXPECT_EQ (stats.reclaimed, 2);
+	EXPECT_EQ (stats.pending, 0);
+
+	// Objects still retired are freed with the domain
+	{
+		custom::EpochDomain other;
+		other.retire(new Counted(3));
+	}
+	EXPECT_EQ (Counted::alive.load(), 0);
+}
+
+TEST (EpochDomainTests /*test suite name*/, ConcurrentStress /*test name*/) {
+	custom::EpochDomain domain(64);
+	stress(domain);
+}
+
+TEST (HazardDomainTests /*test suite name*/, ProtectedObjectsAreKept /*test name*/) {
+	EXPECT_THROW (custom::HazardDomain(0), std::invalid_argument);
+	custom::HazardDomain domain(2, 1000);
+	auto* object = new Counted(1);
+	std::atomic<Counted*> shared{object};
+	{
+		auto guard = domain.guard();
+		EXPECT_EQ (guard.protect(shared), object);
+		auto second = domain.guard();
+		EXPECT_THROW (static_cast<void>(domain.guard()), std::runtime_error);
+		shared.store(nullptr);
+		domain.retire(object);
+		domain.collect();
+		EXPECT_EQ (Counted::alive.load(), 1);
+		EXPECT_EQ (object->value, 1);
+	}
+	EXPECT_EQ (domain.stats().pending, 1);
+	domain.collect();
+	EXPECT_EQ (Counted::alive.load(), 0);
+	EXPECT_EQ (domain.stats().pending, 0);
+}
+
+TEST (HazardDomainTests /*test suite name*/, ConcurrentStress /*test name*/) {
+	custom::HazardDomain domain(1, 64);
+	stress(domain);
+}
@@ -0,0 +1,239 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../Array.h"
+#include "../BinarySearchTree.h"
+#include "../BinaryTree.h"
+#include "../DoublyLinkedList.h"
+#include "../Graph.h"
+#include "../LinkedList.h"
+#include "../Map.h"
+#include "../Queue.h"
+#include "../Serialization.h"
+#include "../Stack.h"
+#include "../Tree.h"
+#include "../Vector.h"
+#include "gtest/gtest.h"
+
+namespace {
+	// A file in the temporary directory, removed at the end of the test
+	class ScratchFile {
+	public:
+		explicit ScratchFile(const std::string& name) :
+				mPath(std::filesystem::temp_directory_path() / ("custom-serialization-test-" + name)) {}
+
+		~ScratchFile() {
+			std::filesystem::remove(mPath);
+		}
+
+		[[nodiscard]] const std::filesystem::path& path() const noexcept {
+			return mPath;
+		}
+
+	private:
+		std::filesystem::path mPath;
+	};
+}
+
+TEST (SerializationTests /*test suite name*/, Sequences /*test name*/) {
+	custom::Vector<int> vector = {1, 2, 3, 4, 5};
+	auto vector_copy = custom::deserialize<custom::Vector<int>>(custom::serialize(vector));
+	EXPECT_EQ (vector_copy, vector);
+	EXPECT_EQ (custom::deserialize<custom::Vector<int>>(custom::serialize(custom::Vector<int>())).size(), 0);
+
+	custom::Array<double, 3> array = {0.5, -1.25, 3};
+	auto array_copy = custom::deserialize<custom::Array<double, 3>>(custom::serialize(array));
+	for (size_t i = 0; i < 3; ++i)
+		EXPECT_EQ (array_copy[i], array[i]);
+
+	custom::LinkedList<std::string> list = {"a", "", "longer string"};
+	auto list_copy = custom::deserialize<custom::LinkedList<std::string>>(custom::serialize(list));
+	EXPECT_EQ (list_copy.contents(), list.contents());
+	list_copy.append("tail");
+	EXPECT_EQ (list_copy.back(), "tail");
+
+	custom::DoublyLinkedList<std::int64_t> doubly = {-1, 0, 1};
+	auto doubly_copy = custom::deserialize<custom::DoublyLinkedList<std::int64_t>>(custom::serialize(doubly));
+	EXPECT_EQ (doubly_copy.contents(), doubly.contents());
+	doubly_copy.reverse_order();  // Walks the links to the previous nodes
+	EXPECT_EQ (doubly_copy.contents(), std::vector<std::int64_t>({1, 0, -1}));
+
+	custom::Stack<int> stack;
+	stack.push({1, 2, 3});
+	auto stack_copy = custom::deserialize<custom::Stack<int>>(custom::serialize(stack));
+	EXPECT_EQ (stack_copy.contents(), stack.contents());
+	EXPECT_EQ (stack_copy.pop(), stack.pop());
+
+	custom::Queue<int> queue = {7, 8, 9};
+	auto queue_copy = custom::deserialize<custom::Queue<int>>(custom::serialize(queue));
+	EXPECT_EQ (queue_copy.contents(), queue.contents());
+	EXPECT_EQ (queue_copy.dequeue(), 7);
+
+	custom::PriorityQueue<int, custom::queue_policy::Ascending> priority;
+	priority.enqueue({5, 1, 3});
+	auto priority_copy = custom::deserialize<custom::PriorityQueue<int, custom::queue_policy::Ascending>>(
+			custom::serialize(priority));
+	EXPECT_EQ (priority_copy.contents(), std::vector<int>({1, 3, 5}));
+}
+
+TEST (SerializationTests /*test suite name*/, Nested /*test name*/) {
+	custom::Vector<custom::Vector<std::string>> nested;
+	nested.push_back(custom::Vector<std::string>({"x", "y"}));
+	nested.push_back(custom::Vector<std::string>());
+	auto copy = custom::deserialize<custom::Vector<custom::Vector<std::string>>>(custom::serialize(nested));
+	ASSERT_EQ (copy.size(), 2);
+	EXPECT_EQ (copy[0], nested[0]);
+	EXPECT_EQ (copy[1].size(), 0);
+
+	// Several containers written one after another keep their alignment
+	custom::serialization::Writer out;
+	out.value(std::uint8_t{1});
+	custom::Vector<std::uint64_t>({10, 20}).serialize(out);
+	custom::serialization::Reader in(out.buffer());
+	EXPECT_EQ (in.value<std::uint8_t>(), 1);
+	std::span<const std::uint64_t> view = custom::Vector<std::uint64_t>::view(in);
+	EXPECT_EQ (view.size(), 2);
+	EXPECT_EQ (view[1], 20);
+}
+
+TEST (SerializationTests /*test suite name*/, Associative /*test name*/) {
+	custom::Map<std::string, int> map(5);
+	for (int i = 0; i < 20; ++i)
+		map.add("key" + std::to_string(i), i);
+	auto map_copy = custom::deserialize<custom::Map<std::string, int>>(custom::serialize(map));
+	EXPECT_EQ (map_copy.size(), 20);
+	EXPECT_EQ (map_copy.contents(), map.contents());
+	EXPECT_EQ (map_copy.at("key13"), 13);
+
+	custom::Map<int, int> pairs;
+	pairs.add(1, -1);
+	pairs.add(2, -2);
+	EXPECT_EQ ((custom::deserialize<custom::Map<int, int>>(custom::serialize(pairs)).at(2)), -2);
+}
+
+TEST (SerializationTests /*test suite name*/, Trees /*test name*/) {
+	custom::BinarySearchTree<int> search_tree;
+	for (int value: {50, 30, 70, 20, 40, 60, 80})
+		search_tree.add(value);
+	auto search_copy = custom::deserialize<custom::BinarySearchTree<int>>(custom::serialize(search_tree));
+	EXPECT_EQ (search_copy.contents_PreOrder(), search_tree.contents_PreOrder());
+	EXPECT_EQ (search_copy.height(), search_tree.height());
+
+	custom::BinaryTree<std::string> binary_tree("root");
+	binary_tree.new_left("left");
+	binary_tree.new_right("right");
+	binary_tree.advance_right();
+	binary_tree.new_left("right-left");
+	auto binary_copy = custom::deserialize<custom::BinaryTree<std::string>>(custom::serialize(binary_tree));
+	EXPECT_EQ (binary_copy.contents_PreOrder(), binary_tree.contents_PreOrder());
+	EXPECT_EQ (binary_copy.contents_InOrder(), binary_tree.contents_InOrder());
+	EXPECT_EQ (binary_copy.get_data(), "root");
+
+	custom::Tree<int> tree(1, true);
+	tree.add_child({4, 2, 3});
+	tree.goto_child(0);
+	tree.add_child(5);
+	auto tree_copy = custom::deserialize<custom::Tree<int>>(custom::serialize(tree));
+	EXPECT_EQ (tree_copy.contents_InOrder(), tree.contents_InOrder());
+	EXPECT_EQ (tree_copy.children_data(), std::vector<int>({2, 3, 4}));
+	tree_copy.add_child(0);  // The copy keeps the children ordered
+	EXPECT_EQ (tree_copy.children_data(), std::vector<int>({0, 2, 3, 4}));
+	EXPECT_EQ (tree_copy.max_height(), tree.max_height());
+}
+
+TEST (SerializationTests /*test suite name*/, Graphs /*test name*/) {
+	custom::Graph<std::string, int> graph;
+	graph.add_node("a", 1);
+	graph.add_node("b", 2);
+	graph.add_node("c", 3);
+	graph.add_edge(1, 2);
+	graph.add_edge(2, 3);
+	auto graph_copy = custom::deserialize<custom::Graph<std::string, int>>(custom::serialize(graph));
+	EXPECT_EQ (graph_copy.contents(), graph.contents());
+	EXPECT_TRUE (graph_copy.find_edge(3, 2));
+	EXPECT_FALSE (graph_copy.find_edge(1, 3));
+	EXPECT_EQ (graph_copy.bfs(1), graph.bfs(1));
+
+	custom::DirectedGraph<int, int> directed;
+	directed.add_node(10, 1);
+	directed.add_node(20, 2);
+	directed.add_edge(1, 2);
+	const custom::Graph<int, int>& base = directed;
+	std::vector<std::byte> data = custom::serialize(base);  // Recorded as directed through the base class
+	auto directed_copy = custom::deserialize<custom::DirectedGraph<int, int>>(data);
+	EXPECT_TRUE (directed_copy.find_edge(1, 2));
+	EXPECT_FALSE (directed_copy.find_edge(2, 1));
+	EXPECT_THROW ((custom::deserialize<custom::Graph<int, int>>(data)), std::runtime_error);
+}
+
+TEST (SerializationTests /*test suite name*/, MappedViews /*test name*/) {
+	ScratchFile file("mapped-views");
+	custom::Vector<std::uint32_t> vector;
+	for (std::uint32_t i = 0; i < 100000; ++i)
+		vector.push_back(i * 3);
+	custom::save(vector, file.path());
+	EXPECT_EQ (std::filesystem::file_size(file.path()), custom::serialization::header_size + 100000 * 4);
+
+	custom::serialization::MappedFile mapped(file.path());
+	std::span<const std::uint32_t> view = custom::view<custom::Vector<std::uint32_t>>(mapped.bytes());
+	ASSERT_EQ (view.size(), 100000);
+	EXPECT_EQ (view[99999], 299997);
+	EXPECT_EQ (custom::load<custom::Vector<std::uint32_t>>(file.path()), vector);
+
+	custom::Queue<std::int16_t> queue = {3, 1, 2};
+	custom::save(queue, file.path());
+	custom::serialization::MappedFile queue_file(file.path());
+	std::span<const std::int16_t> queue_view = custom::view<custom::Queue<std::int16_t>>(queue_file.bytes());
+	EXPECT_EQ (std::vector<std::int16_t>(queue_view.begin(), queue_view.end()), queue.contents());
+
+	std::vector<std::byte> array_data = custom::serialize(custom::Array<double, 3>({1, 2, 3}));
+	std::span<const double, 3> array_view = custom::view<custom::Array<double, 3>>(array_data);
+	EXPECT_EQ (array_view[2], 3);
+}
+
+TEST (SerializationTests /*test suite name*/, Errors /*test name*/) {
+	std::vector<std::byte> data = custom::serialize(custom::Vector<int>({1, 2, 3}));
+	EXPECT_THROW (custom::deserialize<custom::LinkedList<int>>(data), std::runtime_error);
+	EXPECT_THROW (custom::deserialize<custom::Vector<std::int64_t>>(data), std::runtime_error);
+	EXPECT_THROW ((custom::deserialize<custom::Array<int, 4>>(custom::serialize(custom::Array<int, 3>()))),
+	              std::runtime_error);
+
+	std::vector<std::byte> truncated(data.begin(), data.end() - 1);
+	EXPECT_THROW (custom::deserialize<custom::Vector<int>>(truncated), std::runtime_error);
+	std::vector<std::byte> trailing = data;
+	trailing.push_back(std::byte{0});
+	EXPECT_THROW (custom::deserialize<custom::Vector<int>>(trailing), std::runtime_error);
+	std::vector<std::byte> corrupt = data;
+	corrupt[0] = std::byte{0};
+	EXPECT_THROW (custom::deserialize<custom::Vector<int>>(corrupt), std::runtime_error);
+	std::vector<std::byte> later = data;
+	later[4] = std::byte{2};  // The version of the format
+	EXPECT_THROW (custom::deserialize<custom::Vector<int>>(later), std::runtime_error);
+
+	// A count which does not fit in the data is rejected before anything is allocated for it
+	std::vector<std::byte> huge = data;
+	huge[23] = std::byte{0x7f};
+	EXPECT_THROW (custom::deserialize<custom::Vector<int>>(huge), std::runtime_error);
+
+	// So is a map with no buckets, or with more buckets than its elements could fill
+	for (std::uint64_t buckets: {std::uint64_t{0}, std::uint64_t{1} << 61}) {
+		custom::serialization::Writer map_out;
+		map_out.header<std::pair<int, int>>(custom::serialization::Kind::Map, 0, buckets);
+		EXPECT_THROW ((custom::deserialize<custom::Map<int, int>>(map_out.buffer())), std::runtime_error);
+	}
+
+	custom::serialization::Writer out;
+	out.value(std::uint8_t{1});
+	std::uint64_t values[] = {1, 2};
+	out.values(values, 2);
+	custom::serialization::Reader in(std::span<const std::byte>(out.buffer()).subspan(1));
+	EXPECT_THROW (in.view<std::uint64_t>(2), std::runtime_error);
+
+	EXPECT_THROW (custom::load<custom::Vector<int>>("/nonexistent/custom-serialization"), std::runtime_error);
+}
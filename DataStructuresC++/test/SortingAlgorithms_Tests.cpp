@@ -0,0 +1,475 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../Array.h"
+#include "../DoublyLinkedList.h"
+#include "../SortingAlgorithms.h"
+#include "../Vector.h"
+#include "gtest/gtest.h"
+
+namespace {
+	// Inputs covering the patterns pdq_sort treats specially, plus inputs long enough to use the ninther pivot
+	std::vector<std::vector<int>> sort_inputs() {
+		std::vector<std::vector<int>> inputs = {{}, {1}, {2, 1}, {1, 2, 3}, {3, 3, 3}};
+		std::mt19937 generator(42);
+		for (int size: {10, 23, 24, 25, 100, 129, 1000, 20000}) {
+			std::vector<int> random(size), sorted(size), reverse(size), duplicates(size), organ_pipe(size);
+			for (int i = 0; i < size; ++i) {
+				random[i] = static_cast<int>(generator());
+				sorted[i] = i;
+				reverse[i] = size - i;
+				duplicates[i] = static_cast<int>(generator() % 4);
+				organ_pipe[i] = i < size / 2 ? i : size - i;
+			}
+			std::vector<int> nearly_sorted = sorted;
+			for (int i = 0; i < size / 50 + 1; ++i)
+				std::swap(nearly_sorted[generator() % size], nearly_sorted[generator() % size]);
+			for (auto* input: {&random, &sorted, &reverse, &duplicates, &organ_pipe, &nearly_sorted})
+				inputs.push_back(*input);
+		}
+		return inputs;
+	}
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, IteratorConcepts /*test name*/) {
+	static_assert(std::contiguous_iterator<custom::Vector<int>::Iterator>);
+	static_assert(std::contiguous_iterator<custom::Array<int, 4>::Iterator>);
+	custom::Vector<int> vec = {1, 2, 3, 4};
+	auto it = vec.begin();
+	EXPECT_EQ (vec.end() - it, 4);
+	EXPECT_EQ (it[2], 3);
+	EXPECT_EQ (*(2 + it), 3);
+	EXPECT_TRUE (it < vec.end());
+	EXPECT_THROW (it[4], std::runtime_error);
+	EXPECT_THROW (it + 5, std::out_of_range);
+	EXPECT_THROW (it - 1, std::out_of_range);
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, PdqSortStdVector /*test name*/) {
+	for (const std::vector<int>& input: sort_inputs()) {
+		std::vector<int> expected = input;
+		std::sort(expected.begin(), expected.end());
+		std::vector<int> ascending = input;
+		custom::pdq_sort(ascending.begin(), ascending.end());
+		EXPECT_EQ (ascending, expected);
+
+		std::reverse(expected.begin(), expected.end());
+		std::vector<int> descending = input;
+		custom::pdq_sort(descending, std::greater<>());
+		EXPECT_EQ (descending, expected);
+	}
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, PdqSortVector /*test name*/) {
+	for (const std::vector<int>& input: sort_inputs()) {
+		custom::Vector<int> vec;
+		for (int value: input)
+			vec.push_back(value);
+		custom::pdq_sort(vec);
+		std::vector<int> expected = input;
+		std::sort(expected.begin(), expected.end());
+		ASSERT_EQ (vec.size(), expected.size());
+		for (size_t i = 0; i < expected.size(); ++i)
+			EXPECT_EQ (vec[i], expected[i]);
+	}
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, PdqSortArrays /*test name*/) {
+	custom::Array<int, 6> arr = {5, 3, 6, 1, 4, 2};
+	custom::pdq_sort(arr.begin(), arr.end(), [](int x, int y) { return x > y; });
+	for (int i = 0; i < 6; ++i)
+		EXPECT_EQ (arr[i], 6 - i);
+
+	double raw[] = {2.5, -1.0, 8.0, 0.0, 3.25};
+	custom::pdq_sort(raw);
+	EXPECT_TRUE (std::is_sorted(std::begin(raw), std::end(raw)));
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, PdqSortNonArithmetic /*test name*/) {
+	// Strings take the branching partition and are only ever moved, never copied
+	std::mt19937 generator(3);
+	std::vector<std::string> words(5000);
+	for (std::string& word: words)
+		word = std::to_string(generator() % 1000);
+	std::vector<std::string> expected = words;
+	std::sort(expected.begin(), expected.end());
+	custom::pdq_sort(words);
+	EXPECT_EQ (words, expected);
+
+	// A comparison on part of the element still sorts by that part
+	std::vector<std::pair<int, int>> pairs;
+	for (int i = 0; i < 3000; ++i)
+		pairs.emplace_back(static_cast<int>(generator() % 100), i);
+	custom::pdq_sort(pairs.begin(), pairs.end(), [](const auto& x, const auto& y) { return x.first < y.first; });
+	EXPECT_TRUE (std::is_sorted(pairs.begin(), pairs.end(),
+	                            [](const auto& x, const auto& y) { return x.first < y.first; }));
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, SimpleSortsDefaultAscending /*test name*/) {
+	std::mt19937 generator(5);
+	std::vector<int> input(300);
+	for (int& value: input)
+		value = static_cast<int>(generator() % 100);
+	std::vector<int> expected = input;
+	std::sort(expected.begin(), expected.end());
+	auto check = [&](auto sort) {
+		custom::LinkedList<int> list;
+		for (int value: input)
+			list.append(value);
+		sort(list);
+		for (size_t i = 0; i < expected.size(); ++i)
+			EXPECT_EQ (list[i], expected[i]);
+	};
+	check([](auto& list) { custom::bubble_sort(list); });
+	check([](auto& list) { custom::selection_sort(list); });
+	check([](auto& list) { custom::insertion_sort(list); });
+	check([](auto& list) { custom::merge_sort(list); });
+	// The function pointer form of the default comparison keeps working
+	check([](auto& list) { custom::insertion_sort(list, &custom::ascending<int>); });
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, SimpleSortsCallablesAndProjections /*test name*/) {
+	custom::Vector<std::string> words = {"pear", "fig", "banana", "kiwi", "apple"};
+	custom::insertion_sort(words);
+	EXPECT_EQ (words[0], "apple");
+	EXPECT_EQ (words[4], "pear");
+
+	// A comparison returning true when the first element should come after the second sorts in descending order
+	custom::selection_sort(words, [](const std::string& x, const std::string& y) { return x < y; });
+	EXPECT_EQ (words[0], "pear");
+	EXPECT_EQ (words[4], "apple");
+
+	// Sorting by length keeps words of equal length in their previous order with the stable merge sort
+	custom::merge_sort(words, custom::sort_detail::Ascending(), &std::string::size);
+	EXPECT_EQ (words[0], "fig");
+	EXPECT_EQ (words[1], "pear");
+	EXPECT_EQ (words[2], "kiwi");
+	EXPECT_EQ (words[3], "apple");
+	EXPECT_EQ (words[4], "banana");
+
+	struct Item {
+		int key;
+		std::string name;
+	};
+	std::vector<Item> items = {{3, "c"}, {1, "a"}, {2, "b"}};
+	custom::bubble_sort(items, std::greater<>(), &Item::key);
+	EXPECT_EQ (items[0].name, "a");
+	custom::pdq_sort(items, std::greater<>(), &Item::key);
+	EXPECT_EQ (items[0].name, "c");
+	EXPECT_EQ (items[2].name, "a");
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, RadixSortNumbers /*test name*/) {
+	std::mt19937_64 generator(9);
+	for (size_t size: {size_t(0), size_t(1), size_t(50), size_t(5000)}) {
+		std::vector<std::uint32_t> unsigned_keys(size);
+		std::vector<std::int64_t> signed_keys(size);
+		std::vector<double> doubles(size);
+		std::vector<float> floats(size);
+		std::vector<std::uint64_t> small_keys(size);
+		for (size_t i = 0; i < size; ++i) {
+			unsigned_keys[i] = static_cast<std::uint32_t>(generator());
+			signed_keys[i] = static_cast<std::int64_t>(generator());
+			doubles[i] = std::ldexp(static_cast<double>(static_cast<std::int64_t>(generator())), -50);
+			floats[i] = static_cast<float>(doubles[i] * 1e-3);
+			// Only the lowest byte varies, so every other pass is skipped
+			small_keys[i] = generator() % 200;
+		}
+		auto check = [](auto keys) {
+			auto expected = keys;
+			std::sort(expected.begin(), expected.end());
+			custom::radix_sort(keys);
+			EXPECT_EQ (keys, expected);
+		};
+		check(unsigned_keys);
+		check(signed_keys);
+		check(doubles);
+		check(floats);
+		check(small_keys);
+	}
+
+	std::vector<double> specials = {0.0, -0.0, -1.5, std::numeric_limits<double>::infinity(), 2.0,
+	                                -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::lowest(),
+	                                std::numeric_limits<double>::denorm_min()};
+	custom::radix_sort(specials);
+	EXPECT_TRUE (std::is_sorted(specials.begin(), specials.end()));
+	EXPECT_TRUE (std::signbit(specials[3]));
+	EXPECT_FALSE (std::signbit(specials[4]));
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, RadixSortRecords /*test name*/) {
+	struct Record {
+		std::int32_t key;
+		size_t position;
+	};
+	std::mt19937 generator(2);
+	custom::Vector<Record> records;
+	for (size_t i = 0; i < 3000; ++i)
+		records.push_back(Record{static_cast<std::int32_t>(generator() % 100) - 50, i});
+	custom::radix_sort(records, &Record::key);
+	// The numeric radix sort is stable
+	for (size_t i = 1; i < records.size(); ++i) {
+		EXPECT_LE (records[i - 1].key, records[i].key);
+		if (records[i - 1].key == records[i].key) {
+			EXPECT_LT (records[i - 1].position, records[i].position);
+		}
+	}
+
+	// Keys computed on the fly
+	std::vector<int> values = {5, -3, 8, -9, 0, 2};
+	custom::radix_sort(values, [](int value) { return value * value; });
+	EXPECT_EQ (values, (std::vector<int>{0, 2, -3, 5, 8, -9}));
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, RadixSortStrings /*test name*/) {
+	std::mt19937 generator(4);
+	std::vector<std::string> words;
+	for (int i = 0; i < 20000; ++i) {
+		std::string word(generator() % 12, 'a');
+		for (char& c: word)
+			c = static_cast<char>('a' + generator() % 4);
+		words.push_back(word);
+	}
+	words.push_back(std::string("\xff\x80", 2));
+	words.push_back(std::string("a\0b", 3));
+	words.push_back("");
+	std::vector<std::string> expected = words;
+	std::sort(expected.begin(), expected.end());
+	custom::radix_sort(words);
+	EXPECT_EQ (words, expected);
+
+	// String keys of records, including keys returned by value
+	std::vector<std::pair<std::string, int>> pairs = {{"pear", 1}, {"apple", 2}, {"fig", 3}, {"apples", 4}};
+	custom::radix_sort(pairs, &std::pair<std::string, int>::first);
+	EXPECT_EQ (pairs[0].second, 2);
+	EXPECT_EQ (pairs[1].second, 4);
+	EXPECT_EQ (pairs[3].second, 1);
+	custom::radix_sort(pairs, [](const auto& pair) { return std::to_string(pair.second * 7 % 10); });
+	EXPECT_EQ (pairs[0].second, 3);
+	EXPECT_EQ (pairs[3].second, 4);
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, NthElement /*test name*/) {
+	for (const std::vector<int>& input: sort_inputs()) {
+		std::vector<int> sorted = input;
+		std::sort(sorted.begin(), sorted.end());
+		for (size_t n: {size_t(0), input.size() / 3, input.size() / 2, input.size() - 1}) {
+			if (n >= input.size())
+				continue;
+			std::vector<int> selected = input;
+			custom::nth_element(selected.begin(), selected.begin() + static_cast<std::ptrdiff_t>(n), selected.end());
+			ASSERT_EQ (selected[n], sorted[n]);
+			for (size_t i = 0; i < n; ++i)
+				ASSERT_LE (selected[i], selected[n]);
+			for (size_t i = n + 1; i < selected.size(); ++i)
+				ASSERT_GE (selected[i], selected[n]);
+			std::sort(selected.begin(), selected.end());
+			ASSERT_EQ (selected, sorted);
+		}
+	}
+
+	// Containers, including lists selected through a buffer, and projections
+	custom::Vector<int> vec = {9, 4, 7, 1, 8, 2};
+	custom::nth_element(vec, 2, std::greater<>());
+	EXPECT_EQ (vec[2], 7);
+	custom::LinkedList<std::string> list = {"pear", "fig", "banana", "kiwi", "apple"};
+	custom::nth_element(list, 0, std::less<>(), &std::string::size);
+	EXPECT_EQ (list[0], "fig");
+	EXPECT_EQ (list.length(), 5U);
+	custom::nth_element(list, 5);
+	EXPECT_EQ (list[0], "fig");
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, PartialSort /*test name*/) {
+	for (const std::vector<int>& input: sort_inputs()) {
+		std::vector<int> sorted = input;
+		std::sort(sorted.begin(), sorted.end());
+		for (size_t k: {size_t(0), size_t(1), size_t(10), input.size()}) {
+			k = std::min(k, input.size());
+			std::vector<int> partial = input;
+			custom::partial_sort(partial.begin(), partial.begin() + static_cast<std::ptrdiff_t>(k), partial.end());
+			ASSERT_TRUE (std::equal(partial.begin(), partial.begin() + static_cast<std::ptrdiff_t>(k), sorted.begin()));
+			std::sort(partial.begin(), partial.end());
+			ASSERT_EQ (partial, sorted);
+		}
+	}
+
+	custom::DoublyLinkedList<int> list = {5, 3, 9, 1, 7, 3};
+	custom::partial_sort(list, 3, std::greater<>());
+	EXPECT_EQ (list[0], 9);
+	EXPECT_EQ (list[1], 7);
+	EXPECT_EQ (list[2], 5);
+	custom::Vector<int> vec = {4, 2, 3};
+	custom::partial_sort(vec, 10);
+	EXPECT_EQ (vec[0], 2);
+	EXPECT_EQ (vec[2], 4);
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, TopK /*test name*/) {
+	std::mt19937 generator(87);
+	std::vector<int> values(100000);
+	for (int& value: values)
+		value = static_cast<int>(generator() % 1000000);
+	std::vector<int> sorted = values;
+	std::sort(sorted.begin(), sorted.end());
+	for (size_t k: {size_t(0), size_t(1), size_t(100), size_t(5000)}) {
+		// Contiguous ranges take the filtered path, lists the element-wise one
+		custom::TopK<int> smallest(k);
+		smallest.push(values.begin(), values.end());
+		EXPECT_EQ (smallest.size(), k);
+		if (k > 0) {
+			EXPECT_EQ (smallest.threshold(), sorted[k - 1]);
+		}
+		EXPECT_EQ (smallest.take(), std::vector<int>(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(k)));
+		EXPECT_TRUE (smallest.empty());
+
+		custom::LinkedList<int> list;
+		for (size_t i = 0; i < 3000; ++i)
+			list.append(values[i]);
+		std::vector<int> largest(values.begin(), values.begin() + 3000);
+		std::sort(largest.begin(), largest.end(), std::greater<>());
+		largest.resize(std::min<size_t>(k, largest.size()));
+		EXPECT_EQ (custom::top_k(list, k, std::greater<>()), largest);
+	}
+
+	// Elements pushed one at a time, duplicates and fewer elements than k
+	custom::TopK<std::string, std::greater<>> words(3);
+	EXPECT_THROW (static_cast<void>(words.threshold()), std::runtime_error);
+	for (const char* word: {"b", "d", "a", "d", "c"})
+		words.push(std::string(word));
+	EXPECT_EQ (words.sorted(), (std::vector<std::string>{"d", "d", "c"}));
+	EXPECT_EQ (words.threshold(), "c");
+	EXPECT_EQ (custom::top_k(std::vector<int>{3, 1, 2}, 5), (std::vector<int>{1, 2, 3}));
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, TimSortPatterns /*test name*/) {
+	custom::MergeBuffer<int> buffer;
+	for (const std::vector<int>& input: sort_inputs()) {
+		std::vector<int> expected = input;
+		std::sort(expected.begin(), expected.end());
+		std::vector<int> sorted = input;
+		custom::tim_sort(sorted);
+		EXPECT_EQ (sorted, expected);
+		sorted = input;
+		custom::tim_sort(sorted.begin(), sorted.end(), buffer);
+		EXPECT_EQ (sorted, expected);
+		// The buffer only grows as far as the largest merge, at most half the range
+		EXPECT_LE (buffer.capacity(), 10000U);
+	}
+
+	custom::Vector<std::string> words = {"pear", "fig", "apple", "kiwi", "banana"};
+	custom::tim_sort(words, std::greater<>(), &std::string::size);
+	EXPECT_EQ (words, (custom::Vector<std::string>{"banana", "apple", "pear", "kiwi", "fig"}));
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, TimSortStable /*test name*/) {
+	// Runs of interleaved sorted blocks make the merges gallop from both ends, and the few keys make most elements
+	// equal to others
+	struct Item {
+		int key;
+		int id;
+	};
+	std::mt19937 generator(88);
+	custom::MergeBuffer<Item> buffer(16);
+	for (int blocks: {1, 3, 17, 200}) {
+		std::vector<Item> items;
+		for (int block = 0; block < blocks; ++block) {
+			int length = static_cast<int>(generator() % 3000) + 1, key = static_cast<int>(generator() % 50);
+			for (int i = 0; i < length; ++i) {
+				items.push_back({key, static_cast<int>(items.size())});
+				if (generator() % 8 == 0)
+					key += static_cast<int>(generator() % 4);
+			}
+		}
+		std::vector<Item> expected = items;
+		std::stable_sort(expected.begin(), expected.end(), [](const Item& a, const Item& b) { return a.key < b.key; });
+		custom::tim_sort(items, buffer, std::less<>(), &Item::key);
+		for (size_t i = 0; i < items.size(); ++i) {
+			ASSERT_EQ (items[i].key, expected[i].key);
+			ASSERT_EQ (items[i].id, expected[i].id);
+		}
+	}
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, TimSortThrowingComparison /*test name*/) {
+	std::mt19937 generator(8);
+	std::vector<std::string> values(5000);
+	for (std::string& value: values)
+		value = std::to_string(generator() % 100000);
+	for (int limit: {100, 20000, 40000}) {
+		// Every element is left in the range when a comparison throws halfway through a merge
+		std::vector<std::string> sorted = values;
+		int comparisons = 0;
+		EXPECT_THROW (custom::tim_sort(sorted, [&comparisons, limit](const std::string& a, const std::string& b) {
+			if (++comparisons == limit)
+				throw std::runtime_error("limit");
+			return a < b;
+		}), std::runtime_error);
+		std::vector<std::string> expected = values;
+		std::sort(expected.begin(), expected.end());
+		std::sort(sorted.begin(), sorted.end());
+		EXPECT_EQ (sorted, expected);
+	}
+}
+
+TEST (SortingAlgorithmsTests /*test suite name*/, SortByCachedKey /*test name*/) {
+	struct Item {
+		std::string name;
+		int id;
+	};
+	std::mt19937 generator(90);
+	std::vector<Item> items(20000);
+	for (int i = 0; i < static_cast<int>(items.size()); ++i)
+		items[i] = Item{std::string(1 + generator() % 3, static_cast<char>('a' + generator() % 4)), i};
+
+	// Numeric keys in ascending order take the radix sort, string keys American flag sort and descending keys
+	// pdq_sort, all of them stable and computing each key once
+	size_t calls = 0;
+	auto length = [&calls](const Item& item) {
+		++calls;
+		return static_cast<int>(item.name.size()) - 2;
+	};
+	auto name = [&calls](const Item& item) -> const std::string& {
+		++calls;
+		return item.name;
+	};
+	auto check = [&items](auto key, auto comp) {
+		for (size_t i = 1; i < items.size(); ++i) {
+			ASSERT_FALSE (comp(key(items[i]), key(items[i - 1])));
+			if (!comp(key(items[i - 1]), key(items[i]))) {
+				ASSERT_LT (items[i - 1].id, items[i].id);
+			}
+		}
+	};
+	custom::sort_by_cached_key(items, length);
+	EXPECT_EQ (calls, items.size());
+	check([](const Item& item) { return item.name.size(); }, std::less<>());
+
+	std::shuffle(items.begin(), items.end(), generator);
+	std::stable_sort(items.begin(), items.end(), [](const Item& a, const Item& b) { return a.id < b.id; });
+	calls = 0;
+	custom::sort_by_cached_key(items.begin(), items.end(), name);
+	EXPECT_EQ (calls, items.size());
+	check([](const Item& item) { return item.name; }, std::less<>());
+
+	std::stable_sort(items.begin(), items.end(), [](const Item& a, const Item& b) { return a.id < b.id; });
+	custom::sort_by_cached_key(items, &Item::name, std::greater<>());
+	check([](const Item& item) { return item.name; }, std::greater<>());
+
+	// Lists are sorted through a buffer
+	custom::DoublyLinkedList<double> list;
+	for (double value: {2.5, -1.0, 7.25, 0.0, -3.5})
+		list.append(value);
+	custom::sort_by_cached_key(list, [](double x) { return x * x; });
+	std::vector<double> sorted;
+	for (double value: list)
+		sorted.push_back(value);
+	EXPECT_EQ (sorted, (std::vector<double>{0.0, -1.0, 2.5, -3.5, 7.25}));
+}
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "../SortingAlgorithms.h"
+#include "../SortingNetworks.h"
+#include "../Vector.h"
+#include "gtest/gtest.h"
+
+namespace {
+	std::vector<custom::SimdLevel> supported_levels() {
+		std::vector<custom::SimdLevel> levels = {custom::SimdLevel::Scalar};
+		if (custom::simd_level() >= custom::SimdLevel::Avx2)
+			levels.push_back(custom::SimdLevel::Avx2);
+		if (custom::simd_level() >= custom::SimdLevel::Avx512)
+			levels.push_back(custom::SimdLevel::Avx512);
+		return levels;
+	}
+
+	// Sorts random inputs of every size with every supported instruction set and compares the result with std::sort
+	template<typename T>
+	void fuzz_network(std::mt19937_64& generator) {
+		const std::vector<T> specials = {std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest(), T(0), T(-1)};
+		for (custom::SimdLevel level: supported_levels()) {
+			for (size_t size = 0; size <= custom::network_sort_max; ++size) {
+				for (int trial = 0; trial < 20; ++trial) {
+					std::vector<T> input(size);
+					for (T& value: input) {
+						switch (trial % 4) {
+							case 0:
+								value = static_cast<T>(static_cast<std::int64_t>(generator()));
+								break;
+							case 1:
+								value = static_cast<T>(generator() % 4);
+								break;
+							case 2:
+								value = specials[generator() % specials.size()];
+								break;
+							default:
+								value = static_cast<T>(static_cast<std::int64_t>(generator() % 2001) - 1000) / T(8);
+						}
+					}
+					std::vector<T> expected = input;
+					std::sort(expected.begin(), expected.end());
+					custom::network_sort(input.data(), input.size(), level);
+					ASSERT_EQ (input, expected) << "size " << size << ", level " << static_cast<int>(level);
+				}
+			}
+		}
+	}
+}
+
+TEST (SortingNetworksTests /*test suite name*/, FuzzAgainstStdSort /*test name*/) {
+	std::mt19937_64 generator(85);
+	fuzz_network<std::int32_t>(generator);
+	fuzz_network<float>(generator);
+	fuzz_network<std::int64_t>(generator);
+	fuzz_network<double>(generator);
+}
+
+TEST (SortingNetworksTests /*test suite name*/, RangesAndErrors /*test name*/) {
+	custom::Vector<double> vec = {3.5, -1.0, 2.25, 0.0};
+	custom::network_sort(vec.begin(), vec.end());
+	EXPECT_EQ (vec[0], -1.0);
+	EXPECT_EQ (vec[3], 3.5);
+
+	std::int32_t raw[] = {4, 1, 3};
+	custom::network_sort(std::begin(raw), std::end(raw));
+	EXPECT_TRUE (std::is_sorted(std::begin(raw), std::end(raw)));
+
+	std::vector<std::int64_t> too_long(custom::network_sort_max + 1);
+	EXPECT_THROW (custom::network_sort(too_long.data(), too_long.size()), std::invalid_argument);
+
+	// NaNs leave the elements unsorted but never lose or duplicate any of them
+	for (custom::SimdLevel level: supported_levels()) {
+		std::vector<float> with_nan = {3.0f, std::nanf(""), 1.0f, 2.0f, std::nanf(""), 0.0f, -1.0f};
+		custom::network_sort(with_nan.data(), with_nan.size(), level);
+		EXPECT_EQ (std::count_if(with_nan.begin(), with_nan.end(), [](float x) { return std::isnan(x); }), 2);
+		for (float value: {3.0f, 1.0f, 2.0f, 0.0f, -1.0f})
+			EXPECT_EQ (std::count(with_nan.begin(), with_nan.end(), value), 1);
+	}
+}
+
+TEST (SortingNetworksTests /*test suite name*/, BaseCaseOfLargerSorts /*test name*/) {
+	// pdq_sort and radix_sort hand their small ranges to the networks
+	std::mt19937_64 generator(7);
+	for (size_t size: {size_t(30), size_t(64), size_t(100), size_t(10000)}) {
+		std::vector<float> floats(size);
+		std::vector<std::int64_t> longs(size);
+		for (size_t i = 0; i < size; ++i) {
+			floats[i] = static_cast<float>(static_cast<std::int32_t>(generator() % 1000) - 500);
+			longs[i] = static_cast<std::int64_t>(generator());
+		}
+		std::vector<float> expected_floats = floats;
+		std::sort(expected_floats.begin(), expected_floats.end());
+		custom::pdq_sort(floats);
+		EXPECT_EQ (floats, expected_floats);
+
+		std::vector<std::int64_t> expected_longs = longs;
+		std::sort(expected_longs.begin(), expected_longs.end());
+		std::vector<std::int64_t> radix_longs = longs;
+		custom::radix_sort(radix_longs);
+		EXPECT_EQ (radix_longs, expected_longs);
+		custom::pdq_sort(longs.begin(), longs.end(), std::less<std::int64_t>());
+		EXPECT_EQ (longs, expected_longs);
+	}
+}
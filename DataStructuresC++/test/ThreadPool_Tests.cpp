@@ -0,0 +1,131 @@
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../ThreadPool.h"
+#include "gtest/gtest.h"
+
+static std::uint64_t parallel_fib(custom::ThreadPool& pool, unsigned int n) {
+	if (n < 2)
+		return n;
+	std::uint64_t left = 0;
+	custom::WaitGroup group;
+	pool.spawn(group, [&pool, &left, n] { left = parallel_fib(pool, n - 1); });
+	std::uint64_t right = parallel_fib(pool, n - 2);
+	pool.sync(group);
+	return left + right;
+}
+
+TEST (WorkStealingDequeTests /*test suite name*/, OwnerOperations /*test name*/) {
+	custom::WorkStealingDeque<int> deque(2);
+	EXPECT_TRUE (deque.empty());
+	int item = 0;
+	EXPECT_FALSE (deque.pop(item));
+	EXPECT_FALSE (deque.steal(item));
+	for (int i = 0; i < 100; ++i)
+		deque.push(i);
+	EXPECT_EQ (deque.size(), 100);
+	EXPECT_GE (deque.capacity(), 100);
+
+	// The owner pops in LIFO order while thieves steal in FIFO order.
+	EXPECT_TRUE (deque.pop(item));
+	EXPECT_EQ (item, 99);
+	EXPECT_TRUE (deque.steal(item));
+	EXPECT_EQ (item, 0);
+	EXPECT_EQ (deque.size(), 98);
+}
+
+TEST (WorkStealingDequeTests /*test suite name*/, ConcurrentSteal /*test name*/) {
+	constexpr int count = 100000;
+	custom::WorkStealingDeque<int> deque;
+	std::vector<std::atomic<int>> seen(count);
+	std::atomic<bool> done{false};
+	std::vector<std::thread> thieves;
+	for (int t = 0; t < 3; ++t) {
+		thieves.emplace_back([&] {
+			int item = 0;
+			while (!done.load() || !deque.empty()) {
+				if (deque.steal(item))
+					seen[item].fetch_add(1);
+			}
+		});
+	}
+	int item = 0;
+	for (int i = 0; i < count; ++i) {
+		deque.push(i);
+		if (i % 3 == 0 && deque.pop(item))
+			seen[item].fetch_add(1);
+	}
+	while (deque.pop(item))
+		seen[item].fetch_add(1);
+	done.store(true);
+	for (auto& thief: thieves)
+		thief.join();
+	// Every element must be taken exactly once.
+	for (int i = 0; i < count; ++i)
+		EXPECT_EQ (seen[i].load(), 1);
+}
+
+TEST (ThreadPoolTests /*test suite name*/, SpawnAndSync /*test name*/) {
+	custom::ThreadPool pool(4);
+	EXPECT_EQ (pool.size(), 4);
+	EXPECT_EQ (pool.worker_index(), pool.size());
+	std::atomic<int> counter{0};
+	custom::WaitGroup group;
+	for (int i = 0; i < 1000; ++i)
+		pool.spawn(group, [&counter] { counter.fetch_add(1); });
+	pool.sync(group);
+	EXPECT_EQ (counter.load(), 1000);
+	EXPECT_EQ (group.pending(), 0);
+
+	// Detached tasks are joined by wait_idle()
+	for (int i = 0; i < 1000; ++i)
+		pool.spawn([&counter] { counter.fetch_add(1); });
+	pool.wait_idle();
+	EXPECT_EQ (counter.load(), 2000);
+}
+
+TEST (ThreadPoolTests /*test suite name*/, NestedForkJoin /*test name*/) {
+	custom::ThreadPool pool(3, custom::Affinity::Compact);
+	std::uint64_t result = 0;
+	custom::WaitGroup group;
+	pool.spawn(group, [&] { result = parallel_fib(pool, 20); });
+	pool.sync(group);
+	EXPECT_EQ (result, 6765);
+}
+
+TEST (ThreadPoolTests /*test suite name*/, ParallelFor /*test name*/) {
+	custom::ThreadPool pool(4);
+	std::vector<int> data(10000, 0);
+	pool.parallel_for(0, data.size(), 64, [&data](size_t i) { data[i] = static_cast<int>(i); });
+	for (size_t i = 0; i < data.size(); ++i)
+		EXPECT_EQ (data[i], i);
+
+	std::atomic<std::uint64_t> total{0};
+	std::atomic<size_t> max_chunk{0};
+	pool.parallel_for(0, data.size(), 100, [&](size_t first, size_t last) {
+		std::uint64_t sum = 0;
+		for (size_t i = first; i < last; ++i)
+			sum += data[i];
+		total.fetch_add(sum);
+		size_t chunk = last - first, current = max_chunk.load();
+		while (chunk > current && !max_chunk.compare_exchange_weak(current, chunk)) {}
+	});
+	EXPECT_EQ (total.load(), 9999ULL * 10000ULL / 2);
+	EXPECT_LE (max_chunk.load(), 100);
+
+	// Empty ranges do nothing
+	pool.parallel_for(5, 5, [](size_t) { FAIL(); });
+}
+
+TEST (ThreadPoolTests /*test suite name*/, Exceptions /*test name*/) {
+	EXPECT_THROW (custom::ThreadPool(custom::ThreadPoolOptions{2, custom::Affinity::Custom, {}}), std::invalid_argument);
+	custom::ThreadPool pool(2);
+	custom::WaitGroup group;
+	pool.spawn(group, [] { throw std::runtime_error("task failed"); });
+	pool.spawn(group, [] {});
+	EXPECT_THROW (pool.sync(group), std::runtime_error);
+	EXPECT_EQ (group.pending(), 0);
+}
@@ -0,0 +1,114 @@
+// Built as its own executable, with CUSTOM_TRACE_OPERATIONS defined for every translation unit of it
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Graph.h"
+#include "../LinkedList.h"
+#include "../Map.h"
+#include "../Queue.h"
+#include "../Vector.h"
+#include "gtest/gtest.h"
+
+namespace tracing = custom::tracing;
+
+TEST (TracingTests /*test suite name*/, Histogram /*test name*/) {
+	// Every value maps to a bucket whose range contains it, with 1/16 precision
+	for (std::uint64_t value: {0ULL, 1ULL, 31ULL, 32ULL, 33ULL, 1000ULL, 123456789ULL, ~0ULL}) {
+		size_t index = tracing::Histogram::bucket_index(value);
+		EXPECT_LT (index, tracing::Histogram::buckets);
+		EXPECT_LE (tracing::Histogram::bucket_value(index), value);
+		EXPECT_LE (value - tracing::Histogram::bucket_value(index), value / 16);
+	}
+
+	tracing::Histogram histogram;
+	for (std::uint64_t value = 1; value <= 1000; ++value)
+		histogram.record(value);
+	EXPECT_EQ (histogram.count(), 1000);
+	EXPECT_EQ (histogram.min(), 1);
+	EXPECT_EQ (histogram.max(), 1000);
+	EXPECT_DOUBLE_EQ (histogram.mean(), 500.5);
+	EXPECT_NEAR (static_cast<double>(histogram.value_at_percentile(50)), 500, 500 / 16.0);
+	EXPECT_NEAR (static_cast<double>(histogram.value_at_percentile(99)), 990, 990 / 16.0);
+	EXPECT_EQ (histogram.value_at_percentile(100), 1000);
+
+	tracing::Histogram other;
+	other.record(5000, 10);
+	histogram.merge(other);
+	EXPECT_EQ (histogram.count(), 1010);
+	EXPECT_EQ (histogram.max(), 5000);
+}
+
+TEST (TracingTests /*test suite name*/, Operations /*test name*/) {
+	static_assert(tracing::enabled);
+	tracing::set_sample_rate(1);
+	tracing::reset();
+	custom::Vector<int> vector;
+	for (int i = 0; i < 100; ++i)
+		vector.push_back(i);
+	vector.pop_back();
+	custom::Map<int, int> map(16);
+	for (int i = 0; i < 10; ++i)
+		map.add(i, i);
+	EXPECT_TRUE (map.exists(3));
+	static_cast<void>(map.contents());
+
+	tracing::Snapshot snapshot = tracing::snapshot();
+	EXPECT_EQ (snapshot[tracing::Operation::Insert].count(), 110);
+	EXPECT_EQ (snapshot[tracing::Operation::Erase].count(), 1);
+	EXPECT_GT (snapshot[tracing::Operation::Grow].count(), 0);
+	// Map::add looks the key up before inserting it
+	EXPECT_EQ (snapshot[tracing::Operation::Lookup].count(), 11);
+	EXPECT_EQ (snapshot[tracing::Operation::Traversal].count(), 1);
+	EXPECT_EQ (snapshot[tracing::Operation::Rehash].count(), 0);
+	EXPECT_GE (snapshot.percentile_ns(tracing::Operation::Insert, 99),
+	           snapshot.percentile_ns(tracing::Operation::Insert, 50));
+
+	tracing::reset();
+	EXPECT_EQ (tracing::snapshot()[tracing::Operation::Insert].count(), 0);
+}
+
+TEST (TracingTests /*test suite name*/, SamplingAndThreads /*test name*/) {
+	tracing::set_sample_rate(10);
+	tracing::reset();
+	// Each thread keeps its own buffer, which is merged on read and kept after the thread exits
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([] {
+			custom::LinkedList<int> list;
+			for (int i = 0; i < 1000; ++i)
+				list.push_back(i);
+		});
+	}
+	for (std::thread& thread: threads)
+		thread.join();
+	tracing::Snapshot snapshot = tracing::snapshot();
+	EXPECT_EQ (snapshot.sample_rate, 10);
+	EXPECT_EQ (snapshot[tracing::Operation::Insert].count(), 400);
+	tracing::set_sample_rate(1);
+}
+
+TEST (TracingTests /*test suite name*/, Export /*test name*/) {
+	tracing::reset();
+	custom::Queue<int> queue = {1, 2, 3};
+	queue.dequeue();
+
+	std::uint64_t exported = 0;
+	tracing::set_exporter([&](const tracing::Snapshot& snapshot) {
+		exported = snapshot[tracing::Operation::Erase].count();
+	});
+	tracing::export_snapshot(true);
+	EXPECT_EQ (exported, 1);
+	EXPECT_EQ (tracing::snapshot()[tracing::Operation::Erase].count(), 0);
+	tracing::set_exporter({});
+
+	custom::Graph<int, int> graph(1, 1);
+	graph.add_node(2, 2);
+	std::ostringstream out;
+	tracing::report(out);
+	const std::string report = out.str();
+	EXPECT_NE (report.find("p99 (ns)"), std::string::npos);
+	EXPECT_NE (report.find("Insert"), std::string::npos);
+	EXPECT_EQ (report.find("Erase"), std::string::npos);
+}
@@ -146,4 +146,22 @@ TEST (VectorTests /*test suite name*/, IteratorTest /*test name*/) {
 	EXPECT_EQ (it3->size(), 4);
 	++it3;
 	EXPECT_EQ (it3->size(), 3);
-}
\ No newline at end of file
+}
+
+TEST (VectorTests /*test suite name*/, MemoryUsage /*test name*/) {
+	custom::Vector<int> vec;
+	EXPECT_EQ (vec.memory_usage().payload, 0);
+	EXPECT_EQ (vec.memory_usage().allocations, 0);
+	EXPECT_EQ (vec.memory_usage().structure, sizeof(vec));
+
+	for (int i = 0; i < 9; ++i)
+		vec.push_back(i);
+	custom::MemoryUsage usage = vec.memory_usage();
+	EXPECT_EQ (usage.payload, 9 * sizeof(int));
+	EXPECT_EQ (usage.allocations, 1);
+	// The unused capacity is counted as structural overhead
+	EXPECT_GE (usage.structure, sizeof(vec));
+	EXPECT_GT (usage.allocator, 0);
+	EXPECT_EQ (usage.total(), usage.payload + usage.structure + usage.allocator);
+	EXPECT_LT (usage.efficiency(), 1.0);
+}